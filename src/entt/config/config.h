@@ -21,17 +21,51 @@
 #endif
 
 
+#ifndef ENTT_HASH_POLICY
+#   define ENTT_HASH_POLICY fnv1a_hash
+#endif
+
+
 #ifndef ENTT_PAGE_SIZE
 #   define ENTT_PAGE_SIZE 4096
 #endif
 
 
+#ifndef ENTT_META_SBO_SIZE
+#   define ENTT_META_SBO_SIZE sizeof(void *)
+#endif
+
+
+#ifndef ENTT_PREFETCH_DISTANCE
+#   define ENTT_PREFETCH_DISTANCE 0
+#endif
+
+
+#ifndef ENTT_PREFETCH
+#   if defined __clang__ || defined __GNUC__
+#       define ENTT_PREFETCH(address) __builtin_prefetch(address)
+#   else
+#       define ENTT_PREFETCH(address) static_cast<void>(address)
+#   endif
+#endif
+
+
 #ifndef ENTT_ASSERT
 #   include <cassert>
 #   define ENTT_ASSERT(condition) assert(condition)
 #endif
 
 
+#ifndef ENTT_TRACE
+#   define ENTT_TRACE(name, type)
+#endif
+
+
+#ifndef ENTT_ALLOC_TRACE
+#   define ENTT_ALLOC_TRACE(name, type, bytes)
+#endif
+
+
 #ifndef ENTT_NO_ETO
 #   include <type_traits>
 #   define ENTT_IS_EMPTY(Type) std::is_empty<Type>
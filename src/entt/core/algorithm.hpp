@@ -3,6 +3,7 @@
 
 
 #include <vector>
+#include <cstddef>
 #include <utility>
 #include <iterator>
 #include <algorithm>
@@ -73,6 +74,71 @@ struct insertion_sort {
 };
 
 
+/**
+ * @brief Function object for performing a parallel merge sort.
+ *
+ * The range is split in a power of two number of partitions that are sorted
+ * concurrently with `std::sort`. Partitions are then merged pairwise, with all
+ * the merges of a pass running concurrently.<br/>
+ * Tasks are run by an executor, that is, a function object that is invoked
+ * with a number of tasks and a function object and that calls the latter once
+ * for each index in the range `[0, count)`, returning only after all the
+ * tasks have completed. A thread pool is a suitable executor.
+ *
+ * Ranges too short to be split in partitions of at least `threshold` elements
+ * are sorted on the calling thread.
+ */
+struct parallel_sort {
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given binary comparison function.
+     * The comparison function object is invoked concurrently.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Executor Type of executor.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param executor A valid executor.
+     */
+    template<typename It, typename Compare, typename Executor>
+    void operator()(It first, It last, Compare compare, Executor &&executor) const {
+        const auto length = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t parts = 1u;
+
+        while(parts < partitions && !(length / (parts * 2u) < threshold)) {
+            parts *= 2u;
+        }
+
+        if(parts == 1u) {
+            std::sort(first, last, std::move(compare));
+        } else {
+            auto bound = [first, length, parts](const std::size_t pos) {
+                return first + static_cast<typename std::iterator_traits<It>::difference_type>(length * pos / parts);
+            };
+
+            executor(parts, [&bound, &compare](const std::size_t pos) {
+                std::sort(bound(pos), bound(pos + 1u), compare);
+            });
+
+            for(std::size_t step = 1u; step < parts; step *= 2u) {
+                executor(parts / (step * 2u), [&bound, &compare, step](const std::size_t pos) {
+                    const auto from = pos * step * 2u;
+                    std::inplace_merge(bound(from), bound(from + step), bound(from + step * 2u), compare);
+                });
+            }
+        }
+    }
+
+    /*! @brief Maximum number of partitions, rounded down to a power of two. */
+    std::size_t partitions{64u};
+    /*! @brief Minimum number of elements per partition. */
+    std::size_t threshold{4096u};
+};
+
+
 /**
  * @brief Function object for performing LSD radix sort.
  * @tparam Bit Number of bits processed per pass.
@@ -2,8 +2,10 @@
 #define ENTT_CORE_HASHED_STRING_HPP
 
 
+#include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include "../config/config.h"
 #include "fwd.hpp"
 
@@ -49,6 +51,114 @@ struct fnv1a_traits<std::uint64_t> {
  */
 
 
+/*! @brief Fowler–Noll–Vo hash function, one character at a time. */
+struct fnv1a_hash {
+    /**
+     * @brief Returns the hash of a string.
+     * @tparam Char Character type.
+     * @param str Human-readable identifer.
+     * @param size Length of the string to hash.
+     * @return The hash of the string.
+     */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type value(const Char *str, std::size_t size) ENTT_NOEXCEPT {
+        using traits_type = internal::fnv1a_traits<id_type>;
+        id_type partial{traits_type::offset};
+        while(size--) { partial = (partial^(str++)[0])*traits_type::prime; }
+        return partial;
+    }
+
+    /**
+     * @brief Returns the hash of a null terminated string.
+     * @tparam Char Character type.
+     * @param str Human-readable identifer.
+     * @return The hash of the string.
+     */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type value(const Char *str) ENTT_NOEXCEPT {
+        using traits_type = internal::fnv1a_traits<id_type>;
+        auto partial = traits_type::offset;
+
+        // Fowler–Noll–Vo hash function v. 1a - the good
+        while(*str != 0) {
+            partial = (partial ^ static_cast<traits_type::type>(*(str++))) * traits_type::prime;
+        }
+
+        return partial;
+    }
+};
+
+
+/**
+ * @brief Multiplicative hash function, one machine word at a time.
+ *
+ * Characters are packed in 64 bits words in an endianness independent manner
+ * and words are mixed as in MurmurHash64A. Long strings are hashed several
+ * times faster than with the default hash function.<br/>
+ * The function is still usable in constant expressions, so that literals and
+ * strings hashed at runtime are in agreement.
+ */
+struct word_hash {
+    /**
+     * @brief Returns the hash of a string.
+     * @tparam Char Character type.
+     * @param str Human-readable identifer.
+     * @param size Length of the string to hash.
+     * @return The hash of the string.
+     */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type value(const Char *str, std::size_t size) ENTT_NOEXCEPT {
+        constexpr std::uint64_t mul = 0xc6a4a7935bd1e995ull;
+        constexpr std::size_t shift = 47u;
+        constexpr auto length = sizeof(std::uint64_t) / sizeof(Char);
+
+        auto read = [](const Char *curr, const std::size_t count) {
+            std::uint64_t word{};
+
+            for(std::size_t pos{}; pos < count; ++pos) {
+                word |= std::uint64_t{static_cast<std::make_unsigned_t<Char>>(curr[pos])} << (pos * sizeof(Char) * CHAR_BIT);
+            }
+
+            return word;
+        };
+
+        std::uint64_t partial = 0x9e3779b97f4a7c15ull ^ (std::uint64_t{size} * mul);
+
+        for(; !(size < length); size -= length, str += length) {
+            auto word = read(str, length) * mul;
+            word = (word ^ (word >> shift)) * mul;
+            partial = (partial ^ word) * mul;
+        }
+
+        if(size) {
+            partial = (partial ^ read(str, size)) * mul;
+        }
+
+        partial = (partial ^ (partial >> shift)) * mul;
+        partial ^= partial >> shift;
+
+        if constexpr(sizeof(id_type) < sizeof(std::uint64_t)) {
+            return static_cast<id_type>(partial ^ (partial >> (sizeof(id_type) * CHAR_BIT)));
+        } else {
+            return static_cast<id_type>(partial);
+        }
+    }
+
+    /**
+     * @brief Returns the hash of a null terminated string.
+     * @tparam Char Character type.
+     * @param str Human-readable identifer.
+     * @return The hash of the string.
+     */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type value(const Char *str) ENTT_NOEXCEPT {
+        std::size_t size{};
+        while(str[size] != 0) { ++size; }
+        return value(str, size);
+    }
+};
+
+
 /**
  * @brief Zero overhead unique identifier.
  *
@@ -58,27 +168,23 @@ struct fnv1a_traits<std::uint64_t> {
  * Because of that, a hashed string can also be used in constant expressions if
  * required.
  *
+ * The hash function is FNV-1a unless otherwise specified by means of the
+ * `ENTT_HASH_POLICY` definition. All the hashed strings of a program should
+ * use the same function, so that identifiers are the same everywhere.
+ *
  * @tparam Char Character type.
+ * @tparam Hash Type of hash function, either `fnv1a_hash` or `word_hash`.
  */
-template<typename Char>
+template<typename Char, typename Hash = ENTT_HASH_POLICY>
 class basic_hashed_string {
-    using traits_type = internal::fnv1a_traits<id_type>;
-
     struct const_wrapper {
         // non-explicit constructor on purpose
         constexpr const_wrapper(const Char *curr) ENTT_NOEXCEPT: str{curr} {}
         const Char *str;
     };
 
-    // Fowler–Noll–Vo hash function v. 1a - the good
     [[nodiscard]] static constexpr id_type helper(const Char *curr) ENTT_NOEXCEPT {
-        auto value = traits_type::offset;
-
-        while(*curr != 0) {
-            value = (value ^ static_cast<traits_type::type>(*(curr++))) * traits_type::prime;
-        }
-
-        return value;
+        return Hash::value(curr);
     }
 
 public:
@@ -94,9 +200,7 @@ public:
      * @return The numeric representation of the string.
      */
     [[nodiscard]] static constexpr hash_type value(const value_type *str, std::size_t size) ENTT_NOEXCEPT {
-        id_type partial{traits_type::offset};
-        while(size--) { partial = (partial^(str++)[0])*traits_type::prime; }
-        return partial;
+        return Hash::value(str, size);
     }
 
     /**
@@ -219,12 +323,13 @@ basic_hashed_string(const Char (&str)[N]) ENTT_NOEXCEPT
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Hash Type of hash function.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the two hashed strings are identical, false otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator!=(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) ENTT_NOEXCEPT {
+template<typename Char, typename Hash>
+[[nodiscard]] constexpr bool operator!=(const basic_hashed_string<Char, Hash> &lhs, const basic_hashed_string<Char, Hash> &rhs) ENTT_NOEXCEPT {
     return !(lhs == rhs);
 }
 
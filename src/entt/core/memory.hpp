@@ -0,0 +1,423 @@
+#ifndef ENTT_CORE_MEMORY_HPP
+#define ENTT_CORE_MEMORY_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "type_info.hpp"
+
+#if defined __linux__
+#   include <sys/mman.h>
+#endif
+
+
+namespace entt {
+
+
+/**
+ * @brief Allocator that returns memory aligned to a given boundary.
+ *
+ * Useful to align the arrays of the sparse sets and of the storage classes to
+ * the cache lines or to the width of the SIMD registers. The alignment is never
+ * smaller than the natural alignment of the type of elements.
+ *
+ * @tparam Type Type of elements to allocate.
+ * @tparam Alignment Desired alignment, that must be a power of two.
+ */
+template<typename Type, std::size_t Alignment = alignof(Type)>
+class aligned_allocator {
+    static_assert(Alignment && !(Alignment & (Alignment - 1u)), "Alignment must be a power of two");
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Allocations are always fulfilled by the global operators. */
+    using is_always_equal = std::true_type;
+
+    /*! @brief Actual alignment of the memory returned by the allocator. */
+    static constexpr std::size_t alignment = (std::max)(Alignment, alignof(Type));
+
+    /**
+     * @brief Rebinds an allocator to another type of elements.
+     * @tparam Other Type of elements to allocate.
+     */
+    template<typename Other>
+    struct rebind {
+        /*! @brief Type of the rebound allocator. */
+        using other = aligned_allocator<Other, Alignment>;
+    };
+
+    /*! @brief Default constructor. */
+    constexpr aligned_allocator() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     */
+    template<typename Other>
+    constexpr aligned_allocator(const aligned_allocator<Other, Alignment> &) ENTT_NOEXCEPT {}
+
+    /**
+     * @brief Allocates uninitialized storage for a given number of elements.
+     * @param count Number of elements to allocate.
+     * @return A pointer to the first element of the storage.
+     */
+    [[nodiscard]] Type * allocate(const std::size_t count) {
+        return static_cast<Type *>(::operator new(count * sizeof(Type), std::align_val_t{alignment}));
+    }
+
+    /**
+     * @brief Releases storage obtained from the allocator.
+     * @param ptr A pointer returned by `allocate`.
+     */
+    void deallocate(Type *ptr, const std::size_t) ENTT_NOEXCEPT {
+        ::operator delete(ptr, std::align_val_t{alignment});
+    }
+};
+
+
+/**
+ * @brief Compares two aligned allocators.
+ * @return True in all cases.
+ */
+template<typename Type, typename Other, std::size_t Alignment>
+[[nodiscard]] constexpr bool operator==(const aligned_allocator<Type, Alignment> &, const aligned_allocator<Other, Alignment> &) ENTT_NOEXCEPT {
+    return true;
+}
+
+
+/**
+ * @brief Compares two aligned allocators.
+ * @return False in all cases.
+ */
+template<typename Type, typename Other, std::size_t Alignment>
+[[nodiscard]] constexpr bool operator!=(const aligned_allocator<Type, Alignment> &, const aligned_allocator<Other, Alignment> &) ENTT_NOEXCEPT {
+    return false;
+}
+
+
+/**
+ * @brief Allocator that backs large arrays with huge pages.
+ *
+ * Allocations of at least `huge_page_size` bytes are rounded up to a multiple
+ * of it and aligned to its boundary. On Linux, they are also advised for
+ * transparent huge pages. This reduces the misses of the TLB when large pools
+ * are accessed randomly. Smaller allocations are aligned to the cache lines.
+ *
+ * @note
+ * Whether huge pages are actually used depends on the operating system and on
+ * its configuration.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+class huge_page_allocator {
+    [[nodiscard]] static constexpr bool is_huge(const std::size_t bytes) ENTT_NOEXCEPT {
+        return !(bytes < huge_page_size);
+    }
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Allocations are always fulfilled by the global operators. */
+    using is_always_equal = std::true_type;
+
+    /*! @brief Size of the huge pages. */
+    static constexpr std::size_t huge_page_size = std::size_t{1u} << 21u;
+    /*! @brief Alignment of the allocations smaller than a huge page. */
+    static constexpr std::size_t alignment = (std::max)(std::size_t{64u}, alignof(Type));
+
+    /*! @brief Default constructor. */
+    constexpr huge_page_allocator() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     */
+    template<typename Other>
+    constexpr huge_page_allocator(const huge_page_allocator<Other> &) ENTT_NOEXCEPT {}
+
+    /**
+     * @brief Allocates uninitialized storage for a given number of elements.
+     * @param count Number of elements to allocate.
+     * @return A pointer to the first element of the storage.
+     */
+    [[nodiscard]] Type * allocate(const std::size_t count) {
+        if(const auto bytes = count * sizeof(Type); is_huge(bytes)) {
+            const auto size = (bytes + huge_page_size - 1u) / huge_page_size * huge_page_size;
+            auto *ptr = ::operator new(size, std::align_val_t{huge_page_size});
+#if defined __linux__ && defined MADV_HUGEPAGE
+            ::madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+            return static_cast<Type *>(ptr);
+        } else {
+            return static_cast<Type *>(::operator new(bytes, std::align_val_t{alignment}));
+        }
+    }
+
+    /**
+     * @brief Releases storage obtained from the allocator.
+     * @param ptr A pointer returned by `allocate`.
+     * @param count Number of elements passed to `allocate`.
+     */
+    void deallocate(Type *ptr, const std::size_t count) ENTT_NOEXCEPT {
+        ::operator delete(ptr, std::align_val_t{is_huge(count * sizeof(Type)) ? huge_page_size : alignment});
+    }
+};
+
+
+/**
+ * @brief Compares two huge page allocators.
+ * @return True in all cases.
+ */
+template<typename Type, typename Other>
+[[nodiscard]] constexpr bool operator==(const huge_page_allocator<Type> &, const huge_page_allocator<Other> &) ENTT_NOEXCEPT {
+    return true;
+}
+
+
+/**
+ * @brief Compares two huge page allocators.
+ * @return False in all cases.
+ */
+template<typename Type, typename Other>
+[[nodiscard]] constexpr bool operator!=(const huge_page_allocator<Type> &, const huge_page_allocator<Other> &) ENTT_NOEXCEPT {
+    return false;
+}
+
+
+
+
+/**
+ * @brief Non-owning view of a contiguous sequence of elements allocated from
+ * an arena.
+ * @tparam Type Type of elements of the sequence.
+ */
+template<typename Type>
+class arena_span {
+public:
+    /*! @brief Type of elements of the sequence. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator = Type *;
+
+    /*! @brief Default constructor. */
+    constexpr arena_span() ENTT_NOEXCEPT
+        : first{},
+          count{}
+    {}
+
+    /**
+     * @brief Constructs a view of a sequence of elements.
+     * @param data A pointer to the first element of the sequence.
+     * @param size Number of elements of the sequence.
+     */
+    constexpr arena_span(Type *data, const size_type size) ENTT_NOEXCEPT
+        : first{data},
+          count{size}
+    {}
+
+    /**
+     * @brief Returns a pointer to the first element of the sequence.
+     * @return A pointer to the first element of the sequence.
+     */
+    [[nodiscard]] constexpr Type * data() const ENTT_NOEXCEPT {
+        return first;
+    }
+
+    /**
+     * @brief Returns the number of elements of the sequence.
+     * @return Number of elements of the sequence.
+     */
+    [[nodiscard]] constexpr size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether the sequence is empty.
+     * @return True if the sequence is empty, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const ENTT_NOEXCEPT {
+        return !count;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     * @return An iterator to the first element of the sequence.
+     */
+    [[nodiscard]] constexpr iterator begin() const ENTT_NOEXCEPT {
+        return first;
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator past the last element of the sequence.
+     */
+    [[nodiscard]] constexpr iterator end() const ENTT_NOEXCEPT {
+        return first + count;
+    }
+
+    /**
+     * @brief Returns the element at a given position.
+     * @param pos Position of the element to return.
+     * @return A reference to the requested element.
+     */
+    [[nodiscard]] constexpr Type & operator[](const size_type pos) const {
+        ENTT_ASSERT(pos < count);
+        return first[pos];
+    }
+
+private:
+    Type *first;
+    size_type count;
+};
+
+
+/*! @brief Non-owning view of a string allocated from an arena. */
+using arena_string = std::string_view;
+
+
+/**
+ * @brief Monotonic arena for short-lived allocations.
+ *
+ * Memory is handed out from blocks of fixed size and is never returned one
+ * allocation at a time. Instead, an arena is reset in bulk and its blocks are
+ * reused by the allocations that follow. Objects allocated from an arena must
+ * be trivially destructible, since their destructors are never invoked.
+ */
+class arena {
+    struct block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an arena with a given block size.
+     * @param size Default size of the blocks in bytes.
+     */
+    explicit arena(const size_type size = 4096u)
+        : blocks{},
+          curr{},
+          offset{},
+          block_size{size}
+    {
+        ENTT_ASSERT(block_size);
+    }
+
+    /**
+     * @brief Allocates uninitialized storage.
+     * @param size Number of bytes to allocate.
+     * @param align Alignment of the storage.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] void * allocate(const size_type size, const size_type align = alignof(std::max_align_t)) {
+        for(; curr < blocks.size(); ++curr, offset = {}) {
+            const auto base = reinterpret_cast<std::uintptr_t>(blocks[curr].data.get());
+            const auto pos = (base + offset + align - 1u) / align * align - base;
+
+            if(pos + size <= blocks[curr].size) {
+                offset = pos + size;
+                return blocks[curr].data.get() + pos;
+            }
+        }
+
+        // blocks are appended and reused in the same order after a reset
+        const auto length = (std::max)(block_size, size + align);
+        blocks.push_back(block{std::unique_ptr<std::byte[]>{new std::byte[length]}, length});
+        ENTT_ALLOC_TRACE("entt::arena::allocate", type_id<arena>().name(), length);
+        return allocate(size, align);
+    }
+
+    /**
+     * @brief Copies a range of elements into the arena.
+     * @tparam Type Type of elements to allocate.
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range.
+     * @param last An iterator past the last element of the range.
+     * @return A view of the elements allocated from the arena.
+     */
+    template<typename Type, typename It>
+    [[nodiscard]] arena_span<Type> span(It first, It last) {
+        static_assert(std::is_trivially_destructible_v<Type>, "Invalid type");
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        auto *data = static_cast<Type *>(allocate(count * sizeof(Type), alignof(Type)));
+        std::uninitialized_copy(first, last, data);
+        return arena_span<Type>{data, count};
+    }
+
+    /**
+     * @brief Allocates a sequence of value-initialized elements.
+     * @tparam Type Type of elements to allocate.
+     * @param count Number of elements to allocate.
+     * @return A view of the elements allocated from the arena.
+     */
+    template<typename Type>
+    [[nodiscard]] arena_span<Type> span(const size_type count) {
+        static_assert(std::is_trivially_destructible_v<Type>, "Invalid type");
+        auto *data = static_cast<Type *>(allocate(count * sizeof(Type), alignof(Type)));
+        std::uninitialized_value_construct(data, data + count);
+        return arena_span<Type>{data, count};
+    }
+
+    /**
+     * @brief Copies a string into the arena.
+     * @param str The string to copy.
+     * @return A view of the string allocated from the arena.
+     */
+    [[nodiscard]] arena_string string(const std::string_view str) {
+        auto *data = static_cast<char *>(allocate(str.size(), alignof(char)));
+        std::memcpy(data, str.data(), str.size());
+        return arena_string{data, str.size()};
+    }
+
+    /**
+     * @brief Makes all the memory of the arena available again.
+     *
+     * The blocks aren't released and are reused by the allocations that
+     * follow. All the views returned so far are invalidated.
+     */
+    void reset() ENTT_NOEXCEPT {
+        curr = {};
+        offset = {};
+    }
+
+    /**
+     * @brief Returns the number of bytes reserved by the arena.
+     * @return The total size of the blocks of the arena.
+     */
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        size_type sz{};
+
+        for(auto &&elem: blocks) {
+            sz += elem.size;
+        }
+
+        return sz;
+    }
+
+private:
+    std::vector<block> blocks;
+    size_type curr;
+    size_type offset;
+    size_type block_size;
+};
+
+}
+
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef ENTT_CORE_STRING_POOL_HPP
+#define ENTT_CORE_STRING_POOL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "hashed_string.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Interning table for hashed strings.
+ *
+ * A string pool maps the hashes of the strings it contains to their canonical
+ * copies. Copies are null terminated and allocated linearly in large blocks,
+ * so that interning many short strings doesn't result in many allocations.
+ * Pointers to the copies are stable for the lifetime of the pool or until it's
+ * cleared.<br/>
+ * Hashes are the same returned by a hashed string that uses the same hash
+ * function. Therefore, a pool can also be used to get back the string from
+ * which an identifier was generated, for example for debugging purposes.
+ *
+ * @warning
+ * Interning a string whose hash is already assigned to a different string
+ * results in undefined behavior. An assertion will abort the execution at
+ * runtime in debug mode. Use `collides` to test a string up front.
+ *
+ * @tparam Char Character type.
+ * @tparam Hash Type of hash function.
+ */
+template<typename Char, typename Hash = ENTT_HASH_POLICY>
+class basic_string_pool {
+    struct entry_type {
+        const Char *str;
+        std::size_t size;
+        id_type hash;
+    };
+
+    [[nodiscard]] std::size_t slot(const id_type hash) const ENTT_NOEXCEPT {
+        const auto mask = table.size() - 1u;
+        auto pos = std::size_t{hash} & mask;
+
+        while(table[pos].str && table[pos].hash != hash) {
+            pos = (pos + 1u) & mask;
+        }
+
+        return pos;
+    }
+
+    void rehash(const std::size_t cap) {
+        std::vector<entry_type> other(cap, entry_type{});
+        table.swap(other);
+
+        for(auto &&entry: other) {
+            if(entry.str) {
+                table[slot(entry.hash)] = entry;
+            }
+        }
+    }
+
+    [[nodiscard]] const Char * copy(const Char *str, const std::size_t size) {
+        if(!(size < left)) {
+            const auto length = (std::max)(block, size + 1u);
+            blocks.emplace_back(new Char[length]);
+
+            // oversized strings get blocks of their own, the current one is kept
+            if(length == block) {
+                cursor = blocks.back().get();
+                left = length;
+            } else {
+                std::copy(str, str + size, blocks.back().get());
+                blocks.back()[size] = Char{};
+                return blocks.back().get();
+            }
+        }
+
+        auto *curr = cursor;
+        std::copy(str, str + size, curr);
+        curr[size] = Char{};
+        cursor += size + 1u;
+        left -= size + 1u;
+
+        return curr;
+    }
+
+public:
+    /*! @brief Character type. */
+    using value_type = Char;
+    /*! @brief Unsigned integer type. */
+    using hash_type = id_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty pool.
+     * @param length Length of the blocks of characters, in number of
+     * characters. Longer strings are allocated separately.
+     */
+    explicit basic_string_pool(const size_type length = 65536u)
+        : blocks{},
+          table{},
+          cursor{},
+          block{length},
+          left{},
+          count{}
+    {}
+
+    /**
+     * @brief Returns the number of strings in a pool.
+     * @return Number of strings in the pool.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether a pool is empty.
+     * @return True if the pool is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !count;
+    }
+
+    /**
+     * @brief Makes room for a given number of strings.
+     * @param cap Desired number of strings.
+     */
+    void reserve(const size_type cap) {
+        // the table is kept at most half full
+        if(table.size() < cap * 2u) {
+            auto length = (std::max)(table.size(), size_type{16u});
+
+            while(length < cap * 2u) {
+                length *= 2u;
+            }
+
+            rehash(length);
+        }
+    }
+
+    /**
+     * @brief Interns a string if it isn't already in a pool.
+     * @param str Human-readable identifer.
+     * @param size Length of the string to intern.
+     * @return The hash of the string.
+     */
+    hash_type intern(const value_type *str, const size_type size) {
+        const auto hash = Hash::value(str, size);
+        reserve(count + 1u);
+
+        if(auto &&entry = table[slot(hash)]; entry.str) {
+            ENTT_ASSERT(entry.size == size && std::equal(str, str + size, entry.str));
+        } else {
+            entry = entry_type{copy(str, size), size, hash};
+            ++count;
+        }
+
+        return hash;
+    }
+
+    /**
+     * @brief Interns a null terminated string if it isn't already in a pool.
+     * @param str Human-readable identifer.
+     * @return The hash of the string.
+     */
+    hash_type intern(const value_type *str) {
+        size_type size{};
+        while(str[size] != 0) { ++size; }
+        return intern(str, size);
+    }
+
+    /**
+     * @brief Checks if a string has the same hash of a different string in a
+     * pool.
+     * @param str Human-readable identifer.
+     * @param size Length of the string to test.
+     * @return True in case of collisions, false otherwise.
+     */
+    [[nodiscard]] bool collides(const value_type *str, const size_type size) const {
+        if(table.empty()) {
+            return false;
+        }
+
+        const auto &entry = table[slot(Hash::value(str, size))];
+        return entry.str && !(entry.size == size && std::equal(str, str + size, entry.str));
+    }
+
+    /**
+     * @brief Checks if a pool contains a string with the given hash.
+     * @param hash The hash of the string to look for.
+     * @return True if there is such a string, false otherwise.
+     */
+    [[nodiscard]] bool contains(const hash_type hash) const {
+        return find(hash) != nullptr;
+    }
+
+    /**
+     * @brief Returns the canonical copy of the string with the given hash.
+     * @param hash The hash of the string to look for.
+     * @return A pointer to the null terminated copy of the string, if any, a
+     * null pointer otherwise.
+     */
+    [[nodiscard]] const value_type * find(const hash_type hash) const {
+        return table.empty() ? nullptr : table[slot(hash)].str;
+    }
+
+    /**
+     * @brief Returns the length of the string with the given hash.
+     *
+     * @warning
+     * Attempting to use a hash that doesn't belong to the pool results in
+     * undefined behavior.
+     *
+     * @param hash The hash of a string in the pool.
+     * @return The length of the string.
+     */
+    [[nodiscard]] size_type length(const hash_type hash) const {
+        ENTT_ASSERT(contains(hash));
+        return table[slot(hash)].size;
+    }
+
+    /*! @brief Removes all the strings and releases the memory. */
+    void clear() {
+        blocks.clear();
+        table.clear();
+        cursor = nullptr;
+        left = {};
+        count = {};
+    }
+
+private:
+    std::vector<std::unique_ptr<Char[]>> blocks;
+    std::vector<entry_type> table;
+    Char *cursor;
+    size_type block;
+    size_type left;
+    size_type count;
+};
+
+
+/*! @brief Aliases for common character types. */
+using string_pool = basic_string_pool<char>;
+
+
+/*! @brief Aliases for common character types. */
+using wstring_pool = basic_string_pool<wchar_t>;
+
+
+}
+
+
+#endif
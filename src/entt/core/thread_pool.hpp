@@ -0,0 +1,523 @@
+#ifndef ENTT_CORE_THREAD_POOL_HPP
+#define ENTT_CORE_THREAD_POOL_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "type_traits.hpp"
+
+
+namespace entt {
+
+
+/*! @brief Timings of a vertex of a task graph executed by a thread pool. */
+struct task_profile {
+    /*! @brief Thread on which the vertex was executed. */
+    std::thread::id thread{};
+    /*! @brief Start time, relative to the beginning of the execution. */
+    std::chrono::nanoseconds start{};
+    /*! @brief Wall time of the vertex. */
+    std::chrono::nanoseconds duration{};
+    /*! @brief Length of the longest chain of vertices that ends with this one. */
+    std::chrono::nanoseconds path{};
+};
+
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Every worker owns a queue of tasks. Workers pick tasks from the back of
+ * their own queues and steal them from the front of the queues of the other
+ * workers once they run out of work. Tasks submitted from within a worker are
+ * pushed to the queue of the worker itself, all the others are distributed
+ * among the workers in a round-robin fashion.<br/>
+ * Threads that wait for some tasks to complete don't sit idle. Instead, they
+ * run pending tasks in the meantime. Therefore, waiting from within a task is
+ * allowed and a pool without workers is still a valid pool, that is, all the
+ * tasks are executed by the waiting thread in this case.
+ *
+ * The pool also satisfies the requirements of an executor. When invoked with a
+ * number of tasks and a function object, it calls the function object once for
+ * each index in the range `[0, count)` and returns only after all the tasks
+ * have completed.
+ */
+class thread_pool {
+    using task_type = std::function<void()>;
+
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+    };
+
+    [[nodiscard]] static std::pair<const thread_pool *, std::size_t> & local() ENTT_NOEXCEPT {
+        static thread_local std::pair<const thread_pool *, std::size_t> owner{nullptr, 0u};
+        return owner;
+    }
+
+    [[nodiscard]] std::size_t current() const ENTT_NOEXCEPT {
+        const auto &owner = local();
+        return owner.first == this ? owner.second : (next.fetch_add(1u, std::memory_order_relaxed) % queues.size());
+    }
+
+    [[nodiscard]] bool pop(const std::size_t from, task_type &task) {
+        for(std::size_t offset{}, last = queues.size(); offset < last; ++offset) {
+            auto &queue = *queues[(from + offset) % last];
+            std::lock_guard lock{queue.mutex};
+
+            if(!queue.tasks.empty()) {
+                if(offset) {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                } else {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+
+                queued.fetch_sub(1u, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void work(const std::size_t index) {
+        local() = {this, index};
+        task_type task;
+
+        while(true) {
+            if(pop(index, task)) {
+                task();
+                task = nullptr;
+            } else {
+                std::unique_lock lock{mutex};
+                cv.wait(lock, [this]() { return stop || queued.load(std::memory_order_relaxed); });
+
+                if(stop && !queued.load(std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+    }
+
+    template<typename Graph, typename Args, typename Hook>
+    struct graph_context {
+        const Graph &graph;
+        std::unique_ptr<std::atomic<std::size_t>[]> parents;
+        std::atomic<std::size_t> left;
+        Args &args;
+        Hook &hook;
+        std::mutex mutex;
+        std::vector<std::size_t> main;
+    };
+
+    template<typename Node>
+    [[nodiscard]] static auto cost_of(const Node &node, choice_t<1>) -> decltype(static_cast<std::size_t>(node.cost())) {
+        return static_cast<std::size_t>(node.cost());
+    }
+
+    template<typename Node>
+    [[nodiscard]] static std::size_t cost_of(const Node &, choice_t<0>) ENTT_NOEXCEPT {
+        return 0u;
+    }
+
+    template<typename Node>
+    [[nodiscard]] static auto main_thread_of(const Node &node, choice_t<1>) -> decltype(static_cast<bool>(node.main_thread())) {
+        return static_cast<bool>(node.main_thread());
+    }
+
+    template<typename Node>
+    [[nodiscard]] static bool main_thread_of(const Node &, choice_t<0>) ENTT_NOEXCEPT {
+        return false;
+    }
+
+    template<typename Context>
+    void complete(Context &ctx, const std::size_t pos, std::vector<std::size_t> &ready) {
+        const auto &node = ctx.graph[pos];
+        ctx.hook(pos, [&node, &ctx]() { std::apply([&node](auto &&... curr) { node.callback()(node.data(), curr...); }, ctx.args); });
+
+        for(auto child: node.children()) {
+            if(ctx.parents[child].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                ready.push_back(child);
+            }
+        }
+
+        ctx.left.fetch_sub(1u, std::memory_order_release);
+    }
+
+    template<typename Context>
+    void submit_batch(Context &ctx, std::vector<std::size_t> batch) {
+        submit([this, &ctx, batch = std::move(batch)]() {
+            std::vector<std::size_t> ready{};
+
+            for(auto pos: batch) {
+                complete(ctx, pos, ready);
+            }
+
+            // the context can be gone already if nothing is left to dispatch
+            if(!ready.empty()) {
+                dispatch(ctx, ready);
+            }
+        });
+    }
+
+    template<typename Context>
+    void dispatch(Context &ctx, const std::vector<std::size_t> &ready) {
+        std::vector<std::size_t> batch{};
+        std::size_t budget{};
+
+        for(auto pos: ready) {
+            if(main_thread_of(ctx.graph[pos], choice<1>)) {
+                std::lock_guard lock{ctx.mutex};
+                ctx.main.push_back(pos);
+            } else if(const auto cost = cost_of(ctx.graph[pos], choice<1>); !cost || !(cost < coarsening)) {
+                submit_batch(ctx, {pos});
+            } else {
+                // vertices cheaper than the grain are merged as long as they fit it together
+                if(budget + cost > coarsening) {
+                    submit_batch(ctx, std::move(batch));
+                    batch.clear();
+                    budget = {};
+                }
+
+                batch.push_back(pos);
+                budget += cost;
+            }
+        }
+
+        if(!batch.empty()) {
+            submit_batch(ctx, std::move(batch));
+        }
+    }
+
+    template<typename Graph, typename Hook, typename... Args>
+    void execute(const Graph &graph, Hook &hook, Args &... args) {
+        const auto count = graph.size();
+        std::tuple<Args &...> refs{args...};
+        graph_context<Graph, std::tuple<Args &...>, Hook> ctx{graph, std::unique_ptr<std::atomic<std::size_t>[]>{new std::atomic<std::size_t>[count]}, {count}, refs, hook, {}, {}};
+        std::vector<std::size_t> ready{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ctx.parents[pos].store(0u, std::memory_order_relaxed);
+        }
+
+        for(auto &&node: graph) {
+            node.prepare(args...);
+
+            for(auto child: node.children()) {
+                ctx.parents[child].fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            if(graph[pos].top_level()) {
+                ready.push_back(pos);
+            }
+        }
+
+        dispatch(ctx, ready);
+
+        while(ctx.left.load(std::memory_order_acquire)) {
+            std::size_t pos = count;
+
+            {
+                std::lock_guard lock{ctx.mutex};
+
+                if(!ctx.main.empty()) {
+                    pos = ctx.main.back();
+                    ctx.main.pop_back();
+                }
+            }
+
+            if(pos != count) {
+                // vertices bound to the main thread are run only by the thread that executes the graph
+                ready.clear();
+                complete(ctx, pos, ready);
+                dispatch(ctx, ready);
+            } else if(!try_run()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a pool with the given number of workers.
+     * @param count Number of workers to spawn.
+     */
+    explicit thread_pool(const size_type count = (std::max)(std::thread::hardware_concurrency(), 1u))
+        : queues(count + 1u)
+    {
+        // the extra queue is reserved to the threads that aren't workers
+        for(auto &&queue: queues) {
+            queue = std::make_unique<worker_queue>();
+        }
+
+        workers.reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            workers.emplace_back(&thread_pool::work, this, pos);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    thread_pool(const thread_pool &) = delete;
+
+    /*! @brief Waits for all the pending tasks and joins the workers. */
+    ~thread_pool() {
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+
+        cv.notify_all();
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+
+        // tasks can still be there if the pool has no workers
+        wait();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This thread pool.
+     */
+    thread_pool & operator=(const thread_pool &) = delete;
+
+    /**
+     * @brief Returns the number of workers.
+     * @return Number of workers.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return workers.size();
+    }
+
+    /**
+     * @brief Sets the grain used to merge cheap vertices of task graphs.
+     *
+     * Vertices that offer a `cost` member function are dispatched together
+     * when they become ready at the same time and their costs are less than
+     * the grain, as long as the sum of their costs fits it. Vertices without a
+     * cost or with a null cost are always dispatched on their own.<br/>
+     * The grain is measured in the same unit as the costs. It's null by
+     * default, that is, vertices are never merged.
+     *
+     * @param value The grain to use to merge cheap vertices.
+     */
+    void grain(const size_type value) ENTT_NOEXCEPT {
+        coarsening = value;
+    }
+
+    /**
+     * @brief Returns the grain used to merge cheap vertices of task graphs.
+     * @return The grain used to merge cheap vertices of task graphs.
+     */
+    [[nodiscard]] size_type grain() const ENTT_NOEXCEPT {
+        return coarsening;
+    }
+
+    /**
+     * @brief Submits a task for asynchronous execution.
+     * @tparam Func Type of function object to execute.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void submit(Func func) {
+        auto &queue = *queues[current()];
+
+        pending.fetch_add(1u, std::memory_order_relaxed);
+
+        {
+            std::lock_guard lock{queue.mutex};
+            queue.tasks.emplace_back([this, func = std::move(func)]() mutable {
+                func();
+                pending.fetch_sub(1u, std::memory_order_release);
+            });
+        }
+
+        {
+            std::lock_guard lock{mutex};
+            queued.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        cv.notify_one();
+    }
+
+    /**
+     * @brief Runs a pending task on the calling thread, if any.
+     * @return True if a task has been executed, false otherwise.
+     */
+    bool try_run() {
+        task_type task;
+        const auto &owner = local();
+
+        if(pop(owner.first == this ? owner.second : (queues.size() - 1u), task)) {
+            task();
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Waits for all the submitted tasks to complete.
+     *
+     * The calling thread runs pending tasks in the meantime.
+     */
+    void wait() {
+        while(pending.load(std::memory_order_acquire)) {
+            if(!try_run()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Invokes a function object once for each index in a range.
+     *
+     * The function object is invoked with the index of the task as its sole
+     * argument. It must be such that concurrent invocations aren't a problem.
+     * The calling thread runs pending tasks until all the ones of the range
+     * have completed.
+     *
+     * @tparam Task Type of function object to invoke.
+     * @param count Number of tasks to run.
+     * @param task A valid function object.
+     */
+    template<typename Task>
+    void operator()(const size_type count, Task task) {
+        std::atomic<size_type> left{count};
+
+        for(size_type pos{}; pos < count; ++pos) {
+            submit([&task, &left, pos]() {
+                task(pos);
+                left.fetch_sub(1u, std::memory_order_release);
+            });
+        }
+
+        while(left.load(std::memory_order_acquire)) {
+            if(!try_run()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Executes a task graph, such as the one returned by an organizer.
+     *
+     * Top level vertices are dispatched immediately. Any other vertex is
+     * dispatched as soon as all its parents have completed. The function
+     * returns after all the vertices of the graph have been executed.<br/>
+     * Vertices are also prepared sequentially with the given arguments before
+     * dispatching any of them, since setting up resources isn't necessarily
+     * thread safe.<br/>
+     * Cheap vertices are merged in coarser tasks according to the grain of the
+     * pool. Vertices that offer a `main_thread` member function that returns
+     * true are always executed by the calling thread.
+     *
+     * @sa grain
+     *
+     * @tparam Graph Type of task graph to execute.
+     * @tparam Args Types of arguments to use to invoke the vertices.
+     * @param graph A task graph in the form of an adjacency list.
+     * @param args Parameters to use to invoke the vertices.
+     */
+    template<typename Graph, typename... Args>
+    void run(const Graph &graph, Args &&... args) {
+        auto hook = [](const size_type, auto invoke) { invoke(); };
+        execute(graph, hook, args...);
+    }
+
+    /**
+     * @brief Executes a task graph and measures its vertices.
+     *
+     * Vertices are executed as described for `run`. Moreover, the execution of
+     * each of them is timed and the results are reported to the given function
+     * object once all the vertices have completed. Its signature should be
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const task_profile *profiles, const std::size_t count);
+     * @endcode
+     *
+     * Profiles are indexed by vertex. The longest path among all the vertices
+     * is the critical path of the graph for this execution, that is, the
+     * lower bound on its duration regardless of the number of workers.
+     *
+     * @sa run
+     *
+     * @tparam Graph Type of task graph to execute.
+     * @tparam Func Type of function object to invoke with the results.
+     * @tparam Args Types of arguments to use to invoke the vertices.
+     * @param graph A task graph in the form of an adjacency list.
+     * @param func A valid function object.
+     * @param args Parameters to use to invoke the vertices.
+     */
+    template<typename Graph, typename Func, typename... Args>
+    void profile(const Graph &graph, Func func, Args &&... args) {
+        using rep_type = std::chrono::nanoseconds::rep;
+        const auto count = graph.size();
+        std::vector<task_profile> profiles(count);
+        std::unique_ptr<std::atomic<rep_type>[]> longest{new std::atomic<rep_type>[count]};
+        const auto origin = std::chrono::steady_clock::now();
+
+        for(size_type pos{}; pos < count; ++pos) {
+            longest[pos].store(0, std::memory_order_relaxed);
+        }
+
+        auto hook = [&graph, &profiles, &longest, origin](const size_type pos, auto invoke) {
+            const auto first = std::chrono::steady_clock::now();
+            invoke();
+            const auto last = std::chrono::steady_clock::now();
+
+            auto &&elem = profiles[pos];
+            elem.thread = std::this_thread::get_id();
+            elem.start = std::chrono::duration_cast<std::chrono::nanoseconds>(first - origin);
+            elem.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(last - first);
+            elem.path = elem.duration + std::chrono::nanoseconds{longest[pos].load(std::memory_order_acquire)};
+
+            // children are dispatched after this, once all their parents have published their paths
+            for(auto child: graph[pos].children()) {
+                auto curr = longest[child].load(std::memory_order_relaxed);
+                while(curr < elem.path.count() && !longest[child].compare_exchange_weak(curr, elem.path.count(), std::memory_order_acq_rel)) {}
+            }
+        };
+
+        execute(graph, hook, args...);
+        func(std::as_const(profiles).data(), count);
+    }
+
+private:
+    std::vector<std::unique_ptr<worker_queue>> queues;
+    std::vector<std::thread> workers;
+    mutable std::atomic<size_type> next{};
+    std::atomic<size_type> pending{};
+    std::atomic<size_type> queued{};
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_type coarsening{};
+    bool stop{};
+};
+
+
+}
+
+
+#endif
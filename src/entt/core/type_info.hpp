@@ -2,8 +2,12 @@
 #define ENTT_CORE_TYPE_INFO_HPP
 
 
+#include <algorithm>
+#include <cstddef>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/attribute.h"
 #include "hashed_string.hpp"
@@ -13,6 +17,138 @@
 namespace entt {
 
 
+/**
+ * @brief Dense table of sequential identifiers shared across boundaries.
+ *
+ * A table assigns sequential identifiers to types by hash. Once bound, it's
+ * the source of all the sequential identifiers of the current module. Binding
+ * the same table from the main application and from the plugins it loads makes
+ * `type_seq` return the same identifier for the same type everywhere, with no
+ * need to specialize it. Identifiers are still cached by each module the first
+ * time they are requested, then accessing them costs as much as in a single
+ * binary.<br/>
+ * Types are registered upfront by the main application, then the table is
+ * frozen before it's shared with other modules or threads. A frozen table is
+ * never modified again and can be read concurrently by all modules.
+ *
+ * @warning
+ * A table must be bound before sequential identifiers are requested for the
+ * first time and it must outlive all the modules that refer to it.<br/>
+ * Requesting sequential identifiers while a table is bound and not yet frozen
+ * results in undefined behavior. Types not registered before the table is
+ * frozen are given identifiers that aren't shared with other modules.<br/>
+ * An assertion will abort the execution at runtime in debug mode in both
+ * cases.
+ */
+class type_table final {
+    [[nodiscard]] auto lower_bound(const id_type hash) const ENTT_NOEXCEPT {
+        return std::lower_bound(entries.cbegin(), entries.cend(), hash, [](const auto &elem, const auto value) { return elem.first < value; });
+    }
+
+public:
+    /**
+     * @brief Binds the sequential identifiers to a given table, if any.
+     * @param other A table to which to bind or a null pointer to detach.
+     */
+    static inline void bind(type_table *other) ENTT_NOEXCEPT;
+
+    /**
+     * @brief Returns the sequential identifier of a type given its hash and
+     * registers the type if required.
+     *
+     * @warning
+     * Registering types isn't thread safe. Attempting to register a type with
+     * a frozen table results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the table is frozen.
+     *
+     * @param hash Type hash.
+     * @return The sequential identifier of the type.
+     */
+    [[nodiscard]] id_type value(const id_type hash) {
+        if(auto it = lower_bound(hash); it != entries.cend() && it->first == hash) {
+            return it->second;
+        }
+
+        ENTT_ASSERT(!sealed);
+        const auto seq = next();
+        entries.insert(lower_bound(hash), { hash, seq });
+        return seq;
+    }
+
+    /**
+     * @brief Returns the sequential identifier of a registered type given its
+     * hash.
+     *
+     * Unlike `value`, this function never registers types nor allocates. Types
+     * that aren't registered are given a new identifier every time.
+     *
+     * @param hash Type hash.
+     * @return The sequential identifier of the type if it's registered, a new
+     * identifier otherwise.
+     */
+    [[nodiscard]] id_type find(const id_type hash) ENTT_NOEXCEPT {
+        const auto it = lower_bound(hash);
+        return (it != entries.cend() && it->first == hash) ? it->second : next();
+    }
+
+    /**
+     * @brief Checks if a type is registered with the table.
+     * @param hash Type hash.
+     * @return True if the type is registered, false otherwise.
+     */
+    [[nodiscard]] bool contains(const id_type hash) const ENTT_NOEXCEPT {
+        const auto it = lower_bound(hash);
+        return it != entries.cend() && it->first == hash;
+    }
+
+    /**
+     * @brief Returns a sequential identifier that doesn't refer to any type.
+     *
+     * This is mainly meant for types that don't exist at compile-time, such as
+     * those defined by scripts.
+     *
+     * @return A new sequential identifier.
+     */
+    [[nodiscard]] id_type next() ENTT_NOEXCEPT {
+        return count++;
+    }
+
+    /**
+     * @brief Registers the given types and assigns their identifiers.
+     * @tparam Type Types to register.
+     */
+    template<typename... Type>
+    void emplace();
+
+    /*! @brief Prevents new types from being registered. */
+    void freeze() ENTT_NOEXCEPT {
+        sealed = true;
+    }
+
+    /**
+     * @brief Checks whether a table is frozen.
+     * @return True if the table is frozen, false otherwise.
+     */
+    [[nodiscard]] bool frozen() const ENTT_NOEXCEPT {
+        return sealed;
+    }
+
+    /**
+     * @brief Returns the number of types registered so far.
+     * @return Number of types registered so far.
+     */
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return entries.size();
+    }
+
+private:
+    std::vector<std::pair<id_type, id_type>> entries{};
+    ENTT_MAYBE_ATOMIC(id_type) count{};
+    bool sealed{};
+};
+
+
 /**
  * @cond TURN_OFF_DOXYGEN
  * Internal details not to be documented.
@@ -23,10 +159,29 @@ namespace internal {
 
 
 struct ENTT_API type_seq final {
+    [[nodiscard]] static type_table * & table() ENTT_NOEXCEPT {
+        static type_table *ref{};
+        return ref;
+    }
+
     [[nodiscard]] static id_type next() ENTT_NOEXCEPT {
+        if(auto *ref = table(); ref) {
+            return ref->next();
+        }
+
         static ENTT_MAYBE_ATOMIC(id_type) value{};
         return value++;
     }
+
+    [[nodiscard]] static id_type value([[maybe_unused]] const id_type hash) ENTT_NOEXCEPT {
+        if(auto *ref = table(); ref) {
+            // bound tables are shared and therefore read-only, types are registered upfront
+            ENTT_ASSERT(ref->frozen() && ref->contains(hash));
+            return ref->find(hash);
+        }
+
+        return next();
+    }
 };
 
 
@@ -83,6 +238,15 @@ template<typename Type>
  */
 
 
+void type_table::bind(type_table *other) ENTT_NOEXCEPT {
+    internal::type_seq::table() = other;
+}
+
+
+template<typename, typename = void>
+struct type_hash;
+
+
 /**
  * @brief Type sequential identifier.
  * @tparam Type Type for which to generate a sequential identifier.
@@ -94,7 +258,12 @@ struct ENTT_API type_seq final {
      * @return The sequential identifier of a given type.
      */
     [[nodiscard]] static id_type value() ENTT_NOEXCEPT {
+#if defined ENTT_PRETTY_FUNCTION
+        static const id_type value = internal::type_seq::value(type_hash<Type>::value());
+#else
+        // hashes are sequential identifiers in this case, tables can't be used
         static const id_type value = internal::type_seq::next();
+#endif
         return value;
     }
 };
@@ -104,7 +273,7 @@ struct ENTT_API type_seq final {
  * @brief Type hash.
  * @tparam Type Type for which to generate a hash value.
  */
-template<typename Type, typename = void>
+template<typename Type, typename>
 struct type_hash final {
     /**
      * @brief Returns the numeric representation of a given type.
@@ -139,21 +308,28 @@ struct type_name final {
 
 /*! @brief Implementation specific information about a type. */
 class type_info final {
-    template<typename>
-    friend type_info type_id() ENTT_NOEXCEPT;
+public:
+    /*! @brief Default constructor. */
+    type_info() ENTT_NOEXCEPT
+        : type_info({}, {}, {})
+    {}
 
+    /**
+     * @brief Constructs a type info object from its parts.
+     *
+     * This is mainly meant for types that don't exist at compile-time, such as
+     * those defined by scripts or plugins.
+     *
+     * @param seq_v Type sequential identifier.
+     * @param hash_v Type hash.
+     * @param name_v Type name, that must outlive the object.
+     */
     type_info(id_type seq_v, id_type hash_v, std::string_view name_v) ENTT_NOEXCEPT
         : seq_value{seq_v},
           hash_value{hash_v},
           name_value{name_v}
     {}
 
-public:
-    /*! @brief Default constructor. */
-    type_info() ENTT_NOEXCEPT
-        : type_info({}, {}, {})
-    {}
-
     /*! @brief Default copy constructor. */
     type_info(const type_info &) ENTT_NOEXCEPT = default;
     /*! @brief Default move constructor. */
@@ -230,6 +406,12 @@ private:
 }
 
 
+template<typename... Type>
+void type_table::emplace() {
+    (static_cast<void>(value(type_hash<Type>::value())), ...);
+}
+
+
 /**
  * @brief Returns the type info object for a given type.
  * @tparam Type Type for which to generate a type info object.
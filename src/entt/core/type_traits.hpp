@@ -322,6 +322,30 @@ template<typename Type>
 inline constexpr auto is_empty_v = is_empty<Type>::value;
 
 
+/**
+ * @brief Provides the member constant `value` to true if objects of a given
+ * type can be relocated by means of a copy of their bytes, false otherwise.
+ *
+ * Trivially copyable types are trivially relocatable by default. Users can
+ * specialize this class to opt-in other types, as long as moving an object
+ * and then destroying the source is equivalent to copying its bytes.
+ *
+ * @tparam Type Potentially trivially relocatable type.
+ */
+template<typename Type, typename = void>
+struct is_trivially_relocatable
+    : std::is_trivially_copyable<Type>
+{};
+
+
+/**
+ * @brief Helper variable template.
+ * @tparam Type Potentially trivially relocatable type.
+ */
+template<typename Type>
+inline constexpr auto is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+
 /**
  * @brief Transcribes the constness of a type to another type.
  * @tparam To The type to which to transcribe the constness.
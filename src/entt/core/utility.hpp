@@ -2,6 +2,7 @@
 #define ENTT_CORE_UTILITY_HPP
 
 
+#include <cstddef>
 #include <utility>
 #include "../config/config.h"
 
@@ -99,6 +100,102 @@ private:
 };
 
 
+/**
+ * @brief Non-owning view of a contiguous sequence of objects (waiting for
+ * C++20).
+ * @tparam Type Type of objects in the sequence.
+ */
+template<typename Type>
+class span {
+public:
+    /*! @brief Type of objects in the sequence. */
+    using element_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator = Type *;
+
+    /*! @brief Default constructor. */
+    constexpr span() ENTT_NOEXCEPT
+        : ptr{},
+          count{}
+    {}
+
+    /**
+     * @brief Constructs a span from a pointer and a number of objects.
+     * @param first A pointer to the first object of the sequence.
+     * @param length Number of objects in the sequence.
+     */
+    constexpr span(Type *first, const size_type length) ENTT_NOEXCEPT
+        : ptr{first},
+          count{length}
+    {}
+
+    /**
+     * @brief Direct access to the sequence.
+     * @return A pointer to the first object of the sequence.
+     */
+    [[nodiscard]] constexpr Type * data() const ENTT_NOEXCEPT {
+        return ptr;
+    }
+
+    /**
+     * @brief Returns the number of objects in a span.
+     * @return Number of objects in the span.
+     */
+    [[nodiscard]] constexpr size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Returns the size of a span in bytes.
+     * @return Size of the span in bytes.
+     */
+    [[nodiscard]] constexpr size_type size_bytes() const ENTT_NOEXCEPT {
+        return count * sizeof(Type);
+    }
+
+    /**
+     * @brief Checks whether a span is empty.
+     * @return True if the span is empty, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const ENTT_NOEXCEPT {
+        return !count;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     * @return An iterator to the first object of the span.
+     */
+    [[nodiscard]] constexpr iterator begin() const ENTT_NOEXCEPT {
+        return ptr;
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last object of the
+     * span.
+     */
+    [[nodiscard]] constexpr iterator end() const ENTT_NOEXCEPT {
+        return ptr + count;
+    }
+
+    /**
+     * @brief Returns the object at a given position.
+     * @param pos The position of the object to return.
+     * @return The requested object.
+     */
+    [[nodiscard]] constexpr Type & operator[](const size_type pos) const {
+        ENTT_ASSERT(pos < count);
+        return ptr[pos];
+    }
+
+private:
+    Type *ptr;
+    size_type count;
+};
+
+
 }
 
 
@@ -0,0 +1,344 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Deferred command buffer for structural changes.
+ *
+ * A command buffer records the creation and destruction of entities, as well as
+ * the assignment and removal of components, so that they can be applied to a
+ * registry later on, for example when it's no longer being iterated.<br/>
+ * Components are stored per type in packed arrays. When the buffer is played
+ * back, operations are grouped by kind and type and applied in bulk through
+ * the range functions of the registry. In particular, they are played back in
+ * the following order: creation, assignment, removal and destruction.
+ * Therefore, the order in which commands are recorded is lost across kinds and
+ * types.
+ *
+ * Recording commands isn't thread safe. However, each thread can record its
+ * own buffer and all of them can be merged into a single one at the next
+ * synchronization point.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_command_buffer {
+    struct basic_command_pool {
+        virtual ~basic_command_pool() = default;
+        virtual void emplace(basic_registry<Entity> &, const Entity *) = 0;
+        virtual void remove(basic_registry<Entity> &) = 0;
+        virtual void merge(basic_command_pool &, const std::size_t) = 0;
+        [[nodiscard]] virtual std::unique_ptr<basic_command_pool> make() const = 0;
+    };
+
+    template<typename Component>
+    struct command_pool final: basic_command_pool {
+        void emplace(basic_registry<Entity> &owner, const Entity *created) override {
+            basic_sparse_set<Entity> seen{};
+            std::size_t last{};
+
+            // the last command recorded for an entity wins, the others are discarded
+            for(auto pos = entities.size(); pos; --pos) {
+                if(const auto entt = entities[pos - 1u]; owner.valid(entt) && !seen.contains(entt)) {
+                    seen.emplace(entt);
+
+                    if(owner.template has<Component>(entt)) {
+                        if constexpr(!is_empty_v<Component>) {
+                            owner.template replace<Component>(entt, std::move(instances[pos - 1u]));
+                        }
+
+                        entities[pos - 1u] = null;
+                    }
+                } else {
+                    entities[pos - 1u] = null;
+                }
+            }
+
+            for(std::size_t pos{}, end = entities.size(); pos < end; ++pos) {
+                if(entities[pos] != null) {
+                    entities[last] = entities[pos];
+
+                    if(last != pos) {
+                        instances[last] = std::move(instances[pos]);
+                    }
+
+                    ++last;
+                }
+            }
+
+            entities.resize(last);
+            instances.erase(instances.begin() + last, instances.end());
+
+            for(auto &&index: spawned) {
+                entities.push_back(created[index]);
+            }
+
+            std::move(spawned_instances.begin(), spawned_instances.end(), std::back_inserter(instances));
+
+            if constexpr(is_empty_v<Component>) {
+                owner.template insert<Component>(entities.cbegin(), entities.cend());
+            } else {
+                owner.template insert<Component>(entities.cbegin(), entities.cend(), std::make_move_iterator(instances.begin()), std::make_move_iterator(instances.end()));
+            }
+
+            entities.clear();
+            instances.clear();
+            spawned.clear();
+            spawned_instances.clear();
+        }
+
+        void remove(basic_registry<Entity> &owner) override {
+            std::sort(removed.begin(), removed.end());
+            removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+
+            removed.erase(std::remove_if(removed.begin(), removed.end(), [&owner](const auto entt) {
+                return !owner.valid(entt) || !owner.template has<Component>(entt);
+            }), removed.end());
+
+            owner.template remove<Component>(removed.cbegin(), removed.cend());
+            removed.clear();
+        }
+
+        void merge(basic_command_pool &other, const std::size_t offset) override {
+            auto &&pool = static_cast<command_pool &>(other);
+
+            entities.insert(entities.end(), pool.entities.cbegin(), pool.entities.cend());
+            std::move(pool.instances.begin(), pool.instances.end(), std::back_inserter(instances));
+            std::move(pool.spawned_instances.begin(), pool.spawned_instances.end(), std::back_inserter(spawned_instances));
+            removed.insert(removed.end(), pool.removed.cbegin(), pool.removed.cend());
+
+            for(auto &&index: pool.spawned) {
+                spawned.push_back(index + offset);
+            }
+
+            pool.entities.clear();
+            pool.instances.clear();
+            pool.spawned.clear();
+            pool.spawned_instances.clear();
+            pool.removed.clear();
+        }
+
+        [[nodiscard]] std::unique_ptr<basic_command_pool> make() const override {
+            return std::make_unique<command_pool>();
+        }
+
+        std::vector<Entity> entities{};
+        std::vector<Component> instances{};
+        std::vector<std::size_t> spawned{};
+        std::vector<Component> spawned_instances{};
+        std::vector<Entity> removed{};
+    };
+
+    template<typename Component>
+    [[nodiscard]] command_pool<Component> & assure() {
+        static_assert(std::is_same_v<Component, std::decay_t<Component>>, "Invalid component type");
+        const auto index = type_seq<Component>::value();
+
+        if(!(index < pools.size())) {
+            pools.resize(size_type(index)+1u);
+        }
+
+        if(auto &&pdata = pools[index]; !pdata) {
+            pdata.reset(new command_pool<Component>());
+        }
+
+        return static_cast<command_pool<Component> &>(*pools[index]);
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_command_buffer() = default;
+
+    /*! @brief Default move constructor. */
+    basic_command_buffer(basic_command_buffer &&) = default;
+
+    /*! @brief Default move assignment operator. @return This buffer. */
+    basic_command_buffer & operator=(basic_command_buffer &&) = default;
+
+    /**
+     * @brief Checks whether a command buffer is empty.
+     * @return True if the command buffer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !commands;
+    }
+
+    /**
+     * @brief Records the creation of an entity along with its components.
+     *
+     * The entity is created and the components are assigned to it only when
+     * the command buffer is played back.
+     *
+     * @tparam Component Types of components to assign to the entity.
+     * @param component Instances of the components to assign to the entity.
+     */
+    template<typename... Component>
+    void create(Component &&... component) {
+        ([this](auto &&instance) {
+            using component_type = std::decay_t<decltype(instance)>;
+            auto &&pool = assure<component_type>();
+            pool.spawned.push_back(created);
+            pool.spawned_instances.emplace_back(std::forward<decltype(instance)>(instance));
+        }(std::forward<Component>(component)), ...);
+
+        ++created;
+        ++commands;
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entity A valid entity identifier.
+     */
+    void destroy(const entity_type entity) {
+        destroyed.push_back(entity);
+        ++commands;
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * The component is constructed immediately and moved into the registry
+     * when the command buffer is played back. If the entity already owns a
+     * component of the same type at that time, the latter is replaced.<br/>
+     * When multiple components of the same type are recorded for an entity,
+     * only the last one is assigned to it.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void emplace(const entity_type entity, Args &&... args) {
+        auto &&pool = assure<Component>();
+
+        if constexpr(std::is_aggregate_v<Component>) {
+            pool.instances.push_back(Component{std::forward<Args>(args)...});
+        } else {
+            pool.instances.emplace_back(std::forward<Args>(args)...);
+        }
+
+        pool.entities.push_back(entity);
+        ++commands;
+    }
+
+    /**
+     * @brief Records the removal of the given components from an entity.
+     *
+     * Components that the entity doesn't own when the command buffer is played
+     * back are ignored.
+     *
+     * @tparam Component Types of components to remove.
+     * @param entity A valid entity identifier.
+     */
+    template<typename... Component>
+    void remove(const entity_type entity) {
+        (assure<Component>().removed.push_back(entity), ...);
+        ++commands;
+    }
+
+    /**
+     * @brief Moves all the commands of another buffer into this one.
+     *
+     * The other buffer is left empty.
+     *
+     * @param other The command buffer to merge into this one.
+     */
+    void merge(basic_command_buffer &other) {
+        for(size_type pos{}, last = other.pools.size(); pos < last; ++pos) {
+            if(auto &&pdata = other.pools[pos]; pdata) {
+                if(!(pos < pools.size())) {
+                    pools.resize(pos + 1u);
+                }
+
+                if(!pools[pos]) {
+                    pools[pos] = pdata->make();
+                }
+
+                pools[pos]->merge(*pdata, created);
+            }
+        }
+
+        destroyed.insert(destroyed.end(), other.destroyed.cbegin(), other.destroyed.cend());
+        created += other.created;
+        commands += other.commands;
+
+        other.destroyed.clear();
+        other.created = {};
+        other.commands = {};
+    }
+
+    /**
+     * @brief Plays back all the commands and clears the buffer.
+     *
+     * Entities are created first, then components are assigned and removed
+     * type by type. Finally, entities are destroyed. Commands that refer to
+     * entities that are no longer valid are discarded.
+     *
+     * @param owner The registry to which to apply the commands.
+     */
+    void apply(registry_type &owner) {
+        std::vector<entity_type> entities(created);
+        owner.create(entities.begin(), entities.end());
+
+        for(auto &&pdata: pools) {
+            if(pdata) {
+                pdata->emplace(owner, entities.data());
+            }
+        }
+
+        for(auto &&pdata: pools) {
+            if(pdata) {
+                pdata->remove(owner);
+            }
+        }
+
+        std::sort(destroyed.begin(), destroyed.end());
+        destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+        destroyed.erase(std::remove_if(destroyed.begin(), destroyed.end(), [&owner](const auto entt) { return !owner.valid(entt); }), destroyed.end());
+        owner.destroy(destroyed.cbegin(), destroyed.cend());
+
+        destroyed.clear();
+        created = {};
+        commands = {};
+    }
+
+private:
+    std::vector<std::unique_ptr<basic_command_pool>> pools{};
+    std::vector<entity_type> destroyed{};
+    size_type created{};
+    size_type commands{};
+};
+
+
+}
+
+
+#endif
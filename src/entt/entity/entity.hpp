@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_ENTITY_HPP
 
 
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -32,31 +33,59 @@ struct entt_traits<Type, std::enable_if_t<std::is_enum_v<Type>>>
 
 
 /**
- * @brief Entity traits for a 32 bits entity identifier.
+ * @brief Entity traits with a custom layout.
  *
- * A 32 bits entity identifier guarantees:
+ * Identifiers are split in three parts, from the least to the most significant
+ * bits:
  *
- * * 20 bits for the entity number (suitable for almost all the games).
- * * 12 bit for the version (resets in [0-4095]).
+ * * The entity number, that is used to index the internal data structures.
+ * * The version, that is updated whenever an identifier is recycled.
+ * * The remaining bits, if any, that are reserved for users' purposes.
+ *
+ * Users' bits are never touched by the library. Registries preserve them when
+ * identifiers are destroyed and recycled.
+ *
+ * @tparam Type Underlying unsigned integral type.
+ * @tparam EntityBits Number of bits reserved for the entity number.
+ * @tparam VersionBits Number of bits reserved for the version.
  */
-template<>
-struct entt_traits<std::uint32_t> {
+template<typename Type, std::size_t EntityBits, std::size_t VersionBits>
+struct basic_entt_traits {
+    static_assert(std::is_unsigned_v<Type>, "Invalid underlying type");
+    static_assert(EntityBits != 0u && VersionBits != 0u && VersionBits <= 32u && (EntityBits + VersionBits) <= sizeof(Type) * CHAR_BIT, "Invalid layout");
+
     /*! @brief Underlying entity type. */
-    using entity_type = std::uint32_t;
+    using entity_type = Type;
     /*! @brief Underlying version type. */
-    using version_type = std::uint16_t;
+    using version_type = std::conditional_t<(VersionBits <= 8u), std::uint8_t, std::conditional_t<(VersionBits <= 16u), std::uint16_t, std::uint32_t>>;
     /*! @brief Difference type. */
     using difference_type = std::int64_t;
 
     /*! @brief Mask to use to get the entity number out of an identifier. */
-    static constexpr entity_type entity_mask = 0xFFFFF;
+    static constexpr entity_type entity_mask = static_cast<entity_type>(static_cast<entity_type>(~entity_type{}) >> (sizeof(Type) * CHAR_BIT - EntityBits));
     /*! @brief Mask to use to get the version out of an identifier. */
-    static constexpr entity_type version_mask = 0xFFF;
+    static constexpr entity_type version_mask = static_cast<entity_type>(static_cast<entity_type>(~entity_type{}) >> (sizeof(Type) * CHAR_BIT - VersionBits));
     /*! @brief Extent of the entity number within an identifier. */
-    static constexpr std::size_t entity_shift = 20u;
+    static constexpr std::size_t entity_shift = EntityBits;
+    /*! @brief Mask to use to get the users' bits out of an identifier. */
+    static constexpr entity_type user_mask = static_cast<entity_type>(~((version_mask << entity_shift) | entity_mask));
+    /*! @brief Offset of the users' bits within an identifier. */
+    static constexpr std::size_t user_shift = EntityBits + VersionBits;
 };
 
 
+/**
+ * @brief Entity traits for a 32 bits entity identifier.
+ *
+ * A 32 bits entity identifier guarantees:
+ *
+ * * 20 bits for the entity number (suitable for almost all the games).
+ * * 12 bit for the version (resets in [0-4095]).
+ */
+template<>
+struct entt_traits<std::uint32_t>: basic_entt_traits<std::uint32_t, 20u, 12u> {};
+
+
 /**
  * @brief Entity traits for a 64 bits entity identifier.
  *
@@ -64,23 +93,11 @@ struct entt_traits<std::uint32_t> {
  *
  * * 32 bits for the entity number (an indecently large number).
  * * 32 bit for the version (an indecently large number).
+ *
+ * @sa basic_entt_traits
  */
 template<>
-struct entt_traits<std::uint64_t> {
-    /*! @brief Underlying entity type. */
-    using entity_type = std::uint64_t;
-    /*! @brief Underlying version type. */
-    using version_type = std::uint32_t;
-    /*! @brief Difference type. */
-    using difference_type = std::int64_t;
-
-    /*! @brief Mask to use to get the entity number out of an identifier. */
-    static constexpr entity_type entity_mask = 0xFFFFFFFF;
-    /*! @brief Mask to use to get the version out of an identifier. */
-    static constexpr entity_type version_mask = 0xFFFFFFFF;
-    /*! @brief Extent of the entity number within an identifier. */
-    static constexpr std::size_t entity_shift = 32u;
-};
+struct entt_traits<std::uint64_t>: basic_entt_traits<std::uint64_t, 32u, 32u> {};
 
 
 /**
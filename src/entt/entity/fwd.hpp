@@ -2,20 +2,43 @@
 #define ENTT_ENTITY_FWD_HPP
 
 
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include "../core/fwd.hpp"
 
 
 namespace entt {
 
 
-template<typename>
+template<typename Entity, typename = std::pmr::polymorphic_allocator<Entity>>
 class basic_sparse_set;
 
 
-template<typename, typename, typename>
+template<typename, typename, typename, typename>
 class basic_storage;
 
 
+template<typename, typename, typename>
+class basic_stable_storage;
+
+
+template<typename, typename, typename>
+class basic_paged_storage;
+
+
+template<typename, typename, auto...>
+class basic_split_storage;
+
+
+template<typename, typename>
+class basic_transient_storage;
+
+
+template<typename, typename>
+class basic_multi_storage;
+
+
 template<typename>
 class basic_registry;
 
@@ -24,14 +47,30 @@ template<typename...>
 class basic_view;
 
 
+template<typename...>
+class basic_query;
+
+
+template<typename>
+class basic_runtime_storage;
+
+
 template<typename>
 class basic_runtime_view;
 
 
+template<typename>
+class basic_meta_view;
+
+
 template<typename...>
 class basic_group;
 
 
+template<typename, typename>
+class basic_mailbox;
+
+
 template<typename>
 class basic_observer;
 
@@ -40,14 +79,42 @@ template<typename>
 class basic_organizer;
 
 
+template<typename>
+class basic_spawner;
+
+
+template<typename>
+class basic_sharded_registry;
+
+
+template<typename>
+class basic_command_buffer;
+
+
+template<typename>
+class basic_signature_index;
+
+
 template<typename, typename...>
 struct basic_handle;
 
 
+template<typename, typename...>
+class basic_cached_handle;
+
+
+template<typename>
+struct basic_relationship;
+
+
 template<typename>
 class basic_snapshot;
 
 
+template<typename>
+class basic_delta_snapshot;
+
+
 template<typename>
 class basic_snapshot_loader;
 
@@ -56,6 +123,18 @@ template<typename>
 class basic_continuous_loader;
 
 
+template<typename, typename...>
+class basic_rollback;
+
+
+template<typename>
+class basic_image;
+
+
+template<typename, std::size_t = 64u, std::size_t = 16u>
+class basic_telemetry;
+
+
 /*! @brief Default entity identifier. */
 enum class entity: id_type {};
 
@@ -72,10 +151,59 @@ template<typename... Args>
 using storage = basic_storage<entity, Args...>;
 
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using stable_storage = basic_stable_storage<entity, Args...>;
+
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using paged_storage = basic_paged_storage<entity, Args...>;
+
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Member Pointers to the data members of the type to store.
+ */
+template<typename Type, auto... Member>
+using split_storage = basic_split_storage<entity, Type, Member...>;
+
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+using transient_storage = basic_transient_storage<entity, Type>;
+
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+using multi_storage = basic_multi_storage<entity, Type>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using registry = basic_registry<entity>;
 
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Event Type of events to deliver.
+ */
+template<typename Event>
+using mailbox = basic_mailbox<entity, Event>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using observer = basic_observer<entity>;
 
@@ -84,6 +212,18 @@ using observer = basic_observer<entity>;
 using organizer = basic_organizer<entity>;
 
 
+/*! @brief Alias declaration for the most common use case. */
+using spawner = basic_spawner<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using signature_index = basic_signature_index<entity>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<entity>;
 
@@ -108,10 +248,34 @@ template<typename... Args>
 using const_handle_view = basic_handle<const entity, Args...>;
 
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using cached_handle = basic_cached_handle<entity, Args...>;
+
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using const_cached_handle = basic_cached_handle<const entity, Args...>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using relationship = basic_relationship<entity>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<entity>;
 
 
+/*! @brief Alias declaration for the most common use case. */
+using delta_snapshot = basic_delta_snapshot<entity>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot_loader = basic_snapshot_loader<entity>;
 
@@ -120,6 +284,22 @@ using snapshot_loader = basic_snapshot_loader<entity>;
 using continuous_loader = basic_continuous_loader<entity>;
 
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Component Types of components to save and restore.
+ */
+template<typename... Component>
+using rollback = basic_rollback<entity, Component...>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using image = basic_image<entity>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using telemetry = basic_telemetry<entity>;
+
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Args Other template parameters.
@@ -128,10 +308,26 @@ template<typename... Args>
 using view = basic_view<entity, Args...>;
 
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Other template parameters.
+ */
+template<typename... Args>
+using query = basic_query<entity, Args...>;
+
+
+/*! @brief Alias declaration for the most common use case. */
+using runtime_storage = basic_runtime_storage<entity>;
+
+
 /*! @brief Alias declaration for the most common use case. */
 using runtime_view = basic_runtime_view<entity>;
 
 
+/*! @brief Alias declaration for the most common use case. */
+using meta_view = basic_meta_view<entity>;
+
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Args Other template parameters.
@@ -2,11 +2,18 @@
 #define ENTT_ENTITY_GROUP_HPP
 
 
+#include <climits>
+#include <cstddef>
 #include <tuple>
 #include <utility>
 #include <type_traits>
+#include <vector>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
+#include "../signal/delegate.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "sparse_set.hpp"
@@ -17,6 +24,42 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Key>
+[[nodiscard]] constexpr auto radix_key(const Key key) ENTT_NOEXCEPT {
+    if constexpr(std::is_enum_v<Key>) {
+        return radix_key(static_cast<std::underlying_type_t<Key>>(key));
+    } else {
+        static_assert(std::is_integral_v<Key>, "Invalid key type");
+        using unsigned_type = std::make_unsigned_t<Key>;
+
+        if constexpr(std::is_signed_v<Key>) {
+            // flipping the sign bit makes negative values come first
+            return static_cast<unsigned_type>(static_cast<unsigned_type>(key) ^ (unsigned_type{1u} << (sizeof(Key) * CHAR_BIT - 1u)));
+        } else {
+            return static_cast<unsigned_type>(key);
+        }
+    }
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief Group.
  *
@@ -32,7 +75,11 @@ class basic_group;
  *
  * A non-owning group returns all entities and only the entities that have at
  * least the given components. Moreover, it's guaranteed that the entity list
- * is tightly packed in memory for fast iterations.
+ * is tightly packed in memory for fast iterations.<br/>
+ * Non-owning groups are initialized lazily. The entity list is filled the first
+ * time a group is used rather than when it's created and it's kept up-to-date
+ * only from then on. Threads that use a group for the first time at once wait
+ * for one of them to fill it.
  *
  * @b Important
  *
@@ -148,11 +195,18 @@ class basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>> final {
         const std::tuple<storage_type<Get> *...> pools;
     };
 
-    basic_group(basic_sparse_set<Entity> &ref, storage_type<Get> &... gpool) ENTT_NOEXCEPT
+    basic_group(basic_sparse_set<Entity> &ref, delegate<void()> populate, storage_type<Get> &... gpool) ENTT_NOEXCEPT
         : handler{&ref},
+          init{populate},
           pools{&gpool...}
     {}
 
+    [[nodiscard]] basic_sparse_set<Entity> & current() const {
+        // lazily initialized, the first use of the group fills it if required
+        init();
+        return *handler;
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -167,8 +221,8 @@ public:
      * @brief Returns the number of entities that have the given components.
      * @return Number of entities that have the given components.
      */
-    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
-        return handler->size();
+    [[nodiscard]] size_type size() const {
+        return current().size();
     }
 
     /**
@@ -176,21 +230,21 @@ public:
      * allocated space for.
      * @return Capacity of the group.
      */
-    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
-        return handler->capacity();
+    [[nodiscard]] size_type capacity() const {
+        return current().capacity();
     }
 
     /*! @brief Requests the removal of unused capacity. */
     void shrink_to_fit() {
-        handler->shrink_to_fit();
+        current().shrink_to_fit();
     }
 
     /**
      * @brief Checks whether a group is empty.
      * @return True if the group is empty, false otherwise.
      */
-    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
-        return handler->empty();
+    [[nodiscard]] bool empty() const {
+        return current().empty();
     }
 
     /**
@@ -201,8 +255,8 @@ public:
      *
      * @return A pointer to the array of entities.
      */
-    [[nodiscard]] const entity_type * data() const ENTT_NOEXCEPT {
-        return handler->data();
+    [[nodiscard]] const entity_type * data() const {
+        return current().data();
     }
 
     /**
@@ -213,8 +267,8 @@ public:
      *
      * @return An iterator to the first entity of the group.
      */
-    [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-        return handler->begin();
+    [[nodiscard]] iterator begin() const {
+        return current().begin();
     }
 
     /**
@@ -227,8 +281,8 @@ public:
      * @return An iterator to the entity following the last entity of the
      * group.
      */
-    [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-        return handler->end();
+    [[nodiscard]] iterator end() const {
+        return current().end();
     }
 
     /**
@@ -239,8 +293,8 @@ public:
      *
      * @return An iterator to the first entity of the reversed group.
      */
-    [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
-        return handler->rbegin();
+    [[nodiscard]] reverse_iterator rbegin() const {
+        return current().rbegin();
     }
 
     /**
@@ -254,8 +308,8 @@ public:
      * @return An iterator to the entity following the last entity of the
      * reversed group.
      */
-    [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
-        return handler->rend();
+    [[nodiscard]] reverse_iterator rend() const {
+        return current().rend();
     }
 
     /**
@@ -285,7 +339,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const {
-        const auto it = handler->find(entt);
+        const auto it = current().find(entt);
         return it != end() && *it == entt ? it : end();
     }
 
@@ -304,7 +358,7 @@ public:
      * @return True if the group contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const {
-        return handler->contains(entt);
+        return current().contains(entt);
     }
 
     /**
@@ -359,7 +413,9 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        for(const auto entt: *handler) {
+        ENTT_TRACE("entt::group::each", type_id<basic_group>().name());
+
+        for(const auto entt: current()) {
             if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
                 std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
             } else {
@@ -368,6 +424,56 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The group is split in chunks of contiguous elements and each chunk is
+     * offered to the executor as a separate task.<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying components of the iterated types during a
+     * parallel iteration results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        ENTT_ASSERT(chunk);
+        const auto length = current().size();
+
+        if(const auto count = (length + chunk - 1u) / chunk; count) {
+            executor(count, [this, &func, length, chunk](const size_type pos) {
+                const auto *entities = current().data();
+
+                for(auto next = pos * chunk, last = (std::min)(next + chunk, length); next < last; ++next) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(entities[next]), get(entities[next])));
+                    } else {
+                        std::apply(func, get(entities[next]));
+                    }
+                }
+            });
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ the group.
      *
@@ -381,8 +487,8 @@ public:
      *
      * @return An iterable object to use to _visit_ the group.
      */
-    [[nodiscard]] iterable_group each() const ENTT_NOEXCEPT {
-        return iterable_group{*handler, pools};
+    [[nodiscard]] iterable_group each() const {
+        return iterable_group{current(), pools};
     }
 
     /**
@@ -423,15 +529,17 @@ public:
      */
     template<typename... Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_TRACE("entt::group::sort", type_id<basic_group>().name());
+
         if constexpr(sizeof...(Component) == 0) {
             static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type>, "Invalid comparison function");
-            handler->sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
+            current().sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
         }  else if constexpr(sizeof...(Component) == 1) {
-            handler->sort([this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
+            current().sort([this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
                 return compare((std::get<storage_type<Component> *>(pools)->get(lhs), ...), (std::get<storage_type<Component> *>(pools)->get(rhs), ...));
             }, std::move(algo), std::forward<Args>(args)...);
         } else {
-            handler->sort([this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
+            current().sort([this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
                 return compare(std::forward_as_tuple(std::get<storage_type<Component> *>(pools)->get(lhs)...), std::forward_as_tuple(std::get<storage_type<Component> *>(pools)->get(rhs)...));
             }, std::move(algo), std::forward<Args>(args)...);
         }
@@ -455,11 +563,13 @@ public:
      */
     template<typename Component>
     void sort() const {
-        handler->respect(*std::get<storage_type<Component> *>(pools));
+        ENTT_TRACE("entt::group::sort", type_id<basic_group>().name());
+        current().respect(*std::get<storage_type<Component> *>(pools));
     }
 
 private:
     basic_sparse_set<entity_type> *handler;
+    delegate<void()> init;
     const std::tuple<storage_type<Get> *...> pools;
 };
 
@@ -621,6 +731,15 @@ class basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> final
         }
 
     private:
+        [[nodiscard]] reverse_iterator at(const std::size_t pos) const ENTT_NOEXCEPT {
+            // owned pools are aligned, elements are reached in constant time
+            return {
+                std::get<0>(pools)->basic_sparse_set<Entity>::rbegin() + pos,
+                std::make_tuple((std::get<storage_type<Owned> *>(pools)->rbegin() + pos)...),
+                std::make_tuple(std::get<storage_type<Get> *>(pools)...)
+            };
+        }
+
         const std::tuple<storage_type<Owned> *..., storage_type<Get> *...> pools;
         const std::size_t *length;
     };
@@ -687,6 +806,32 @@ public:
         return std::get<0>(pools)->data();
     }
 
+    /**
+     * @brief Returns the contiguous ranges of entities and owned components.
+     *
+     * The first span refers to the entities of the group, while the others
+     * refer to the instances of the non-empty owned types, in the order in
+     * which they are specified. All the spans have the same size and elements
+     * at the same position belong to the same entity.
+     *
+     * @note
+     * Spans follow the order of the packed arrays, that is the reverse of the
+     * one of the iterators returned by `begin` and `end`.
+     *
+     * @return A tuple of spans over the entities and the owned components.
+     */
+    [[nodiscard]] auto spans() const ENTT_NOEXCEPT {
+        const auto last = *length;
+
+        return std::tuple_cat(std::make_tuple(span<const entity_type>{data(), last}), [last](auto *cpool) {
+            if constexpr(std::is_same_v<typename std::remove_pointer_t<decltype(cpool)>::storage_category, empty_storage_tag>) {
+                return std::make_tuple();
+            } else {
+                return std::make_tuple(span<std::remove_pointer_t<decltype(cpool->raw())>>{cpool->raw(), last});
+            }
+        }(std::get<storage_type<Owned> *>(pools))...);
+    }
+
     /**
      * @brief Returns an iterator to the first entity of the group.
      *
@@ -841,6 +986,8 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
+        ENTT_TRACE("entt::group::each", type_id<basic_group>().name());
+
         for(auto args: each()) {
             if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
                 std::apply(func, args);
@@ -850,6 +997,131 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The group is split in chunks of contiguous elements and each chunk is
+     * offered to the executor as a separate task. Owned components are reached at the
+     * same positions in all their pools, observed ones are looked up per entity<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying components of the iterated types during a
+     * parallel iteration results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        ENTT_ASSERT(chunk);
+        const auto extent = *length;
+
+        if(const auto count = (extent + chunk - 1u) / chunk; count) {
+            executor(count, [this, &func, extent, chunk](const size_type pos) {
+                const auto from = pos * chunk;
+                auto it = each().at(from);
+
+                for(auto next = from, last = (std::min)(from + chunk, extent); next < last; ++next, ++it) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                        std::apply(func, *it);
+                    } else {
+                        std::apply([&func](auto, auto &&... less) { func(std::forward<decltype(less)>(less)...); }, *it);
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in batches and applies the
+     * given function object to them.
+     *
+     * The group is split in batches of `Size` elements, the last of which can
+     * be shorter. The function object is invoked once per batch and it's
+     * provided with a pointer to the entities, a pointer to the contiguous
+     * components for each non-empty owned type, an array of pointers for each
+     * non-empty observed type and the number of elements in the batch. The
+     * signature of the function must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, Owned *..., Get *const *..., Count);
+     * @endcode
+     *
+     * Where `Count` is `std::integral_constant<size_type, Size>` for full
+     * batches and `size_type` for the last one, if shorter. Both convert to
+     * `size_type`, though generic function objects get loops with a trip count
+     * known at compile-time for full batches, that compilers can unroll and
+     * vectorize.
+     *
+     * @note
+     * Batches follow the order of the packed arrays, that is the reverse of the
+     * one of the iterators returned by `begin` and `end`.
+     *
+     * @sa each
+     *
+     * @tparam Size Number of elements in full batches.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<size_type Size, typename Func>
+    void each_batch(Func func) const {
+        static_assert(Size != 0u, "Invalid batch size");
+        static_assert(!(std::is_same_v<typename storage_type<Owned>::storage_category, split_storage_tag> || ...), "Split storage cannot be iterated in batches");
+        static_assert(!(std::is_same_v<typename storage_type<Get>::storage_category, split_storage_tag> || ...), "Split storage cannot be iterated in batches");
+        ENTT_TRACE("entt::group::each_batch", type_id<basic_group>().name());
+
+        const auto owned = std::tuple_cat([](auto *cpool) {
+            if constexpr(std::is_same_v<typename std::remove_pointer_t<decltype(cpool)>::storage_category, empty_storage_tag>) {
+                return std::make_tuple();
+            } else {
+                return std::make_tuple(cpool->raw());
+            }
+        }(std::get<storage_type<Owned> *>(pools))...);
+
+        const auto *entities = std::get<0>(pools)->data();
+        typename internal::batch_pointers<Size, decltype(std::tuple_cat(get_as_tuple(std::declval<storage_type<Get> &>(), entity_type{})...))>::type pointers;
+
+        const auto invoke = [this, &func, &owned, entities, &pointers](const size_type from, const auto count) {
+            for(size_type next{}; next < count; ++next) {
+                std::apply([this, next, entt = entities[from + next]](auto &... array) {
+                    std::apply([next, &array...](auto &... component) { ((array[next] = &component), ...); }, std::tuple_cat(get_as_tuple(*std::get<storage_type<Get> *>(pools), entt)...));
+                }, pointers);
+            }
+
+            std::apply([&func, &pointers, entities, from, count](auto *... base) {
+                std::apply([&func, entities, from, count, base...](auto &... array) { func(entities + from, (base + from)..., array.data()..., count); }, pointers);
+            }, owned);
+        };
+
+        const auto last = *length;
+        size_type pos{};
+
+        for(; (last - pos) >= Size; pos += Size) {
+            invoke(pos, std::integral_constant<size_type, Size>{});
+        }
+
+        if(pos != last) {
+            invoke(pos, last - pos);
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ the group.
      *
@@ -906,6 +1178,7 @@ public:
      */
     template<typename... Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_TRACE("entt::group::sort", type_id<basic_group>().name());
         auto *cpool = std::get<0>(pools);
 
         if constexpr(sizeof...(Component) == 0) {
@@ -930,6 +1203,69 @@ public:
         }(std::get<storage_type<Owned> *>(pools)...);
     }
 
+    /**
+     * @brief Sort a group according to the keys projected from a component.
+     *
+     * Keys are projected once per entity and sorted by means of a radix sort,
+     * rather than comparing components. The resulting order is applied then to
+     * all the owned pools in a single pass each.<br/>
+     * The projection function object is invoked with a component of the given
+     * type and must return either an integral value or an enum. The signature
+     * of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * Key(const Component &);
+     * @endcode
+     *
+     * Entities are sorted in ascending order of their keys and the sort is
+     * stable.
+     *
+     * @tparam Component Type of component from which to project the keys.
+     * @tparam Bit Number of bits processed per pass of the radix sort.
+     * @tparam Key Type of projection function object.
+     * @param key A valid projection function object.
+     */
+    template<typename Component, std::size_t Bit = 8u, typename Key>
+    void sort_by(Key key) {
+        using key_type = decltype(internal::radix_key(key(std::declval<const Component &>())));
+        static_assert(((sizeof(key_type) * CHAR_BIT) % Bit) == 0u, "Invalid number of bits per pass");
+        ENTT_TRACE("entt::group::sort", type_id<basic_group>().name());
+
+        const auto *cpool = std::get<storage_type<Component> *>(pools);
+        const auto *head = std::get<0>(pools);
+        std::vector<std::pair<key_type, entity_type>> order{};
+        order.reserve(*length);
+
+        for(size_type pos{}; pos < *length; ++pos) {
+            const auto entt = head->data()[*length - pos - 1u];
+            order.emplace_back(internal::radix_key(key(std::as_const(*cpool).get(entt))), entt);
+        }
+
+        radix_sort<Bit, sizeof(key_type) * CHAR_BIT>{}(order.begin(), order.end(), [](const auto &elem) { return elem.first; });
+
+        // entities are iterated in reverse order, the first one goes last
+        [&order, last = *length](auto *... owned) {
+            for(size_type pos{}; pos < last; ++pos) {
+                const auto entt = order[last - pos - 1u].second;
+                ((owned->data()[pos] == entt ? void() : owned->swap(owned->data()[pos], entt)), ...);
+            }
+        }(std::get<storage_type<Owned> *>(pools)...);
+    }
+
+    /**
+     * @brief Sort a group according to a data member of a component.
+     *
+     * @sa sort_by
+     *
+     * @tparam Member Pointer to the data member to use as a key.
+     * @tparam Bit Number of bits processed per pass of the radix sort.
+     */
+    template<auto Member, std::size_t Bit = 8u>
+    void sort_by() {
+        static_assert(std::is_member_object_pointer_v<decltype(Member)>, "Invalid data member");
+        sort_by<member_class_t<decltype(Member)>, Bit>([](const auto &instance) { return instance.*Member; });
+    }
+
 private:
     const std::tuple<storage_type<Owned> *..., storage_type<Get> *...> pools;
     const size_type *length;
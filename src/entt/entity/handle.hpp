@@ -302,6 +302,236 @@ bool operator!=(const basic_handle<Type> &lhs, const basic_handle<Other> &rhs) E
 }
 
 
+/**
+ * @brief Handle to an entity that caches the pools of its components.
+ *
+ * Pools are looked up once, when the handle is constructed. Checking for,
+ * getting and trying to get components then reduce to lookups in the sparse
+ * sets, with no indirection through the registry.<br/>
+ * Functions that create, update or destroy components are still forwarded to
+ * the registry, so that groups are kept up to date and listeners are notified.
+ *
+ * @note
+ * Pools are never destroyed by a registry. Therefore, a cached handle is valid
+ * as long as its registry is alive, no matter what happens to its entity.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Types of components whose pools are cached.
+ */
+template<typename Entity, typename... Type>
+class basic_cached_handle {
+    static_assert(sizeof...(Type) != 0, "Exhaustive list of components required");
+
+    template<typename Component>
+    using storage_type = std::remove_reference_t<decltype(std::declval<constness_as_t<basic_registry<std::remove_const_t<Entity>>, Entity> &>().template view<std::conditional_t<std::is_const_v<Entity>, std::add_const_t<Component>, Component>>().storage())>;
+
+    template<typename Component>
+    [[nodiscard]] auto * pool() const ENTT_NOEXCEPT {
+        static_assert(type_list_contains_v<type_list<Type...>, Component>, "Invalid component type");
+        return std::get<storage_type<Component> *>(pools);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = std::remove_const_t<Entity>;
+    /*! @brief Type of registry accepted by the handle. */
+    using registry_type = constness_as_t<basic_registry<entity_type>, Entity>;
+
+    /*! @brief Constructs an invalid handle. */
+    basic_cached_handle() ENTT_NOEXCEPT
+        : reg{}, entt{null}, pools{}
+    {}
+
+    /**
+     * @brief Constructs a handle from a given registry and entity.
+     * @param ref An instance of the registry class.
+     * @param value An entity identifier.
+     */
+    basic_cached_handle(registry_type &ref, entity_type value)
+        : reg{&ref},
+          entt{value},
+          pools{&ref.template view<std::conditional_t<std::is_const_v<Entity>, std::add_const_t<Type>, Type>>().storage()...}
+    {}
+
+    /**
+     * @brief Returns a handle that shares the pools of this one and refers to
+     * another entity.
+     *
+     * This is the cheapest way to visit multiple entities with a cached handle,
+     * since pools aren't looked up again.
+     *
+     * @param value An entity identifier.
+     * @return A handle for the given entity.
+     */
+    [[nodiscard]] basic_cached_handle rebind(const entity_type value) const ENTT_NOEXCEPT {
+        auto other = *this;
+        other.entt = value;
+        return other;
+    }
+
+    /**
+     * @brief Converts a cached handle to a plain handle.
+     * @return A plain handle referring to the same registry and the same
+     * entity.
+     */
+    [[nodiscard]] operator basic_handle<Entity, Type...>() const ENTT_NOEXCEPT {
+        return reg ? basic_handle<Entity, Type...>{*reg, entt} : basic_handle<Entity, Type...>{};
+    }
+
+    /**
+     * @brief Converts a handle to its underlying entity.
+     * @return An entity identifier.
+     */
+    [[nodiscard]] operator entity_type() const ENTT_NOEXCEPT {
+        return entity();
+    }
+
+    /**
+     * @brief Checks if a handle refers to non-null registry pointer and entity.
+     * @return True if the handle refers to non-null registry and entity, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return reg && entt != null;
+    }
+
+    /**
+     * @brief Checks if a handle refers to a valid entity or not.
+     * @return True if the handle refers to a valid entity, false otherwise.
+     */
+    [[nodiscard]] bool valid() const {
+        return reg->valid(entt);
+    }
+
+    /**
+     * @brief Returns a pointer to the underlying registry, if any.
+     * @return A pointer to the underlying registry, if any.
+     */
+    [[nodiscard]] registry_type * registry() const ENTT_NOEXCEPT {
+        return reg;
+    }
+
+    /**
+     * @brief Returns the entity associated with a handle.
+     * @return The entity associated with the handle.
+     */
+    [[nodiscard]] entity_type entity() const ENTT_NOEXCEPT {
+        return entt;
+    }
+
+    /**
+     * @brief Assigns the given component to a handle.
+     * @sa basic_registry::emplace
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the newly created component.
+     */
+    template<typename Component, typename... Args>
+    decltype(auto) emplace(Args &&... args) const {
+        static_assert(type_list_contains_v<type_list<Type...>, Component>, "Invalid component type");
+        return reg->template emplace<Component>(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Patches the given component for a handle.
+     * @sa basic_registry::patch
+     * @tparam Component Type of component to patch.
+     * @tparam Func Types of the function objects to invoke.
+     * @param func Valid function objects.
+     * @return A reference to the patched component.
+     */
+    template<typename Component, typename... Func>
+    decltype(auto) patch(Func &&... func) const {
+        static_assert(type_list_contains_v<type_list<Type...>, Component>, "Invalid component type");
+        return reg->template patch<Component>(entt, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Replaces the given component for a handle.
+     * @sa basic_registry::replace
+     * @tparam Component Type of component to replace.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param args Parameters to use to initialize the component.
+     * @return A reference to the component being replaced.
+     */
+    template<typename Component, typename... Args>
+    decltype(auto) replace(Args &&... args) const {
+        static_assert(type_list_contains_v<type_list<Type...>, Component>, "Invalid component type");
+        return reg->template replace<Component>(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes the given components from a handle.
+     * @sa basic_registry::remove
+     * @tparam Component Types of components to remove.
+     */
+    template<typename... Component>
+    void remove() const {
+        static_assert((type_list_contains_v<type_list<Type...>, Component> && ...), "Invalid component type");
+        reg->template remove<Component...>(entt);
+    }
+
+    /**
+     * @brief Checks if a handle has all the given components.
+     * @tparam Component Components for which to perform the check.
+     * @return True if the handle has all the components, false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool has() const {
+        return (pool<Component>()->contains(entt) && ...);
+    }
+
+    /**
+     * @brief Checks if a handle has at least one of the given components.
+     * @tparam Component Components for which to perform the check.
+     * @return True if the handle has at least one of the given components,
+     * false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] bool any() const {
+        return (pool<Component>()->contains(entt) || ...);
+    }
+
+    /**
+     * @brief Returns references to the given components for a handle.
+     *
+     * @warning
+     * Attempting to get a component from an entity that doesn't own it results
+     * in undefined behavior.
+     *
+     * @tparam Component Types of components to get.
+     * @return References to the components owned by the handle.
+     */
+    template<typename... Component>
+    [[nodiscard]] decltype(auto) get() const {
+        if constexpr(sizeof...(Component) == 1) {
+            return (pool<Component>()->get(entt), ...);
+        } else {
+            return std::tuple<decltype(pool<Component>()->get(entt))...>{pool<Component>()->get(entt)...};
+        }
+    }
+
+    /**
+     * @brief Returns pointers to the given components for a handle.
+     * @tparam Component Types of components to get.
+     * @return Pointers to the components owned by the handle.
+     */
+    template<typename... Component>
+    [[nodiscard]] auto try_get() const {
+        if constexpr(sizeof...(Component) == 1) {
+            return ((pool<Component>()->contains(entt) ? &pool<Component>()->get(entt) : nullptr), ...);
+        } else {
+            return std::make_tuple(try_get<Component>()...);
+        }
+    }
+
+private:
+    registry_type *reg;
+    entity_type entt;
+    std::tuple<storage_type<Type> *...> pools;
+};
+
+
 /**
  * @brief Deduction guide.
  * @tparam Entity A valid entity type (see entt_traits for more details).
@@ -2,10 +2,16 @@
 #define ENTT_ENTITY_HELPER_HPP
 
 
+#include <climits>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
 #include "../core/type_traits.hpp"
 #include "../signal/delegate.hpp"
+#include "entity.hpp"
 #include "registry.hpp"
 #include "fwd.hpp"
 
@@ -145,6 +151,209 @@ Entity to_entity(const basic_registry<Entity> &reg, const Component &component)
 }
 
 
+/**
+ * @brief Constructs a component in place, meant to be registered with meta.
+ *
+ * Once registered as a meta function of the component, this function creates
+ * components of types chosen at runtime directly in their storage, from the
+ * arguments of the meta call:
+ *
+ * @code{.cpp}
+ * entt::meta<position>().func<&entt::meta_emplace<entt::entity, position, float, float>, entt::as_ref_t>("emplace"_hs);
+ * // ...
+ * type.func("emplace"_hs).invoke({}, std::ref(registry), entity, 1.f, 2.f);
+ * @endcode
+ *
+ * This way, no temporary instance of the component is wrapped in a meta any
+ * to be moved into the registry later on.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Type of component to create.
+ * @tparam Args Types of arguments to use to construct the component.
+ * @param reg A registry that contains the given entity.
+ * @param entt A valid entity identifier.
+ * @param args Parameters to use to initialize the component.
+ * @return A reference to the newly created component.
+ */
+template<typename Entity, typename Component, typename... Args>
+decltype(auto) meta_emplace(basic_registry<Entity> &reg, const Entity entt, Args... args) {
+    return reg.template emplace<Component>(entt, std::move(args)...);
+}
+
+
+/**
+ * @brief Constructs a component in place for each entity of a range, meant to
+ * be registered with meta.
+ *
+ * @sa meta_emplace
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Type of component to create.
+ * @tparam Args Types of arguments to use to construct the components.
+ * @param reg A registry that contains the given entities.
+ * @param first A pointer to the first element of the range of entities.
+ * @param last A pointer past the last element of the range of entities.
+ * @param args Parameters to use to initialize the components.
+ */
+template<typename Entity, typename Component, typename... Args>
+void meta_insert(basic_registry<Entity> &reg, const Entity *first, const Entity *last, Args... args) {
+    reg.template reserve<Component>(reg.template size<Component>() + static_cast<std::size_t>(last - first));
+
+    for(; first != last; ++first) {
+        reg.template emplace<Component>(*first, args...);
+    }
+}
+
+
+/**
+ * @brief Component to use to arrange entities in hierarchies.
+ *
+ * Children of an entity are linked to each other and the parent refers only to
+ * the first of them. This way, entities can be moved around in a hierarchy in
+ * constant time, no matter how many children they have.
+ *
+ * @warning
+ * Relationships must be updated by means of `reparent` only. Moreover, entities
+ * must be detached from their hierarchies before being destroyed.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+struct basic_relationship {
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Number of children. */
+    size_type children{};
+    /*! @brief First child, if any. */
+    entity_type first{null};
+    /*! @brief Previous sibling, if any. */
+    entity_type prev{null};
+    /*! @brief Next sibling, if any. */
+    entity_type next{null};
+    /*! @brief Parent, if any. */
+    entity_type parent{null};
+};
+
+
+/**
+ * @brief Moves an entity under a new parent.
+ *
+ * The entity and the parent are given a relationship if they don't have one
+ * yet. Children follow the entity in its new position. A null parent turns the
+ * entity into the root of its own hierarchy.<br/>
+ * The order of the pool of relationships isn't affected by this function. Use
+ * `sort_hierarchy` to restore it when required.
+ *
+ * @warning
+ * Attempting to move an entity under itself or under one of its descendants
+ * results in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @param reg A registry that contains the given entities.
+ * @param entt A valid entity identifier.
+ * @param parent A valid entity identifier or the null entity.
+ */
+template<typename Entity>
+void reparent(basic_registry<Entity> &reg, const Entity entt, const typename basic_registry<Entity>::entity_type parent) {
+    using node_type = basic_relationship<Entity>;
+
+    if(parent != null) {
+        static_cast<void>(reg.template get_or_emplace<node_type>(parent));
+
+        ENTT_ASSERT([&]() {
+            auto curr = parent;
+            for(; curr != null && curr != entt; curr = reg.template get<node_type>(curr).parent);
+            return curr == null;
+        }());
+    }
+
+    // references are taken only after all the relationships exist
+    auto &&node = reg.template get_or_emplace<node_type>(entt);
+
+    if(node.parent != null) {
+        auto &&owner = reg.template get<node_type>(node.parent);
+        owner.first = (owner.first == entt) ? node.next : owner.first;
+        --owner.children;
+    }
+
+    if(node.prev != null) {
+        reg.template get<node_type>(node.prev).next = node.next;
+    }
+
+    if(node.next != null) {
+        reg.template get<node_type>(node.next).prev = node.prev;
+    }
+
+    node.prev = null;
+    node.next = null;
+    node.parent = parent;
+
+    if(parent != null) {
+        auto &&owner = reg.template get<node_type>(parent);
+
+        if(owner.first != null) {
+            reg.template get<node_type>(owner.first).prev = entt;
+        }
+
+        node.next = owner.first;
+        owner.first = entt;
+        ++owner.children;
+    }
+}
+
+
+/**
+ * @brief Sorts the pool of relationships in depth-first order.
+ *
+ * Once sorted, iterating the relationships returns parents before their
+ * children. Therefore, transforms and the like can be propagated with a single
+ * linear pass. Other pools can be sorted the same way by means of
+ * `basic_registry::sort`.<br/>
+ * Hierarchies are visited once to compute the order of their entities, that
+ * is imposed then to the pool with a radix sort.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @param reg A registry that contains the given entities.
+ */
+template<typename Entity>
+void sort_hierarchy(basic_registry<Entity> &reg) {
+    using node_type = basic_relationship<Entity>;
+    using traits_type = entt_traits<Entity>;
+    using rank_type = typename traits_type::entity_type;
+
+    const auto view = reg.template view<const node_type>();
+    std::vector<rank_type> rank(reg.size());
+    rank_type next{};
+
+    for(const auto root: view) {
+        if(view.template get<const node_type>(root).parent == null) {
+            // the links are enough to visit a hierarchy, no stack required
+            for(auto curr = root; curr != null;) {
+                const auto &node = view.template get<const node_type>(curr);
+                rank[to_integral(curr) & traits_type::entity_mask] = next++;
+
+                if(node.first != null) {
+                    curr = node.first;
+                } else {
+                    while(curr != root && view.template get<const node_type>(curr).next == null) {
+                        curr = view.template get<const node_type>(curr).parent;
+                    }
+
+                    curr = (curr == root) ? static_cast<Entity>(null) : view.template get<const node_type>(curr).next;
+                }
+            }
+        }
+    }
+
+    reg.template sort<node_type>([&rank](const Entity entt) {
+        return rank[to_integral(entt) & traits_type::entity_mask];
+    }, radix_sort<8, sizeof(rank_type) * CHAR_BIT>{});
+}
+
+
 }
 
 
@@ -0,0 +1,310 @@
+#ifndef ENTT_ENTITY_IMAGE_HPP
+#define ENTT_ENTITY_IMAGE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Flat image of a registry made of trivially copyable components.
+ *
+ * An image is a single contiguous block of bytes that contains the list of
+ * entities of a registry and, for each type of component, the packed arrays of
+ * entities and objects of its pool, in the order in which they are stored.
+ * Sections are aligned to 64 bytes and contain no pointers, therefore an image
+ * is relocatable and can be written to a file and mapped back in memory as-is.
+ *
+ * Loading an image doesn't deserialize objects one at a time. The arrays are
+ * read directly from the buffer and each pool is filled with a single bulk
+ * insertion, so that a mapped file is paged in sequentially and on demand.
+ * Pools are restored in the same order they had when the image was saved.
+ *
+ * @warning
+ * The buffer of an image must be aligned at least as required by the entity
+ * and the component types. Memory-mapped files always are.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_image {
+    using traits_type = entt_traits<Entity>;
+    using word_type = std::uint64_t;
+
+    // the string "ENTTIMG1" in little-endian order
+    static constexpr word_type signature = 0x31474d4954544e45ull;
+    static constexpr std::size_t alignment = 64u;
+    static constexpr std::size_t header_words = 5u;
+    static constexpr std::size_t record_words = 3u;
+    static constexpr auto word_digits = std::numeric_limits<word_type>::digits;
+
+    [[nodiscard]] static constexpr std::size_t align(const std::size_t size) ENTT_NOEXCEPT {
+        return (size + alignment - 1u) / alignment * alignment;
+    }
+
+    template<typename Component>
+    [[nodiscard]] static constexpr std::size_t section(const std::size_t count) ENTT_NOEXCEPT {
+        if constexpr(std::is_empty_v<Component>) {
+            return align(count * sizeof(Entity));
+        } else {
+            return align(count * sizeof(Entity)) + align(count * sizeof(Component));
+        }
+    }
+
+    template<typename... Component>
+    [[nodiscard]] static constexpr std::size_t prologue() ENTT_NOEXCEPT {
+        return align((header_words + sizeof...(Component) * record_words) * sizeof(word_type));
+    }
+
+    static void write(std::byte *out, const std::size_t pos, const word_type value) ENTT_NOEXCEPT {
+        std::memcpy(out + pos * sizeof(word_type), &value, sizeof(word_type));
+    }
+
+    static void copy(std::byte *out, std::size_t &offset, const void *data, const std::size_t size) ENTT_NOEXCEPT {
+        if(size) {
+            std::memcpy(out + offset, data, size);
+        }
+
+        // padding is zeroed so that images of equal registries are equal
+        std::memset(out + offset + size, 0, align(size) - size);
+        offset += align(size);
+    }
+
+    [[nodiscard]] static bool advance(const std::size_t length, std::size_t &offset, const std::size_t count, const std::size_t size) ENTT_NOEXCEPT {
+        // counts come from the buffer and are tested before they are multiplied, so that nothing overflows
+        if(count > (length - offset) / size) {
+            return false;
+        }
+
+        const auto used = count * size;
+
+        if(const auto padding = (alignment - used % alignment) % alignment; padding > length - offset - used) {
+            return false;
+        }
+
+        offset += align(used);
+        return true;
+    }
+
+    [[nodiscard]] static word_type read(const std::byte *in, const std::size_t pos) ENTT_NOEXCEPT {
+        word_type value{};
+        std::memcpy(&value, in + pos * sizeof(word_type), sizeof(word_type));
+        return value;
+    }
+
+    template<typename Component>
+    static void save_pool(const basic_registry<Entity> &reg, std::byte *out, const std::size_t index, std::size_t &offset) {
+        const auto &cpool = reg.template storage<Component>();
+        const auto count = cpool.size();
+
+        write(out, header_words + index * record_words, type_hash<Component>::value());
+        write(out, header_words + index * record_words + 1u, std::is_empty_v<Component> ? 0u : sizeof(Component));
+        write(out, header_words + index * record_words + 2u, count);
+
+        copy(out, offset, cpool.data(), count * sizeof(Entity));
+
+        if constexpr(!std::is_empty_v<Component>) {
+            copy(out, offset, cpool.raw(), count * sizeof(Component));
+        }
+    }
+
+    [[nodiscard]] static std::size_t index_of(const Entity entt) ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(to_integral(entt) & traits_type::entity_mask);
+    }
+
+    [[nodiscard]] static bool check_entities(const Entity *entities, const std::size_t count, const Entity destroyed) ENTT_NOEXCEPT {
+        std::size_t dead{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            dead += (index_of(entities[pos]) != pos);
+        }
+
+        // the list of destroyed entities must end without leaving the range nor looping
+        for(auto curr = destroyed; curr != null; curr = entities[index_of(curr)], --dead) {
+            if(const auto pos = index_of(curr); !dead || !(pos < count) || index_of(entities[pos]) == pos) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static bool check_owners(const Entity *first, const std::size_t size, const Entity *entities, const std::size_t count, std::vector<word_type> &seen) {
+        std::fill(seen.begin(), seen.end(), word_type{});
+
+        for(std::size_t pos{}; pos < size; ++pos) {
+            // components must belong to entities in use and appear only once
+            const auto entt = first[pos];
+            const auto curr = index_of(entt);
+            const auto flag = word_type{1u} << (curr % word_digits);
+
+            if(!(curr < count) || entities[curr] != entt || (seen[curr / word_digits] & flag)) {
+                return false;
+            }
+
+            seen[curr / word_digits] |= flag;
+        }
+
+        return true;
+    }
+
+    template<typename Component>
+    [[nodiscard]] static bool check_pool(const std::byte *in, const std::size_t length, const std::size_t index, std::size_t &offset, const Entity *entities, const std::size_t size, std::vector<word_type> &seen) {
+        const auto count = read(in, header_words + index * record_words + 2u);
+        const auto *first = reinterpret_cast<const Entity *>(in + offset);
+
+        if(read(in, header_words + index * record_words) != type_hash<Component>::value()
+            || read(in, header_words + index * record_words + 1u) != (std::is_empty_v<Component> ? 0u : sizeof(Component))
+            || static_cast<word_type>(static_cast<std::size_t>(count)) != count
+            || !advance(length, offset, static_cast<std::size_t>(count), sizeof(Entity))
+            || !check_owners(first, static_cast<std::size_t>(count), entities, size, seen))
+        {
+            return false;
+        }
+
+        if constexpr(std::is_empty_v<Component>) {
+            return true;
+        } else {
+            return advance(length, offset, static_cast<std::size_t>(count), sizeof(Component));
+        }
+    }
+
+    template<typename Component>
+    static void load_pool(basic_registry<Entity> &reg, const std::byte *in, const std::size_t index, std::size_t &offset) {
+        const auto count = static_cast<std::size_t>(read(in, header_words + index * record_words + 2u));
+        const auto *first = reinterpret_cast<const Entity *>(in + offset);
+        offset += align(count * sizeof(Entity));
+
+        if constexpr(std::is_empty_v<Component>) {
+            reg.template insert<Component>(first, first + count);
+        } else {
+            const auto *from = reinterpret_cast<const Component *>(in + offset);
+            offset += align(count * sizeof(Component));
+            reg.template insert<Component>(first, first + count, from, from + count);
+        }
+    }
+
+    template<typename... Component, std::size_t... Index>
+    static void save(const basic_registry<Entity> &reg, std::byte *out, std::size_t offset, std::index_sequence<Index...>) {
+        (save_pool<Component>(reg, out, Index, offset), ...);
+    }
+
+    template<typename... Component, std::size_t... Index>
+    [[nodiscard]] static bool check(const std::byte *in, const std::size_t length, std::size_t offset, const Entity *entities, const std::size_t size, std::index_sequence<Index...>) {
+        std::vector<word_type> seen((size + word_digits - 1u) / word_digits);
+        return (check_pool<Component>(in, length, Index, offset, entities, size, seen) && ...);
+    }
+
+    template<typename... Component, std::size_t... Index>
+    static void load(basic_registry<Entity> &reg, const std::byte *in, std::size_t offset, std::index_sequence<Index...>) {
+        (load_pool<Component>(reg, in, Index, offset), ...);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Returns the size of the image of a registry.
+     * @tparam Component Types of components to put in the image.
+     * @param reg A valid reference to a registry.
+     * @return The size of the image, in bytes.
+     */
+    template<typename... Component>
+    [[nodiscard]] static size_type bytes(const basic_registry<entity_type> &reg) {
+        return prologue<Component...>() + align(reg.size() * sizeof(entity_type)) + (size_type{} + ... + section<Component>(reg.template storage<Component>().size()));
+    }
+
+    /**
+     * @brief Writes the image of a registry to a buffer.
+     * @tparam Component Types of components to put in the image.
+     * @param reg A valid reference to a registry.
+     * @param out A buffer at least as large as returned by `bytes`.
+     */
+    template<typename... Component>
+    static void save(const basic_registry<entity_type> &reg, std::byte *out) {
+        static_assert((std::is_trivially_copyable_v<Component> && ...), "Components must be trivially copyable");
+        const auto count = reg.size();
+        size_type offset = prologue<Component...>();
+
+        std::memset(out, 0, offset);
+        write(out, 0u, signature);
+        write(out, 1u, sizeof(entity_type));
+        write(out, 2u, sizeof...(Component));
+        write(out, 3u, count);
+        write(out, 4u, to_integral(reg.destroyed()));
+
+        copy(out, offset, reg.data(), count * sizeof(entity_type));
+        save<Component...>(reg, out, offset, std::index_sequence_for<Component...>{});
+    }
+
+    /**
+     * @brief Restores a registry from an image.
+     *
+     * The image is validated before touching the registry. It's rejected if it
+     * doesn't contain exactly the given types of components, in the same
+     * order, or if any of its sections doesn't fit the buffer. It's also
+     * rejected if the list of destroyed entities is broken or if a pool
+     * contains entities that aren't in use or that appear more than once.
+     *
+     * @warning
+     * The registry must be empty, see `assign` for further details.
+     *
+     * @tparam Component Types of components contained in the image.
+     * @param reg A valid reference to an empty registry.
+     * @param in A buffer that contains an image.
+     * @param length The size of the buffer, in bytes.
+     * @return True if the image has been loaded, false otherwise.
+     */
+    template<typename... Component>
+    [[nodiscard]] static bool load(basic_registry<entity_type> &reg, const std::byte *in, const size_type length) {
+        static_assert((std::is_trivially_copyable_v<Component> && ...), "Components must be trivially copyable");
+        [[maybe_unused]] constexpr auto required = (std::max)({ alignof(entity_type), alignof(std::conditional_t<std::is_empty_v<Component>, entity_type, Component>)... });
+        ENTT_ASSERT(reinterpret_cast<std::uintptr_t>(in) % required == 0u);
+
+        if(length < prologue<Component...>() || read(in, 0u) != signature || read(in, 1u) != sizeof(entity_type) || read(in, 2u) != sizeof...(Component)) {
+            return false;
+        }
+
+        const auto count = static_cast<size_type>(read(in, 3u));
+        const auto *first = reinterpret_cast<const entity_type *>(in + prologue<Component...>());
+        const entity_type destroyed{static_cast<typename traits_type::entity_type>(read(in, 4u))};
+        size_type offset = prologue<Component...>();
+
+        if(static_cast<word_type>(count) != read(in, 3u)
+            || static_cast<word_type>(to_integral(destroyed)) != read(in, 4u)
+            || !advance(length, offset, count, sizeof(entity_type))
+            || !check_entities(first, count, destroyed)
+            || !check<Component...>(in, length, offset, first, count, std::index_sequence_for<Component...>{}))
+        {
+            return false;
+        }
+
+        reg.assign(first, first + count, destroyed);
+
+        load<Component...>(reg, in, offset, std::index_sequence_for<Component...>{});
+        return true;
+    }
+};
+
+
+}
+
+
+#endif
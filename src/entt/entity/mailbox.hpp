@@ -0,0 +1,154 @@
+#ifndef ENTT_ENTITY_MAILBOX_HPP
+#define ENTT_ENTITY_MAILBOX_HPP
+
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "multi_storage.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Mailbox of events that target entities.
+ *
+ * Events are appended to the mailbox of their targets rather than to a global
+ * queue. All the events of an entity are kept together and are delivered at
+ * once, along with the components of the entity. Therefore, delivering the
+ * events requires a single lookup per target rather than one per event.
+ *
+ * Events enqueued while the mailbox is being drained are delivered the next
+ * time it's drained.
+ *
+ * @sa basic_multi_storage
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Event Type of events to deliver.
+ */
+template<typename Entity, typename Event>
+class basic_mailbox {
+    using storage_type = basic_multi_storage<Entity, Event>;
+
+public:
+    /*! @brief Type of events to deliver. */
+    using value_type = Event;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type for the events of a target. */
+    using iterator = typename storage_type::iterator;
+
+    /**
+     * @brief Enqueues an event for a target.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param target A valid entity identifier.
+     * @param args Parameters to use to construct the event.
+     */
+    template<typename... Args>
+    void enqueue(const entity_type target, Args &&... args) {
+        storages[current].emplace(target, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns the number of pending events.
+     * @return Number of events not yet delivered.
+     */
+    [[nodiscard]] size_type count() const ENTT_NOEXCEPT {
+        return storages[current].count();
+    }
+
+    /**
+     * @brief Returns the number of pending events for a target.
+     * @param target A valid entity identifier.
+     * @return Number of events not yet delivered to the target.
+     */
+    [[nodiscard]] size_type count(const entity_type target) const {
+        return storages[current].count(target);
+    }
+
+    /**
+     * @brief Returns the number of targets with pending events.
+     * @return Number of targets with pending events.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return storages[current].size();
+    }
+
+    /**
+     * @brief Checks whether there are pending events.
+     * @return True if there are no pending events, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return storages[current].empty();
+    }
+
+    /*! @brief Discards all the pending events. */
+    void clear() {
+        storages[current].clear();
+    }
+
+    /**
+     * @brief Delivers the pending events to their targets.
+     *
+     * The function object is invoked once for each target that has all the
+     * given components, with the range of its events and references to its
+     * non-empty components. Events for the other targets are discarded. The
+     * signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, iterator, iterator, Component &...);
+     * @endcode
+     *
+     * When no components are requested, events are delivered to all the
+     * targets still valid.
+     *
+     * @tparam Component Types of components required by the targets.
+     * @tparam Func Type of the function object to invoke.
+     * @param reg A valid reference to a registry.
+     * @param func A valid function object.
+     */
+    template<typename... Component, typename Func>
+    void drain(basic_registry<entity_type> &reg, Func func) {
+        auto &&pending = storages[current];
+        current = !current;
+
+        // events of a target are contiguous and targets are visited in sequence
+        pending.compact();
+
+        if constexpr(sizeof...(Component) == 0u) {
+            for(auto pos = pending.size(); pos; --pos) {
+                if(const auto entt = pending.data()[pos - 1u]; reg.valid(entt)) {
+                    auto [first, last] = pending.equal_range(entt);
+                    func(entt, first, last);
+                }
+            }
+        } else {
+            const auto view = reg.template view<Component...>();
+
+            for(auto pos = pending.size(); pos; --pos) {
+                if(const auto entt = pending.data()[pos - 1u]; reg.valid(entt) && view.contains(entt)) {
+                    auto [first, last] = pending.equal_range(entt);
+                    std::apply([entt, first = first, last = last, &func](auto &&... curr) { func(entt, first, last, curr...); }, view.get(entt));
+                }
+            }
+        }
+
+        pending.clear();
+    }
+
+private:
+    storage_type storages[2u]{};
+    bool current{};
+};
+
+
+}
+
+
+#endif
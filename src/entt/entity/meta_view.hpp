@@ -0,0 +1,213 @@
+#ifndef ENTT_ENTITY_META_VIEW_HPP
+#define ENTT_ENTITY_META_VIEW_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../meta/meta.hpp"
+#include "../meta/resolve.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "runtime_view.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Reflection driven view.
+ *
+ * A meta view is a runtime view that works in terms of columns rather than
+ * single components. Each column refers to the pool of one of the requested
+ * types of components and offers direct access to its array of components,
+ * along with the meta type of the components.<br/>
+ * Entities are returned in batches. For each batch, the view also returns the
+ * positions within the columns of the components of those entities. This way,
+ * a whole batch can be processed at once with a single call, rather than
+ * wrapping each component of each entity in a `meta_any`.
+ *
+ * @note
+ * Pools of empty types or with a custom layout don't offer a contiguous array
+ * of components. Their columns have no data and their positions can only be
+ * used to access the pools in other ways.
+ *
+ * @warning
+ * Columns are returned by copy and they are invalidated by any operation that
+ * creates or destroys components of the same types. The same applies to the
+ * view, whose lifetime must not overcome that of the registry that generated
+ * it either.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_meta_view final {
+    using basic_pool_type = basic_sparse_set<Entity>;
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Column of components. */
+    struct column_type {
+        /*! @brief Meta type of the components, if they are reflected. */
+        meta_type type;
+        /*! @brief Array of components, if contiguous. */
+        void *data;
+        /*! @brief Number of components. */
+        size_type size;
+        /*! @brief Entities to which the components belong, in the same order. */
+        const entity_type *entities;
+    };
+
+    /**
+     * @brief Constructs a meta view for a given registry.
+     *
+     * @sa basic_registry::runtime_view
+     *
+     * @tparam ItComp Type of input iterator for the components to use to
+     * construct the view.
+     * @tparam ItExcl Type of input iterator for the components to use to filter
+     * the view.
+     * @param ref A valid reference to a registry.
+     * @param first An iterator to the first element of the range of components
+     * to use to construct the view.
+     * @param last An iterator past the last element of the range of components
+     * to use to construct the view.
+     * @param from An iterator to the first element of the range of components
+     * to use to filter the view.
+     * @param to An iterator past the last element of the range of components to
+     * use to filter the view.
+     */
+    template<typename ItComp, typename ItExcl = id_type *>
+    basic_meta_view(basic_registry<entity_type> &ref, ItComp first, ItComp last, ItExcl from = {}, ItExcl to = {})
+        : view{ref.runtime_view(first, last, from, to)},
+          pools{},
+          meta{}
+    {
+        for(; first != last; ++first) {
+            const auto ctype = *first;
+            const auto it = std::find_if(ref.pools.begin(), ref.pools.end(), [ctype](auto &&pdata) { return pdata.pool && pdata.info.hash() == ctype; });
+
+            if(it == ref.pools.end()) {
+                pools.push_back({});
+                meta.emplace_back();
+            } else {
+                pools.push_back({it->pool.get(), it->vtable->raw});
+                meta.push_back(resolve(it->info));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of columns of a view.
+     * @return Number of columns.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return pools.size();
+    }
+
+    /**
+     * @brief Estimates the number of entities iterated by the view.
+     * @return Estimated number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type size_hint() const {
+        return view.size_hint();
+    }
+
+    /**
+     * @brief Returns a column of a view.
+     *
+     * Columns are in the same order of the components used to construct the
+     * view.
+     *
+     * @param pos Index of the column to return.
+     * @return The requested column.
+     */
+    [[nodiscard]] column_type column(const size_type pos) const {
+        ENTT_ASSERT(pos < pools.size());
+
+        if(auto &&[cpool, raw] = pools[pos]; cpool) {
+            return { meta[pos], raw(*cpool), cpool->size(), cpool->data() };
+        }
+
+        return { meta[pos], nullptr, {}, nullptr };
+    }
+
+    /**
+     * @brief Iterates entities in batches and applies the given function
+     * object to them.
+     *
+     * The function object is invoked once for each batch of entities. It is
+     * provided with the entities of the batch, the positions of their
+     * components within the columns and the number of entities in the batch.
+     * Positions are stored column after column, so that the position of the
+     * component of the `i`-th entity within the `c`-th column is
+     * `positions[c * count + i]`.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type *entities, const size_type *positions, const size_type count);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @param chunk Maximum number of entities in a batch.
+     */
+    template<typename Func>
+    void each(Func func, const size_type chunk = basic_pool_type::chunk_size) const {
+        ENTT_ASSERT(chunk);
+        std::vector<entity_type> entities{};
+        std::vector<size_type> positions{};
+        entities.reserve((std::min)(chunk, view.size_hint()));
+
+        const auto flush = [&]() {
+            const auto count = entities.size();
+            positions.resize(count * pools.size());
+
+            for(size_type col{}; col < pools.size(); ++col) {
+                std::transform(entities.cbegin(), entities.cend(), positions.begin() + col * count, [cpool = pools[col].pool](const auto entt) {
+                    return cpool->index(entt);
+                });
+            }
+
+            func(std::as_const(entities).data(), std::as_const(positions).data(), count);
+            entities.clear();
+        };
+
+        for(const auto entt: view) {
+            entities.push_back(entt);
+
+            if(entities.size() == chunk) {
+                flush();
+            }
+        }
+
+        if(!entities.empty()) {
+            flush();
+        }
+    }
+
+private:
+    struct pool_data {
+        basic_pool_type *pool;
+        void *(* raw)(basic_pool_type &);
+    };
+
+    basic_runtime_view<entity_type> view;
+    std::vector<pool_data> pools;
+    std::vector<meta_type> meta;
+};
+
+
+}
+
+
+#endif
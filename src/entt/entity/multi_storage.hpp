@@ -0,0 +1,279 @@
+#ifndef ENTT_ENTITY_MULTI_STORAGE_HPP
+#define ENTT_ENTITY_MULTI_STORAGE_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Multi-instance storage implementation.
+ *
+ * Any number of instances can be assigned to the same entity. Instances are
+ * kept in a single array and those of an entity are always contiguous, so that
+ * they can be visited as a plain range of objects.<br/>
+ * Assigning an instance to an entity other than the last one that received
+ * instances moves its group at the end of the array. Slots left behind are
+ * reclaimed by compacting the array, either explicitly or as soon as they
+ * outnumber the instances in use. A compacted array is laid out in iteration
+ * order, therefore `each` visits it linearly.
+ *
+ * @note
+ * A multi-instance storage isn't meant to be used by a registry. Entities that
+ * are destroyed must be removed explicitly, for example by a listener
+ * connected to the registry.
+ *
+ * @warning
+ * Pointers and references to the instances are invalidated whenever instances
+ * are assigned to an entity or the array is compacted.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_multi_storage: public basic_sparse_set<Entity> {
+    static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The managed type must be at least move constructible and assignable");
+
+    using underlying_type = basic_sparse_set<Entity>;
+
+    struct group_data {
+        std::size_t offset;
+        std::size_t count;
+    };
+
+    void release(const group_data &group) {
+        if(group.offset + group.count == instances.size()) {
+            instances.erase(instances.begin() + group.offset, instances.end());
+        } else {
+            waste += group.count;
+        }
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        std::swap(groups[lhs], groups[rhs]);
+    }
+
+    void swap_and_pop(const std::size_t pos) final {
+        release(groups[pos]);
+        groups[pos] = groups.back();
+        groups.pop_back();
+    }
+
+    void clear_all() ENTT_NOEXCEPT final {
+        groups.clear();
+        instances.clear();
+        waste = {};
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type for the instances of an entity. */
+    using iterator = Type *;
+    /*! @brief Constant random access iterator type for the instances of an entity. */
+    using const_iterator = const Type *;
+
+    /**
+     * @brief Returns the number of instances in use.
+     * @return Number of instances assigned to the entities.
+     */
+    [[nodiscard]] size_type count() const ENTT_NOEXCEPT {
+        return instances.size() - waste;
+    }
+
+    /**
+     * @brief Returns the number of instances assigned to an entity.
+     * @param entt A valid entity identifier.
+     * @return Number of instances assigned to the entity, if any.
+     */
+    [[nodiscard]] size_type count(const entity_type entt) const {
+        return this->contains(entt) ? groups[this->index(entt)].count : size_type{};
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+        stats.instances = instances.capacity();
+        stats.instance_bytes = instances.capacity() * sizeof(value_type) + groups.capacity() * sizeof(group_data);
+        return stats;
+    }
+
+    /**
+     * @brief Returns the range of instances assigned to an entity.
+     * @param entt A valid entity identifier.
+     * @return A pair of iterators that delimit the instances of the entity,
+     * empty if the entity doesn't belong to the storage.
+     */
+    [[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const entity_type entt) const {
+        if(this->contains(entt)) {
+            const auto &group = groups[this->index(entt)];
+            return { instances.data() + group.offset, instances.data() + group.offset + group.count };
+        }
+
+        return { instances.data() + instances.size(), instances.data() + instances.size() };
+    }
+
+    /*! @copydoc equal_range */
+    [[nodiscard]] std::pair<iterator, iterator> equal_range(const entity_type entt) {
+        const auto [first, last] = std::as_const(*this).equal_range(entt);
+        return { const_cast<iterator>(first), const_cast<iterator>(last) };
+    }
+
+    /**
+     * @brief Assigns a new instance to an entity.
+     *
+     * The entity is assigned to the storage if it doesn't belong to it yet.
+     * Otherwise, the new instance is appended to those of the entity.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return The object associated with the entity.
+     */
+    template<typename... Args>
+    value_type & emplace(const entity_type entt, Args &&... args) {
+        if(waste > instances.size() / 2u) {
+            compact();
+        }
+
+        if(!this->contains(entt)) {
+            underlying_type::emplace(entt);
+            groups.push_back(group_data{instances.size(), 0u});
+        }
+
+        auto &&group = groups[this->index(entt)];
+
+        if(group.offset + group.count != instances.size()) {
+            // moves the group at the end of the array, the slots left behind are wasted
+            const auto offset = instances.size();
+            instances.reserve(offset + group.count + 1u);
+
+            for(auto pos = group.offset, last = group.offset + group.count; pos < last; ++pos) {
+                instances.push_back(std::move(instances[pos]));
+            }
+
+            waste += group.count;
+            group.offset = offset;
+        }
+
+        if constexpr(std::is_aggregate_v<value_type>) {
+            instances.push_back(Type{std::forward<Args>(args)...});
+        } else {
+            instances.emplace_back(std::forward<Args>(args)...);
+        }
+
+        ++group.count;
+        return instances.back();
+    }
+
+    /**
+     * @brief Removes an instance from an entity.
+     *
+     * The last instance of the entity takes the place of the one removed. The
+     * entity is also removed from the storage if it has no instances left.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage or an
+     * invalid position results in undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @param pos The position of the instance within those of the entity.
+     */
+    void erase(const entity_type entt, const size_type pos) {
+        ENTT_ASSERT(pos < count(entt));
+        auto &&group = groups[this->index(entt)];
+        const auto last = group.offset + group.count - 1u;
+
+        if(group.offset + pos != last) {
+            instances[group.offset + pos] = std::move(instances[last]);
+        }
+
+        if(--group.count; last + 1u == instances.size()) {
+            instances.pop_back();
+        } else {
+            ++waste;
+        }
+
+        if(!group.count) {
+            underlying_type::remove(entt);
+        }
+    }
+
+    /**
+     * @brief Reclaims the slots left behind by the groups moved or removed.
+     *
+     * Groups are laid out in iteration order, the same order in which `each`
+     * returns them.
+     */
+    void compact() {
+        std::vector<value_type> other{};
+        other.reserve(instances.size() - waste);
+
+        for(auto pos = groups.size(); pos; --pos) {
+            auto &&group = groups[pos - 1u];
+            const auto offset = other.size();
+
+            for(size_type next{}; next < group.count; ++next) {
+                other.push_back(std::move(instances[group.offset + next]));
+            }
+
+            group.offset = offset;
+        }
+
+        instances.swap(other);
+        waste = {};
+    }
+
+    /**
+     * @brief Iterates entities and instances and applies the given function
+     * object to them.
+     *
+     * The function object is invoked once for each instance, along with the
+     * entity it's assigned to. The signature of the function should be
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        for(auto pos = groups.size(); pos; --pos) {
+            const auto entt = this->data()[pos - 1u];
+
+            for(auto [first, last] = equal_range(entt); first != last; ++first) {
+                func(entt, *first);
+            }
+        }
+    }
+
+private:
+    std::vector<group_data> groups{};
+    std::vector<value_type> instances{};
+    size_type waste{};
+};
+
+
+}
+
+
+#endif
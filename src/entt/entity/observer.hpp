@@ -2,11 +2,17 @@
 #define ENTT_ENTITY_OBSERVER_HPP
 
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 #include <type_traits>
+#include <vector>
 #include "../config/config.h"
 #include "../core/type_traits.hpp"
 #include "../signal/delegate.hpp"
@@ -180,19 +186,13 @@ class basic_observer {
         template<std::size_t Index>
         static void maybe_valid_if(basic_observer &obs, basic_registry<Entity> &reg, const Entity entt) {
             if(reg.template has<Require...>(entt) && !reg.template any<Reject...>(entt)) {
-                if(!obs.view.contains(entt)) {
-                    obs.view.emplace(entt);
-                }
-
-                obs.view.get(entt) |= (1 << Index);
+                obs.record(entt, payload_type{1u} << Index, true);
             }
         }
 
         template<std::size_t Index>
         static void discard_if(basic_observer &obs, basic_registry<Entity> &, const Entity entt) {
-            if(obs.view.contains(entt) && !(obs.view.get(entt) &= (~(1 << Index)))) {
-                obs.view.remove(entt);
-            }
+            obs.record(entt, payload_type{1u} << Index, false);
         }
 
         template<std::size_t Index>
@@ -223,19 +223,13 @@ class basic_observer {
                 }
             }())
             {
-                if(!obs.view.contains(entt)) {
-                    obs.view.emplace(entt);
-                }
-
-                obs.view.get(entt) |= (1 << Index);
+                obs.record(entt, payload_type{1u} << Index, true);
             }
         }
 
         template<std::size_t Index>
         static void discard_if(basic_observer &obs, basic_registry<Entity> &, const Entity entt) {
-            if(obs.view.contains(entt) && !(obs.view.get(entt) &= (~(1 << Index)))) {
-                obs.view.remove(entt);
-            }
+            obs.record(entt, payload_type{1u} << Index, false);
         }
 
         template<std::size_t Index>
@@ -258,6 +252,64 @@ class basic_observer {
         }
     };
 
+    struct record_type {
+        Entity entt;
+        payload_type bit;
+        bool valid;
+    };
+
+    void apply(const Entity entt, const payload_type bit, const bool valid) const {
+        if(valid) {
+            if(!view.contains(entt)) {
+                view.emplace(entt);
+            }
+
+            view.get(entt) |= bit;
+        } else if(view.contains(entt) && !(view.get(entt) &= ~bit)) {
+            view.remove(entt);
+        }
+    }
+
+    [[nodiscard]] std::vector<record_type> & buffer() {
+        static thread_local std::pair<std::size_t, std::vector<record_type> *> cache{};
+
+        if(cache.first != serial) {
+            // slow path, taken the first time a thread records for an observer
+            std::lock_guard lock{mutex};
+            const auto id = std::this_thread::get_id();
+            auto it = std::find_if(buffers.begin(), buffers.end(), [id](const auto &elem) { return elem.first == id; });
+
+            if(it == buffers.end()) {
+                it = buffers.emplace(buffers.end(), id, std::make_unique<std::vector<record_type>>());
+            }
+
+            cache = { serial, it->second.get() };
+        }
+
+        return *cache.second;
+    }
+
+    void record(const Entity entt, const payload_type bit, const bool valid) {
+        if(serial && valid) {
+            buffer().push_back({entt, bit, valid});
+        } else {
+            // discards come from structural changes only, all the matches recorded so far go first
+            flush();
+            apply(entt, bit, valid);
+        }
+    }
+
+    void flush() const {
+        // records of a thread are applied in order, no matter how many there are
+        for(auto &&elem: buffers) {
+            for(auto &&curr: *elem.second) {
+                apply(curr.entt, curr.bit, curr.valid);
+            }
+
+            elem.second->clear();
+        }
+    }
+
     template<typename... Matcher>
     static void disconnect(basic_registry<Entity> &reg, basic_observer &obs) {
         (matcher_handler<Matcher>::disconnect(obs, reg), ...);
@@ -281,7 +333,10 @@ public:
     /*! @brief Default constructor. */
     basic_observer()
         : release{},
-          view{}
+          view{},
+          serial{},
+          mutex{},
+          buffers{}
     {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
@@ -325,9 +380,45 @@ public:
     void connect(basic_registry<entity_type> &reg, basic_collector<Matcher...>) {
         disconnect();
         connect<Matcher...>(reg, std::index_sequence_for<Matcher...>{});
+
+        for(auto &&elem: buffers) {
+            elem.second->clear();
+        }
+
         view.clear();
     }
 
+    /**
+     * @brief Enables or disables the concurrent mode of an observer.
+     *
+     * In concurrent mode, matches are recorded in a buffer per thread rather
+     * than in the observer itself. Therefore, components can be patched from
+     * multiple threads at once, as long as the observer isn't accessed in the
+     * meantime. Buffers are merged into the observer and duplicates are
+     * discarded as soon as it's accessed again or an entity no longer matches
+     * its requirements.
+     *
+     * @warning
+     * Only signals that are emitted concurrently are safe, that is, those of
+     * functions such as `patch` or `replace`. Creating or destroying components
+     * from multiple threads at once is still undefined behavior.
+     *
+     * @param value True to enable the concurrent mode, false otherwise.
+     */
+    void concurrent(const bool value) {
+        flush();
+        buffers.clear();
+        serial = value ? ++counter : size_type{};
+    }
+
+    /**
+     * @brief Checks whether the concurrent mode is enabled.
+     * @return True if the concurrent mode is enabled, false otherwise.
+     */
+    [[nodiscard]] bool concurrent() const ENTT_NOEXCEPT {
+        return (serial != size_type{});
+    }
+
     /*! @brief Disconnects an observer from the registry it keeps track of. */
     void disconnect() {
         if(release) {
@@ -340,7 +431,8 @@ public:
      * @brief Returns the number of elements in an observer.
      * @return Number of elements.
      */
-    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+    [[nodiscard]] size_type size() const {
+        flush();
         return view.size();
     }
 
@@ -348,7 +440,8 @@ public:
      * @brief Checks whether an observer is empty.
      * @return True if the observer is empty, false otherwise.
      */
-    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+    [[nodiscard]] bool empty() const {
+        flush();
         return view.empty();
     }
 
@@ -364,7 +457,8 @@ public:
      *
      * @return A pointer to the array of entities.
      */
-    [[nodiscard]] const entity_type * data() const ENTT_NOEXCEPT {
+    [[nodiscard]] const entity_type * data() const {
+        flush();
         return view.data();
     }
 
@@ -376,7 +470,8 @@ public:
      *
      * @return An iterator to the first entity of the observer.
      */
-    [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+    [[nodiscard]] iterator begin() const {
+        flush();
         return view.basic_sparse_set<entity_type>::begin();
     }
 
@@ -390,32 +485,83 @@ public:
      * @return An iterator to the entity following the last entity of the
      * observer.
      */
-    [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+    [[nodiscard]] iterator end() const {
+        flush();
         return view.basic_sparse_set<entity_type>::end();
     }
 
-    /*! @brief Clears the underlying container. */
-    void clear() ENTT_NOEXCEPT {
-        view.clear();
+    /*! @brief Clears the underlying container and keeps its memory. */
+    void clear() {
+        flush();
+        view.reset();
+    }
+
+    /**
+     * @brief Sorts the entities of an observer according to their order in a
+     * range.
+     *
+     * Entities that are also part of the range are returned in the same order
+     * they have in it when iterating the observer. All the other entities are
+     * returned last and there are no guarantees on their order.<br/>
+     * As an example, sorting an observer as the view of a component allows to
+     * access the components of the observed entities linearly.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void sort_as(It first, It last) {
+        flush();
+
+        for(auto pos = view.size(); pos && first != last; ++first) {
+            if(const auto entt = *first; view.contains(entt)) {
+                if(const auto other = view.data()[--pos]; other != entt) {
+                    view.swap(other, entt);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Sorts the entities of an observer according to their order in a
+     * sparse set.
+     *
+     * @sa sort_as
+     *
+     * @param other The sparse set that imposes the order of the entities.
+     */
+    void sort_as(const basic_sparse_set<entity_type> &other) {
+        sort_as(other.begin(), other.end());
     }
 
     /**
      * @brief Iterates entities and applies the given function object to them.
      *
-     * The function object is invoked for each entity.<br/>
-     * The signature of the function must be equivalent to the following form:
+     * The function object is invoked either for each entity or once for the
+     * whole range of entities.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
      *
      * @code{.cpp}
      * void(const entity_type);
+     * void(const entity_type *, const size_type);
      * @endcode
      *
+     * In the second case, the function object is provided with the same range
+     * returned by `data` and `size`, whether the observer is empty or not.
+     *
      * @tparam Func Type of the function object to invoke.
      * @param func A valid function object.
      */
     template<typename Func>
     void each(Func func) const {
-        for(const auto entity: *this) {
-            func(entity);
+        if constexpr(std::is_invocable_v<Func, const entity_type *, size_type>) {
+            func(data(), size());
+        } else {
+            for(const auto entity: *this) {
+                func(entity);
+            }
         }
     }
 
@@ -423,6 +569,9 @@ public:
      * @brief Iterates entities and applies the given function object to them,
      * then clears the observer.
      *
+     * The observer is cleared all at once after the function object returns,
+     * rather than entity by entity.
+     *
      * @sa each
      *
      * @tparam Func Type of the function object to invoke.
@@ -435,8 +584,12 @@ public:
     }
 
 private:
+    inline static std::atomic<size_type> counter{};
     delegate<void(basic_observer &)> release;
-    basic_storage<entity_type, payload_type> view;
+    mutable basic_storage<entity_type, payload_type> view;
+    size_type serial;
+    std::mutex mutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<std::vector<record_type>>>> buffers;
 };
 
 
@@ -10,6 +10,7 @@
 #include <vector>
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "command_buffer.hpp"
 #include "fwd.hpp"
 #include "helper.hpp"
 
@@ -133,6 +134,8 @@ class basic_organizer final {
         dependency_type *dependency;
         prepare_type *prepare{};
         type_info info{};
+        std::size_t cost{};
+        bool main_thread{};
     };
 
     template<typename Type>
@@ -163,81 +166,64 @@ class basic_organizer final {
         }
     }
 
-    template<typename... RO, typename... RW>
-    void track_dependencies(std::size_t index, const bool requires_registry, type_list<RO...>, type_list<RW...>) {
-        dependencies[type_hash<basic_registry<Entity>>::value()].emplace_back(index, requires_registry && (sizeof...(RO) + sizeof...(RW) == 0u));
-        (dependencies[type_hash<RO>::value()].emplace_back(index, false), ...);
-        (dependencies[type_hash<RW>::value()].emplace_back(index, true), ...);
-    }
+    void link(std::vector<std::size_t> &candidates, const std::size_t index, const id_type type, const bool rw) {
+        auto &&deps = dependencies[type];
+        const auto last = std::find_if(deps.crbegin(), deps.crend(), [](const auto &elem) { return elem.second; });
 
-    [[nodiscard]] std::vector<bool> adjacency_matrix() {
-        const auto length = vertices.size();
-        std::vector<bool> edges(length * length, false);
-
-        // creates the ajacency matrix
-        for(const auto &deps: dependencies) {
-            const auto last = deps.second.cend();
-            auto it = deps.second.cbegin();
-
-            while(it != last) {
-                if(it->second) {
-                    // rw item
-                    if(auto curr = it++; it != last) {
-                        if(it->second) {
-                            edges[curr->first * length + it->first] = true;
-                        } else {
-                            if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
-                                for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
-                                    edges[it->first * length + next->first] = true;
-                                }
-                            } else {
-                                for(; it != next; ++it) {
-                                    edges[curr->first * length + it->first] = true;
-                                }
-                            }
-                        }
-                    }
-                } else {
-                    // ro item, possibly only on first iteration
-                    if(const auto next = std::find_if(it, last, [](const auto &elem) { return elem.second; }); next != last) {
-                        for(; it != next; ++it) {
-                            edges[it->first * length + next->first] = true;
-                        }
-                    } else {
-                        it = last;
-                    }
-                }
+        if(rw && last != deps.crbegin()) {
+            // rw item, it waits for all the ro items after the last rw one
+            for(auto it = deps.crbegin(); it != last; ++it) {
+                candidates.push_back(it->first);
             }
+        } else if(last != deps.crend()) {
+            // it waits for the last rw item
+            candidates.push_back(last->first);
         }
 
-        // computes the transitive closure
-        for(std::size_t vk{}; vk < length; ++vk) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                for(std::size_t vj{}; vj < length; ++vj) {
-                    edges[vi * length + vj] = edges[vi * length + vj] || (edges[vi * length + vk] && edges[vk * length + vj]);
-                }
-            }
+        deps.emplace_back(index, rw);
+    }
+
+    void reduce(const std::size_t index, std::vector<std::size_t> candidates) {
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        candidates.erase(std::remove(candidates.begin(), candidates.end(), index), candidates.end());
+
+        // candidates that precede other candidates are only reachable through them
+        std::vector<bool> visited(index, false);
+        std::vector<std::size_t> stack{};
+
+        for(const auto curr: candidates) {
+            stack.insert(stack.end(), parents[curr].cbegin(), parents[curr].cend());
         }
 
-        // applies the transitive reduction
-        for(std::size_t vert{}; vert < length; ++vert) {
-            edges[vert * length + vert] = false;
+        while(!stack.empty()) {
+            const auto curr = stack.back();
+            stack.pop_back();
+
+            if(!visited[curr]) {
+                visited[curr] = true;
+                stack.insert(stack.end(), parents[curr].cbegin(), parents[curr].cend());
+            }
         }
 
-        for(std::size_t vj{}; vj < length; ++vj) {
-            for(std::size_t vi{}; vi < length; ++vi) {
-                if(edges[vi * length + vj]) {
-                    for(std::size_t vk{}; vk < length; ++vk) {
-                        if(edges[vj * length + vk]) {
-                            edges[vi * length + vk] = false;
-                        }
-                    }
-                }
+        parents.emplace_back();
+        children.emplace_back();
+
+        for(const auto curr: candidates) {
+            if(!visited[curr]) {
+                parents[index].push_back(curr);
+                children[curr].push_back(index);
             }
         }
+    }
 
-        return edges;
+    template<typename... RO, typename... RW>
+    void track_dependencies(std::size_t index, const bool requires_registry, type_list<RO...>, type_list<RW...>) {
+        std::vector<std::size_t> candidates{};
+        link(candidates, index, type_hash<basic_registry<Entity>>::value(), requires_registry && (sizeof...(RO) + sizeof...(RW) == 0u));
+        (link(candidates, index, type_hash<RO>::value(), false), ...);
+        (link(candidates, index, type_hash<RW>::value(), true), ...);
+        reduce(index, std::move(candidates));
     }
 
 public:
@@ -340,6 +326,23 @@ public:
             return node.payload;
         }
 
+        /**
+         * @brief Returns the cost hint associated with a vertex, if any.
+         * @return The cost hint associated with the vertex, if any.
+         */
+        size_type cost() const ENTT_NOEXCEPT {
+            return node.cost;
+        }
+
+        /**
+         * @brief Checks if a vertex must run on the main thread.
+         * @return True if the vertex must run on the main thread, false
+         * otherwise.
+         */
+        bool main_thread() const ENTT_NOEXCEPT {
+            return node.main_thread;
+        }
+
         /**
          * @brief Returns the list of nodes reachable from a given vertex.
          * @return The list of nodes reachable from the vertex.
@@ -379,6 +382,7 @@ public:
         };
 
         track_dependencies(vertices.size(), requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
+        deferred = deferred || type_list_contains_v<typename resource_type::args, basic_command_buffer<entity_type>>;
 
         vertices.push_back({
             resource_type::ro::size,
@@ -412,6 +416,7 @@ public:
         };
 
         track_dependencies(vertices.size(), requires_registry, typename resource_type::ro{}, typename resource_type::rw{});
+        deferred = deferred || type_list_contains_v<typename resource_type::args, basic_command_buffer<entity_type>>;
 
         vertices.push_back({
             resource_type::ro::size,
@@ -456,33 +461,87 @@ public:
         });
     }
 
+    /**
+     * @brief Adds a synchronization point to the task list.
+     *
+     * A synchronization point runs after all the tasks added before it and
+     * before all the tasks added after it. It plays back the command buffer in
+     * the context of the registry, so that the structural changes recorded by
+     * the tasks of a phase are applied once and in bulk.<br/>
+     * Tasks record their changes by taking a reference to a command buffer
+     * rather than to the registry. Therefore, they don't need to be serialized
+     * with all the other tasks that use the registry.
+     *
+     * @param name Optional name to associate with the task.
+     */
+    void sync(const char *name = nullptr) {
+        track_dependencies(vertices.size(), true, type_list<>{}, type_list<>{});
+        deferred = false;
+
+        vertices.push_back({
+            0u,
+            0u,
+            name,
+            nullptr,
+            +[](const void *, basic_registry<entity_type> &reg) {
+                if(auto *buffer = reg.template try_ctx<basic_command_buffer<entity_type>>(); buffer) {
+                    buffer->apply(reg);
+                }
+            },
+            +[](const bool, type_info *, const std::size_t) { return size_type{}; },
+            +[](basic_registry<entity_type> &reg) {
+                void(reg.template ctx_or_set<basic_command_buffer<entity_type>>());
+            },
+            type_id<basic_command_buffer<entity_type>>()
+        });
+    }
+
+    /**
+     * @brief Attaches scheduling hints to the last task added.
+     *
+     * Hints don't affect the graph. Executors can use the cost to merge cheap
+     * tasks into coarser ones and the affinity to run tasks that access
+     * resources bound to a thread, such as rendering or system calls, on the
+     * main thread.
+     *
+     * @warning
+     * Attempting to attach hints to an empty task list results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in this
+     * case.
+     *
+     * @param cost Declared or measured cost of the task, null if unknown.
+     * @param main_thread True if the task must run on the main thread, false
+     * otherwise.
+     */
+    void hint(const size_type cost, const bool main_thread = false) {
+        ENTT_ASSERT(!vertices.empty());
+        vertices.back().cost = cost;
+        vertices.back().main_thread = main_thread;
+    }
+
     /**
      * @brief Generates a task graph for the current content.
+     *
+     * Edges are computed incrementally whenever a task is added, therefore
+     * generating a graph only copies them.<br/>
+     * A synchronization point is appended to the task list if there are tasks
+     * that record commands after the last one, if any.
+     *
+     * @sa sync
+     *
      * @return The adjacency list of the task graph.
      */
     std::vector<vertex> graph() {
-        const auto edges = adjacency_matrix();
+        if(deferred) {
+            sync();
+        }
 
-        // creates the adjacency list
         std::vector<vertex> adjacency_list{};
         adjacency_list.reserve(vertices.size());
 
-        for(std::size_t col{}, length = vertices.size(); col < length; ++col) {
-            std::vector<std::size_t> reachable{};
-            const auto row = col * length;
-            bool is_top_level = true;
-
-            for(std::size_t next{}; next < length; ++next) {
-                if(edges[row + next]) {
-                    reachable.push_back(next);
-                }
-            }
-
-            for(std::size_t next{}; next < length && is_top_level; ++next) {
-                is_top_level = !edges[next * length + col];
-            }
-
-            adjacency_list.emplace_back(is_top_level, vertices[col], std::move(reachable));
+        for(std::size_t pos{}, length = vertices.size(); pos < length; ++pos) {
+            adjacency_list.emplace_back(parents[pos].empty(), vertices[pos], children[pos]);
         }
 
         return adjacency_list;
@@ -492,11 +551,17 @@ public:
     void clear() {
         dependencies.clear();
         vertices.clear();
+        parents.clear();
+        children.clear();
+        deferred = false;
     }
 
 private:
     std::unordered_map<entt::id_type, std::vector<std::pair<std::size_t, bool>>> dependencies;
     std::vector<vertex_data> vertices;
+    std::vector<std::vector<std::size_t>> parents;
+    std::vector<std::vector<std::size_t>> children;
+    bool deferred{};
 };
 
 
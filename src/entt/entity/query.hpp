@@ -0,0 +1,137 @@
+#ifndef ENTT_ENTITY_QUERY_HPP
+#define ENTT_ENTITY_QUERY_HPP
+
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+#include "utility.hpp"
+#include "view.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Persistent view meant to be stored aside and reused over time.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error, but for a few reasonable cases.
+ */
+template<typename...>
+class basic_query;
+
+
+/**
+ * @brief Persistent view meant to be stored aside and reused over time.
+ *
+ * A query looks up its pools once, when it's constructed, rather than every
+ * time a view is requested to the registry. It also keeps track of the sizes
+ * the pools had when the pool that drives the iterations was last picked and
+ * picks it again only when any of them doubled or halved in the meantime.<br/>
+ * Systems that run every frame can then keep a query instead of creating the
+ * same view over and over.
+ *
+ * @note
+ * Pools are never destroyed by a registry, not even when it's cleared.
+ * Therefore, a query is valid as long as its registry is alive. Clearing the
+ * registry shrinks the pools and the pool that drives the iterations is picked
+ * again on the next access.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Exclude Types of components used to filter the query.
+ * @tparam Component Types of components iterated by the query.
+ */
+template<typename Entity, typename... Exclude, typename... Component>
+class basic_query<Entity, exclude_t<Exclude...>, Component...> {
+    static_assert(sizeof...(Component) != 0, "Exclusion-only queries are not supported");
+
+    using sizes_type = std::array<std::size_t, sizeof...(Component)>;
+
+    [[nodiscard]] sizes_type sizes_of() const ENTT_NOEXCEPT {
+        sizes_type curr{};
+
+        for(std::size_t pos{}; pos < curr.size(); ++pos) {
+            curr[pos] = pools[pos]->size();
+        }
+
+        return curr;
+    }
+
+    [[nodiscard]] bool changed(const sizes_type &curr) const ENTT_NOEXCEPT {
+        for(std::size_t pos{}; pos < curr.size(); ++pos) {
+            if(curr[pos] > 2u * sizes[pos] || 2u * curr[pos] < sizes[pos]) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of view returned by the query. */
+    using view_type = decltype(std::declval<basic_registry<Entity> &>().template view<Component...>(exclude_t<Exclude...>{}));
+
+    /**
+     * @brief Constructs a query for a given registry.
+     * @param ref A valid reference to a registry.
+     */
+    explicit basic_query(basic_registry<Entity> &ref)
+        : steady{ref.template view<Component...>(exclude_t<Exclude...>{})},
+          pools{&ref.template view<Component>().storage()...},
+          sizes{}
+    {
+        sizes = sizes_of();
+    }
+
+    /**
+     * @brief Returns the view of a query.
+     *
+     * The pool that drives the iterations is picked again first, if the sizes
+     * of the pools changed significantly since the last time.
+     *
+     * @return A reference to the view of the query.
+     */
+    [[nodiscard]] const view_type & view() const ENTT_NOEXCEPT {
+        if constexpr(sizeof...(Component) > 1u) {
+            if(const auto curr = sizes_of(); changed(curr)) {
+                steady.refresh();
+                sizes = curr;
+            }
+        }
+
+        return steady;
+    }
+
+    /*! @copydoc view */
+    [[nodiscard]] const view_type & operator*() const ENTT_NOEXCEPT {
+        return view();
+    }
+
+    /**
+     * @brief Returns a pointer to the view of a query.
+     * @return A pointer to the view of the query.
+     */
+    [[nodiscard]] const view_type * operator->() const ENTT_NOEXCEPT {
+        return &view();
+    }
+
+private:
+    view_type steady;
+    std::array<const basic_sparse_set<Entity> *, sizeof...(Component)> pools;
+    mutable sizes_type sizes;
+};
+
+
+}
+
+
+#endif
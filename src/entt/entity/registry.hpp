@@ -3,9 +3,15 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -15,9 +21,11 @@
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "../signal/sigh.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "group.hpp"
+#include "runtime_storage.hpp"
 #include "runtime_view.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -28,6 +36,48 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+[[nodiscard]] inline std::size_t countr_zero(std::uint64_t word) ENTT_NOEXCEPT {
+    ENTT_ASSERT(word);
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+    std::size_t count{};
+    for(; !(word & 1u); word >>= 1u, ++count);
+    return count;
+#endif
+}
+
+
+[[nodiscard]] inline std::size_t highest_bit(std::uint64_t word) ENTT_NOEXCEPT {
+    ENTT_ASSERT(word);
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(63 - __builtin_clzll(word));
+#else
+    std::size_t count{};
+    for(; word >>= 1u; ++count);
+    return count;
+#endif
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief Fast and reliable entity-component system.
  *
@@ -40,15 +90,40 @@ namespace entt {
  */
 template<typename Entity>
 class basic_registry {
+    /*! @brief A meta view is allowed to access the pools directly. */
+    friend class basic_meta_view<Entity>;
+
+    /*! @brief Exclusion-only views skip the identifiers not in use. */
+    template<typename...>
+    friend class basic_view;
+
     using traits_type = entt_traits<Entity>;
 
     template<typename Component>
     using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Component>>::storage_type, Component>;
 
+    struct pool_vtable {
+        void(* remove)(basic_sparse_set<Entity> &, basic_registry &, const Entity *, const Entity *);
+        void *(* raw)(basic_sparse_set<Entity> &);
+        void(* transfer)(basic_sparse_set<Entity> &, basic_registry &, const Entity *, const Entity *, const Entity *);
+        bool(* track)(basic_sparse_set<Entity> &, const bool);
+        void(* clone)(basic_sparse_set<Entity> &, basic_registry &, const Entity, const Entity *, const Entity *);
+        void(* merge)(basic_sparse_set<Entity> &, basic_registry &, const Entity *, const bool);
+    };
+
     struct pool_data {
         type_info info{};
         std::unique_ptr<basic_sparse_set<Entity>> pool{};
-        void(* remove)(basic_sparse_set<Entity> &, basic_registry &, const Entity *, const Entity *){};
+        const pool_vtable *vtable{};
+    };
+
+    using word_type = std::uint64_t;
+
+    static constexpr auto word_digits = std::numeric_limits<word_type>::digits;
+
+    struct signature_data {
+        std::vector<word_type> words{};
+        word_type untracked{};
     };
 
     template<typename...>
@@ -58,36 +133,115 @@ class basic_registry {
     struct group_handler<exclude_t<Exclude...>, get_t<Get...>, Owned...> {
         static_assert(std::conjunction_v<std::is_same<Owned, std::decay_t<Owned>>..., std::is_same<Get, std::decay_t<Get>>..., std::is_same<Exclude, std::decay_t<Exclude>>...>, "One or more component types are invalid");
         std::conditional_t<sizeof...(Owned) == 0, basic_sparse_set<Entity>, std::size_t> current{};
+        std::conditional_t<sizeof...(Owned) == 0, std::tuple<storage_type<Get> *..., storage_type<Exclude> *...>, std::tuple<>> lazy{};
+        // zero if empty, one if being filled and two if ready to use
+        std::atomic<int> state{};
 
-        template<typename Component>
-        void maybe_valid_if(basic_registry &owner, const Entity entt) {
-            [[maybe_unused]] const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...);
+        [[nodiscard]] bool ready() const ENTT_NOEXCEPT {
+            return state.load(std::memory_order_acquire) == 2;
+        }
 
-            const auto is_valid = ((std::is_same_v<Component, Owned> || std::get<storage_type<Owned> &>(cpools).contains(entt)) && ...)
-                    && ((std::is_same_v<Component, Get> || owner.assure<Get>().contains(entt)) && ...)
-                    && ((std::is_same_v<Component, Exclude> || !owner.assure<Exclude>().contains(entt)) && ...);
+        void populate() {
+            // const groups can be used from multiple threads at once, only one of them fills the group
+            if(int expected{}; !ready() && state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+                // non-owning groups are filled only the first time they are used
+                const basic_sparse_set<Entity> *candidate = (std::min)({ static_cast<const basic_sparse_set<Entity> *>(std::get<storage_type<Get> *>(lazy))... }, [](const auto *lhs, const auto *rhs) {
+                    return lhs->size() < rhs->size();
+                });
 
-            if constexpr(sizeof...(Owned) == 0) {
-                if(is_valid && !current.contains(entt)) {
-                    current.emplace(entt);
+                // packed order is preserved so that entities are returned as if they were added one at a time
+                for(std::size_t pos{}, last = candidate->size(); pos < last; ++pos) {
+                    if(const auto entt = candidate->data()[pos]; (std::get<storage_type<Get> *>(lazy)->contains(entt) && ...) && (!std::get<storage_type<Exclude> *>(lazy)->contains(entt) && ...)) {
+                        current.emplace(entt);
+                    }
                 }
+
+                state.store(2, std::memory_order_release);
             } else {
-                if(is_valid && !(std::get<0>(cpools).index(entt) < current)) {
-                    const auto pos = current++;
-                    (std::get<storage_type<Owned> &>(cpools).swap(std::get<storage_type<Owned> &>(cpools).data()[pos], entt), ...);
+                while(!ready()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        template<typename Component>
+        void maybe_valid_if(basic_registry &owner, const Entity *first, const Entity *last) {
+            if constexpr(sizeof...(Owned) == 0) {
+                if(!ready()) {
+                    return;
+                }
+            }
+
+            [[maybe_unused]] const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...);
+            [[maybe_unused]] const auto gpools = std::forward_as_tuple(owner.assure<Get>()...);
+            [[maybe_unused]] const auto epools = std::forward_as_tuple(owner.assure<Exclude>()...);
+
+            for(; first != last; ++first) {
+                const auto entt = *first;
+
+                const auto is_valid = ((std::is_same_v<Component, Owned> || std::get<storage_type<Owned> &>(cpools).contains(entt)) && ...)
+                        && ((std::is_same_v<Component, Get> || std::get<storage_type<Get> &>(gpools).contains(entt)) && ...)
+                        && ((std::is_same_v<Component, Exclude> || !std::get<storage_type<Exclude> &>(epools).contains(entt)) && ...);
+
+                if constexpr(sizeof...(Owned) == 0) {
+                    if(is_valid && !current.contains(entt)) {
+                        current.emplace(entt);
+                    }
+                } else {
+                    if(is_valid && !(std::get<0>(cpools).index(entt) < current)) {
+                        const auto pos = current++;
+                        // entities appended in bulk are often already in place, no need to swap them
+                        ((std::get<storage_type<Owned> &>(cpools).data()[pos] == entt ? void() : std::get<storage_type<Owned> &>(cpools).swap(std::get<storage_type<Owned> &>(cpools).data()[pos], entt)), ...);
+                    }
+                }
+            }
+        }
+
+        void partition(basic_registry &owner) {
+            const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...);
+            [[maybe_unused]] const auto gpools = std::forward_as_tuple(owner.assure<Get>()...);
+            [[maybe_unused]] const auto epools = std::forward_as_tuple(owner.assure<Exclude>()...);
+            const auto &lead = std::get<0>(cpools);
+
+            const auto is_valid = [&](const auto entt) {
+                return (std::get<storage_type<Owned> &>(cpools).contains(entt) && ...)
+                        && (std::get<storage_type<Get> &>(gpools).contains(entt) && ...)
+                        && (!std::get<storage_type<Exclude> &>(epools).contains(entt) && ...);
+            };
+
+            // valid entities at the front stay where they are, those at the back replace the invalid ones
+            for(auto last = lead.size(); current < last; ++current) {
+                auto entt = lead.data()[current];
+
+                if(!is_valid(entt)) {
+                    while(--last > current && !is_valid(lead.data()[last]));
+
+                    if(last == current) {
+                        break;
+                    }
+
+                    entt = lead.data()[last];
                 }
+
+                ((std::get<storage_type<Owned> &>(cpools).data()[current] == entt ? void() : std::get<storage_type<Owned> &>(cpools).swap(std::get<storage_type<Owned> &>(cpools).data()[current], entt)), ...);
             }
         }
 
-        void discard_if([[maybe_unused]] basic_registry &owner, const Entity entt) {
+        void discard_if([[maybe_unused]] basic_registry &owner, const Entity *first, const Entity *last) {
             if constexpr(sizeof...(Owned) == 0) {
-                if(current.contains(entt)) {
-                    current.remove(entt);
+                for(; ready() && first != last; ++first) {
+                    if(current.contains(*first)) {
+                        current.remove(*first);
+                    }
                 }
             } else {
-                if(const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...); std::get<0>(cpools).contains(entt) && (std::get<0>(cpools).index(entt) < current)) {
-                    const auto pos = --current;
-                    (std::get<storage_type<Owned> &>(cpools).swap(std::get<storage_type<Owned> &>(cpools).data()[pos], entt), ...);
+                const auto cpools = std::forward_as_tuple(owner.assure<Owned>()...);
+
+                for(; first != last; ++first) {
+                    if(const auto entt = *first; std::get<0>(cpools).contains(entt) && (std::get<0>(cpools).index(entt) < current)) {
+                        const auto pos = --current;
+                        (std::get<storage_type<Owned> &>(cpools).swap(std::get<storage_type<Owned> &>(cpools).data()[pos], entt), ...);
+                    }
                 }
             }
         }
@@ -99,6 +253,9 @@ class basic_registry {
         bool (* owned)(const id_type) ENTT_NOEXCEPT;
         bool (* get)(const id_type) ENTT_NOEXCEPT;
         bool (* exclude)(const id_type) ENTT_NOEXCEPT;
+        void (* remap)(void *, const Entity *);
+        std::size_t (* length)(const void *) ENTT_NOEXCEPT;
+        void (* build)(void *);
     };
 
     struct variable_data {
@@ -107,47 +264,406 @@ class basic_registry {
     };
 
     template<typename Component>
-    [[nodiscard]] const storage_type<Component> & assure() const {
-        const auto index = type_seq<Component>::value();
+    [[nodiscard]] static auto raw(basic_sparse_set<Entity> &cpool, choice_t<1>)
+    -> decltype(static_cast<void *>(std::declval<storage_type<Component> &>().raw())) {
+        return static_cast<storage_type<Component> &>(cpool).raw();
+    }
 
-        if(!(index < pools.size())) {
-            pools.resize(size_type(index)+1u);
+    template<typename Component>
+    [[nodiscard]] static void * raw(basic_sparse_set<Entity> &, choice_t<0>) ENTT_NOEXCEPT {
+        return nullptr;
+    }
+
+    template<typename Component>
+    static auto track(basic_sparse_set<Entity> &cpool, const bool value, choice_t<1>)
+    -> decltype(std::declval<storage_type<Component> &>().on_construct_range(), bool{}) {
+        auto &&cstorage = static_cast<storage_type<Component> &>(cpool);
+
+        if(value) {
+            cstorage.on_construct_range().template connect<&basic_registry::signature_listener<Component, true>>();
+            cstorage.on_destroy_range().template connect<&basic_registry::signature_listener<Component, false>>();
+        } else {
+            cstorage.on_construct_range().template disconnect<&basic_registry::signature_listener<Component, true>>();
+            cstorage.on_destroy_range().template disconnect<&basic_registry::signature_listener<Component, false>>();
         }
 
-        if(auto &&pdata = pools[index]; !pdata.pool) {
-            pdata.info = type_id<Component>();
-            pdata.pool.reset(new storage_type<Component>());
-            pdata.remove = +[](basic_sparse_set<Entity> &cpool, basic_registry &owner, const Entity *first, const Entity *last) {
+        return true;
+    }
+
+    template<typename Component>
+    static bool track(basic_sparse_set<Entity> &, const bool, choice_t<0>) ENTT_NOEXCEPT {
+        // storage classes without signals are always scanned
+        return false;
+    }
+
+    template<typename Component, typename Storage, typename... Args>
+    static void quiet_insert(Storage &cstorage, basic_registry &owner, const Entity *first, const Entity *last, Args &&... args) {
+        // storage classes that don't use the default signal mixin cannot be silenced
+        cstorage.insert(owner, first, last, std::forward<Args>(args)...);
+    }
+
+    template<typename Component, typename Type, typename... Args>
+    static void quiet_insert(sigh_storage_mixin<Type> &cstorage, basic_registry &owner, const Entity *first, const Entity *last, Args &&... args) {
+        cstorage.Type::insert(owner, first, last, std::forward<Args>(args)...);
+
+        if(owner.caching) {
+            // signals are skipped but cached signatures must stay up to date
+            owner.assign_signature(owner.pool_index(type_seq<Component>::value()), first, last, true);
+        }
+    }
+
+    template<typename Component, bool Value>
+    static void signature_listener(basic_registry &owner, const Entity *first, const Entity *last) {
+        owner.assign_signature(owner.pool_index(type_seq<Component>::value()), first, last, Value);
+    }
+
+    void assign_signature(const std::size_t pos, const Entity *first, const Entity *last, const bool value) const {
+        const auto flag = word_type{1u} << (pos % word_digits);
+        auto &&words = signatures[pos / word_digits].words;
+
+        for(; first != last; ++first) {
+            const auto entt = std::size_t(to_integral(*first) & traits_type::entity_mask);
+
+            if(!(entt < words.size())) {
+                words.resize(entt + 1u);
+            }
+
+            words[entt] = value ? (words[entt] | flag) : (words[entt] & ~flag);
+        }
+    }
+
+    void track_pool(const std::size_t pos) const {
+        const auto &pdata = pools[pos];
+
+        if(const auto word = pos / word_digits; !(word < signatures.size())) {
+            signatures.resize(word + 1u);
+        }
+
+        if(pdata.vtable->track(*pdata.pool, true)) {
+            assign_signature(pos, pdata.pool->data(), pdata.pool->data() + pdata.pool->size(), true);
+        } else {
+            signatures[pos / word_digits].untracked |= word_type{1u} << (pos % word_digits);
+        }
+    }
+
+    template<typename Func>
+    void pools_of(const Entity entity, Func func) const {
+        if(caching) {
+            const auto entt = std::size_t(to_integral(entity) & traits_type::entity_mask);
+
+            // bits are visited from the last pool to the first one, as for a full scan
+            for(auto word = signatures.size(); word; --word) {
+                const auto &sdata = signatures[word - 1u];
+                auto candidates = sdata.untracked | (entt < sdata.words.size() ? sdata.words[entt] : word_type{});
+
+                for(auto bit = word_digits; candidates; --bit) {
+                    if(const auto flag = word_type{1u} << (bit - 1u); candidates & flag) {
+                        candidates ^= flag;
+
+                        if(const auto &pdata = pools[(word - 1u) * word_digits + bit - 1u]; pdata.pool && pdata.pool->contains(entity)) {
+                            func(pdata);
+                        }
+                    }
+                }
+            }
+        } else {
+            for(auto pos = pools.size(); pos; --pos) {
+                if(const auto &pdata = pools[pos-1]; pdata.pool && pdata.pool->contains(entity)) {
+                    func(pdata);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t pool_index(const id_type seq) const ENTT_NOEXCEPT {
+        if(const auto mask = lookup.size() - 1u; !lookup.empty()) {
+            // open addressing with linear probing, sequential identifiers rarely collide
+            for(auto slot = std::size_t{seq} & mask; lookup[slot]; slot = (slot + 1u) & mask) {
+                if(const auto pos = lookup[slot] - 1u; pools[pos].info.seq() == seq) {
+                    return pos;
+                }
+            }
+        }
+
+        return pools.size();
+    }
+
+    template<typename Pools, typename It, typename Out, std::size_t... Index>
+    static void gather_into(const Pools &cpools, It first, It last, Out out, std::index_sequence<Index...>) {
+        [[maybe_unused]] auto ahead = first;
+
+        if constexpr(ENTT_PREFETCH_DISTANCE != 0) {
+            for(std::size_t pos{}; pos < ENTT_PREFETCH_DISTANCE && ahead != last; ++pos, ++ahead) {
+                (std::get<Index>(cpools).prefetch(*ahead), ...);
+            }
+        }
+
+        for(; first != last; ++first) {
+            if constexpr(ENTT_PREFETCH_DISTANCE != 0) {
+                if(ahead != last) {
+                    (std::get<Index>(cpools).prefetch(*ahead), ...);
+                    ++ahead;
+                }
+            }
+
+            const auto entt = *first;
+            ((*std::get<Index>(out) = std::addressof(std::get<Index>(cpools).get(entt)), ++std::get<Index>(out)), ...);
+        }
+    }
+
+    [[nodiscard]] std::size_t var_index(const id_type seq) const ENTT_NOEXCEPT {
+        // context variables are indexed directly, zero means that the slot is empty
+        return (std::size_t{seq} < var_lookup.size() && var_lookup[seq]) ? (var_lookup[seq] - 1u) : vars.size();
+    }
+
+    void index_pool(const std::size_t pos) const {
+        const auto mask = lookup.size() - 1u;
+        auto slot = std::size_t{pools[pos].info.seq()} & mask;
+
+        while(lookup[slot]) {
+            slot = (slot + 1u) & mask;
+        }
+
+        lookup[slot] = static_cast<id_type>(pos + 1u);
+    }
+
+    pool_data & push_pool(const type_info info, std::unique_ptr<basic_sparse_set<Entity>> cpool) const {
+        const auto cap = pools.capacity();
+        pools.push_back(pool_data{info, std::move(cpool)});
+
+        if(pools.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::registry::assure", type_id<entity_type>().name(), pools.capacity() * sizeof(pool_data));
+        }
+
+        // the table is kept at most half full
+        if(lookup.size() < pools.size() * 2u) {
+            lookup.assign((std::max)(lookup.size() * 2u, std::size_t{8u}), id_type{});
+            ENTT_ALLOC_TRACE("entt::registry::assure", type_id<entity_type>().name(), lookup.capacity() * sizeof(id_type));
+
+            for(std::size_t pos{}, last = pools.size(); pos < last; ++pos) {
+                index_pool(pos);
+            }
+        } else {
+            index_pool(pools.size() - 1u);
+        }
+
+        return pools.back();
+    }
+
+    template<typename Component>
+    [[nodiscard]] const storage_type<Component> & assure_pool() const {
+        if(const auto pos = pool_index(type_seq<Component>::value()); pos != pools.size()) {
+            return static_cast<const storage_type<Component> &>(*pools[pos].pool);
+        }
+
+        std::unique_ptr<basic_sparse_set<Entity>> cpool{};
+
+        if constexpr(std::is_constructible_v<storage_type<Component>, const allocator_type &>) {
+            cpool.reset(new storage_type<Component>(get_allocator()));
+        } else {
+            cpool.reset(new storage_type<Component>());
+        }
+
+        auto &&pdata = push_pool(type_id<Component>(), std::move(cpool));
+        ENTT_ALLOC_TRACE("entt::registry::assure", type_id<Component>().name(), sizeof(storage_type<Component>));
+
+        // one table per type of component, shared by all the registries
+        static constexpr pool_vtable vtable{
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &owner, const Entity *first, const Entity *last) {
                 static_cast<storage_type<Component> &>(cpool).remove(owner, first, last);
-            };
+            },
+            +[](basic_sparse_set<Entity> &cpool) -> void * {
+                return raw<Component>(cpool, choice<1>);
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &other, const Entity *first, const Entity *last, const Entity *dst) {
+                auto &&from = static_cast<storage_type<Component> &>(cpool);
+                auto &&to = other.assure<Component>();
+
+                for(; first != last; ++first, ++dst) {
+                    if constexpr(std::is_same_v<typename storage_type<Component>::storage_category, empty_storage_tag>) {
+                        to.emplace(other, *dst);
+                    } else if constexpr(std::is_same_v<typename storage_type<Component>::storage_category, split_storage_tag>) {
+                        to.emplace(other, *dst, static_cast<Component>(from.get(*first)));
+                    } else {
+                        to.emplace(other, *dst, std::move(from.get(*first)));
+                    }
+                }
+            },
+            +[](basic_sparse_set<Entity> &cpool, const bool value) {
+                return track<Component>(cpool, value, choice<1>);
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &owner, const Entity src, const Entity *first, const Entity *last) {
+                auto &&cstorage = static_cast<storage_type<Component> &>(cpool);
+
+                if constexpr(std::is_same_v<typename storage_type<Component>::storage_category, empty_storage_tag>) {
+                    cstorage.insert(owner, first, last);
+                } else if constexpr(std::is_copy_constructible_v<Component>) {
+                    // the pool can reallocate on insertion, the prototype is copied first
+                    const Component prototype = cstorage.get(src);
+                    cstorage.insert(owner, first, last, prototype);
+                } else {
+                    ENTT_ASSERT(false);
+                }
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &other, const Entity *remap, const bool signals) {
+                auto &&from = static_cast<storage_type<Component> &>(cpool);
+                auto &&to = other.assure<Component>();
+                std::vector<Entity> target{};
+                target.reserve(from.size());
+
+                for(auto first = from.data(), last = first + from.size(); first != last; ++first) {
+                    target.push_back(remap[to_integral(*first) & traits_type::entity_mask]);
+                }
+
+                const auto *first = target.data();
+                const auto *last = target.data() + target.size();
+
+                if constexpr(std::is_same_v<typename storage_type<Component>::storage_category, empty_storage_tag>) {
+                    signals ? to.insert(other, first, last) : quiet_insert<Component>(to, other, first, last);
+                } else {
+                    std::vector<Component> instances{};
+                    instances.reserve(from.size());
+
+                    for(auto entt = from.data(), end = entt + from.size(); entt != end; ++entt) {
+                        if constexpr(std::is_same_v<typename storage_type<Component>::storage_category, split_storage_tag>) {
+                            instances.push_back(static_cast<Component>(from.get(*entt)));
+                        } else {
+                            instances.push_back(std::move(from.get(*entt)));
+                        }
+                    }
+
+                    const auto value = std::make_move_iterator(instances.begin());
+                    const auto end = std::make_move_iterator(instances.end());
+                    signals ? to.insert(other, first, last, value, end) : quiet_insert<Component>(to, other, first, last, value, end);
+                }
+            }
+        };
+        pdata.vtable = &vtable;
+
+        if(caching) {
+            track_pool(pools.size() - 1u);
         }
 
-        return static_cast<const storage_type<Component> &>(*pools[index].pool);
+        return static_cast<const storage_type<Component> &>(*pdata.pool);
+    }
+
+    template<typename Component>
+    [[nodiscard]] const storage_type<Component> & assure() const {
+        if(sealed) {
+            if(const auto pos = pool_index(type_seq<Component>::value()); pos != pools.size()) {
+                return static_cast<const storage_type<Component> &>(*pools[pos].pool);
+            }
+
+            // frozen registries never create pools on const access, missing pools are empty for all purposes
+            static const std::remove_const_t<storage_type<Component>> placeholder{};
+            return placeholder;
+        }
+
+        return assure_pool<Component>();
     }
 
     template<typename Component>
     [[nodiscard]] storage_type<Component> & assure() {
-        return const_cast<storage_type<Component> &>(std::as_const(*this).template assure<Component>());
+        return const_cast<storage_type<Component> &>(assure_pool<Component>());
+    }
+
+    template<typename... Owned, typename... Get, typename... Exclude>
+    [[nodiscard]] auto find_group(get_t<Get...>, exclude_t<Exclude...>) const {
+        constexpr auto size = sizeof...(Owned) + sizeof...(Get) + sizeof...(Exclude);
+
+        return std::find_if(groups.cbegin(), groups.cend(), [size](const auto &gdata) {
+            return gdata.size == size
+                && (gdata.owned(type_hash<std::decay_t<Owned>>::value()) && ...)
+                && (gdata.get(type_hash<std::decay_t<Get>>::value()) && ...)
+                && (gdata.exclude(type_hash<Exclude>::value()) && ...);
+        });
+    }
+
+    [[nodiscard]] const pool_data * find_pool(const id_type id) const {
+        const auto it = std::find_if(pools.cbegin(), pools.cend(), [id](auto &&pdata) { return pdata.pool && pdata.info.hash() == id; });
+        return it == pools.cend() ? nullptr : &*it;
+    }
+
+    void mark(const std::size_t pos, const bool value) {
+        if(const auto word = pos / word_digits; !(word < in_use.size())) {
+            const auto cap = in_use.capacity();
+            in_use.resize(word + 1u);
+
+            if(in_use.capacity() != cap) {
+                ENTT_ALLOC_TRACE("entt::registry::create", type_id<entity_type>().name(), in_use.capacity() * sizeof(word_type));
+            }
+        }
+
+        const auto flag = word_type{1u} << (pos % word_digits);
+        in_use[pos / word_digits] = value ? (in_use[pos / word_digits] | flag) : (in_use[pos / word_digits] & ~flag);
+    }
+
+    [[nodiscard]] std::size_t next_in_use(const std::size_t pos) const ENTT_NOEXCEPT {
+        // returns the first identifier in use at or after the given position
+        if(auto word = pos / word_digits; word < in_use.size()) {
+            for(auto curr = in_use[word] & (~word_type{} << (pos % word_digits));; curr = in_use[word]) {
+                if(curr) {
+                    return word * word_digits + internal::countr_zero(curr);
+                } else if(++word == in_use.size()) {
+                    break;
+                }
+            }
+        }
+
+        return entities.size();
+    }
+
+    [[nodiscard]] std::size_t prev_in_use(const std::size_t pos) const ENTT_NOEXCEPT {
+        // returns one past the last identifier in use before the given position
+        if(pos) {
+            auto word = (pos - 1u) / word_digits;
+
+            for(auto curr = in_use[word] & (~word_type{} >> (word_digits - 1u - (pos - 1u) % word_digits));; curr = in_use[--word]) {
+                if(curr) {
+                    return word * word_digits + internal::highest_bit(curr) + 1u;
+                } else if(!word) {
+                    break;
+                }
+            }
+        }
+
+        return {};
     }
 
     Entity generate_identifier() {
         // traits_type::entity_mask is reserved to allow for null identifiers
         ENTT_ASSERT(static_cast<typename traits_type::entity_type>(entities.size()) < traits_type::entity_mask);
-        return entities.emplace_back(entity_type{static_cast<typename traits_type::entity_type>(entities.size())});
+        mark(entities.size(), true);
+        return push_identifier(entity_type{static_cast<typename traits_type::entity_type>(entities.size()) | bits});
+    }
+
+    Entity push_identifier(const Entity entt) {
+        const auto cap = entities.capacity();
+        entities.push_back(entt);
+
+        if(entities.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::registry::create", type_id<entity_type>().name(), entities.capacity() * sizeof(entity_type));
+        }
+
+        return entt;
     }
 
     Entity recycle_identifier() {
         ENTT_ASSERT(available != null);
         const auto curr = to_integral(available);
-        const auto version = to_integral(entities[curr]) & (traits_type::version_mask << traits_type::entity_shift);
+        // the version and the users' bits, if any, are those of the destroyed identifier
+        const auto version = to_integral(entities[curr]) & ~traits_type::entity_mask;
         available = entity_type{to_integral(entities[curr]) & traits_type::entity_mask};
+        mark(curr, true);
         return entities[curr] = entity_type{curr | version};
     }
 
     void release_entity(const Entity entity, const typename traits_type::version_type version) {
         const auto entt = to_integral(entity) & traits_type::entity_mask;
-        entities[entt] = entity_type{to_integral(available) | (typename traits_type::entity_type{version} << traits_type::entity_shift)};
+        const auto user = to_integral(entity) & ~((traits_type::version_mask << traits_type::entity_shift) | traits_type::entity_mask);
+        entities[entt] = entity_type{to_integral(available) | ((typename traits_type::entity_type{version} & traits_type::version_mask) << traits_type::entity_shift) | user};
         available = entity_type{entt};
+        mark(entt, false);
     }
 
 public:
@@ -157,10 +673,29 @@ public:
     using version_type = typename traits_type::version_type;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
+    /*! @brief Allocator type handed to the pools. */
+    using allocator_type = std::pmr::polymorphic_allocator<Entity>;
 
     /*! @brief Default constructor. */
     basic_registry() = default;
 
+    /**
+     * @brief Constructs an empty registry with the given allocator.
+     *
+     * The allocator is handed to the pools whose storage classes accept it
+     * (see `storage_traits`), that is all the storage classes that use a
+     * polymorphic allocator, as the default ones do. Pools that don't accept it
+     * are default constructed.
+     *
+     * @warning
+     * The memory resource must outlive the registry and the pools it creates.
+     *
+     * @param allocator The allocator to use.
+     */
+    explicit basic_registry(const allocator_type &allocator)
+        : resource{allocator.resource()}
+    {}
+
     /*! @brief Default move constructor. */
     basic_registry(basic_registry &&) = default;
 
@@ -168,13 +703,173 @@ public:
     basic_registry & operator=(basic_registry &&) = default;
 
     /**
-     * @brief Prepares a pool for the given type if required.
-     * @tparam Component Type of component for which to prepare a pool.
+     * @brief Returns the allocator handed to the pools.
+     * @return The allocator handed to the pools.
      */
-    template<typename Component>
+    [[nodiscard]] allocator_type get_allocator() const ENTT_NOEXCEPT {
+        return allocator_type{resource};
+    }
+
+    /**
+     * @brief Prepares the pools for the given types if required.
+     * @tparam Component Types of components for which to prepare a pool.
+     */
+    template<typename... Component>
     void prepare() {
         // suppress the warning due to the [[nodiscard]] attribute
-        static_cast<void>(assure<Component>());
+        (static_cast<void>(assure<Component>()), ...);
+    }
+
+    /**
+     * @brief Freezes or unfreezes the internal data structures of a registry.
+     *
+     * Const member functions of a frozen registry never create pools nor touch
+     * any internal data structure. Pools that don't exist yet are treated as
+     * empty ones. Therefore, multiple threads can safely create and iterate
+     * views of a frozen registry through constant references, with no need for
+     * external synchronization.<br/>
+     * Pools and groups of interest should be prepared before freezing a
+     * registry, see `prepare` for further details. Non-const member functions
+     * aren't affected by this flag.<br/>
+     * Non-owning groups not yet used are filled when a registry is frozen, as
+     * well as those created later on, so that their first use through a
+     * constant reference doesn't touch them either.
+     *
+     * @warning
+     * Attempting to create a group through a constant reference to a frozen
+     * registry results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in this
+     * case.
+     *
+     * @param value True to freeze the registry, false otherwise.
+     */
+    void freeze(const bool value = true) {
+        if((sealed = value)) {
+            for(auto &&gdata: groups) {
+                gdata.build(gdata.group.get());
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether a registry is frozen.
+     * @return True if the registry is frozen, false otherwise.
+     */
+    [[nodiscard]] bool frozen() const ENTT_NOEXCEPT {
+        return sealed;
+    }
+
+    /**
+     * @brief Returns the storage for a given component type.
+     *
+     * The storage is created if it doesn't exist yet. Storage classes are never
+     * destroyed by a registry, therefore the reference returned is stable and
+     * can be cached for the lifetime of the registry.<br/>
+     * Functions of the storage that accept the registry as their first
+     * argument are those used by the registry itself. They notify listeners
+     * and keep groups up to date, with no need to look up the storage again.
+     *
+     * @tparam Component Type of component of which to return the storage.
+     * @return The storage for the given component type.
+     */
+    template<typename Component>
+    [[nodiscard]] const storage_type<Component> & storage() const {
+        return assure<Component>();
+    }
+
+    /*! @copydoc storage */
+    template<typename Component>
+    [[nodiscard]] storage_type<Component> & storage() {
+        return assure<Component>();
+    }
+
+    /**
+     * @brief Returns the storage for a type of components that is known only at
+     * runtime or creates it if it doesn't exist.
+     *
+     * Runtime storage classes are registered under the given identifier. Like
+     * any other pool, they take part in runtime views, in the functions that
+     * work per entity and in the destruction of the entities.
+     *
+     * @warning
+     * Runtime identifiers must not clash with the hashes of the types of
+     * components known at compile-time.
+     *
+     * @param id Runtime identifier of the type of components.
+     * @param desc Runtime descriptor of the type of components, only used on
+     * creation.
+     * @return The storage for the given type of components.
+     */
+    basic_runtime_storage<Entity> & storage(const id_type id, const runtime_descriptor &desc) {
+        if(auto *cpool = storage(id); cpool) {
+            return *cpool;
+        }
+
+        auto &&pdata = push_pool(type_info{internal::type_seq::next(), id, desc.name}, std::unique_ptr<basic_sparse_set<Entity>>{new basic_runtime_storage<Entity>{id, desc}});
+        ENTT_ALLOC_TRACE("entt::registry::storage", desc.name, sizeof(basic_runtime_storage<Entity>));
+
+        // runtime storage classes differ only in their descriptors and share a table
+        static constexpr pool_vtable vtable{
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &, const Entity *first, const Entity *last) {
+                cpool.remove(first, last);
+            },
+            +[](basic_sparse_set<Entity> &cpool) -> void * {
+                return static_cast<basic_runtime_storage<Entity> &>(cpool).raw();
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &other, const Entity *first, const Entity *last, const Entity *dst) {
+                auto &&from = static_cast<basic_runtime_storage<Entity> &>(cpool);
+                auto &&to = other.storage(from.id(), from.descriptor());
+
+                for(; first != last; ++first, ++dst) {
+                    to.emplace_move(*dst, from.get(*first));
+                }
+            },
+            +[](basic_sparse_set<Entity> &, const bool) {
+                // runtime storage classes don't offer signals
+                return false;
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &, const Entity src, const Entity *first, const Entity *last) {
+                auto &&cstorage = static_cast<basic_runtime_storage<Entity> &>(cpool);
+                cstorage.reserve(cstorage.size() + size_type(last - first));
+
+                for(const auto *prototype = cstorage.get(src); first != last; ++first) {
+                    cstorage.emplace(*first, prototype);
+                }
+            },
+            +[](basic_sparse_set<Entity> &cpool, basic_registry &other, const Entity *remap, const bool) {
+                auto &&from = static_cast<basic_runtime_storage<Entity> &>(cpool);
+                auto &&to = other.storage(from.id(), from.descriptor());
+                to.reserve(to.size() + from.size());
+
+                for(auto first = from.data(), last = first + from.size(); first != last; ++first) {
+                    to.emplace_move(remap[to_integral(*first) & traits_type::entity_mask], from.get(*first));
+                }
+            }
+        };
+        pdata.vtable = &vtable;
+
+        if(caching) {
+            track_pool(pools.size() - 1u);
+        }
+
+        return static_cast<basic_runtime_storage<Entity> &>(*pdata.pool);
+    }
+
+    /**
+     * @brief Returns the storage for a type of components that is known only at
+     * runtime, if any.
+     * @param id Runtime identifier of the type of components.
+     * @return The storage for the given type of components, if any, a null
+     * pointer otherwise.
+     */
+    [[nodiscard]] const basic_runtime_storage<Entity> * storage(const id_type id) const {
+        const auto *pdata = find_pool(id);
+        return pdata ? dynamic_cast<const basic_runtime_storage<Entity> *>(pdata->pool.get()) : nullptr;
+    }
+
+    /*! @copydoc storage */
+    [[nodiscard]] basic_runtime_storage<Entity> * storage(const id_type id) {
+        return const_cast<basic_runtime_storage<Entity> *>(std::as_const(*this).storage(id));
     }
 
     /**
@@ -200,16 +895,115 @@ public:
      * @return Number of entities still in use.
      */
     [[nodiscard]] size_type alive() const {
-        auto sz = entities.size();
-        auto curr = available;
+        size_type sz{};
 
-        for(; curr != null; --sz) {
-            curr = entities[to_integral(curr) & traits_type::entity_mask];
+        for(auto word: in_use) {
+            sz += internal::popcount(word);
         }
 
         return sz;
     }
 
+    /**
+     * @brief Returns the current tick of a registry.
+     *
+     * Storage classes that track changes, such as those that use a
+     * `tick_storage_mixin`, stamp the objects they create or update with the
+     * current tick of the registry that issued the request.
+     *
+     * @sa tick_storage_mixin
+     *
+     * @return The current tick.
+     */
+    [[nodiscard]] std::uint64_t tick() const ENTT_NOEXCEPT {
+        return clock;
+    }
+
+    /**
+     * @brief Advances the tick of a registry.
+     *
+     * Objects created or updated after this call are stamped with a tick that
+     * is greater than the returned value. Therefore, the returned value can be
+     * stored aside and used later to find out the objects changed in the
+     * meantime.
+     *
+     * @return The tick before the call.
+     */
+    std::uint64_t advance_tick() ENTT_NOEXCEPT {
+        return clock++;
+    }
+
+    /**
+     * @brief Sets the users' bits of the identifiers generated from now on.
+     *
+     * Identifiers that are recycled keep the users' bits they were created
+     * with, while those generated from scratch get the given bits. It's a
+     * simple way to partition the space of identifiers among different
+     * registries.
+     *
+     * @warning
+     * Attempting to use bits that aren't reserved for users' purposes results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * of invalid bits.
+     *
+     * @sa basic_entt_traits
+     *
+     * @param value Users' bits in place, that is, not shifted.
+     */
+    void user_bits(const typename traits_type::entity_type value) ENTT_NOEXCEPT {
+        ENTT_ASSERT(!(value & ~traits_type::user_mask));
+        bits = value;
+    }
+
+    /**
+     * @brief Returns the users' bits of the identifiers generated from scratch.
+     * @return The users' bits in place, that is, not shifted.
+     */
+    [[nodiscard]] typename traits_type::entity_type user_bits() const ENTT_NOEXCEPT {
+        return bits;
+    }
+
+    /**
+     * @brief Enables or disables the signature cache.
+     *
+     * The signature cache keeps a bitset for each entity, with one bit for
+     * each pool. Bitsets are kept up-to-date by means of the signals of the
+     * pools, therefore the cache slightly slows down the creation and
+     * destruction of components.<br/>
+     * In exchange, functions that work per entity, such as `remove_all`,
+     * `orphan` and `visit`, touch only the pools that contain the entity
+     * rather than scanning all of them. Pools of storage classes that don't
+     * offer signals are always scanned.
+     *
+     * @param value True to enable the cache, false to disable it.
+     */
+    void cache_signatures(const bool value) {
+        if(value != caching) {
+            caching = value;
+
+            for(auto pos = pools.size(); pos; --pos) {
+                if(const auto &pdata = pools[pos-1]; pdata.pool && caching) {
+                    track_pool(pos-1);
+                } else if(pdata.pool) {
+                    pdata.vtable->track(*pdata.pool, false);
+                }
+            }
+
+            if(!caching) {
+                signatures.clear();
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether the signature cache is enabled.
+     * @return True if the signature cache is enabled, false otherwise.
+     */
+    [[nodiscard]] bool cached_signatures() const ENTT_NOEXCEPT {
+        return caching;
+    }
+
     /**
      * @brief Increases the capacity of the registry or of the pools for the
      * given components.
@@ -226,12 +1020,36 @@ public:
     template<typename... Component>
     void reserve(const size_type cap) {
         if constexpr(sizeof...(Component) == 0) {
-            entities.reserve(cap);
+            if(cap > entities.capacity()) {
+                entities.reserve(cap);
+                in_use.reserve((cap + word_digits - 1u) / word_digits);
+                ENTT_ALLOC_TRACE("entt::registry::reserve", type_id<entity_type>().name(), entities.capacity() * sizeof(entity_type) + in_use.capacity() * sizeof(word_type));
+            }
         } else {
             (assure<Component>().reserve(cap), ...);
         }
     }
 
+    /**
+     * @brief Prepares the registry and the pools for the given components for
+     * a range of identifiers.
+     *
+     * Room is made for all the identifiers in `[0, extent)`, both in the list
+     * of entities and in the sparse arrays of the pools. This way, loading a
+     * level or a snapshot of known size doesn't allocate a page at a time on
+     * first use.
+     *
+     * @sa basic_sparse_set::reserve_sparse
+     *
+     * @tparam Component Types of components for which to reserve storage.
+     * @param extent The number of identifiers to make room for.
+     */
+    template<typename... Component>
+    void reserve_sparse(const size_type extent) {
+        reserve(extent);
+        (assure<Component>().reserve_sparse(extent), ...);
+    }
+
     /**
      * @brief Returns the capacity of the pool for the given component.
      * @tparam Component Type of component in which one is interested.
@@ -380,7 +1198,7 @@ public:
      * @return The version stored along with the given entity identifier.
      */
     [[nodiscard]] static version_type version(const entity_type entity) ENTT_NOEXCEPT {
-        return version_type(to_integral(entity) >> traits_type::entity_shift);
+        return version_type((to_integral(entity) >> traits_type::entity_shift) & traits_type::version_mask);
     }
 
     /**
@@ -411,6 +1229,7 @@ public:
      * @return A valid entity identifier.
      */
     entity_type create() {
+        ENTT_TRACE("entt::registry::create", type_id<entity_type>().name());
         return available == null ? generate_identifier() : recycle_identifier();
     }
 
@@ -430,19 +1249,21 @@ public:
         entity_type entt;
 
         if(const auto req = (to_integral(hint) & traits_type::entity_mask); !(req < entities.size())) {
-            entities.reserve(size_type(req) + 1u);
+            reserve(size_type(req) + 1u);
 
             for(auto pos = entities.size(); pos < req; ++pos) {
                 release_entity(generate_identifier(), {});
             }
 
-            entt = entities.emplace_back(hint);
+            mark(req, true);
+            entt = push_identifier(hint);
         } else if(const auto curr = (to_integral(entities[req]) & traits_type::entity_mask); req == curr) {
             entt = create();
         } else {
             auto *it = &available;
             for(; (to_integral(*it) & traits_type::entity_mask) != req; it = &entities[to_integral(*it) & traits_type::entity_mask]);
-            *it = entity_type{curr | (to_integral(*it) & (traits_type::version_mask << traits_type::entity_shift))};
+            *it = entity_type{curr | (to_integral(*it) & ~traits_type::entity_mask)};
+            mark(req, true);
             entt = entities[req] = hint;
         }
 
@@ -460,6 +1281,8 @@ public:
      */
     template<typename It>
     void create(It first, It last) {
+        ENTT_TRACE("entt::registry::create", type_id<entity_type>().name());
+
         for(; available != null && first != last; ++first) {
             *first = recycle_identifier();
         }
@@ -491,6 +1314,14 @@ public:
         ENTT_ASSERT(std::all_of(pools.cbegin(), pools.cend(), [](auto &&pdata) { return !pdata.pool || pdata.pool->empty(); }));
         entities.assign(first, last);
         available = destroyed;
+        in_use.assign((entities.size() + word_digits - 1u) / word_digits, word_type{});
+
+        for(size_type pos{}, end = entities.size(); pos < end; ++pos) {
+            // destroyed entities point to the next element of the list rather than to their own position
+            if((to_integral(entities[pos]) & traits_type::entity_mask) == pos) {
+                mark(pos, true);
+            }
+        }
     }
 
     /**
@@ -519,6 +1350,7 @@ public:
      * @param version A desired version upon destruction.
      */
     void destroy(const entity_type entity, const version_type version) {
+        ENTT_TRACE("entt::registry::destroy", type_id<entity_type>().name());
         remove_all(entity);
         release_entity(entity, version);
     }
@@ -526,6 +1358,9 @@ public:
     /**
      * @brief Destroys all the entities in a range.
      *
+     * Components are removed pool by pool rather than entity by entity, then
+     * the identifiers are released in the order in which they appear.
+     *
      * @sa destroy
      *
      * @tparam It Type of input iterator.
@@ -534,11 +1369,65 @@ public:
      */
     template<typename It>
     void destroy(It first, It last) {
-        for(; first != last; ++first) {
-            destroy(*first);
+        ENTT_TRACE("entt::registry::destroy", type_id<entity_type>().name());
+        const std::vector<entity_type> range(first, last);
+        std::vector<entity_type> contained{};
+
+        ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }));
+
+        for(auto pos = pools.size(); pos; --pos) {
+            if(auto &pdata = pools[pos-1]; pdata.pool && !pdata.pool->empty()) {
+                const auto limit = pdata.pool->size();
+                contained.clear();
+
+                for(auto it = range.cbegin(), end = range.cend(); it != end && contained.size() != limit; ++it) {
+                    if(pdata.pool->contains(*it)) {
+                        contained.push_back(*it);
+                    }
+                }
+
+                if(!contained.empty()) {
+                    pdata.vtable->remove(*pdata.pool, *this, contained.data(), contained.data() + contained.size());
+                }
+            }
+        }
+
+        for(const auto entity: range) {
+            release_entity(entity, static_cast<typename traits_type::version_type>(version(entity) + 1u));
         }
     }
 
+    /**
+     * @brief Copies all the components of an entity to a range of entities.
+     *
+     * The pools that contain the prototype are looked up only once. Then, the
+     * components of each pool are copied to all the entities in a single range
+     * insertion, as if by `insert`.
+     *
+     * @warning
+     * Attempting to use invalid entities, to assign components to entities
+     * that already own them or to copy a component that isn't copy
+     * constructible results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entities or components that cannot be copied.
+     *
+     * @tparam It Type of input iterator.
+     * @param src A valid entity identifier to use as a prototype.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void clone(const entity_type src, It first, It last) {
+        ENTT_ASSERT(valid(src));
+        const std::vector<entity_type> range(first, last);
+
+        ENTT_ASSERT(std::all_of(range.cbegin(), range.cend(), [this](const auto entity) { return valid(entity); }));
+
+        pools_of(src, [this, src, &range](auto &&pdata) {
+            pdata.vtable->clone(*pdata.pool, *this, src, range.data(), range.data() + range.size());
+        });
+    }
+
     /**
      * @brief Assigns the given component to an entity.
      *
@@ -707,64 +1596,296 @@ public:
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
-    template<typename... Component, typename It>
-    void remove(It first, It last) {
-        ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
-        (assure<Component>().remove(*this, first, last), ...);
+    template<typename... Component, typename It>
+    void remove(It first, It last) {
+        ENTT_ASSERT(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        (assure<Component>().remove(*this, first, last), ...);
+    }
+
+    /**
+     * @brief Removes the given components from an entity.
+     *
+     * Equivalent to the following snippet (pseudocode):
+     *
+     * @code{.cpp}
+     * if(registry.has<Component>(entity)) { registry.remove<Component>(entity) }
+     * @endcode
+     *
+     * Prefer this function anyway because it has slightly better performance.
+     *
+     * @warning
+     * Attempting to use an invalid entity results in undefined behavior.
+     *
+     * @tparam Component Types of components to remove.
+     * @param entity A valid entity identifier.
+     * @return The number of components actually removed.
+     */
+    template<typename... Component>
+    size_type remove_if_exists(const entity_type entity) {
+        ENTT_ASSERT(valid(entity));
+
+        return ([this, entity](auto &&cpool) {
+            return cpool.contains(entity) ? (cpool.remove(*this, entity), true) : false;
+        }(assure<Component>()) + ... + size_type{});
+    }
+
+    /**
+     * @brief Removes all the components from an entity and makes it orphaned.
+     *
+     * @warning
+     * In case there are listeners that observe the destruction of components
+     * and assign other components to the entity in their bodies, the result of
+     * invoking this function may not be as expected. In the worst case, it
+     * could lead to undefined behavior.
+     *
+     * @warning
+     * Attempting to use an invalid entity results in undefined behavior.
+     *
+     * @param entity A valid entity identifier.
+     */
+    void remove_all(const entity_type entity) {
+        ENTT_ASSERT(valid(entity));
+        entity_type wrap[1]{entity};
+
+        pools_of(entity, [this, &wrap](auto &&pdata) {
+            pdata.vtable->remove(*pdata.pool, *this, std::begin(wrap), std::end(wrap));
+        });
+    }
+
+    /**
+     * @brief Moves all the components of the given entities to another
+     * registry.
+     *
+     * Components are moved pool by pool. The entities in the range are still
+     * valid within this registry once the function returns, though they have
+     * no components assigned. Pools aren't created in the other registry for
+     * types that none of the entities in the range have.<br/>
+     * Signals are emitted as if components were created in the other registry
+     * and removed from this one.
+     *
+     * @warning
+     * Attempting to use invalid entities or to move components to entities
+     * that already have them results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entities or if the two registries are the same.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Out Type of input iterator for the destination entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param other A registry to which to move the components.
+     * @param dst An iterator to the first element of the range of entities to
+     * which the components are moved in the other registry.
+     */
+    template<typename It, typename Out>
+    void transfer(It first, It last, basic_registry &other, Out dst) {
+        ENTT_ASSERT(this != &other);
+        const std::vector<entity_type> source(first, last);
+        std::vector<entity_type> target{};
+        std::vector<entity_type> from{};
+        std::vector<entity_type> to{};
+
+        for(size_type count = source.size(); count; --count, ++dst) {
+            target.push_back(*dst);
+        }
+
+        ENTT_ASSERT(std::all_of(source.cbegin(), source.cend(), [this](const auto entity) { return valid(entity); }));
+        ENTT_ASSERT(std::all_of(target.cbegin(), target.cend(), [&other](const auto entity) { return other.valid(entity); }));
+
+        for(auto pos = pools.size(); pos; --pos) {
+            if(auto &pdata = pools[pos-1]; pdata.pool && !pdata.pool->empty()) {
+                from.clear();
+                to.clear();
+
+                for(size_type next{}, end = source.size(); next < end; ++next) {
+                    if(pdata.pool->contains(source[next])) {
+                        from.push_back(source[next]);
+                        to.push_back(target[next]);
+                    }
+                }
+
+                if(!from.empty()) {
+                    pdata.vtable->transfer(*pdata.pool, other, from.data(), from.data() + from.size(), to.data());
+                    pdata.vtable->remove(*pdata.pool, *this, from.data(), from.data() + from.size());
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Moves all the components of an entity to another registry.
+     *
+     * @sa transfer
+     *
+     * @param entity A valid entity identifier.
+     * @param other A registry to which to move the components.
+     * @param dst A valid entity identifier of the other registry.
+     */
+    void transfer(const entity_type entity, basic_registry &other, const entity_type dst) {
+        const entity_type src[1]{entity};
+        const entity_type out[1]{dst};
+        transfer(std::begin(src), std::end(src), other, std::begin(out));
     }
 
     /**
-     * @brief Removes the given components from an entity.
+     * @brief Moves all the entities and components of another registry to this
+     * one.
      *
-     * Equivalent to the following snippet (pseudocode):
+     * Entities are created in bulk in this registry, one for each entity in use
+     * in the other registry and in the order in which `each` returns them.
+     * Components are then moved pool by pool with a single range insertion
+     * each. The other registry is cleared once the function returns.<br/>
+     * The function object is invoked for each entity before its components are
+     * moved. The signature of the function should be equivalent to the
+     * following:
      *
      * @code{.cpp}
-     * if(registry.has<Component>(entity)) { registry.remove<Component>(entity) }
+     * void(const Entity src, const Entity dst);
      * @endcode
      *
-     * Prefer this function anyway because it has slightly better performance.
+     * Construction signals are skipped on request for all the storage classes
+     * that use the default signal mixin. Cached signatures are kept up to date
+     * in any case.
      *
      * @warning
-     * Attempting to use an invalid entity results in undefined behavior.
+     * Skipping signals when groups exist results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * groups or if the two registries are the same.
      *
-     * @tparam Component Types of components to remove.
-     * @param entity A valid entity identifier.
-     * @return The number of components actually removed.
+     * @tparam Func Type of the function object to invoke.
+     * @param other A registry from which to move entities and components.
+     * @param func A valid function object.
+     * @param signals Whether construction signals should be emitted or not.
      */
-    template<typename... Component>
-    size_type remove_if_exists(const entity_type entity) {
-        ENTT_ASSERT(valid(entity));
+    template<typename Func>
+    void merge(basic_registry &other, Func func, const bool signals = true) {
+        ENTT_ASSERT(this != &other);
+        ENTT_ASSERT(signals || groups.empty());
 
-        return ([this, entity](auto &&cpool) {
-            return cpool.contains(entity) ? (cpool.remove(*this, entity), true) : false;
-        }(assure<Component>()) + ... + size_type{});
+        std::vector<entity_type> source{};
+        other.each([&source](const auto entt) { source.push_back(entt); });
+
+        std::vector<entity_type> target(source.size());
+        create(target.begin(), target.end());
+
+        std::vector<entity_type> remap(other.entities.size(), entity_type{null});
+
+        for(size_type pos{}, end = source.size(); pos < end; ++pos) {
+            remap[to_integral(source[pos]) & traits_type::entity_mask] = target[pos];
+            func(source[pos], target[pos]);
+        }
+
+        for(auto &&pdata: other.pools) {
+            if(pdata.pool && !pdata.pool->empty()) {
+                pdata.vtable->merge(*pdata.pool, *this, remap.data(), signals);
+            }
+        }
+
+        other.clear();
     }
 
     /**
-     * @brief Removes all the components from an entity and makes it orphaned.
+     * @brief Moves all the entities and components of another registry to this
+     * one.
      *
-     * @warning
-     * In case there are listeners that observe the destruction of components
-     * and assign other components to the entity in their bodies, the result of
-     * invoking this function may not be as expected. In the worst case, it
-     * could lead to undefined behavior.
+     * @sa merge
+     *
+     * @param other A registry from which to move entities and components.
+     * @param signals Whether construction signals should be emitted or not.
+     */
+    void merge(basic_registry &other, const bool signals = true) {
+        merge(other, [](const auto, const auto) {}, signals);
+    }
+
+    /**
+     * @brief Renumbers the entities in use so that their identifiers are dense.
+     *
+     * Entities keep their versions and user bits, while the entity part of
+     * their identifiers is replaced so that all of them are packed at the
+     * beginning of the range. The order of the entities is preserved.<br/>
+     * Pools are updated in bulk. Objects aren't moved but the sparse arrays are
+     * rebuilt from scratch and the pages that are no longer in use are
+     * released. Destroyed identifiers are discarded along with their versions.
+     *
+     * Listeners connected to `on_remap` are notified first, once the registry
+     * is up to date. The function object is then invoked for each entity that
+     * has been renumbered. The signature of the function should be equivalent
+     * to the following:
+     *
+     * @code{.cpp}
+     * void(const Entity src, const Entity dst);
+     * @endcode
      *
      * @warning
-     * Attempting to use an invalid entity results in undefined behavior.
+     * All the identifiers held by the users, including those stored in
+     * components, context variables or observers, are invalidated. The
+     * function object and the listeners of `on_remap` are the only means to
+     * update them.
      *
-     * @param entity A valid entity identifier.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
      */
-    void remove_all(const entity_type entity) {
-        ENTT_ASSERT(valid(entity));
-        entity_type wrap[1]{entity};
+    template<typename Func>
+    void compact(Func func) {
+        std::vector<entity_type> remap(entities.size(), entity_type{null});
+        std::vector<entity_type> dense{};
+
+        for(size_type pos{}, last = entities.size(); pos < last; ++pos) {
+            if(const auto entt = entities[pos]; (to_integral(entt) & traits_type::entity_mask) == pos) {
+                const auto other = typename traits_type::entity_type(to_integral(entt) & ~traits_type::entity_mask);
+                dense.push_back(entity_type{static_cast<typename traits_type::entity_type>(other | dense.size())});
+                remap[pos] = dense.back();
+            }
+        }
 
-        for(auto pos = pools.size(); pos; --pos) {
-            if(auto &pdata = pools[pos-1]; pdata.pool && pdata.pool->contains(entity)) {
-                pdata.remove(*pdata.pool, *this, std::begin(wrap), std::end(wrap));
+        for(auto &&pdata: pools) {
+            if(pdata.pool) {
+                pdata.pool->remap(remap.data());
+            }
+        }
+
+        for(auto &&gdata: groups) {
+            gdata.remap(gdata.group.get(), remap.data());
+        }
+
+        for(auto &&sdata: signatures) {
+            std::vector<word_type> words(dense.size(), word_type{});
+
+            for(size_type pos{}, last = (std::min)(sdata.words.size(), remap.size()); pos < last; ++pos) {
+                if(remap[pos] != null) {
+                    words[to_integral(remap[pos]) & traits_type::entity_mask] = sdata.words[pos];
+                }
+            }
+
+            sdata.words = std::move(words);
+        }
+
+        const auto range = std::move(entities);
+        entities = dense;
+        available = null;
+        in_use.assign((entities.size() + word_digits - 1u) / word_digits, word_type{});
+
+        for(size_type pos{}, last = entities.size(); pos < last; ++pos) {
+            mark(pos, true);
+        }
+
+        remapping.publish(*this, remap.data(), remap.data() + remap.size());
+
+        for(size_type pos{}, last = range.size(); pos < last; ++pos) {
+            if(remap[pos] != null && remap[pos] != range[pos]) {
+                func(range[pos], remap[pos]);
             }
         }
     }
 
+    /**
+     * @brief Renumbers the entities in use so that their identifiers are dense.
+     * @sa compact
+     */
+    void compact() {
+        compact([](const auto, const auto) {});
+    }
+
     /**
      * @brief Checks if an entity has all the given components.
      *
@@ -816,7 +1937,7 @@ public:
         if constexpr(sizeof...(Component) == 1) {
             return (assure<Component>().get(entity), ...);
         } else {
-            return std::forward_as_tuple(assure<Component>().get(entity)...);
+            return std::tuple<decltype(assure<Component>().get(entity))...>{assure<Component>().get(entity)...};
         }
     }
 
@@ -828,7 +1949,7 @@ public:
         if constexpr(sizeof...(Component) == 1) {
             return (assure<Component>().get(entity), ...);
         } else {
-            return std::forward_as_tuple(assure<Component>().get(entity)...);
+            return std::tuple<decltype(assure<Component>().get(entity))...>{assure<Component>().get(entity)...};
         }
     }
 
@@ -899,6 +2020,42 @@ public:
         }
     }
 
+    /**
+     * @brief Gathers pointers to the given components for a range of entities.
+     *
+     * Pools are looked up once for the whole range. For each entity, a pointer
+     * to each of its components is written to the output iterator of the
+     * component, in the order in which the entities are provided. When
+     * `ENTT_PREFETCH_DISTANCE` is set, the sparse arrays are prefetched ahead
+     * of time to hide the latency of scattered entities.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to gather a component from an
+     * entity that doesn't own it results in undefined behavior.
+     *
+     * @note
+     * The registry retains ownership of the pointed-to components.
+     *
+     * @tparam Component Types of components to gather.
+     * @tparam It Type of input iterator.
+     * @tparam Out Types of output iterators.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param out Output iterators, one for each component.
+     */
+    template<typename... Component, typename It, typename... Out>
+    void gather(It first, It last, Out... out) const {
+        static_assert(sizeof...(Component) == sizeof...(Out), "Invalid number of output iterators");
+        gather_into(std::forward_as_tuple(assure<Component>()...), first, last, std::make_tuple(out...), std::index_sequence_for<Component...>{});
+    }
+
+    /*! @copydoc gather */
+    template<typename... Component, typename It, typename... Out>
+    void gather(It first, It last, Out... out) {
+        static_assert(sizeof...(Component) == sizeof...(Out), "Invalid number of output iterators");
+        gather_into(std::forward_as_tuple(assure<Component>()...), first, last, std::make_tuple(out...), std::index_sequence_for<Component...>{});
+    }
+
     /**
      * @brief Clears a whole registry or the pools for the given components.
      * @tparam Component Types of components to remove from their entities.
@@ -908,15 +2065,11 @@ public:
         if constexpr(sizeof...(Component) == 0) {
             for(auto pos = pools.size(); pos; --pos) {
                 if(const auto &pdata = pools[pos-1]; pdata.pool) {
-                    pdata.remove(*pdata.pool, *this, pdata.pool->data(), pdata.pool->data() + pdata.pool->size());
+                    pdata.vtable->remove(*pdata.pool, *this, pdata.pool->data(), pdata.pool->data() + pdata.pool->size());
                 }
             }
 
-            for(auto pos = entities.size(); pos; --pos) {
-                if(const auto entt = entities[pos - 1]; (to_integral(entt) & traits_type::entity_mask) == (pos - 1)) {
-                    release_entity(entt, version(entt) + 1u);
-                }
-            }
+            each([this](const auto entt) { release_entity(entt, version(entt) + 1u); });
         } else {
             ([this](auto &&cpool) {
                 cpool.remove(*this, cpool.basic_sparse_set<entity_type>::begin(), cpool.basic_sparse_set<entity_type>::end());
@@ -943,15 +2096,13 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        if(available == null) {
-            for(auto pos = entities.size(); pos; --pos) {
-                func(entities[pos-1]);
-            }
-        } else {
-            for(auto pos = entities.size(); pos; --pos) {
-                if(const auto entt = entities[pos - 1]; (to_integral(entt) & traits_type::entity_mask) == (pos - 1)) {
-                    func(entt);
-                }
+        // dead ranges are skipped a word at a time
+        for(auto word = in_use.size(); word; --word) {
+            for(auto curr = in_use[word - 1u]; curr;) {
+                const auto bit = internal::highest_bit(curr);
+                func(entities[(word - 1u) * word_digits + bit]);
+                // entities can be created or destroyed by the function object
+                curr = in_use[word - 1u] & ~(~word_type{} << bit);
             }
         }
     }
@@ -963,6 +2114,13 @@ public:
      */
     [[nodiscard]] bool orphan(const entity_type entity) const {
         ENTT_ASSERT(valid(entity));
+
+        if(caching) {
+            bool orphaned = true;
+            pools_of(entity, [&orphaned](auto &&) { orphaned = false; });
+            return orphaned;
+        }
+
         return std::none_of(pools.cbegin(), pools.cend(), [entity](auto &&pdata) { return pdata.pool && pdata.pool->contains(entity); });
     }
 
@@ -1016,6 +2174,32 @@ public:
         return assure<Component>().on_construct();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances of the given component are created and assigned to a
+     * range of entities, such as during a call to `insert`.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked once per operation, **after** the components have
+     * been assigned to the entities. Single entity operations are notified as
+     * ranges of one element.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_construct_range() {
+        return assure<Component>().on_construct_range();
+    }
+
     /**
      * @brief Returns a sink object for the given component.
      *
@@ -1064,6 +2248,58 @@ public:
         return assure<Component>().on_destroy();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances of the given component are removed from a range of
+     * entities and thus destroyed, such as during a call to `clear`.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * Listeners are invoked once per operation, **before** the components have
+     * been removed from the entities. Single entity operations are notified as
+     * ranges of one element.
+     *
+     * @sa sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    [[nodiscard]] auto on_destroy_range() {
+        return assure<Component>().on_destroy_range();
+    }
+
+    /**
+     * @brief Returns a sink object to use to know when entities are renumbered.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever the identifiers of the entities are replaced all at once, such
+     * as during a call to `compact`.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, const Entity *);
+     * @endcode
+     *
+     * The range is a table indexed by the entity part of the old identifiers
+     * that contains their replacements. Identifiers that are no longer in use
+     * are replaced by the null entity.<br/>
+     * Listeners are invoked **after** the registry and its pools have been
+     * updated.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_remap() {
+        return sink{remapping};
+    }
+
     /**
      * @brief Returns a view for the given components.
      *
@@ -1082,6 +2318,8 @@ public:
      * * Multi component views look at the number of entities available for each
      *   component and pick up a reference to the smallest set of candidates to
      *   test for the given components.
+     * * Exclusion-only views iterate the list of entities of the registry and
+     *   return all the entities still in use that are not filtered out.
      *
      * Views in no way affect the functionalities of the registry nor those of
      * the underlying pools.
@@ -1098,15 +2336,21 @@ public:
      */
     template<typename... Component, typename... Exclude>
     [[nodiscard]] basic_view<Entity, exclude_t<Exclude...>, Component...> view(exclude_t<Exclude...> = {}) const {
-        static_assert(sizeof...(Component) > 0, "Exclusion-only views are not supported");
-        return { assure<std::decay_t<Component>>()..., assure<Exclude>()... };
+        if constexpr(sizeof...(Component) == 0) {
+            return { *this, assure<Exclude>()... };
+        } else {
+            return { assure<std::decay_t<Component>>()..., assure<Exclude>()... };
+        }
     }
 
     /*! @copydoc view */
     template<typename... Component, typename... Exclude>
     [[nodiscard]] basic_view<Entity, exclude_t<Exclude...>, Component...> view(exclude_t<Exclude...> = {}) {
-        static_assert(sizeof...(Component) > 0, "Exclusion-only views are not supported");
-        return { assure<std::decay_t<Component>>()..., assure<Exclude>()... };
+        if constexpr(sizeof...(Component) == 0) {
+            return { *this, assure<Exclude>()... };
+        } else {
+            return { assure<std::decay_t<Component>>()..., assure<Exclude>()... };
+        }
     }
 
     /**
@@ -1165,6 +2409,10 @@ public:
      * type of initialization, but for the first time they are requested.<br/>
      * As a rule of thumb, storing a group should never be an option.
      *
+     * Non-owning groups are populated the first time they are used rather than
+     * when they are requested, so that creating many of them doesn't result in
+     * a spike of work. Owning groups are always initialized eagerly instead.
+     *
      * Groups support exclusion lists and can own types of components. The more
      * types are owned by a group, the faster it is to iterate entities and
      * components.<br/>
@@ -1193,13 +2441,7 @@ public:
         constexpr auto size = sizeof...(Owned) + sizeof...(Get) + sizeof...(Exclude);
         handler_type *handler = nullptr;
 
-        if(auto it = std::find_if(groups.cbegin(), groups.cend(), [size](const auto &gdata) {
-            return gdata.size == size
-                && (gdata.owned(type_hash<std::decay_t<Owned>>::value()) && ...)
-                && (gdata.get(type_hash<std::decay_t<Get>>::value()) && ...)
-                && (gdata.exclude(type_hash<Exclude>::value()) && ...);
-        }); it != groups.cend())
-        {
+        if(auto it = find_group<Owned...>(get_t<Get...>{}, exclude<Exclude...>); it != groups.cend()) {
             handler = static_cast<handler_type *>(it->group.get());
         }
 
@@ -1210,10 +2452,30 @@ public:
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<std::decay_t<Owned>>::value()) || ...); },
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<std::decay_t<Get>>::value()) || ...); },
                 []([[maybe_unused]] const id_type ctype) ENTT_NOEXCEPT { return ((ctype == type_hash<Exclude>::value()) || ...); },
+                []([[maybe_unused]] void *instance, [[maybe_unused]] const Entity *table) {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        // owning groups rely only on the positions of the entities within their pools
+                        static_cast<handler_type *>(instance)->current.remap(table);
+                    }
+                },
+                [](const void *instance) ENTT_NOEXCEPT -> std::size_t {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        return static_cast<const handler_type *>(instance)->current.size();
+                    } else {
+                        return static_cast<const handler_type *>(instance)->current;
+                    }
+                },
+                []([[maybe_unused]] void *instance) {
+                    if constexpr(sizeof...(Owned) == 0) {
+                        static_cast<handler_type *>(instance)->populate();
+                    }
+                }
             };
 
             handler = static_cast<handler_type *>(candidate.group.get());
+            ENTT_ALLOC_TRACE("entt::registry::group", type_id<handler_type>().name(), sizeof(handler_type));
 
+            const auto cap = groups.capacity();
             const void *maybe_valid_if = nullptr;
             const void *discard_if = nullptr;
 
@@ -1239,28 +2501,32 @@ public:
                 groups.insert(next, std::move(candidate));
             }
 
-            (on_construct<std::decay_t<Owned>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Owned>>>(*handler), ...);
-            (on_construct<std::decay_t<Get>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Get>>>(*handler), ...);
-            (on_destroy<Exclude>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<Exclude>>(*handler), ...);
+            if(groups.capacity() != cap) {
+                ENTT_ALLOC_TRACE("entt::registry::group", type_id<handler_type>().name(), groups.capacity() * sizeof(group_data));
+            }
+
+            (on_construct_range<std::decay_t<Owned>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Owned>>>(*handler), ...);
+            (on_construct_range<std::decay_t<Get>>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<std::decay_t<Get>>>(*handler), ...);
+            (on_destroy_range<Exclude>().before(maybe_valid_if).template connect<&handler_type::template maybe_valid_if<Exclude>>(*handler), ...);
 
-            (on_destroy<std::decay_t<Owned>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
-            (on_destroy<std::decay_t<Get>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
-            (on_construct<Exclude>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_destroy_range<std::decay_t<Owned>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_destroy_range<std::decay_t<Get>>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
+            (on_construct_range<Exclude>().before(discard_if).template connect<&handler_type::discard_if>(*handler), ...);
 
             if constexpr(sizeof...(Owned) == 0) {
-                for(const auto entity: view<Owned..., Get...>(exclude<Exclude...>)) {
-                    handler->current.emplace(entity);
+                handler->lazy = std::forward_as_tuple(&assure<std::decay_t<Get>>()..., &assure<Exclude>()...);
+
+                if(sealed) {
+                    handler->populate();
                 }
             } else {
-                // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
-                for(auto *first = std::get<0>(cpools).data(), *last = first + std::get<0>(cpools).size(); first != last; ++first) {
-                    handler->template maybe_valid_if<std::tuple_element_t<0, std::tuple<std::decay_t<Owned>...>>>(*this, *first);
-                }
+                // entities of nested groups are already at the front of the pools and are left where they are
+                handler->partition(*this);
             }
         }
 
         if constexpr(sizeof...(Owned) == 0) {
-            return { handler->current, std::get<storage_type<std::decay_t<Get>> &>(cpools)... };
+            return { handler->current, delegate<void()>{connect_arg<&handler_type::populate>, *handler}, std::get<storage_type<std::decay_t<Get>> &>(cpools)... };
         } else {
             return { handler->current, std::get<storage_type<std::decay_t<Owned>> &>(cpools)... , std::get<storage_type<std::decay_t<Get>> &>(cpools)... };
         }
@@ -1279,6 +2545,7 @@ public:
     template<typename... Owned, typename... Get, typename... Exclude>
     [[nodiscard]] basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> group(get_t<Get...>, exclude_t<Exclude...> = {}) const {
         static_assert(std::conjunction_v<std::is_const<Owned>..., std::is_const<Get>...>, "Invalid non-const type");
+        ENTT_ASSERT(!sealed || (find_group<Owned...>(get_t<Get...>{}, exclude<Exclude...>) != groups.cend()));
         return const_cast<basic_registry *>(this)->group<Owned...>(get_t<Get...>{}, exclude<Exclude...>);
     }
 
@@ -1308,9 +2575,41 @@ public:
     template<typename... Owned, typename... Exclude>
     [[nodiscard]] basic_group<Entity, exclude_t<Exclude...>, get_t<>, Owned...> group(exclude_t<Exclude...> = {}) const {
         static_assert(std::conjunction_v<std::is_const<Owned>...>, "Invalid non-const type");
+        ENTT_ASSERT(!sealed || (find_group<Owned...>(get_t<>{}, exclude<Exclude...>) != groups.cend()));
         return const_cast<basic_registry *>(this)->group<Owned...>(exclude<Exclude...>);
     }
 
+    /**
+     * @brief Populates in parallel the non-owning groups not yet used.
+     *
+     * Non-owning groups are filled the first time they are used. This function
+     * fills all of them at once instead, for example at the end of a loading
+     * phase, one task for each group. Owning groups are initialized eagerly
+     * when they are created and are left untouched. The signature of the
+     * executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Where `task` must be invoked once for each index in `[0, count)` and the
+     * executor doesn't return until all tasks are completed.
+     *
+     * @warning
+     * The registry must not be modified while the groups are being populated.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @param executor A valid executor.
+     */
+    template<typename Exec>
+    void build_groups(Exec executor) {
+        if(!groups.empty()) {
+            executor(groups.size(), [this](const std::size_t pos) {
+                groups[pos].build(groups[pos].group.get());
+            });
+        }
+    }
+
     /**
      * @brief Checks whether the given components belong to any group.
      * @tparam Component Types of components in which one is interested.
@@ -1371,6 +2670,11 @@ public:
      * necessarily the type of the one passed along with the other parameters to
      * this member function.
      *
+     * Sort function objects that work on keys rather than comparisons, such as
+     * `radix_sort`, accept also a _getter_ in place of the comparison function.
+     * Its signature should be equivalent to one of `Key(const Entity)` or
+     * `Key(const Component &)`.
+     *
      * @warning
      * Pools of components owned by a group cannot be sorted.
      *
@@ -1384,6 +2688,7 @@ public:
      */
     template<typename Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_TRACE("entt::registry::sort", type_id<Component>().name());
         ENTT_ASSERT(sortable<Component>());
         assure<Component>().sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
     }
@@ -1423,10 +2728,57 @@ public:
      */
     template<typename To, typename From>
     void sort() {
+        ENTT_TRACE("entt::registry::sort", type_id<To>().name());
         ENTT_ASSERT(sortable<To>());
         assure<To>().respect(assure<From>());
     }
 
+    /**
+     * @brief Sorts multiple pools of components according to the order of
+     * another pool.
+     *
+     * @sa sort
+     *
+     * @warning
+     * Pools of components owned by a group cannot be sorted.
+     *
+     * @tparam Lead Type of components to use to sort.
+     * @tparam Other Types of components to sort.
+     */
+    template<typename Lead, typename... Other>
+    void sort_as() {
+        ENTT_ASSERT((sortable<Other>() && ...));
+        const auto &lead = assure<Lead>();
+        (assure<Other>().respect(lead), ...);
+    }
+
+    /**
+     * @brief Sorts all the pools so that shared entities have the same order.
+     *
+     * All the pools are sorted by means of the same comparison function object
+     * for the entities. Therefore, the entities they share are returned in the
+     * same relative order and multi component views access their objects
+     * almost sequentially. By default, entities are sorted by identifier.<br/>
+     * Pools of components owned by a group are skipped.
+     *
+     * @sa sort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare = std::less<Entity>, typename Sort = std_sort, typename... Args>
+    void sort_all(Compare compare = Compare{}, Sort algo = Sort{}, Args &&... args) {
+        for(auto &&pdata: pools) {
+            if(pdata.pool && pdata.pool->size() > 1u && std::none_of(groups.cbegin(), groups.cend(), [id = pdata.info.hash()](auto &&gdata) { return gdata.owned(id); })) {
+                pdata.pool->sort(compare, algo, args...);
+            }
+        }
+    }
+
     /**
      * @brief Visits an entity and returns the type info for its components.
      *
@@ -1450,11 +2802,7 @@ public:
      */
     template<typename Func>
     void visit(entity_type entity, Func func) const {
-        for(auto pos = pools.size(); pos; --pos) {
-            if(const auto &pdata = pools[pos-1]; pdata.pool && pdata.pool->contains(entity)) {
-                func(pdata.info);
-            }
-        }
+        pools_of(entity, [&func](auto &&pdata) { func(pdata.info); });
     }
 
     /**
@@ -1486,6 +2834,57 @@ public:
         }
     }
 
+    /**
+     * @brief Visits a registry and returns the memory usage of its pools.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const type_info, const pool_stats &);
+     * @endcode
+     *
+     * Statistics are those of the pools of the components managed by the
+     * registry. They are useful to find pools that waste memory, for example
+     * because of large identifiers or of a capacity far greater than the size,
+     * and to decide when to shrink them.
+     *
+     * @sa pool_stats
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void stats(Func func) const {
+        for(auto pos = pools.size(); pos; --pos) {
+            if(const auto &pdata = pools[pos-1]; pdata.pool) {
+                func(pdata.info, pdata.pool->memory_usage());
+            }
+        }
+    }
+
+    /**
+     * @brief Visits a registry and returns the sizes of its groups.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t, const std::size_t);
+     * @endcode
+     *
+     * The function receives the number of types a group refers to and the
+     * number of entities it contains. Non-owning groups that have not been
+     * used yet are reported as empty.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void group_stats(Func func) const {
+        for(auto &&gdata: groups) {
+            func(gdata.size, gdata.length(gdata.group.get()));
+        }
+    }
+
     /**
      * @brief Binds an object to the context of the registry.
      *
@@ -1499,9 +2898,23 @@ public:
      */
     template<typename Type, typename... Args>
     Type & set(Args &&... args) {
-        unset<Type>();
-        vars.push_back(variable_data{type_id<Type>(), { new Type{std::forward<Args>(args)...}, [](void *instance) { delete static_cast<Type *>(instance); } }});
-        return *static_cast<Type *>(vars.back().value.get());
+        std::unique_ptr<void, void(*)(void *)> value{new Type{std::forward<Args>(args)...}, [](void *instance) { delete static_cast<Type *>(instance); }};
+        auto *instance = static_cast<Type *>(value.get());
+
+        if(const auto pos = var_index(type_seq<Type>::value()); pos != vars.size()) {
+            vars[pos].value = std::move(value);
+        } else {
+            const auto seq = std::size_t{type_seq<Type>::value()};
+
+            if(!(seq < var_lookup.size())) {
+                var_lookup.resize(seq + 1u);
+            }
+
+            var_lookup[seq] = vars.size() + 1u;
+            vars.push_back(variable_data{type_id<Type>(), std::move(value)});
+        }
+
+        return *instance;
     }
 
     /**
@@ -1510,9 +2923,17 @@ public:
      */
     template<typename Type>
     void unset() {
-        vars.erase(std::remove_if(vars.begin(), vars.end(), [](auto &&var) {
-            return var.info.hash() == type_hash<Type>::value();
-        }), vars.end());
+        if(const auto pos = var_index(type_seq<Type>::value()); pos != vars.size()) {
+            var_lookup[std::size_t{type_seq<Type>::value()}] = {};
+
+            if(const auto last = vars.size() - 1u; pos != last) {
+                // the last variable takes the place of the one removed
+                vars[pos] = std::move(vars[last]);
+                var_lookup[std::size_t{vars[pos].info.seq()}] = pos + 1u;
+            }
+
+            vars.pop_back();
+        }
     }
 
     /**
@@ -1540,8 +2961,8 @@ public:
      */
     template<typename Type>
     [[nodiscard]] const Type * try_ctx() const {
-        auto it = std::find_if(vars.cbegin(), vars.cend(), [](auto &&var) { return var.info.hash() == type_hash<Type>::value(); });
-        return it == vars.cend() ? nullptr : static_cast<const Type *>(it->value.get());
+        const auto pos = var_index(type_seq<Type>::value());
+        return pos == vars.size() ? nullptr : static_cast<const Type *>(vars[pos].value.get());
     }
 
     /*! @copydoc try_ctx */
@@ -1602,11 +3023,21 @@ public:
     }
 
 private:
+    std::pmr::memory_resource *resource{std::pmr::get_default_resource()};
     std::vector<group_data> groups{};
     mutable std::vector<pool_data> pools{};
+    mutable std::vector<id_type> lookup{};
     std::vector<entity_type> entities{};
+    std::vector<word_type> in_use{};
     std::vector<variable_data> vars{};
+    std::vector<std::size_t> var_lookup{};
     entity_type available{null};
+    std::uint64_t clock{1u};
+    typename traits_type::entity_type bits{};
+    mutable std::vector<signature_data> signatures{};
+    sigh<void(basic_registry &, const entity_type *, const entity_type *)> remapping{};
+    bool caching{};
+    bool sealed{};
 };
 
 
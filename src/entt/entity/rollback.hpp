@@ -0,0 +1,248 @@
+#ifndef ENTT_ENTITY_ROLLBACK_HPP
+#define ENTT_ENTITY_ROLLBACK_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Utility class to save and rewind the state of a registry.
+ *
+ * A rollback keeps the last frames saved from a registry, up to a given
+ * length. Each frame contains the list of entities of the registry and the
+ * pools of the given components.<br/>
+ * Frames are split in pages of fixed size. Pages that didn't change since the
+ * previous frame are shared rather than copied, so that the memory used by the
+ * history is proportional to what changes from frame to frame rather than to
+ * the size of the world.
+ *
+ * @note
+ * Restoring a frame clears the registry first. Components that aren't managed
+ * by the rollback are lost in the process.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components to save and restore.
+ */
+template<typename Entity, typename... Component>
+class basic_rollback {
+    static_assert((std::is_trivially_copyable_v<Component> && ...), "Components must be trivially copyable");
+
+    static constexpr std::size_t page_size = 4096u;
+    using page_type = std::array<std::byte, page_size>;
+
+    struct chain {
+        void assign(const void *data, const std::size_t length, const chain *prev) {
+            const auto *src = static_cast<const std::byte *>(data);
+            pages.resize((length + page_size - 1u) / page_size);
+            bytes = length;
+
+            for(std::size_t pos{}, offset{}; offset < length; ++pos, offset += page_size) {
+                const auto count = (std::min)(page_size, length - offset);
+
+                if(prev && pos < prev->pages.size() && offset + count <= prev->bytes && std::memcmp(prev->pages[pos]->data(), src + offset, count) == 0) {
+                    pages[pos] = prev->pages[pos];
+                } else {
+                    auto page = std::make_shared<page_type>();
+                    std::memcpy(page->data(), src + offset, count);
+                    pages[pos] = std::move(page);
+                }
+            }
+        }
+
+        void copy(void *data) const {
+            auto *dst = static_cast<std::byte *>(data);
+
+            for(std::size_t pos{}, offset{}; offset < bytes; ++pos, offset += page_size) {
+                std::memcpy(dst + offset, pages[pos]->data(), (std::min)(page_size, bytes - offset));
+            }
+        }
+
+        std::vector<std::shared_ptr<const page_type>> pages{};
+        std::size_t bytes{};
+    };
+
+    struct pool_frame {
+        chain entities;
+        chain instances;
+    };
+
+    struct frame {
+        chain entities;
+        Entity destroyed;
+        std::array<pool_frame, sizeof...(Component)> pools;
+    };
+
+    template<typename Type>
+    static void save_pool(const basic_registry<Entity> &reg, const pool_frame *prev, pool_frame &curr) {
+        const auto &cpool = reg.template storage<Type>();
+        curr.entities.assign(cpool.data(), cpool.size() * sizeof(Entity), prev ? &prev->entities : nullptr);
+
+        if constexpr(!is_empty_v<Type>) {
+            curr.instances.assign(cpool.raw(), cpool.size() * sizeof(Type), prev ? &prev->instances : nullptr);
+        }
+    }
+
+    template<typename Type>
+    static void restore_pool(basic_registry<Entity> &reg, const pool_frame &curr) {
+        std::vector<Entity> entt(curr.entities.bytes / sizeof(Entity));
+        curr.entities.copy(entt.data());
+
+        if constexpr(is_empty_v<Type>) {
+            reg.template insert<Type>(entt.cbegin(), entt.cend());
+        } else {
+            std::vector<std::aligned_storage_t<sizeof(Type), alignof(Type)>> buffer(entt.size());
+            curr.instances.copy(buffer.data());
+            const auto *first = reinterpret_cast<const Type *>(buffer.data());
+            reg.template insert<Type>(entt.cbegin(), entt.cend(), first, first + entt.size());
+        }
+    }
+
+    template<std::size_t... Index>
+    void save(const basic_registry<Entity> &reg, std::index_sequence<Index...>) {
+        const frame *prev = frames.empty() ? nullptr : &frames.back();
+        auto &curr = frames.emplace_back();
+
+        curr.entities.assign(reg.data(), reg.size() * sizeof(Entity), prev ? &prev->entities : nullptr);
+        curr.destroyed = reg.destroyed();
+        (save_pool<Component>(reg, prev ? &prev->pools[Index] : nullptr, curr.pools[Index]), ...);
+    }
+
+    template<std::size_t... Index>
+    void restore(basic_registry<Entity> &reg, const frame &curr, std::index_sequence<Index...>) const {
+        std::vector<Entity> entt(curr.entities.bytes / sizeof(Entity));
+        curr.entities.copy(entt.data());
+
+        reg.clear();
+        reg.assign(entt.cbegin(), entt.cend(), curr.destroyed);
+        (restore_pool<Component>(reg, curr.pools[Index]), ...);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a rollback with a given length.
+     * @param len The maximum number of frames to keep.
+     */
+    explicit basic_rollback(const size_type len = 8u)
+        : frames{},
+          length{len}
+    {
+        ENTT_ASSERT(length);
+    }
+
+    /**
+     * @brief Saves the state of a registry as the most recent frame.
+     *
+     * The oldest frame is discarded if the maximum length is exceeded.
+     *
+     * @param reg A valid reference to a registry.
+     */
+    void save(const basic_registry<Entity> &reg) {
+        save(reg, std::index_sequence_for<Component...>{});
+
+        if(frames.size() > length) {
+            frames.pop_front();
+        }
+    }
+
+    /**
+     * @brief Restores the state of a registry from a given frame.
+     *
+     * Frames are counted backwards from the most recent one, that is, a value
+     * of zero restores the last frame saved. All the frames more recent than
+     * the one restored are discarded, so that the history can be resimulated.
+     *
+     * @warning
+     * Attempting to restore a frame that doesn't exist results in undefined
+     * behavior.
+     *
+     * @param reg A valid reference to a registry.
+     * @param back The number of frames to rewind from the most recent one.
+     */
+    void restore(basic_registry<Entity> &reg, const size_type back = 0u) {
+        ENTT_ASSERT(back < frames.size());
+        frames.erase(frames.end() - back, frames.end());
+        restore(reg, frames.back(), std::index_sequence_for<Component...>{});
+    }
+
+    /**
+     * @brief Returns the number of frames saved so far.
+     * @return Number of frames saved so far.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return frames.size();
+    }
+
+    /**
+     * @brief Checks whether the history is empty.
+     * @return True if there are no frames, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return frames.empty();
+    }
+
+    /**
+     * @brief Returns the number of distinct pages used by the history.
+     *
+     * Pages shared by multiple frames are counted only once. The memory used
+     * by the history amounts roughly to this value times the page size.
+     *
+     * @return Number of distinct pages used by the history.
+     */
+    [[nodiscard]] size_type pages() const {
+        std::vector<const page_type *> all{};
+
+        const auto collect = [&all](const chain &elem) {
+            for(auto &&page: elem.pages) {
+                all.push_back(page.get());
+            }
+        };
+
+        for(auto &&curr: frames) {
+            collect(curr.entities);
+
+            for(auto &&pdata: curr.pools) {
+                collect(pdata.entities);
+                collect(pdata.instances);
+            }
+        }
+
+        std::sort(all.begin(), all.end());
+        return static_cast<size_type>(std::unique(all.begin(), all.end()) - all.begin());
+    }
+
+    /*! @brief Discards all the frames. */
+    void clear() {
+        frames.clear();
+    }
+
+private:
+    std::deque<frame> frames;
+    size_type length;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,320 @@
+#ifndef ENTT_ENTITY_RUNTIME_STORAGE_HPP
+#define ENTT_ENTITY_RUNTIME_STORAGE_HPP
+
+
+#include <cstddef>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Description of a type of objects that isn't known at compile-time.
+ *
+ * Function pointers are invoked on properly aligned memory. Those for the copy
+ * and the default construction are optional, as long as objects are never
+ * copied or default constructed respectively. Move construction and
+ * destruction are required instead.
+ */
+struct runtime_descriptor {
+    /*! @brief Name of the type, if any. */
+    std::string_view name{};
+    /*! @brief Size of the objects in bytes. */
+    std::size_t size{};
+    /*! @brief Alignment of the objects in bytes. */
+    std::size_t alignment{alignof(std::max_align_t)};
+    /*! @brief Default constructs an object in place. */
+    void(* construct)(void *){};
+    /*! @brief Copy constructs an object in place. */
+    void(* copy)(void *, const void *){};
+    /*! @brief Move constructs an object in place. */
+    void(* move)(void *, void *){};
+    /*! @brief Destroys an object in place. */
+    void(* destroy)(void *){};
+};
+
+
+/**
+ * @brief Returns the runtime descriptor of a type known at compile-time.
+ *
+ * This is mainly meant for types that are exposed to scripts or plugins and
+ * that have to share the storage of their runtime counterparts.
+ *
+ * @tparam Type Type of objects to describe.
+ * @param name Optional name of the type.
+ * @return The runtime descriptor of the given type.
+ */
+template<typename Type>
+[[nodiscard]] runtime_descriptor make_runtime_descriptor(const std::string_view name = type_name<Type>::value()) ENTT_NOEXCEPT {
+    static_assert(std::is_move_constructible_v<Type> && std::is_destructible_v<Type>, "The type must be at least move constructible and destructible");
+
+    runtime_descriptor desc{name, sizeof(Type), alignof(Type)};
+
+    if constexpr(std::is_default_constructible_v<Type>) {
+        desc.construct = +[](void *instance) { new (instance) Type{}; };
+    }
+
+    if constexpr(std::is_copy_constructible_v<Type>) {
+        desc.copy = +[](void *instance, const void *other) { new (instance) Type{*static_cast<const Type *>(other)}; };
+    }
+
+    desc.move = +[](void *instance, void *other) { new (instance) Type{std::move(*static_cast<Type *>(other))}; };
+    desc.destroy = +[](void *instance) { static_cast<Type *>(instance)->~Type(); };
+
+    return desc;
+}
+
+
+/**
+ * @brief Storage for objects whose type is known only at runtime.
+ *
+ * The size, the alignment and the special member functions of the objects are
+ * those of a runtime descriptor. Objects are tightly packed in the same order
+ * of the entities, as it happens with the basic storage.<br/>
+ * A registry creates this kind of storage on demand for a runtime identifier,
+ * so that its entities can be iterated by means of runtime views and its
+ * objects can be serialized along with those of the other pools.
+ *
+ * @warning
+ * Objects are addressed as opaque pointers. Attempting to use them as objects
+ * of a type other than the one described results in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_runtime_storage: public basic_sparse_set<Entity> {
+    using underlying_type = basic_sparse_set<Entity>;
+
+    [[nodiscard]] std::byte * at(const std::size_t pos) const ENTT_NOEXCEPT {
+        return instances + pos * stride;
+    }
+
+    void reserve_instances(const std::size_t cap) {
+        if(cap > capacity) {
+            auto *other = static_cast<std::byte *>(::operator new(cap * stride, std::align_val_t{desc.alignment}));
+
+            for(std::size_t pos{}; pos < count; ++pos) {
+                desc.move(other + pos * stride, at(pos));
+                desc.destroy(at(pos));
+            }
+
+            release();
+            instances = other;
+            capacity = cap;
+            ENTT_ALLOC_TRACE("entt::runtime_storage::reserve", desc.name, cap * stride);
+        }
+    }
+
+    void release() ENTT_NOEXCEPT {
+        if(instances) {
+            ::operator delete(instances, std::align_val_t{desc.alignment});
+        }
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        // the spare slot past the last object is used as a temporary
+        desc.move(at(count), at(lhs));
+        desc.destroy(at(lhs));
+        desc.move(at(lhs), at(rhs));
+        desc.destroy(at(rhs));
+        desc.move(at(rhs), at(count));
+        desc.destroy(at(count));
+    }
+
+    void swap_and_pop(const std::size_t pos) final {
+        desc.destroy(at(pos));
+
+        if(--count; pos != count) {
+            desc.move(at(pos), at(count));
+            desc.destroy(at(count));
+        }
+    }
+
+    void clear_all() ENTT_NOEXCEPT final {
+        for(; count; --count) {
+            desc.destroy(at(count - 1u));
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty storage for a given type of objects.
+     * @param identifier The runtime identifier of the type of objects.
+     * @param descriptor The runtime descriptor of the objects.
+     */
+    basic_runtime_storage(const id_type identifier, const runtime_descriptor &descriptor)
+        : ident{identifier},
+          desc{descriptor},
+          stride{(descriptor.size + descriptor.alignment - 1u) / descriptor.alignment * descriptor.alignment},
+          instances{},
+          count{},
+          capacity{}
+    {
+        ENTT_ASSERT(desc.size && desc.move && desc.destroy);
+        ENTT_ASSERT(!(desc.alignment & (desc.alignment - 1u)));
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_runtime_storage(const basic_runtime_storage &) = delete;
+
+    /*! @brief Destroys the objects and releases the memory. */
+    ~basic_runtime_storage() override {
+        clear_all();
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_runtime_storage & operator=(const basic_runtime_storage &) = delete;
+
+    /**
+     * @brief Returns the runtime identifier of the type of objects.
+     * @return The runtime identifier of the type of objects.
+     */
+    [[nodiscard]] id_type id() const ENTT_NOEXCEPT {
+        return ident;
+    }
+
+    /**
+     * @brief Returns the runtime descriptor of the objects.
+     * @return The runtime descriptor of the objects.
+     */
+    [[nodiscard]] const runtime_descriptor & descriptor() const ENTT_NOEXCEPT {
+        return desc;
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        reserve_instances(cap + 1u);
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+        stats.instances = capacity;
+        stats.instance_bytes = capacity * stride;
+        return stats;
+    }
+
+    /**
+     * @brief Direct access to the array of objects.
+     * @return A pointer to the array of objects.
+     */
+    [[nodiscard]] const void * raw() const ENTT_NOEXCEPT {
+        return instances;
+    }
+
+    /*! @copydoc raw */
+    [[nodiscard]] void * raw() ENTT_NOEXCEPT {
+        return instances;
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @return A pointer to the object assigned to the entity.
+     */
+    [[nodiscard]] const void * get(const entity_type entt) const {
+        return at(this->index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] void * get(const entity_type entt) {
+        return at(this->index(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * The object is copy constructed from the one provided, if any. Otherwise,
+     * it's default constructed.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @param value An optional object to copy.
+     * @return A pointer to the newly created object.
+     */
+    void * emplace(const entity_type entt, const void *value = nullptr) {
+        if(!(count + 1u < capacity)) {
+            // a spare slot is always available past the last object
+            reserve_instances(capacity ? (capacity * 2u) : 8u);
+        }
+
+        if(value) {
+            ENTT_ASSERT(desc.copy);
+            desc.copy(at(count), value);
+        } else {
+            ENTT_ASSERT(desc.construct);
+            desc.construct(at(count));
+        }
+
+        // entity goes after the object in case its constructor throws
+        ++count;
+        underlying_type::emplace(entt);
+        return at(count - 1u);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and moves an object to it.
+     * @param entt A valid entity identifier.
+     * @param value A valid object to move.
+     * @return A pointer to the newly created object.
+     */
+    void * emplace_move(const entity_type entt, void *value) {
+        if(!(count + 1u < capacity)) {
+            // a spare slot is always available past the last object
+            reserve_instances(capacity ? (capacity * 2u) : 8u);
+        }
+
+        desc.move(at(count), value);
+        ++count;
+        underlying_type::emplace(entt);
+        return at(count - 1u);
+    }
+
+private:
+    id_type ident;
+    runtime_descriptor desc;
+    size_type stride;
+    std::byte *instances;
+    size_type count;
+    size_type capacity;
+};
+
+
+}
+
+
+#endif
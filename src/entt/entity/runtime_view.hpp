@@ -6,8 +6,10 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <cstdint>
 #include <type_traits>
 #include "../config/config.h"
+#include "../signal/delegate.hpp"
 #include "sparse_set.hpp"
 #include "fwd.hpp"
 
@@ -22,7 +24,7 @@ namespace entt {
  * components in their bags. During initialization, a runtime view looks at the
  * number of entities available for each component and picks up a reference to
  * the smallest set of candidate entities in order to get a performance boost
- * when iterate.<br/>
+ * when iterate. The other pools are tested in order of increasing size.<br/>
  * Order of elements during iterations are highly dependent on the order of the
  * underlying data structures. See sparse_set and its specializations for more
  * details.
@@ -47,6 +49,11 @@ namespace entt {
  * a pool was missing when the view was built (in this case, the view won't
  * have a valid reference and won't be updated accordingly).
  *
+ * @note
+ * Views returned by a signature index test entities against the bitsets of the
+ * index rather than the pools. In this case, the lifetime of the view must not
+ * overcome that of the index either.
+ *
  * @warning
  * Lifetime of a view must not overcome that of the registry that generated it.
  * In any other case, attempting to use a view results in undefined behavior.
@@ -58,14 +65,19 @@ class basic_runtime_view final {
     /*! @brief A registry is allowed to create views. */
     friend class basic_registry<Entity>;
 
+    /*! @brief A signature index is allowed to attach itself to views. */
+    friend class basic_signature_index<Entity>;
+
     using underlying_iterator = typename basic_sparse_set<Entity>::iterator;
 
     class view_iterator final {
         friend class basic_runtime_view<Entity>;
 
-        view_iterator(const std::vector<const basic_sparse_set<Entity> *> &cpools, const std::vector<const basic_sparse_set<Entity> *> &ignore, underlying_iterator curr) ENTT_NOEXCEPT
+        view_iterator(const std::vector<const basic_sparse_set<Entity> *> &cpools, const std::vector<const basic_sparse_set<Entity> *> &ignore, const delegate<bool(const Entity, const std::uint64_t *)> &index, const std::uint64_t *mask, underlying_iterator curr) ENTT_NOEXCEPT
             : pools{&cpools},
               filter{&ignore},
+              signature{&index},
+              masks{mask},
               it{curr}
         {
             if(it != (*pools)[0]->end() && !valid()) {
@@ -74,7 +86,11 @@ class basic_runtime_view final {
         }
 
         [[nodiscard]] bool valid() const {
-            return std::all_of(pools->begin()++, pools->end(), [entt = *it](const auto *curr) { return curr->contains(entt); })
+            if(*signature) {
+                return (*signature)(*it, masks);
+            }
+
+            return std::all_of(std::next(pools->begin()), pools->end(), [entt = *it](const auto *curr) { return curr->contains(entt); })
                     && std::none_of(filter->cbegin(), filter->cend(), [entt = *it](const auto *curr) { return curr && curr->contains(entt); });
         }
 
@@ -126,25 +142,36 @@ class basic_runtime_view final {
     private:
         const std::vector<const basic_sparse_set<Entity> *> *pools;
         const std::vector<const basic_sparse_set<Entity> *> *filter;
+        const delegate<bool(const Entity, const std::uint64_t *)> *signature;
+        const std::uint64_t *masks;
         underlying_iterator it;
     };
 
     basic_runtime_view(std::vector<const basic_sparse_set<Entity> *> cpools, std::vector<const basic_sparse_set<Entity> *> epools) ENTT_NOEXCEPT
         : pools{std::move(cpools)},
-          filter{std::move(epools)}
+          filter{std::move(epools)},
+          signature{},
+          masks{}
     {
-        const auto it = std::min_element(pools.begin(), pools.end(), [](const auto *lhs, const auto *rhs) {
+        // brings the best candidate (if any) on front of the vector, smaller pools reject more entities and are tested first
+        std::stable_sort(pools.begin(), pools.end(), [](const auto *lhs, const auto *rhs) {
             return (!lhs && rhs) || (lhs && rhs && lhs->size() < rhs->size());
         });
-
-        // brings the best candidate (if any) on front of the vector
-        std::rotate(pools.begin(), it, pools.end());
     }
 
     [[nodiscard]] bool valid() const {
         return !pools.empty() && pools.front();
     }
 
+    [[nodiscard]] bool accept(const Entity entt) const {
+        if(signature) {
+            return signature(entt, masks.data());
+        }
+
+        return std::all_of(std::next(pools.cbegin()), pools.cend(), [entt](const auto *curr) { return curr->contains(entt); })
+                && std::none_of(filter.cbegin(), filter.cend(), [entt](const auto *curr) { return curr && curr->contains(entt); });
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -172,7 +199,7 @@ public:
      * @return An iterator to the first entity that has the given components.
      */
     [[nodiscard]] iterator begin() const {
-        return valid() ? iterator{pools, filter, pools[0]->begin()} : iterator{};
+        return valid() ? iterator{pools, filter, signature, masks.data(), pools[0]->begin()} : iterator{};
     }
 
     /**
@@ -187,7 +214,7 @@ public:
      * given components.
      */
     [[nodiscard]] iterator end() const {
-        return valid() ? iterator{pools, filter, pools[0]->end()} : iterator{};
+        return valid() ? iterator{pools, filter, signature, masks.data(), pools[0]->end()} : iterator{};
     }
 
     /**
@@ -196,6 +223,10 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const {
+        if(signature) {
+            return valid() && signature(entt, masks.data());
+        }
+
         return valid() && std::all_of(pools.cbegin(), pools.cend(), [entt](const auto *curr) { return curr->contains(entt); })
                 && std::none_of(filter.cbegin(), filter.cend(), [entt](const auto *curr) { return curr && curr->contains(entt); });
     }
@@ -222,9 +253,61 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities in parallel and applies the given function
+     * object to them.
+     *
+     * The pool used to drive the iterations is split in chunks of contiguous
+     * elements and each chunk is offered to the executor as a separate task.
+     * Every task performs its own checks against the other pools and the
+     * exclusion list.<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying components of the iterated types during a
+     * parallel iteration results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        ENTT_ASSERT(chunk);
+        const auto length = size_hint();
+
+        if(const auto count = (length + chunk - 1u) / chunk; count) {
+            executor(count, [this, &func, length, chunk](const size_type pos) {
+                const auto *data = pools.front()->data();
+
+                for(auto next = pos * chunk, last = (std::min)(next + chunk, length); next < last; ++next) {
+                    if(const auto entt = data[next]; accept(entt)) {
+                        func(entt);
+                    }
+                }
+            });
+        }
+    }
+
 private:
     std::vector<const basic_sparse_set<Entity> *> pools;
     std::vector<const basic_sparse_set<Entity> *> filter;
+    delegate<bool(const Entity, const std::uint64_t *)> signature;
+    std::vector<std::uint64_t> masks;
 };
 
 
@@ -0,0 +1,230 @@
+#ifndef ENTT_ENTITY_SHARDED_HPP
+#define ENTT_ENTITY_SHARDED_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "utility.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Registry partitioned in shards with disjoint identifiers.
+ *
+ * A sharded registry owns a fixed number of registries, each of which uses a
+ * different value for the users' bits of its identifiers. Therefore, the shard
+ * an entity belongs to is encoded in its identifier and the identifiers of
+ * different shards never clash.<br/>
+ * Shards are plain registries and work in isolation. Entities and components
+ * can move from one shard to another by means of `migrate`, while iterations
+ * can be spread over many threads, one task per shard.
+ *
+ * @sa basic_entt_traits
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_sharded_registry {
+    using traits_type = entt_traits<Entity>;
+
+    static_assert(traits_type::user_mask != 0u, "The entity type reserves no bits for users' purposes");
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Type of registries used as shards. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a sharded registry with the given number of shards.
+     * @param count Number of shards, that must fit the users' bits.
+     */
+    explicit basic_sharded_registry(const size_type count)
+        : shards(count)
+    {
+        ENTT_ASSERT(count && (count - 1u) <= static_cast<size_type>(traits_type::user_mask >> traits_type::user_shift));
+
+        for(size_type pos{}; pos < count; ++pos) {
+            shards[pos].user_bits(static_cast<typename traits_type::entity_type>(pos) << traits_type::user_shift);
+        }
+    }
+
+    /**
+     * @brief Returns the number of shards.
+     * @return Number of shards.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return shards.size();
+    }
+
+    /**
+     * @brief Returns the shard an entity belongs to.
+     * @param entity An entity identifier, either valid or not.
+     * @return The index of the shard that generated the identifier.
+     */
+    [[nodiscard]] static size_type shard(const entity_type entity) ENTT_NOEXCEPT {
+        return static_cast<size_type>((to_integral(entity) & traits_type::user_mask) >> traits_type::user_shift);
+    }
+
+    /**
+     * @brief Returns the registry used as a given shard.
+     * @param pos The index of the shard to return.
+     * @return A reference to the requested shard.
+     */
+    [[nodiscard]] const registry_type & operator[](const size_type pos) const {
+        ENTT_ASSERT(pos < shards.size());
+        return shards[pos];
+    }
+
+    /*! @copydoc operator[] */
+    [[nodiscard]] registry_type & operator[](const size_type pos) {
+        return const_cast<registry_type &>(std::as_const(*this)[pos]);
+    }
+
+    /**
+     * @brief Checks if an identifier refers to a valid entity of its shard.
+     * @param entity An entity identifier, either valid or not.
+     * @return True if the identifier is valid, false otherwise.
+     */
+    [[nodiscard]] bool valid(const entity_type entity) const {
+        const auto pos = shard(entity);
+        return pos < shards.size() && shards[pos].valid(entity);
+    }
+
+    /**
+     * @brief Creates a new entity within a given shard.
+     * @param pos The index of the shard in which to create the entity.
+     * @return A valid entity identifier.
+     */
+    [[nodiscard]] entity_type create(const size_type pos) {
+        return (*this)[pos].create();
+    }
+
+    /**
+     * @brief Destroys an entity and releases its identifier.
+     * @param entity A valid entity identifier.
+     */
+    void destroy(const entity_type entity) {
+        (*this)[shard(entity)].destroy(entity);
+    }
+
+    /**
+     * @brief Moves entities and their components to a given shard.
+     *
+     * Components are moved in bulk, pool by pool. The original entities are
+     * destroyed and the identifiers in the range are replaced with those
+     * created in the destination shard. Entities that already belong to it are
+     * left untouched.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param to The index of the destination shard.
+     */
+    template<typename It>
+    void migrate(It first, It last, const size_type to) {
+        auto &&dst = (*this)[to];
+
+        for(size_type from{}, count = shards.size(); from < count; ++from) {
+            if(from != to) {
+                std::vector<entity_type> source{};
+                std::vector<It> where{};
+
+                for(auto it = first; it != last; ++it) {
+                    if(shard(*it) == from) {
+                        source.push_back(*it);
+                        where.push_back(it);
+                    }
+                }
+
+                if(!source.empty()) {
+                    std::vector<entity_type> target(source.size());
+                    dst.create(target.begin(), target.end());
+                    shards[from].transfer(source.cbegin(), source.cend(), dst, target.cbegin());
+                    shards[from].destroy(source.cbegin(), source.cend());
+
+                    for(size_type pos{}, end = where.size(); pos < end; ++pos) {
+                        *where[pos] = target[pos];
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Moves an entity and its components to a given shard.
+     *
+     * @sa migrate
+     *
+     * @param entity A valid entity identifier.
+     * @param to The index of the destination shard.
+     * @return The identifier of the entity within the destination shard.
+     */
+    [[nodiscard]] entity_type migrate(entity_type entity, const size_type to) {
+        migrate(&entity, &entity + 1u, to);
+        return entity;
+    }
+
+    /**
+     * @brief Iterates entities and components of all the shards, one task per
+     * shard.
+     *
+     * The function object is the same that would be used with a view for the
+     * given components and it's applied to the entities of all the shards.<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa basic_view::each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying entities or components during a parallel
+     * iteration results in undefined behavior.
+     *
+     * @tparam Component Types of components used to construct the views.
+     * @tparam Exclude Types of components used to filter the views.
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename... Component, typename... Exclude, typename Exec, typename Func>
+    void par_each(Exec executor, Func func, exclude_t<Exclude...> = {}) {
+        // pools are created up front, tasks only read the shards
+        for(auto &&curr: shards) {
+            (curr.template prepare<std::remove_const_t<Component>>(), ...);
+            (curr.template prepare<Exclude>(), ...);
+        }
+
+        executor(shards.size(), [this, &func](const size_type pos) {
+            shards[pos].template view<Component...>(exclude<Exclude...>).each(func);
+        });
+    }
+
+private:
+    std::vector<registry_type> shards;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef ENTT_ENTITY_SIGNATURE_HPP
+#define ENTT_ENTITY_SIGNATURE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../signal/delegate.hpp"
+#include "../signal/sigh.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "runtime_view.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Component signature index.
+ *
+ * A signature index keeps a bitset for each entity, with one bit for each of
+ * the tracked types of components. Bitsets are kept up-to-date by means of the
+ * signals of the pools, therefore tracking a type slightly slows down the
+ * creation and destruction of its components. Bitsets also follow their
+ * entities when the registry renumbers them.<br/>
+ * In exchange, the index can test all the types of a runtime view at once with
+ * a masked compare and count the entities that match a set of types without
+ * accessing the pools at all.
+ *
+ * @warning
+ * Lifetime of an index must not overcome that of the registry it tracks. The
+ * index must also be discarded in case the registry is moved.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_signature_index {
+    using traits_type = entt_traits<Entity>;
+    using word_type = std::uint64_t;
+
+    static constexpr auto word_digits = std::numeric_limits<word_type>::digits;
+
+    [[nodiscard]] static auto index(const Entity entt) ENTT_NOEXCEPT {
+        return std::size_t{to_integral(entt) & traits_type::entity_mask};
+    }
+
+    [[nodiscard]] std::size_t bit(const id_type type) const {
+        return static_cast<std::size_t>(std::distance(types.cbegin(), std::find(types.cbegin(), types.cend(), type)));
+    }
+
+    void assign(const Entity *first, const Entity *last, const std::size_t pos, const bool value) {
+        const auto offset = pos / word_digits;
+        const auto flag = word_type{1u} << (pos % word_digits);
+
+        for(; first != last; ++first) {
+            const auto base = index(*first) * stride;
+
+            if(!(base < signatures.size())) {
+                signatures.resize(base + stride);
+            }
+
+            signatures[base + offset] = value ? (signatures[base + offset] | flag) : (signatures[base + offset] & ~flag);
+        }
+    }
+
+    template<typename Component>
+    void set(basic_registry<Entity> &, const Entity *first, const Entity *last) {
+        assign(first, last, bit(type_hash<Component>::value()), true);
+    }
+
+    template<typename Component>
+    void unset(basic_registry<Entity> &, const Entity *first, const Entity *last) {
+        assign(first, last, bit(type_hash<Component>::value()), false);
+    }
+
+    void remap(basic_registry<Entity> &, const Entity *first, const Entity *last) {
+        // bitsets follow their entities, those of the identifiers no longer in use are dropped
+        std::vector<word_type> other{};
+
+        for(std::size_t pos{}, end = (std::min)(static_cast<std::size_t>(last - first), signatures.size() / stride); pos < end; ++pos) {
+            if(first[pos] != null) {
+                if(const auto base = index(first[pos]) * stride; !(base < other.size())) {
+                    other.resize(base + stride);
+                }
+
+                std::copy_n(signatures.cbegin() + pos * stride, stride, other.begin() + index(first[pos]) * stride);
+            }
+        }
+
+        signatures = std::move(other);
+    }
+
+    template<typename It, typename Other>
+    [[nodiscard]] std::vector<word_type> mask(It first, It last, Other from, Other to) const {
+        // masks start with their width, so that they outlive any further growth of the bitsets
+        std::vector<word_type> masks(1u + 2u * stride);
+        masks[0u] = stride;
+
+        for(; first != last; ++first) {
+            if(const auto pos = bit(*first); pos == types.size()) {
+                return {};
+            } else {
+                masks[1u + pos / word_digits] |= word_type{1u} << (pos % word_digits);
+            }
+        }
+
+        for(; from != to; ++from) {
+            if(const auto pos = bit(*from); pos == types.size()) {
+                return {};
+            } else {
+                masks[1u + stride + pos / word_digits] |= word_type{1u} << (pos % word_digits);
+            }
+        }
+
+        return masks;
+    }
+
+    [[nodiscard]] bool test_at(const std::size_t base, const word_type *masks) const ENTT_NOEXCEPT {
+        // types are only ever appended, words past the width of the masks are of no interest
+        const auto width = static_cast<std::size_t>(masks[0u]);
+        bool match = (base < signatures.size());
+
+        for(std::size_t pos{}; match && pos < width; ++pos) {
+            const auto curr = signatures[base + pos];
+            match = ((curr & masks[1u + pos]) == masks[1u + pos]) && !(curr & masks[1u + width + pos]);
+        }
+
+        return match;
+    }
+
+    [[nodiscard]] bool test(const Entity entt, const word_type *masks) const ENTT_NOEXCEPT {
+        return test_at(index(entt) * stride, masks);
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an index for a given registry.
+     * @param ref A valid reference to a registry.
+     */
+    explicit basic_signature_index(registry_type &ref)
+        : reg{&ref},
+          types{},
+          connections{},
+          signatures{},
+          stride{1u}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_signature_index(const basic_signature_index &) = delete;
+
+    /*! @brief Disconnects the index from the registry. */
+    ~basic_signature_index() {
+        for(auto &&conn: connections) {
+            conn.release();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_signature_index & operator=(const basic_signature_index &) = delete;
+
+    /**
+     * @brief Starts tracking the given types of components.
+     *
+     * Bitsets are filled for the entities that already own the given
+     * components. Types that are already tracked are ignored.
+     *
+     * @tparam Component Types of components to track.
+     */
+    template<typename... Component>
+    void track() {
+        ([this](auto *type) {
+            using component_type = std::remove_pointer_t<decltype(type)>;
+
+            if(const auto ctype = type_hash<component_type>::value(); !tracked(ctype)) {
+                if(types.empty()) {
+                    connections.push_back(reg->on_remap().template connect<&basic_signature_index::remap>(*this));
+                }
+
+                types.push_back(ctype);
+
+                if(const auto required = (types.size() + word_digits - 1u) / word_digits; required != stride) {
+                    std::vector<word_type> other(signatures.size() / stride * required);
+
+                    for(size_type pos{}, last = signatures.size() / stride; pos < last; ++pos) {
+                        std::copy_n(signatures.cbegin() + pos * stride, stride, other.begin() + pos * required);
+                    }
+
+                    signatures = std::move(other);
+                    stride = required;
+                }
+
+                auto &&cpool = reg->template view<component_type>();
+                assign(cpool.data(), cpool.data() + cpool.size(), types.size() - 1u, true);
+
+                connections.push_back(reg->template on_construct_range<component_type>().template connect<&basic_signature_index::set<component_type>>(*this));
+                connections.push_back(reg->template on_destroy_range<component_type>().template connect<&basic_signature_index::unset<component_type>>(*this));
+            }
+        }(static_cast<Component *>(nullptr)), ...);
+    }
+
+    /**
+     * @brief Checks if a type of components is tracked by the index.
+     * @param type Type identifier of the component, as returned by `type_hash`.
+     * @return True if the type is tracked, false otherwise.
+     */
+    [[nodiscard]] bool tracked(const id_type type) const {
+        return bit(type) != types.size();
+    }
+
+    /**
+     * @brief Checks if an entity matches the given types of components.
+     *
+     * @warning
+     * Attempting to use a type of component that isn't tracked by the index
+     * results in undefined behavior.
+     *
+     * @tparam ItComp Type of input iterator for the required components.
+     * @tparam ItExcl Type of input iterator for the excluded components.
+     * @param entt A valid entity identifier.
+     * @param first An iterator to the first element of the range of required
+     * components.
+     * @param last An iterator past the last element of the range of required
+     * components.
+     * @param from An iterator to the first element of the range of excluded
+     * components.
+     * @param to An iterator past the last element of the range of excluded
+     * components.
+     * @return True if the entity matches the given types, false otherwise.
+     */
+    template<typename ItComp, typename ItExcl = id_type *>
+    [[nodiscard]] bool matches(const entity_type entt, ItComp first, ItComp last, ItExcl from = {}, ItExcl to = {}) const {
+        const auto masks = mask(first, last, from, to);
+        ENTT_ASSERT(!masks.empty());
+        return test(entt, masks.data());
+    }
+
+    /**
+     * @brief Counts the entities that match the given types of components.
+     *
+     * When all the types are tracked, the bitsets are scanned and the pools
+     * aren't accessed at all. Otherwise, entities are counted by iterating a
+     * runtime view.
+     *
+     * @tparam ItComp Type of input iterator for the required components.
+     * @tparam ItExcl Type of input iterator for the excluded components.
+     * @param first An iterator to the first element of the range of required
+     * components.
+     * @param last An iterator past the last element of the range of required
+     * components.
+     * @param from An iterator to the first element of the range of excluded
+     * components.
+     * @param to An iterator past the last element of the range of excluded
+     * components.
+     * @return The number of entities that match the given types.
+     */
+    template<typename ItComp, typename ItExcl = id_type *>
+    [[nodiscard]] size_type count(ItComp first, ItComp last, ItExcl from = {}, ItExcl to = {}) const {
+        size_type matches{};
+
+        if(first != last) {
+            if(const auto masks = mask(first, last, from, to); masks.empty()) {
+                const auto view = reg->runtime_view(first, last, from, to);
+                matches = static_cast<size_type>(std::distance(view.begin(), view.end()));
+            } else {
+                for(size_type base{}, end = signatures.size(); base < end; base += stride) {
+                    matches += test_at(base, masks.data());
+                }
+            }
+        }
+
+        return matches;
+    }
+
+    /**
+     * @brief Returns a runtime view for the given components.
+     *
+     * The runtime view uses the index to test entities when all the types are
+     * tracked. Otherwise, it's a plain runtime view as returned by the
+     * registry.
+     *
+     * @sa basic_registry::runtime_view
+     *
+     * @tparam ItComp Type of input iterator for the components to use to
+     * construct the view.
+     * @tparam ItExcl Type of input iterator for the components to use to filter
+     * the view.
+     * @param first An iterator to the first element of the range of components
+     * to use to construct the view.
+     * @param last An iterator past the last element of the range of components
+     * to use to construct the view.
+     * @param from An iterator to the first element of the range of components
+     * to use to filter the view.
+     * @param to An iterator past the last element of the range of components to
+     * use to filter the view.
+     * @return A newly created runtime view.
+     */
+    template<typename ItComp, typename ItExcl = id_type *>
+    [[nodiscard]] basic_runtime_view<Entity> runtime_view(ItComp first, ItComp last, ItExcl from = {}, ItExcl to = {}) const {
+        auto view = reg->runtime_view(first, last, from, to);
+
+        if(auto masks = mask(first, last, from, to); !masks.empty()) {
+            view.signature.template connect<&basic_signature_index::test>(*this);
+            view.masks = std::move(masks);
+        }
+
+        return view;
+    }
+
+private:
+    registry_type *reg;
+    std::vector<id_type> types;
+    std::vector<connection> connections;
+    std::vector<word_type> signatures;
+    size_type stride;
+};
+
+
+}
+
+
+#endif
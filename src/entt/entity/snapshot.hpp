@@ -2,24 +2,92 @@
 #define ENTT_ENTITY_SNAPSHOT_HPP
 
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
 #include <iterator>
+#include <ostream>
 #include <tuple>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "registry.hpp"
+#include "runtime_storage.hpp"
+#include "sparse_set.hpp"
 
 
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename, typename, typename, typename = void>
+struct has_block: std::false_type {};
+
+
+template<typename Archive, typename Entity, typename Component>
+struct has_block<Archive, Entity, Component, std::void_t<decltype(std::declval<Archive &>().block(std::declval<Entity *>(), std::declval<Entity *>(), std::declval<Component *>()))>>
+    : std::true_type
+{};
+
+
+template<typename Archive, typename Entity, typename Component>
+inline constexpr bool has_block_v = has_block<Archive, Entity, Component>::value;
+
+
+template<typename, typename, typename, typename = void>
+struct has_block_view: std::false_type {};
+
+
+template<typename Archive, typename Entity, typename Component>
+struct has_block_view<Archive, Entity, Component, std::void_t<decltype(std::declval<Archive &>().template block<Entity>(std::size_t{}, std::declval<const Component **>()))>>
+    : std::true_type
+{};
+
+
+template<typename Archive, typename Entity, typename Component>
+inline constexpr bool has_block_view_v = has_block_view<Archive, Entity, Component>::value;
+
+
+template<typename, typename, typename = void>
+struct has_view: std::false_type {};
+
+
+template<typename Archive, typename Type>
+struct has_view<Archive, Type, std::void_t<decltype(std::declval<Archive &>().template view<Type>(std::size_t{}))>>
+    : std::true_type
+{};
+
+
+template<typename Archive, typename Type>
+inline constexpr bool has_view_v = has_view<Archive, Type>::value;
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief Utility class to create snapshots from a registry.
  *
@@ -39,15 +107,54 @@ class basic_snapshot {
         const auto view = reg->template view<std::add_const_t<Component>>();
         archive(typename traits_type::entity_type(sz));
 
-        while(first != last) {
-            const auto entt = *(first++);
+        if constexpr(internal::has_block_v<Archive, const entity_type, const Component>) {
+            std::vector<entity_type> entities{};
+            entities.reserve(sz);
+            std::copy_if(first, last, std::back_inserter(entities), [this](const auto entt) { return reg->template has<Component>(entt); });
+
+            if constexpr(std::tuple_size_v<decltype(view.get({}))> == 0) {
+                archive.block(entities.data(), entities.data() + entities.size(), static_cast<const Component *>(nullptr));
+            } else {
+                std::vector<Component> instances{};
+                instances.reserve(sz);
+                std::transform(entities.cbegin(), entities.cend(), std::back_inserter(instances), [&view](const auto entt) { return view.template get<const Component>(entt); });
+                archive.block(entities.data(), entities.data() + entities.size(), instances.data());
+            }
+        } else {
+            while(first != last) {
+                const auto entt = *(first++);
 
-            if(reg->template has<Component>(entt)) {
-                std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+                if(reg->template has<Component>(entt)) {
+                    std::apply(archive, std::tuple_cat(std::make_tuple(entt), view.get(entt)));
+                }
             }
         }
     }
 
+    template<typename Component, typename Archive>
+    void pool(Archive &archive) const {
+        const auto *first = reg->template data<Component>();
+        const auto *last = first + reg->template size<Component>();
+
+        if constexpr(internal::has_block_v<Archive, const entity_type, const Component>) {
+            // components are written directly from the pool, no matter how many they are
+            archive(typename traits_type::entity_type(last - first));
+
+            if constexpr(std::tuple_size_v<decltype(reg->template view<const Component>().get({}))> == 0) {
+                archive.block(first, last, static_cast<const Component *>(nullptr));
+            } else {
+                archive.block(first, last, reg->template raw<Component>());
+            }
+        } else {
+            component<Component>(archive, first, last);
+        }
+    }
+
+    template<typename... Component, typename... Archive, std::size_t... Index>
+    void dispatch(const std::size_t pos, const std::tuple<Archive &...> &archive, std::index_sequence<Index...>) const {
+        ((pos == Index ? pool<Component>(std::get<Index>(archive)) : void()), ...);
+    }
+
     template<typename... Component, typename Archive, typename It, std::size_t... Indexes>
     void component(Archive &archive, It first, It last, std::index_sequence<Indexes...>) const {
         std::array<std::size_t, sizeof...(Indexes)> size{};
@@ -117,7 +224,83 @@ public:
      */
     template<typename... Component, typename Archive>
     const basic_snapshot & component(Archive &archive) const {
-        (component<Component>(archive, reg->template data<Component>(), reg->template data<Component>() + reg->template size<Component>()), ...);
+        (pool<Component>(archive), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the components of a type known only at runtime.
+     *
+     * The number of components is serialized first. Then, each entity is
+     * serialized followed by an opaque pointer to its component, the latter
+     * with a separate call. The archive is responsible for interpreting the
+     * pointer correctly.
+     *
+     * @sa basic_runtime_storage
+     *
+     * @tparam Archive Type of output archive.
+     * @param id Runtime identifier of the type of components.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Archive>
+    const basic_snapshot & component(const id_type id, Archive &archive) const {
+        const auto *cpool = reg->storage(id);
+        const auto sz = cpool ? cpool->size() : std::size_t{};
+        archive(typename traits_type::entity_type(sz));
+
+        for(std::size_t pos{}; pos < sz; ++pos) {
+            const auto entt = cpool->data()[pos];
+            archive(entt);
+            archive(cpool->get(entt));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given components, each one in its own archive and
+     * possibly in parallel.
+     *
+     * Pools are independent of each other. Therefore, each type of component
+     * is serialized in a dedicated archive by a separate task. Tasks are run by
+     * the given executor, whose signature should be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.<br/>
+     * The archives contain exactly what `component` would put aside for the
+     * same types, one type at a time. They can be restored in order with a
+     * loader, one archive at a time.
+     *
+     * @sa component
+     *
+     * @warning
+     * Archives are used concurrently from different threads, therefore they
+     * must not share state. Modifying the registry during serialization
+     * results in undefined behavior.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Archive Types of output archives.
+     * @param executor A valid executor.
+     * @param archive Valid references to output archives, one per type.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Exec, typename... Archive>
+    const basic_snapshot & par_component(Exec executor, Archive &... archive) const {
+        static_assert(sizeof...(Component) == sizeof...(Archive), "Invalid number of archives");
+        // pools are created lazily, make sure they exist before going parallel
+        (static_cast<void>(reg->template size<Component>()), ...);
+
+        executor(sizeof...(Component), [this, archives = std::forward_as_tuple(archive...)](const std::size_t pos) {
+            dispatch<Component...>(pos, archives, std::index_sequence_for<Component...>{});
+        });
+
         return *this;
     }
 
@@ -146,6 +329,191 @@ private:
 };
 
 
+/**
+ * @brief Utility class to create incremental snapshots from a registry.
+ *
+ * A delta snapshot keeps track of the components that are constructed, patched
+ * or destroyed over time, starting from the last checkpoint. Only those
+ * changes are serialized when a snapshot is created, rather than whole pools.
+ * Components that are updated without notifying the registry aren't tracked.
+ *
+ * Delta snapshots are meant to be restored by means of continuous loaders.
+ *
+ * @warning
+ * The lifetime of a delta snapshot must not overcome that of the registry to
+ * which it's bound.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_delta_snapshot {
+    using traits_type = entt_traits<Entity>;
+
+    struct tracker {
+        basic_sparse_set<Entity> updated;
+        basic_sparse_set<Entity> removed;
+        void(* release)(basic_delta_snapshot &, basic_registry<Entity> &);
+    };
+
+    template<typename Component>
+    static void on_update(basic_delta_snapshot &delta, basic_registry<Entity> &, const Entity entt) {
+        auto &&curr = delta.trackers[type_seq<Component>::value()];
+
+        if(curr.removed.contains(entt)) {
+            curr.removed.remove(entt);
+        }
+
+        if(!curr.updated.contains(entt)) {
+            curr.updated.emplace(entt);
+        }
+    }
+
+    template<typename Component>
+    static void on_destroy(basic_delta_snapshot &delta, basic_registry<Entity> &, const Entity entt) {
+        auto &&curr = delta.trackers[type_seq<Component>::value()];
+
+        if(curr.updated.contains(entt)) {
+            curr.updated.remove(entt);
+        }
+
+        if(!curr.removed.contains(entt)) {
+            curr.removed.emplace(entt);
+        }
+    }
+
+    template<typename Component>
+    static void release(basic_delta_snapshot &delta, basic_registry<Entity> &reg) {
+        reg.template on_construct<Component>().disconnect(delta);
+        reg.template on_update<Component>().disconnect(delta);
+        reg.template on_destroy<Component>().disconnect(delta);
+    }
+
+    template<typename Component>
+    void assure() {
+        const auto index = type_seq<Component>::value();
+
+        if(!(index < trackers.size())) {
+            trackers.resize(std::size_t(index)+1u);
+        }
+
+        if(auto &&curr = trackers[index]; !curr.release) {
+            reg->template on_construct<Component>().template connect<&on_update<Component>>(*this);
+            reg->template on_update<Component>().template connect<&on_update<Component>>(*this);
+            reg->template on_destroy<Component>().template connect<&on_destroy<Component>>(*this);
+            curr.release = &release<Component>;
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void get(Archive &archive) const {
+        const auto index = type_seq<Component>::value();
+        ENTT_ASSERT(index < trackers.size() && trackers[index].release);
+        auto &&curr = trackers[index];
+
+        archive(typename traits_type::entity_type(curr.removed.size()));
+
+        for(const auto entt: curr.removed) {
+            archive(entt);
+        }
+
+        basic_snapshot<Entity>{*reg}.template component<Component>(archive, curr.updated.begin(), curr.updated.end());
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_delta_snapshot(basic_registry<entity_type> &source) ENTT_NOEXCEPT
+        : trackers{},
+          reg{&source}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_delta_snapshot(const basic_delta_snapshot &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_delta_snapshot(basic_delta_snapshot &&) = delete;
+
+    /*! @brief Stops tracking changes. */
+    ~basic_delta_snapshot() {
+        for(auto &&curr: trackers) {
+            if(curr.release) {
+                curr.release(*this, *reg);
+            }
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This delta snapshot.
+     */
+    basic_delta_snapshot & operator=(const basic_delta_snapshot &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This delta snapshot.
+     */
+    basic_delta_snapshot & operator=(basic_delta_snapshot &&) = delete;
+
+    /**
+     * @brief Starts tracking changes to the given components.
+     *
+     * Components that already exist aren't considered as changed.
+     *
+     * @tparam Component Types of components to track.
+     * @return A non-const reference to this delta snapshot.
+     */
+    template<typename... Component>
+    basic_delta_snapshot & track() {
+        (assure<Component>(), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the changes to the given components.
+     *
+     * For each type, the entities that lost their components are serialized
+     * first, followed by the components that were constructed or patched, each
+     * one together with the entity to which it belongs.
+     *
+     * @warning
+     * Attempting to serialize components that aren't tracked results in
+     * undefined behavior.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive>
+    const basic_delta_snapshot & component(Archive &archive) const {
+        (get<Component>(archive), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Forgets all the changes tracked so far.
+     * @return A non-const reference to this delta snapshot.
+     */
+    basic_delta_snapshot & checkpoint() ENTT_NOEXCEPT {
+        for(auto &&curr: trackers) {
+            curr.updated.reset();
+            curr.removed.reset();
+        }
+
+        return *this;
+    }
+
+private:
+    std::vector<tracker> trackers;
+    basic_registry<entity_type> *reg;
+};
+
+
 /**
  * @brief Utility class to restore a snapshot as a whole.
  *
@@ -167,7 +535,39 @@ class basic_snapshot_loader {
 
         entity_type entt{};
 
-        if constexpr(std::tuple_size_v<decltype(reg->template view<Type>().get({}))> == 0) {
+        [[maybe_unused]] const auto restore = [this](auto first, auto last) {
+            for(; first != last; ++first) {
+                [[maybe_unused]] const auto entity = reg->valid(*first) ? *first : reg->create(*first);
+                ENTT_ASSERT(entity == *first);
+            }
+        };
+
+        if constexpr(internal::has_block_view_v<Archive, entity_type, Type>) {
+            // arrays are used in place, there are no intermediate buffers in this case
+            if constexpr(std::tuple_size_v<decltype(reg->template view<Type>().get({}))> == 0) {
+                const auto *first = archive.template block<entity_type>(length, static_cast<const Type **>(nullptr));
+                restore(first, first + length);
+                reg->template insert<Type>(first, first + length);
+            } else {
+                const Type *instance{};
+                const auto *first = archive.template block<entity_type>(length, &instance);
+                restore(first, first + length);
+                reg->template insert<Type>(first, first + length, instance, instance + length);
+            }
+        } else if constexpr(internal::has_block_v<Archive, entity_type, Type>) {
+            std::vector<entity_type> entities(length);
+
+            if constexpr(std::tuple_size_v<decltype(reg->template view<Type>().get({}))> == 0) {
+                archive.block(entities.data(), entities.data() + entities.size(), static_cast<Type *>(nullptr));
+                restore(entities.cbegin(), entities.cend());
+                reg->template insert<Type>(entities.cbegin(), entities.cend());
+            } else {
+                std::vector<Type> instances(length);
+                archive.block(entities.data(), entities.data() + entities.size(), instances.data());
+                restore(entities.cbegin(), entities.cend());
+                reg->template insert<Type>(entities.cbegin(), entities.cend(), std::make_move_iterator(instances.begin()), std::make_move_iterator(instances.end()));
+            }
+        } else if constexpr(std::tuple_size_v<decltype(reg->template view<Type>().get({}))> == 0) {
             while(length--) {
                 archive(entt);
                 const auto entity = reg->valid(entt) ? entt : reg->create(entt);
@@ -222,16 +622,22 @@ public:
         typename traits_type::entity_type length{};
 
         archive(length);
-        std::vector<entity_type> all(length);
+        entity_type destroyed;
 
-        for(decltype(length) pos{}; pos < length; ++pos) {
-            archive(all[pos]);
-        }
+        if constexpr(internal::has_view_v<Archive, entity_type>) {
+            const auto *first = archive.template view<entity_type>(length);
+            archive(destroyed);
+            reg->assign(first, first + length, destroyed);
+        } else {
+            std::vector<entity_type> all(length);
 
-        entity_type destroyed;
-        archive(destroyed);
+            for(decltype(length) pos{}; pos < length; ++pos) {
+                archive(all[pos]);
+            }
 
-        reg->assign(all.cbegin(), all.cend(), destroyed);
+            archive(destroyed);
+            reg->assign(all.cbegin(), all.cend(), destroyed);
+        }
 
         return *this;
     }
@@ -255,6 +661,36 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Restores the components of a type known only at runtime.
+     *
+     * Components are default constructed and then passed to the archive as
+     * opaque pointers, so that it can fill them in place.
+     *
+     * @sa basic_runtime_storage
+     *
+     * @tparam Archive Type of input archive.
+     * @param id Runtime identifier of the type of components.
+     * @param desc Runtime descriptor of the type of components.
+     * @param archive A valid reference to an input archive.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Archive>
+    const basic_snapshot_loader & component(const id_type id, const runtime_descriptor &desc, Archive &archive) const {
+        auto &&cpool = reg->storage(id, desc);
+        typename traits_type::entity_type length{};
+        archive(length);
+
+        for(entity_type entt{}; length; --length) {
+            archive(entt);
+            const auto entity = reg->valid(entt) ? entt : reg->create(entt);
+            ENTT_ASSERT(entity == entt);
+            archive(cpool.emplace(entity));
+        }
+
+        return *this;
+    }
+
     /**
      * @brief Destroys those entities that have no components.
      *
@@ -298,27 +734,52 @@ template<typename Entity>
 class basic_continuous_loader {
     using traits_type = entt_traits<Entity>;
 
+    [[nodiscard]] std::size_t find(const Entity entt) const {
+        if(remloc.contains(entt)) {
+            if(const auto pos = remloc.index(entt); remloc.data()[pos] == entt) {
+                return pos;
+            }
+        }
+
+        return locals.size();
+    }
+
+    void bind(const Entity entt, const Entity other) {
+        if(remloc.contains(entt)) {
+            // a newer version of a remote entity replaces the older one along with its local counterpart
+            const auto pos = remloc.index(entt);
+
+            if(reg->valid(locals[pos].first)) {
+                reg->destroy(locals[pos].first);
+            }
+
+            remloc.remove(remloc.data()[pos]);
+            locals[pos] = locals.back();
+            locals.pop_back();
+        }
+
+        remloc.emplace(entt);
+        locals.emplace_back(other, true);
+    }
+
     void destroy(Entity entt) {
-        if(const auto it = remloc.find(entt); it == remloc.cend()) {
-            const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
-            reg->destroy(local);
+        if(find(entt) == locals.size()) {
+            const auto other = reg->create();
+            bind(entt, other);
+            reg->destroy(other);
         }
     }
 
     void restore(Entity entt) {
-        const auto it = remloc.find(entt);
-
-        if(it == remloc.cend()) {
-            const auto local = reg->create();
-            remloc.emplace(entt, std::make_pair(local, true));
-        } else {
-            if(!reg->valid(remloc[entt].first)) {
-                remloc[entt].first = reg->create();
+        if(const auto pos = find(entt); pos != locals.size()) {
+            if(!reg->valid(locals[pos].first)) {
+                locals[pos].first = reg->create();
             }
 
             // set the dirty flag
-            remloc[entt].second = true;
+            locals[pos].second = true;
+        } else {
+            bind(entt, reg->create());
         }
     }
 
@@ -370,13 +831,29 @@ class basic_continuous_loader {
 
     template<typename Component>
     void remove_if_exists() {
-        for(auto &&ref: remloc) {
-            const auto local = ref.second.first;
+        for(auto &&curr: locals) {
+            if(reg->valid(curr.first)) {
+                reg->template remove_if_exists<Component>(curr.first);
+            }
+        }
+    }
 
-            if(reg->valid(local)) {
-                reg->template remove_if_exists<Component>(local);
+    template<typename Other, typename Archive, typename... Type, typename... Member>
+    void apply(Archive &archive, Member Type:: *... member) {
+        typename traits_type::entity_type length{};
+        entity_type entt{};
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+
+            if(const auto local = map(entt); reg->valid(local)) {
+                reg->template remove_if_exists<Other>(local);
             }
         }
+
+        assign<Other>(archive, member...);
     }
 
     template<typename Other, typename Archive, typename... Type, typename... Member>
@@ -386,7 +863,27 @@ class basic_continuous_loader {
 
         entity_type entt{};
 
-        if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
+        if constexpr(internal::has_block_v<Archive, entity_type, Other>) {
+            std::vector<entity_type> entities(length);
+
+            if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
+                archive.block(entities.data(), entities.data() + entities.size(), static_cast<Other *>(nullptr));
+
+                for(const auto curr: entities) {
+                    restore(curr);
+                    reg->template emplace_or_replace<Other>(map(curr));
+                }
+            } else {
+                std::vector<Other> instances(length);
+                archive.block(entities.data(), entities.data() + entities.size(), instances.data());
+
+                for(decltype(length) pos{}; pos < length; ++pos) {
+                    (update(instances[pos], member), ...);
+                    restore(entities[pos]);
+                    reg->template emplace_or_replace<Other>(map(entities[pos]), std::move(instances[pos]));
+                }
+            }
+        } else if constexpr(std::tuple_size_v<decltype(reg->template view<Other>().get({}))> == 0) {
             while(length--) {
                 archive(entt);
                 restore(entt);
@@ -413,7 +910,9 @@ public:
      * @param source A valid reference to a registry.
      */
     basic_continuous_loader(basic_registry<entity_type> &source) ENTT_NOEXCEPT
-        : reg{&source}
+        : remloc{},
+          locals{},
+          reg{&source}
     {}
 
     /*! @brief Default move constructor. */
@@ -481,6 +980,32 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Applies the changes recorded by a delta snapshot.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization. Components are removed from the local counterparts of
+     * the entities that lost them, then the components that were constructed
+     * or patched are assigned or replaced. Other components are left
+     * untouched.
+     *
+     * @sa basic_delta_snapshot
+     * @sa component
+     *
+     * @tparam Component Types of components to restore.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    basic_continuous_loader & patch(Archive &archive, Member Type:: *... member) {
+        (apply<Component>(archive, member...), ...);
+        return *this;
+    }
+
     /**
      * @brief Helps to purge entities that no longer have a conterpart.
      *
@@ -490,21 +1015,18 @@ public:
      * @return A non-const reference to this loader.
      */
     basic_continuous_loader & shrink() {
-        auto it = remloc.begin();
-
-        while(it != remloc.cend()) {
-            const auto local = it->second.first;
-            bool &dirty = it->second.second;
-
-            if(dirty) {
+        // backwards, so that the elements swapped with the purged ones have already been visited
+        for(auto pos = locals.size(); pos; --pos) {
+            if(auto &&[other, dirty] = locals[pos - 1u]; dirty) {
                 dirty = false;
-                ++it;
             } else {
-                if(reg->valid(local)) {
-                    reg->destroy(local);
+                if(reg->valid(other)) {
+                    reg->destroy(other);
                 }
 
-                it = remloc.erase(it);
+                remloc.remove(remloc.data()[pos - 1u]);
+                locals[pos - 1u] = locals.back();
+                locals.pop_back();
             }
         }
 
@@ -535,7 +1057,7 @@ public:
      * @return True if `entity` is managed by the loader, false otherwise.
      */
     [[nodiscard]] bool contains(entity_type entt) const ENTT_NOEXCEPT {
-        return (remloc.find(entt) != remloc.cend());
+        return (find(entt) != locals.size());
     }
 
     /**
@@ -544,19 +1066,498 @@ public:
      * @return The local identifier if any, the null entity otherwise.
      */
     [[nodiscard]] entity_type map(entity_type entt) const ENTT_NOEXCEPT {
-        const auto it = remloc.find(entt);
-        entity_type other = null;
+        const auto pos = find(entt);
+        return pos == locals.size() ? entity_type{null} : locals[pos].first;
+    }
+
+private:
+    basic_sparse_set<entity_type> remloc;
+    std::vector<std::pair<entity_type, bool>> locals;
+    basic_registry<entity_type> *reg;
+};
+
+
+/**
+ * @brief Output archive that writes data as raw bytes.
+ *
+ * Values are copied byte for byte into a user provided buffer, therefore the
+ * entities and the components must be trivially copyable.<br/>
+ * Components are written in blocks rather than one at a time. When a whole
+ * pool is serialized, its arrays of entities and components are copied as they
+ * are, with a single call for each of them. Blocks are tagged with the hash of
+ * the type of the components, so that a mismatch is detected in debug mode
+ * during loading.<br/>
+ * Values are aligned within the buffer according to their types. This way, a
+ * loader can use the arrays of a buffer (or of a memory mapped file) directly,
+ * as long as the buffer is suitably aligned in memory.
+ *
+ * @note
+ * Values are stored with the native representation of the machine, that is
+ * buffers aren't portable among different architectures.
+ */
+class binary_output_archive {
+    void write(const void *data, const std::size_t size, const std::size_t align) {
+        const auto *bytes = static_cast<const char *>(data);
+        buffer->resize(buffer->size() + (align - buffer->size() % align) % align);
+        buffer->insert(buffer->end(), bytes, bytes + size);
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that appends data to a buffer.
+     * @param ref A valid reference to a buffer.
+     */
+    binary_output_archive(std::vector<char> &ref) ENTT_NOEXCEPT
+        : buffer{&ref}
+    {}
+
+    /**
+     * @brief Writes a single value.
+     * @tparam Type Type of value to write.
+     * @param value The value to write.
+     */
+    template<typename Type>
+    void operator()(const Type &value) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Invalid type");
+        write(&value, sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Writes a block of entities and their components.
+     * @tparam Entity Type of entities to write.
+     * @tparam Component Type of components to write.
+     * @param first A pointer to the first entity of the block.
+     * @param last A pointer past the last entity of the block.
+     * @param instance A pointer to the first component of the block, if any.
+     */
+    template<typename Entity, typename Component>
+    void block(const Entity *first, const Entity *last, const Component *instance) {
+        static_assert(std::is_trivially_copyable_v<Entity> && std::is_trivially_copyable_v<Component>, "Invalid type");
+        const auto tag = type_hash<Component>::value();
+        const auto length = static_cast<std::size_t>(last - first);
+
+        write(&tag, sizeof(tag), alignof(id_type));
+        write(first, length * sizeof(Entity), alignof(Entity));
+
+        if(instance) {
+            write(instance, length * sizeof(Component), alignof(Component));
+        }
+    }
+
+private:
+    std::vector<char> *buffer;
+};
+
+
+/**
+ * @brief Input archive that reads data written by a binary output archive.
+ *
+ * The buffer isn't copied by the archive and must outlive it. Moreover, it must
+ * be aligned in memory at least as strictly as the values it contains, which is
+ * the case for dynamically allocated buffers and memory mapped files.<br/>
+ * Loaders don't copy the arrays of entities and components of a buffer into
+ * intermediate storage when possible. Instead, they use the arrays in place as
+ * a source for the registry.
+ *
+ * @sa binary_output_archive
+ */
+class binary_input_archive {
+    [[nodiscard]] const char * next(const std::size_t size, const std::size_t align) {
+        offset += (align - offset % align) % align;
+        ENTT_ASSERT(offset <= length && size <= length - offset);
+        ENTT_ASSERT(!(reinterpret_cast<std::uintptr_t>(buffer + offset) % align));
+        return buffer + std::exchange(offset, offset + size);
+    }
+
+    void read(void *data, const std::size_t size, const std::size_t align) {
+        if(const auto *curr = next(size, align); size) {
+            std::memcpy(data, curr, size);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that reads data from a buffer.
+     * @param data A pointer to the first byte of the buffer.
+     * @param size Size of the buffer in bytes.
+     */
+    binary_input_archive(const char *data, const std::size_t size) ENTT_NOEXCEPT
+        : buffer{data},
+          length{size},
+          offset{}
+    {}
+
+    /**
+     * @brief Reads a single value.
+     * @tparam Type Type of value to read.
+     * @param value The variable to fill.
+     */
+    template<typename Type>
+    void operator()(Type &value) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Invalid type");
+        read(&value, sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns a sequence of values without copying them.
+     *
+     * The values are skipped as if they were read one at a time.
+     *
+     * @tparam Type Type of values to return.
+     * @param count Number of values to return.
+     * @return A pointer to the first value of the sequence.
+     */
+    template<typename Type>
+    [[nodiscard]] const Type * view(const std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Invalid type");
+        return reinterpret_cast<const Type *>(next(count * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Reads a block of entities and their components.
+     * @tparam Entity Type of entities to read.
+     * @tparam Component Type of components to read.
+     * @param first A pointer to the first entity of the block.
+     * @param last A pointer past the last entity of the block.
+     * @param instance A pointer to the first component of the block, if any.
+     */
+    template<typename Entity, typename Component>
+    void block(Entity *first, Entity *last, Component *instance) {
+        const auto count = static_cast<std::size_t>(last - first);
+        const Component *from{};
+        const auto *entities = block<Entity>(count, instance ? &from : nullptr);
+
+        std::copy(entities, entities + count, first);
+
+        if(instance) {
+            std::copy(from, from + count, instance);
+        }
+    }
+
+    /**
+     * @brief Returns a block of entities and their components without copying
+     * them.
+     * @tparam Entity Type of entities to return.
+     * @tparam Component Type of components to return.
+     * @param count Number of elements of the block.
+     * @param instance A pointer to a variable to fill with a pointer to the
+     * first component of the block, if any.
+     * @return A pointer to the first entity of the block.
+     */
+    template<typename Entity, typename Component>
+    [[nodiscard]] const Entity * block(const std::size_t count, const Component **instance) {
+        static_assert(std::is_trivially_copyable_v<Entity> && std::is_trivially_copyable_v<Component>, "Invalid type");
+        id_type tag{};
+
+        (*this)(tag);
+        ENTT_ASSERT(tag == type_hash<Component>::value());
+        const auto *first = view<Entity>(count);
 
-        if(it != remloc.cend()) {
-            other = it->second.first;
+        if(instance) {
+            *instance = view<Component>(count);
         }
 
-        return other;
+        return first;
+    }
+
+    /**
+     * @brief Returns the number of bytes not yet read.
+     * @return The number of bytes not yet read.
+     */
+    [[nodiscard]] std::size_t remaining() const ENTT_NOEXCEPT {
+        return length - offset;
     }
 
 private:
-    std::unordered_map<entity_type, std::pair<entity_type, bool>> remloc;
-    basic_registry<entity_type> *reg;
+    const char *buffer;
+    std::size_t length;
+    std::size_t offset;
+};
+
+
+/**
+ * @brief Output archive that compresses data and writes it to a stream.
+ *
+ * Data are collected in a buffer of fixed size that is flushed to the stream
+ * every time it fills up, so that the memory used doesn't depend on the size
+ * of the snapshot.<br/>
+ * Blocks of entities are delta-encoded as variable-length integers, since
+ * entities within a pool are often sorted or close to each other. Components
+ * are xor-ed byte by byte with the previous element of the block and runs of
+ * unchanged bytes are collapsed, which fits the repetitive data of most
+ * components well.<br/>
+ * Single values are written as variable-length integers when they are
+ * unsigned integers or enums (entities included) and as they are otherwise.
+ *
+ * @note
+ * Values are stored with the native representation of the machine, that is
+ * streams aren't portable among different architectures. General purpose
+ * codecs can be put in place below the archive by means of a stream buffer,
+ * if a higher compression ratio is required.
+ */
+class stream_output_archive {
+    static constexpr std::size_t literal_length = 128u;
+
+    void put(const char value) {
+        if(curr == buffer.size()) {
+            flush();
+        }
+
+        buffer[curr++] = value;
+    }
+
+    void write(const void *data, const std::size_t size) {
+        const auto *bytes = static_cast<const char *>(data);
+
+        for(std::size_t pos{}; pos < size; ++pos) {
+            put(bytes[pos]);
+        }
+    }
+
+    void varint(std::uint64_t value) {
+        for(; value >= 0x80u; value >>= 7u) {
+            put(static_cast<char>((value & 0x7Fu) | 0x80u));
+        }
+
+        put(static_cast<char>(value));
+    }
+
+    void literals(const char *data, const std::size_t size) {
+        if(size) {
+            put(static_cast<char>(size - 1u));
+            write(data, size);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that writes data to a stream.
+     * @param ref A valid reference to an output stream.
+     * @param size Size of the internal buffer in bytes.
+     */
+    stream_output_archive(std::ostream &ref, const std::size_t size = 65536u)
+        : buffer(size),
+          curr{},
+          stream{&ref}
+    {
+        ENTT_ASSERT(size);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    stream_output_archive(const stream_output_archive &) = delete;
+
+    /*! @brief Flushes the remaining data to the stream. */
+    ~stream_output_archive() {
+        flush();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This archive.
+     */
+    stream_output_archive & operator=(const stream_output_archive &) = delete;
+
+    /**
+     * @brief Writes a single value.
+     * @tparam Type Type of value to write.
+     * @param value The value to write.
+     */
+    template<typename Type>
+    void operator()(const Type &value) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Invalid type");
+
+        if constexpr(std::is_enum_v<Type> || std::is_unsigned_v<Type>) {
+            varint(static_cast<std::uint64_t>(value));
+        } else {
+            write(&value, sizeof(Type));
+        }
+    }
+
+    /**
+     * @brief Writes a block of entities and their components.
+     * @tparam Entity Type of entities to write.
+     * @tparam Component Type of components to write.
+     * @param first A pointer to the first entity of the block.
+     * @param last A pointer past the last entity of the block.
+     * @param instance A pointer to the first component of the block, if any.
+     */
+    template<typename Entity, typename Component>
+    void block(const Entity *first, const Entity *last, const Component *instance) {
+        static_assert(std::is_trivially_copyable_v<Component>, "Invalid type");
+        const auto length = static_cast<std::size_t>(last - first);
+        std::uint64_t prev{};
+
+        varint(type_hash<Component>::value());
+
+        for(auto it = first; it != last; ++it) {
+            // zigzag encoding keeps small negative deltas short as well
+            const auto value = static_cast<std::uint64_t>(to_integral(*it));
+            const auto delta = static_cast<std::int64_t>(value - prev);
+            varint((static_cast<std::uint64_t>(delta) << 1u) ^ static_cast<std::uint64_t>(delta >> 63u));
+            prev = value;
+        }
+
+        if(instance) {
+            const auto *bytes = reinterpret_cast<const char *>(instance);
+            std::array<char, literal_length> pending{};
+            std::size_t count{};
+            std::size_t zeros{};
+
+            for(std::size_t pos{}, end = length * sizeof(Component); pos < end; ++pos) {
+                if(const char value = bytes[pos] ^ (pos < sizeof(Component) ? char{} : bytes[pos - sizeof(Component)]); value) {
+                    for(; zeros; zeros -= (std::min)(zeros, literal_length)) {
+                        put(static_cast<char>(0x80u | ((std::min)(zeros, literal_length) - 1u)));
+                    }
+
+                    pending[count++] = value;
+
+                    if(count == literal_length) {
+                        literals(pending.data(), std::exchange(count, 0u));
+                    }
+                } else {
+                    literals(pending.data(), std::exchange(count, 0u));
+                    ++zeros;
+                }
+            }
+
+            literals(pending.data(), count);
+
+            for(; zeros; zeros -= (std::min)(zeros, literal_length)) {
+                put(static_cast<char>(0x80u | ((std::min)(zeros, literal_length) - 1u)));
+            }
+        }
+    }
+
+    /*! @brief Writes the buffered data to the stream. */
+    void flush() {
+        stream->write(buffer.data(), static_cast<std::streamsize>(std::exchange(curr, 0u)));
+    }
+
+private:
+    std::vector<char> buffer;
+    std::size_t curr;
+    std::ostream *stream;
+};
+
+
+/**
+ * @brief Input archive that reads data written by a stream output archive.
+ *
+ * Data are read from the stream in chunks of fixed size, so that the memory
+ * used doesn't depend on the size of the snapshot. Blocks are decoded directly
+ * into the buffers provided by the loaders.
+ *
+ * @sa stream_output_archive
+ */
+class stream_input_archive {
+    [[nodiscard]] char get() {
+        if(curr == filled) {
+            stream->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            filled = static_cast<std::size_t>(stream->gcount());
+            curr = {};
+            ENTT_ASSERT(filled);
+        }
+
+        return buffer[curr++];
+    }
+
+    void read(void *data, const std::size_t size) {
+        auto *bytes = static_cast<char *>(data);
+
+        for(std::size_t pos{}; pos < size; ++pos) {
+            bytes[pos] = get();
+        }
+    }
+
+    [[nodiscard]] std::uint64_t varint() {
+        std::uint64_t value{};
+
+        for(unsigned int shift{};; shift += 7u) {
+            const auto byte = static_cast<unsigned char>(get());
+            value |= static_cast<std::uint64_t>(byte & 0x7Fu) << shift;
+
+            if(!(byte & 0x80u)) {
+                return value;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that reads data from a stream.
+     * @param ref A valid reference to an input stream.
+     * @param size Size of the internal buffer in bytes.
+     */
+    stream_input_archive(std::istream &ref, const std::size_t size = 65536u)
+        : buffer(size),
+          curr{},
+          filled{},
+          stream{&ref}
+    {
+        ENTT_ASSERT(size);
+    }
+
+    /**
+     * @brief Reads a single value.
+     * @tparam Type Type of value to read.
+     * @param value The variable to fill.
+     */
+    template<typename Type>
+    void operator()(Type &value) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Invalid type");
+
+        if constexpr(std::is_enum_v<Type> || std::is_unsigned_v<Type>) {
+            value = static_cast<Type>(varint());
+        } else {
+            read(&value, sizeof(Type));
+        }
+    }
+
+    /**
+     * @brief Reads a block of entities and their components.
+     * @tparam Entity Type of entities to read.
+     * @tparam Component Type of components to read.
+     * @param first A pointer to the first entity of the block.
+     * @param last A pointer past the last entity of the block.
+     * @param instance A pointer to the first component of the block, if any.
+     */
+    template<typename Entity, typename Component>
+    void block(Entity *first, Entity *last, Component *instance) {
+        static_assert(std::is_trivially_copyable_v<Component>, "Invalid type");
+        const auto length = static_cast<std::size_t>(last - first);
+        [[maybe_unused]] const auto tag = varint();
+        std::uint64_t prev{};
+
+        ENTT_ASSERT(tag == type_hash<Component>::value());
+
+        for(auto it = first; it != last; ++it) {
+            const auto delta = varint();
+            prev += (delta >> 1u) ^ (~(delta & 1u) + 1u);
+            *it = Entity{static_cast<std::underlying_type_t<Entity>>(prev)};
+        }
+
+        if(instance) {
+            auto *bytes = reinterpret_cast<char *>(instance);
+
+            for(std::size_t pos{}, end = length * sizeof(Component); pos < end;) {
+                if(const auto token = static_cast<unsigned char>(get()); token & 0x80u) {
+                    for(auto count = (token & 0x7Fu) + 1u; count; --count, ++pos) {
+                        bytes[pos] = (pos < sizeof(Component) ? char{} : bytes[pos - sizeof(Component)]);
+                    }
+                } else {
+                    for(auto count = token + 1u; count; --count, ++pos) {
+                        bytes[pos] = get() ^ (pos < sizeof(Component) ? char{} : bytes[pos - sizeof(Component)]);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<char> buffer;
+    std::size_t curr;
+    std::size_t filled;
+    std::istream *stream;
 };
 
 
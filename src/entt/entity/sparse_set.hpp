@@ -2,14 +2,21 @@
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <utility>
 #include <vector>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <cstddef>
+#include <cstdint>
+#include <tuple>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
+#include "../core/type_info.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 
@@ -17,6 +24,223 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename... Type>
+class chunked_range final {
+    class chunk_iterator final {
+        friend class chunked_range<Type...>;
+
+        chunk_iterator(const std::tuple<Type *...> &ref, const std::size_t len, const std::size_t extent, const std::size_t idx) ENTT_NOEXCEPT
+            : data{ref}, length{len}, size{extent}, pos{idx}
+        {}
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::tuple<Type *..., std::size_t>;
+        using pointer = void;
+        using reference = value_type;
+        using iterator_category = std::input_iterator_tag;
+
+        chunk_iterator & operator++() ENTT_NOEXCEPT {
+            return ++pos, *this;
+        }
+
+        chunk_iterator operator++(int) ENTT_NOEXCEPT {
+            chunk_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+            const auto offset = pos * length;
+            return std::apply([offset, count = (std::min)(length, size - offset)](auto *... curr) { return value_type{curr + offset..., count}; }, data);
+        }
+
+        [[nodiscard]] bool operator==(const chunk_iterator &other) const ENTT_NOEXCEPT {
+            return other.pos == pos;
+        }
+
+        [[nodiscard]] bool operator!=(const chunk_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+    private:
+        std::tuple<Type *...> data;
+        std::size_t length;
+        std::size_t size;
+        std::size_t pos;
+    };
+
+public:
+    using iterator = chunk_iterator;
+
+    chunked_range(const std::size_t len, const std::size_t extent, Type *... ref) ENTT_NOEXCEPT
+        : data{ref...}, length{len}, count{extent}
+    {
+        ENTT_ASSERT(length);
+    }
+
+    [[nodiscard]] std::size_t size() const ENTT_NOEXCEPT {
+        return (count + length - 1u) / length;
+    }
+
+    [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+        return iterator{data, length, count, {}};
+    }
+
+    [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+        return iterator{data, length, count, size()};
+    }
+
+    [[nodiscard]] typename iterator::value_type operator[](const std::size_t pos) const ENTT_NOEXCEPT {
+        ENTT_ASSERT(pos < size());
+        return *iterator{data, length, count, pos};
+    }
+
+private:
+    std::tuple<Type *...> data;
+    std::size_t length;
+    std::size_t count;
+};
+
+
+[[nodiscard]] inline std::size_t popcount(std::uint64_t word) ENTT_NOEXCEPT {
+#if defined __clang__ || defined __GNUC__
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+    std::size_t count{};
+    for(; word; word &= word - 1u, ++count);
+    return count;
+#endif
+}
+
+
+template<std::size_t, typename>
+struct batch_pointers;
+
+
+template<std::size_t Size, typename... Type>
+struct batch_pointers<Size, std::tuple<Type &...>> {
+    using type = std::tuple<std::array<Type *, Size>...>;
+};
+
+
+template<typename Allocator>
+class allocator_resource final: public std::pmr::memory_resource {
+    using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<std::max_align_t>;
+    using pointer_traits = std::pointer_traits<typename alloc_traits::pointer>;
+
+    [[nodiscard]] static std::size_t length(const std::size_t bytes) ENTT_NOEXCEPT {
+        return (bytes + sizeof(std::max_align_t) - 1u) / sizeof(std::max_align_t);
+    }
+
+    void * do_allocate(const std::size_t bytes, [[maybe_unused]] const std::size_t alignment) override {
+        ENTT_ASSERT(alignment <= alignof(std::max_align_t));
+        return std::addressof(*alloc_traits::allocate(allocator, length(bytes)));
+    }
+
+    void do_deallocate(void *ptr, const std::size_t bytes, const std::size_t) override {
+        alloc_traits::deallocate(allocator, pointer_traits::pointer_to(*static_cast<std::max_align_t *>(ptr)), length(bytes));
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit allocator_resource(const Allocator &alloc)
+        : allocator{alloc}
+    {}
+
+private:
+    typename alloc_traits::allocator_type allocator;
+};
+
+
+template<typename Target, typename Other>
+[[nodiscard]] std::pair<Target, std::shared_ptr<void>> rebind_allocator(const Other &allocator) {
+    if constexpr(std::is_constructible_v<Target, const Other &>) {
+        return { Target{allocator}, nullptr };
+    } else if constexpr(std::is_same_v<Other, std::allocator<typename Other::value_type>>) {
+        return { Target{std::pmr::new_delete_resource()}, nullptr };
+    } else {
+        static_assert(std::is_constructible_v<Target, std::pmr::memory_resource *>, "Allocator not convertible to the one of the sparse set");
+        using resource_type = allocator_resource<Other>;
+
+        if constexpr(std::allocator_traits<Other>::is_always_equal::value) {
+            // never destroyed, sparse sets with static storage duration can outlive it otherwise
+            alignas(resource_type) static std::byte buffer[sizeof(resource_type)];
+            static auto *resource = ::new(static_cast<void *>(buffer)) resource_type{allocator};
+            return { Target{resource}, nullptr };
+        } else {
+            // the adaptor is allocated through the allocator itself and shared with its copies
+            auto resource = std::allocate_shared<resource_type>(allocator, allocator);
+            return { Target{resource.get()}, std::move(resource) };
+        }
+    }
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Memory usage and occupancy statistics of a pool.
+ *
+ * Sizes are expressed in bytes unless otherwise stated. The memory used by the
+ * objects that components allocate on their own isn't taken into account.
+ */
+struct pool_stats {
+    /*! @brief Number of entities in the pool. */
+    std::size_t size{};
+    /*! @brief Number of entities for which the packed array has room. */
+    std::size_t capacity{};
+    /*! @brief Number of pages allocated for the sparse array. */
+    std::size_t pages{};
+    /*! @brief Number of slots of the sparse array actually allocated. */
+    std::size_t slots{};
+    /*! @brief Number of objects for which the pool has room. */
+    std::size_t instances{};
+    /*! @brief Memory used by the sparse array. */
+    std::size_t sparse_bytes{};
+    /*! @brief Memory used by the packed array. */
+    std::size_t packed_bytes{};
+    /*! @brief Memory used by the objects, if any. */
+    std::size_t instance_bytes{};
+    /*! @brief Number of listeners connected to the signals of the pool, if any. */
+    std::size_t listeners{};
+
+    /**
+     * @brief Returns the number of unused slots of the sparse array.
+     * @return The number of slots that don't refer to any entity.
+     */
+    [[nodiscard]] std::size_t null_slots() const ENTT_NOEXCEPT {
+        return slots - size;
+    }
+
+    /**
+     * @brief Returns the overall memory used by a pool.
+     * @return The overall memory used by a pool, in bytes.
+     */
+    [[nodiscard]] std::size_t bytes() const ENTT_NOEXCEPT {
+        return sparse_bytes + packed_bytes + instance_bytes;
+    }
+};
+
+
 /**
  * @brief Basic sparse set implementation.
  *
@@ -37,20 +261,35 @@ namespace entt {
  * no guarantees that entities are returned in the insertion order when iterate
  * a sparse set. Do not make assumption on the order in any case.
  *
+ * @note
+ * The sparse array is paged by default. When `ENTT_PAGE_SIZE` is defined as 0,
+ * pagination is turned off and the sparse array is a flat contiguous one which
+ * is large enough to contain the greatest identifier in use.
+ *
+ * @note
+ * Sparse sets use a polymorphic allocator by default. This way, storage
+ * classes share the same base type whatever their allocators and still route
+ * the memory of their sparse sets through them.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Entity>
+template<typename Entity, typename Allocator>
 class basic_sparse_set {
-    static_assert(ENTT_PAGE_SIZE && ((ENTT_PAGE_SIZE & (ENTT_PAGE_SIZE - 1)) == 0), "ENTT_PAGE_SIZE must be a power of two");
+    static_assert((ENTT_PAGE_SIZE & (ENTT_PAGE_SIZE - 1)) == 0, "ENTT_PAGE_SIZE must be a power of two or 0");
     static constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(Entity);
 
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, Entity>, "Invalid value type");
+
     using traits_type = entt_traits<Entity>;
-    using page_type = std::unique_ptr<Entity[]>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using page_type = std::conditional_t<(entt_per_page != 0u), typename alloc_traits::pointer, Entity>;
+    using page_alloc_type = typename alloc_traits::template rebind_alloc<page_type>;
 
     class sparse_set_iterator final {
-        friend class basic_sparse_set<Entity>;
+        friend class basic_sparse_set<Entity, Allocator>;
 
-        using packed_type = std::vector<Entity>;
+        using packed_type = std::vector<Entity, Allocator>;
         using index_type = typename traits_type::difference_type;
 
         sparse_set_iterator(const packed_type &ref, const index_type idx) ENTT_NOEXCEPT
@@ -150,34 +389,236 @@ class basic_sparse_set {
     };
 
     [[nodiscard]] auto page(const Entity entt) const ENTT_NOEXCEPT {
-        return size_type{(to_integral(entt) & traits_type::entity_mask) / entt_per_page};
+        if constexpr(entt_per_page == 0u) {
+            return size_type{to_integral(entt) & traits_type::entity_mask};
+        } else {
+            return size_type{(to_integral(entt) & traits_type::entity_mask) / entt_per_page};
+        }
     }
 
     [[nodiscard]] auto offset(const Entity entt) const ENTT_NOEXCEPT {
         return size_type{to_integral(entt) & (entt_per_page - 1)};
     }
 
-    [[nodiscard]] page_type & assure(const std::size_t pos) {
+    [[nodiscard]] std::size_t home(const Entity entt) const ENTT_NOEXCEPT {
+        // fibonacci hashing, strided or clustered identifiers are spread over all the buckets
+        const auto hash = (static_cast<std::uint64_t>(to_integral(entt) & traits_type::entity_mask) * 0x9E3779B97F4A7C15ull) >> 32u;
+        return static_cast<std::size_t>(hash) & (hash_table.size() / 2u - 1u);
+    }
+
+    [[nodiscard]] std::size_t bucket(const Entity entt) const ENTT_NOEXCEPT {
+        const auto mask = hash_table.size() / 2u - 1u;
+        const auto key = to_integral(entt) & traits_type::entity_mask;
+        auto pos = home(entt);
+
+        // open addressing with linear probing
+        while(hash_table[2u * pos] != null && (to_integral(hash_table[2u * pos]) & traits_type::entity_mask) != key) {
+            pos = (pos + 1u) & mask;
+        }
+
+        return pos;
+    }
+
+    void rehash(const std::size_t live) {
+        std::size_t buckets{8u};
+
+        // tables are at most a quarter full after a rehash
+        while(buckets < live * 4u) {
+            buckets *= 2u;
+        }
+
+        auto prev = std::move(hash_table);
+        hash_table.assign(buckets * 2u, null);
+        ENTT_ALLOC_TRACE("entt::sparse_set::assure", type_id<entity_type>().name(), hash_table.capacity() * sizeof(Entity));
+        keys = 0u;
+
+        for(std::size_t pos{}, last = prev.size(); pos < last; pos += 2u) {
+            if(prev[pos] != null && in_use(prev[pos + 1u])) {
+                const auto next = bucket(prev[pos]);
+                hash_table[2u * next] = prev[pos];
+                hash_table[2u * next + 1u] = prev[pos + 1u];
+                ++keys;
+            }
+        }
+    }
+
+    [[nodiscard]] const Entity & element(const Entity entt) const {
+        if(hashing) {
+            return hash_table[2u * bucket(entt) + 1u];
+        } else if constexpr(entt_per_page == 0u) {
+            return sparse[page(entt)];
+        } else {
+            return sparse[page(entt)][offset(entt)];
+        }
+    }
+
+    [[nodiscard]] Entity & element(const Entity entt) {
+        return const_cast<Entity &>(std::as_const(*this).element(entt));
+    }
+
+    [[nodiscard]] auto tag() const ENTT_NOEXCEPT {
+        return static_cast<typename traits_type::entity_type>(epoch << traits_type::entity_shift);
+    }
+
+    [[nodiscard]] bool in_use(const Entity slot) const ENTT_NOEXCEPT {
+        // null and stale slots have a version that differs from the epoch
+        return static_cast<typename traits_type::entity_type>(to_integral(slot) & ~traits_type::entity_mask) == tag();
+    }
+
+    [[nodiscard]] Entity slot(const std::size_t pos) const ENTT_NOEXCEPT {
+        return Entity{static_cast<typename traits_type::entity_type>(static_cast<typename traits_type::entity_type>(pos) | tag())};
+    }
+
+    [[nodiscard]] static std::size_t position(const Entity slot) ENTT_NOEXCEPT {
+        return std::size_t{to_integral(slot) & traits_type::entity_mask};
+    }
+
+    void assure_page(const std::size_t pos) {
         if(!(pos < sparse.size())) {
-            sparse.resize(pos+1);
+            const auto cap = sparse.capacity();
+
+            if constexpr(entt_per_page == 0u) {
+                // null is safe in all cases for our purposes
+                sparse.resize(pos+1, null);
+            } else {
+                sparse.resize(pos+1);
+            }
+
+            if(sparse.capacity() != cap) {
+                ENTT_ALLOC_TRACE("entt::sparse_set::assure", type_id<entity_type>().name(), sparse.capacity() * sizeof(page_type));
+            }
+        }
+
+        if constexpr(entt_per_page != 0u) {
+            if(auto &&curr = sparse[pos]; !curr) {
+                auto allocator = packed.get_allocator();
+                curr = alloc_traits::allocate(allocator, entt_per_page);
+                ENTT_ALLOC_TRACE("entt::sparse_set::assure", type_id<entity_type>().name(), entt_per_page * sizeof(Entity));
+
+                // null is safe in all cases for our purposes
+                for(size_type next{}; next < entt_per_page; ++next) {
+                    alloc_traits::construct(allocator, std::addressof(curr[next]), null);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] Entity & assure(const Entity entt) {
+        if(hashing) {
+            if(2u * (keys + 1u) > hash_table.size() / 2u) {
+                // removed keys are left in place and dropped only when rehashing
+                rehash(packed.size() + 1u);
+            }
+
+            const auto pos = bucket(entt);
+
+            if(hash_table[2u * pos] == null) {
+                hash_table[2u * pos] = Entity{static_cast<typename traits_type::entity_type>(to_integral(entt) & traits_type::entity_mask)};
+                ++keys;
+            }
+
+            return hash_table[2u * pos + 1u];
+        }
+
+        assure_page(page(entt));
+        return element(entt);
+    }
+
+    void release_pages() {
+        if constexpr(entt_per_page != 0u) {
+            auto allocator = packed.get_allocator();
+
+            for(auto &&curr: sparse) {
+                if(curr) {
+                    alloc_traits::deallocate(allocator, curr, entt_per_page);
+                }
+            }
         }
 
-        if(!sparse[pos]) {
-            sparse[pos].reset(new entity_type[entt_per_page]);
-            // null is safe in all cases for our purposes
-            for(auto *first = sparse[pos].get(), *last = first + entt_per_page; first != last; ++first) {
-                *first = null;
+        sparse.clear();
+        hash_table.clear();
+        keys = 0u;
+        epoch = 1u;
+    }
+
+    void refresh_pages() ENTT_NOEXCEPT {
+        std::fill(hash_table.begin(), hash_table.end(), entity_type{null});
+        keys = 0u;
+
+        if constexpr(entt_per_page == 0u) {
+            std::fill(sparse.begin(), sparse.end(), entity_type{null});
+        } else {
+            for(auto &&curr: sparse) {
+                if(curr) {
+                    std::fill(curr, curr + entt_per_page, entity_type{null});
+                }
             }
         }
 
-        return sparse[pos];
+        epoch = 1u;
     }
 
     virtual void swap_at(const std::size_t, const std::size_t) {}
     virtual void swap_and_pop(const std::size_t) {}
     virtual void clear_all() {}
+    virtual void remap_all(const Entity *) {}
+
+    virtual void compact_all(const std::size_t from) {
+        // survivors are swapped towards the front, the tail is popped one at a time
+        auto to = from;
+
+        for(auto pos = from, last = packed.size(); pos < last; ++pos) {
+            if(packed[pos] != null) {
+                if(to != pos) {
+                    swap_at(to, pos);
+                }
+
+                ++to;
+            }
+        }
+
+        for(auto pos = packed.size(); pos > to; --pos) {
+            swap_and_pop(pos - 1u);
+        }
+    }
+
+    template<typename It>
+    void compact(It first, It last) {
+        auto from = packed.size();
+
+        for(; first != last; ++first) {
+            ENTT_ASSERT(contains(*first));
+            auto &ref = element(*first);
+            const auto pos = position(ref);
+            from = (std::min)(from, pos);
+            packed[pos] = null;
+            ref = null;
+        }
+
+        // derived classes move their objects while the tombstones are still in place
+        compact_all(from);
+        auto to = from;
+
+        for(auto pos = from, end = packed.size(); pos < end; ++pos) {
+            if(const auto entt = packed[pos]; entt != null) {
+                packed[to] = entt;
+                element(entt) = slot(to++);
+            }
+        }
+
+        packed.erase(packed.begin() + to, packed.end());
+    }
+
+    basic_sparse_set(std::pair<Allocator, std::shared_ptr<void>> args)
+        : resource{std::move(args.second)},
+          sparse(page_alloc_type{args.first}),
+          packed(args.first),
+          hash_table(args.first)
+    {}
 
 public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
@@ -186,18 +627,84 @@ public:
     using iterator = sparse_set_iterator;
     /*! @brief Reverse iterator type. */
     using reverse_iterator = const entity_type *;
+    /*! @brief Iterable type returned when splitting a sparse set in chunks. */
+    using chunked_type = internal::chunked_range<const entity_type>;
+    /*! @brief Bitmask type used to test batches of entities. */
+    using mask_type = std::uint32_t;
+
+    /*! @brief Batches larger than a pool divided by this value are compacted. */
+    static constexpr size_type compact_ratio = 8u;
+
+    /*! @brief Default length of the chunks, in number of elements. */
+    static constexpr size_type chunk_size = (entt_per_page == 0u) ? (4096u / sizeof(Entity)) : entt_per_page;
 
     /*! @brief Default constructor. */
     basic_sparse_set() = default;
 
+    /**
+     * @brief Constructs an empty sparse set with the given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_sparse_set(const allocator_type &allocator)
+        : sparse(page_alloc_type{allocator}),
+          packed(allocator),
+          hash_table(allocator)
+    {}
+
+    /**
+     * @brief Constructs an empty sparse set that takes its memory from an
+     * allocator of another type.
+     *
+     * Allocators convertible to the one of the sparse set are converted.
+     * Otherwise, the sparse set must use a polymorphic allocator and the given
+     * allocator is wrapped in a memory resource that shares its state. In this
+     * case, two sparse sets compare equal only if they refer to the same
+     * adaptor, that is when the allocator is stateless.
+     *
+     * @tparam Other Type of allocator to use.
+     * @param allocator The allocator to use.
+     */
+    template<typename Other>
+    basic_sparse_set(std::allocator_arg_t, const Other &allocator)
+        : basic_sparse_set{internal::rebind_allocator<allocator_type>(allocator)}
+    {}
+
     /*! @brief Default move constructor. */
     basic_sparse_set(basic_sparse_set &&) = default;
 
-    /*! @brief Default destructor. */
-    virtual ~basic_sparse_set() = default;
+    /*! @brief Frees the pages of the sparse array, if any. */
+    virtual ~basic_sparse_set() {
+        release_pages();
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This sparse set.
+     */
+    basic_sparse_set & operator=(basic_sparse_set &&other) {
+        ENTT_ASSERT(alloc_traits::propagate_on_container_move_assignment::value || packed.get_allocator() == other.packed.get_allocator());
+
+        release_pages();
+        sparse = std::move(other.sparse);
+        packed = std::move(other.packed);
+        hash_table = std::move(other.hash_table);
+        keys = other.keys;
+        epoch = other.epoch;
+        hashing = other.hashing;
+        // pages belong to this sparse set from now on
+        other.sparse.clear();
+
+        return *this;
+    }
 
-    /*! @brief Default move assignment operator. @return This sparse set. */
-    basic_sparse_set & operator=(basic_sparse_set &&) = default;
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const {
+        return packed.get_allocator();
+    }
 
     /**
      * @brief Increases the capacity of a sparse set.
@@ -208,7 +715,42 @@ public:
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) {
-        packed.reserve(cap);
+        if(cap > packed.capacity()) {
+            packed.reserve(cap);
+            ENTT_ALLOC_TRACE("entt::sparse_set::reserve", type_id<entity_type>().name(), packed.capacity() * sizeof(entity_type));
+        }
+    }
+
+    /**
+     * @brief Allocates the sparse array for a range of identifiers up front.
+     *
+     * The sparse array is made large enough for all the identifiers in
+     * `[0, extent)` and all its pages are allocated, so that assigning them
+     * later on doesn't allocate anymore. Identifiers are supposed to be plain
+     * entity numbers for this purpose, without versions.
+     *
+     * @note
+     * Nothing happens when the sparse array is a hash table, since its size
+     * doesn't depend on the identifiers.
+     *
+     * @param extent The number of identifiers to make room for.
+     */
+    void reserve_sparse(const size_type extent) {
+        if(hashing) {
+            return;
+        } else if constexpr(entt_per_page == 0u) {
+            if(extent > sparse.size()) {
+                assure_page(extent - 1u);
+            }
+        } else if(extent) {
+            // assures the last page first, the page table is resized only once
+            const auto last = (extent - 1u) / entt_per_page;
+            assure_page(last);
+
+            for(size_type pos{}; pos < last; ++pos) {
+                assure_page(pos);
+            }
+        }
     }
 
     /**
@@ -220,17 +762,82 @@ public:
         return packed.capacity();
     }
 
-    /*! @brief Requests the removal of unused capacity. */
+    /**
+     * @brief Requests the removal of unused capacity.
+     *
+     * Pages of the sparse array that don't refer to any entity are released
+     * and the trailing ones are dropped, so that the extent of the sparse set
+     * is also reduced when possible.
+     */
     void shrink_to_fit() {
-        // conservative approach
         if(packed.empty()) {
-            sparse.clear();
+            release_pages();
+        } else if(hashing) {
+            rehash(packed.size());
+        } else if constexpr(entt_per_page == 0u) {
+            size_type last{};
+
+            for(const auto entt: packed) {
+                last = (std::max)(last, page(entt) + 1u);
+            }
+
+            sparse.resize(last);
+        } else {
+            // pages in use are those of the entities in the packed array
+            std::vector<bool> used(sparse.size());
+            auto allocator = packed.get_allocator();
+
+            for(const auto entt: packed) {
+                used[page(entt)] = true;
+            }
+
+            for(size_type pos{}, last = sparse.size(); pos < last; ++pos) {
+                if(sparse[pos] && !used[pos]) {
+                    alloc_traits::deallocate(allocator, sparse[pos], entt_per_page);
+                    sparse[pos] = nullptr;
+                }
+            }
+
+            while(!sparse.back()) {
+                sparse.pop_back();
+            }
         }
 
         sparse.shrink_to_fit();
+        hash_table.shrink_to_fit();
         packed.shrink_to_fit();
     }
 
+    /**
+     * @brief Returns the memory usage and occupancy of a sparse set.
+     *
+     * Storage classes override this function so as to also take into account
+     * the objects they contain.
+     *
+     * @return The memory usage and occupancy of the sparse set.
+     */
+    [[nodiscard]] virtual pool_stats memory_usage() const {
+        pool_stats stats{};
+
+        stats.size = packed.size();
+        stats.capacity = packed.capacity();
+        stats.packed_bytes = packed.capacity() * sizeof(entity_type);
+
+        if(hashing) {
+            stats.slots = hash_table.size() / 2u;
+            stats.sparse_bytes = hash_table.capacity() * sizeof(entity_type);
+        } else if constexpr(entt_per_page == 0u) {
+            stats.slots = sparse.size();
+            stats.sparse_bytes = sparse.capacity() * sizeof(entity_type);
+        } else {
+            stats.pages = static_cast<size_type>(std::count_if(sparse.cbegin(), sparse.cend(), [](auto &&curr) { return curr != nullptr; }));
+            stats.slots = stats.pages * entt_per_page;
+            stats.sparse_bytes = sparse.capacity() * sizeof(page_type) + stats.slots * sizeof(entity_type);
+        }
+
+        return stats;
+    }
+
     /**
      * @brief Returns the extent of a sparse set.
      *
@@ -239,10 +846,20 @@ public:
      * Usually the size of the internal sparse array is equal or greater than
      * the one of the internal packed array.
      *
+     * @note
+     * When the sparse array is a hash table, its extent is the number of its
+     * buckets instead.
+     *
      * @return Extent of the sparse set.
      */
     [[nodiscard]] size_type extent() const ENTT_NOEXCEPT {
-        return sparse.size() * entt_per_page;
+        if(hashing) {
+            return hash_table.size() / 2u;
+        } else if constexpr(entt_per_page == 0u) {
+            return sparse.size();
+        } else {
+            return sparse.size() * entt_per_page;
+        }
     }
 
     /**
@@ -339,6 +956,30 @@ public:
         return rbegin() + packed.size();
     }
 
+    /**
+     * @brief Splits the internal packed array in chunks of contiguous entities.
+     *
+     * The iterable object returns tuples that contain a pointer to the first
+     * entity of a chunk followed by the number of entities in the chunk. All
+     * chunks have the requested length, but for the last one that can be
+     * shorter. The chunked object also offers random access to the chunks by
+     * means of `operator[]` and returns their number through `size`.
+     *
+     * Chunks are laid out in the order of the internal packed array, starting
+     * from `data()`. Therefore, the default length lines up chunks of entities
+     * with the page boundaries of the packed array.
+     *
+     * @note
+     * Entities are in the reverse order as returned by the `begin`/`end`
+     * iterators.
+     *
+     * @param len Length of the chunks, in number of elements.
+     * @return An iterable object to use to visit the chunks.
+     */
+    [[nodiscard]] chunked_type chunks(const size_type len = chunk_size) const ENTT_NOEXCEPT {
+        return chunked_type{len, packed.size(), packed.data()};
+    }
+
     /**
      * @brief Finds an entity.
      * @param entt A valid entity identifier.
@@ -355,9 +996,63 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const {
+        if(hashing) {
+            return !hash_table.empty() && in_use(hash_table[2u * bucket(entt) + 1u]);
+        }
+
         const auto curr = page(entt);
-        // testing against null permits to avoid accessing the packed array
-        return (curr < sparse.size() && sparse[curr] && sparse[curr][offset(entt)] != null);
+
+        // testing the version of the slot permits to avoid accessing the packed array
+        if constexpr(entt_per_page == 0u) {
+            return (curr < sparse.size() && in_use(sparse[curr]));
+        } else {
+            return (curr < sparse.size() && sparse[curr] && in_use(sparse[curr][offset(entt)]));
+        }
+    }
+
+    /**
+     * @brief Hints that an entity is going to be looked up soon.
+     *
+     * The slot of the sparse array for the given entity is prefetched, if any.
+     * Nothing happens if the entity has never been part of the sparse set.
+     *
+     * @param entt A valid entity identifier.
+     */
+    void prefetch(const entity_type entt) const ENTT_NOEXCEPT {
+        if(hashing) {
+            if(!hash_table.empty()) {
+                ENTT_PREFETCH(hash_table.data() + 2u * home(entt));
+            }
+        } else if(const auto curr = page(entt); curr < sparse.size()) {
+            if constexpr(entt_per_page == 0u) {
+                ENTT_PREFETCH(sparse.data() + curr);
+            } else if(sparse[curr]) {
+                ENTT_PREFETCH(&sparse[curr][offset(entt)]);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if a sparse set contains the entities of a batch.
+     *
+     * The i-th bit of the mask refers to the i-th entity of the batch. Only
+     * the entities whose bits are set are tested, all the others are ignored.
+     * Therefore, a batch contains at most as many entities as the bits of the
+     * mask type.
+     *
+     * @param first Pointer to the first entity of the batch.
+     * @param mask Bitmask of the entities to test.
+     * @return The given bitmask where the bits of the entities that don't
+     * belong to the sparse set are cleared.
+     */
+    [[nodiscard]] mask_type contains(const entity_type *first, mask_type mask) const {
+        for(mask_type curr = mask, pos{}; curr; curr >>= 1u, ++pos) {
+            if((curr & 1u) && !contains(first[pos])) {
+                mask &= ~(mask_type{1u} << pos);
+            }
+        }
+
+        return mask;
     }
 
     /**
@@ -372,7 +1067,7 @@ public:
      */
     [[nodiscard]] size_type index(const entity_type entt) const {
         ENTT_ASSERT(contains(entt));
-        return size_type{to_integral(sparse[page(entt)][offset(entt)])};
+        return position(element(entt));
     }
 
     /**
@@ -386,8 +1081,13 @@ public:
      */
     void emplace(const entity_type entt) {
         ENTT_ASSERT(!contains(entt));
-        assure(page(entt))[offset(entt)] = entity_type{static_cast<typename traits_type::entity_type>(packed.size())};
+        assure(entt) = slot(packed.size());
+        const auto cap = packed.capacity();
         packed.push_back(entt);
+
+        if(packed.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::sparse_set::emplace", type_id<entity_type>().name(), packed.capacity() * sizeof(entity_type));
+        }
     }
 
     /**
@@ -403,12 +1103,26 @@ public:
      */
     template<typename It>
     void insert(It first, It last) {
-        auto next = static_cast<typename traits_type::entity_type>(packed.size());
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            if(first != last) {
+                // grows the sparse array at once rather than entity by entity
+                static_cast<void>(assure(*std::max_element(first, last, [](const auto lhs, const auto rhs) {
+                    return (to_integral(lhs) & traits_type::entity_mask) < (to_integral(rhs) & traits_type::entity_mask);
+                })));
+            }
+        }
+
+        auto next = packed.size();
+        const auto cap = packed.capacity();
         packed.insert(packed.end(), first, last);
 
+        if(packed.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::sparse_set::insert", type_id<entity_type>().name(), packed.capacity() * sizeof(entity_type));
+        }
+
         for(; first != last; ++first) {
             ENTT_ASSERT(!contains(*first));
-            assure(page(*first))[offset(*first)] = entity_type{next++};
+            assure(*first) = slot(next++);
         }
     }
 
@@ -423,11 +1137,11 @@ public:
      */
     void remove(const entity_type entt) {
         ENTT_ASSERT(contains(entt));
-        auto &ref = sparse[page(entt)][offset(entt)];
-        const auto pos = size_type{to_integral(ref)};
+        auto &ref = element(entt);
+        const auto pos = position(ref);
         const auto other = packed.back();
 
-        sparse[page(other)][offset(other)] = ref;
+        element(other) = ref;
         packed[pos] = other;
         ref = null;
 
@@ -437,15 +1151,22 @@ public:
 
     /**
      * @brief Removes multiple entities from a pool.
+     *
+     * Large batches aren't removed one at a time. Entities are marked first
+     * and the packed array is then compacted with a single linear sweep, that
+     * also preserves the relative order of the entities left.
+     *
      * @tparam It Type of input iterator.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
     template<typename It>
     void remove(It first, It last) {
-        if(std::distance(first, last) == std::distance(packed.begin(), packed.end())) {
+        if(const auto count = std::distance(first, last); count == std::distance(packed.begin(), packed.end())) {
             // no validity check, let it be misused
             clear();
+        } else if(size_type(count) * compact_ratio > packed.size()) {
+            compact(first, last);
         } else {
             for(; first != last; ++first) {
                 remove(*first);
@@ -469,7 +1190,7 @@ public:
     void swap(const entity_type lhs, const entity_type rhs) {
         const auto from = index(lhs);
         const auto to = index(rhs);
-        std::swap(sparse[page(lhs)][offset(lhs)], sparse[page(rhs)][offset(rhs)]);
+        std::swap(element(lhs), element(rhs));
         std::swap(packed[from], packed[to]);
         swap_at(from, to);
     }
@@ -516,7 +1237,7 @@ public:
 
             while(curr != next) {
                 swap_at(next, index(packed[next]));
-                sparse[page(packed[curr])][offset(packed[curr])] = entity_type{static_cast<typename traits_type::entity_type>(curr)};
+                element(packed[curr]) = slot(curr);
 
                 curr = next;
                 next = index(packed[curr]);
@@ -557,34 +1278,139 @@ public:
      * @param other The sparse sets that imposes the order of the entities.
      */
     void respect(const basic_sparse_set &other) {
-        const auto to = other.end();
-        auto from = other.begin();
+        if(packed.size() < other.size()) {
+            // only shared entities are visited when the other set is larger
+            std::vector<entity_type> shared{};
+
+            for(auto &&entt: packed) {
+                if(other.contains(entt)) {
+                    shared.push_back(entt);
+                }
+            }
+
+            std::sort(shared.begin(), shared.end(), [&other](const auto lhs, const auto rhs) {
+                return other.index(lhs) < other.index(rhs);
+            });
+
+            for(size_type pos = packed.size() - shared.size(), next{}; next < shared.size(); ++pos, ++next) {
+                if(shared[next] != packed[pos]) {
+                    swap(packed[pos], shared[next]);
+                }
+            }
+        } else if(!packed.empty()) {
+            const auto to = other.end();
+            auto from = other.begin();
 
-        size_type pos = packed.size() - 1;
+            size_type pos = packed.size() - 1;
 
-        while(pos && from != to) {
-            if(contains(*from)) {
-                if(*from != packed[pos]) {
-                    swap(packed[pos], *from);
+            while(pos && from != to) {
+                if(contains(*from)) {
+                    if(*from != packed[pos]) {
+                        swap(packed[pos], *from);
+                    }
+
+                    --pos;
                 }
 
-                --pos;
+                ++from;
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces the identifiers of all the entities at once.
+     *
+     * The table is indexed by the entity part of the identifiers currently in
+     * use and returns their replacements. Entities keep their positions in the
+     * packed array, therefore objects aren't moved. The sparse array is then
+     * rebuilt from scratch and the pages no longer in use are released.
+     *
+     * @warning
+     * Attempting to use a table that doesn't contain a valid replacement for
+     * all the entities results in undefined behavior.
+     *
+     * @param table A table of replacements for the identifiers.
+     */
+    void remap(const entity_type *table) {
+        release_pages();
+
+        for(size_type pos{}, last = packed.size(); pos < last; ++pos) {
+            packed[pos] = table[to_integral(packed[pos]) & traits_type::entity_mask];
+            ENTT_ASSERT(packed[pos] != null);
+            assure(packed[pos]) = slot(pos);
+        }
+
+        remap_all(table);
+    }
+
+    /**
+     * @brief Turns the sparse array into a hash table or back into pages.
+     *
+     * A hash table uses memory proportional to the number of entities rather
+     * than to the greatest identifier in use. It's meant for sets that contain
+     * few entities with large identifiers, at the price of a slightly slower
+     * lookup.<br/>
+     * The sparse array is rebuilt from scratch when the mode changes.
+     *
+     * @param value True to use a hash table, false to use pages.
+     */
+    void hashed(const bool value) {
+        if(value != hashing) {
+            release_pages();
+            hashing = value;
+
+            for(size_type pos{}, last = packed.size(); pos < last; ++pos) {
+                assure(packed[pos]) = slot(pos);
             }
+        }
+    }
+
+    /**
+     * @brief Checks whether the sparse array is a hash table.
+     * @return True if the sparse array is a hash table, false otherwise.
+     */
+    [[nodiscard]] bool hashed() const ENTT_NOEXCEPT {
+        return hashing;
+    }
 
-            ++from;
+    /**
+     * @brief Removes all entities from a sparse set and keeps its memory.
+     *
+     * Unlike `clear`, neither the pages of the sparse array nor the capacity
+     * of the packed array are released, so that refilling the sparse set
+     * doesn't allocate again.<br/>
+     * Slots are tagged with an epoch that is bumped rather than reset one by
+     * one. The sparse array is refreshed only when the epoch wraps around,
+     * therefore the cost of this function is constant in amortized time.
+     */
+    void reset() ENTT_NOEXCEPT {
+        if(epoch == traits_type::version_mask) {
+            refresh_pages();
+        } else {
+            ++epoch;
         }
+
+        packed.clear();
+        clear_all();
     }
 
     /*! @brief Clears a sparse set. */
     void clear() ENTT_NOEXCEPT {
-        sparse.clear();
+        release_pages();
         packed.clear();
         clear_all();
     }
 
 private:
-    std::vector<page_type> sparse;
-    std::vector<entity_type> packed;
+    // keeps alive the adaptor of a foreign allocator, if any
+    std::shared_ptr<void> resource;
+    std::vector<page_type, page_alloc_type> sparse;
+    std::vector<entity_type, allocator_type> packed;
+    // pairs of keys and slots, keys contain only the entity part of the identifiers
+    std::vector<entity_type, allocator_type> hash_table;
+    size_type keys{};
+    typename traits_type::entity_type epoch{1u};
+    bool hashing{};
 };
 
 
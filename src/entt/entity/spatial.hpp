@@ -0,0 +1,372 @@
+#ifndef ENTT_ENTITY_SPATIAL_HPP
+#define ENTT_ENTITY_SPATIAL_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "storage.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Mixin type to use to add spatial queries to storage types.
+ *
+ * Entities are indexed by means of a uniform grid, according to the position
+ * stored in their objects. The grid is kept up-to-date whenever objects are
+ * created, updated by means of the registry or removed. Queries visit only the
+ * cells that overlap the requested area rather than all the entities.
+ *
+ * Example of use:
+ *
+ * @code{.cpp}
+ * template<typename Entity>
+ * struct entt::storage_traits<Entity, position> {
+ *     using storage_type = entt::sigh_storage_mixin<entt::spatial_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, position>>, &position::x, &position::y>>;
+ * };
+ * @endcode
+ *
+ * The mixin should come before the one that emits signals, so that entities
+ * are already indexed when listeners are invoked.
+ *
+ * @note
+ * Objects that are modified in place without notifying the storage aren't
+ * moved to their new cells, the same as updates aren't notified in this case.
+ * Entities with coordinates that aren't a number are never returned.
+ *
+ * @tparam Type The type of the underlying storage.
+ * @tparam Member Pointers to the data members that contain the coordinates.
+ */
+template<typename Type, auto... Member>
+struct spatial_storage_mixin: Type {
+    static_assert(sizeof...(Member) != 0u && sizeof...(Member) <= 3u, "Invalid number of coordinates");
+    static_assert((std::is_member_object_pointer_v<decltype(Member)> && ...), "Invalid data member");
+    static_assert(!std::is_same_v<typename Type::storage_category, empty_storage_tag>, "Empty types have no coordinates");
+
+    using Type::Type;
+
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+    /*! @brief Type of coordinates. */
+    using coord_type = std::common_type_t<std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const value_type &>().*Member)>>...>;
+    /*! @brief Type of points. */
+    using point_type = std::array<coord_type, sizeof...(Member)>;
+
+private:
+    static constexpr auto dimensions = sizeof...(Member);
+    static constexpr auto bits = 64u / dimensions;
+
+    using cell_type = std::array<std::int64_t, dimensions>;
+
+    struct location {
+        std::uint64_t key;
+        std::size_t pos;
+    };
+
+    [[nodiscard]] static std::size_t index_of(const entity_type entity) ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(to_integral(entity) & entt_traits<entity_type>::entity_mask);
+    }
+
+    [[nodiscard]] static std::uint64_t key_of(const cell_type &cell) ENTT_NOEXCEPT {
+        // cells that share a key are told apart when the coordinates are tested
+        std::uint64_t key{};
+
+        for(auto &&curr: cell) {
+            key = (dimensions == 1u) ? static_cast<std::uint64_t>(curr) : ((key << bits) | (static_cast<std::uint64_t>(curr) & ((std::uint64_t{1u} << bits) - 1u)));
+        }
+
+        return key;
+    }
+
+    [[nodiscard]] cell_type cell_of(const point_type &point) const {
+        // cells far from the origin are merged, casting out of range values is undefined behavior
+        constexpr double bound = static_cast<double>(std::int64_t{1} << 62u);
+        cell_type cell{};
+
+        for(std::size_t dim{}; dim < dimensions; ++dim) {
+            const auto value = std::floor(static_cast<double>(point[dim]) / static_cast<double>(extent));
+            cell[dim] = std::isnan(value) ? std::int64_t{} : static_cast<std::int64_t>(std::clamp(value, -bound, bound));
+        }
+
+        return cell;
+    }
+
+    [[nodiscard]] point_type point_of(const entity_type entity) const {
+        const auto &instance = this->get(entity);
+        return { static_cast<coord_type>(instance.*Member)... };
+    }
+
+    void attach(const entity_type entity) {
+        const auto key = key_of(cell_of(point_of(entity)));
+        auto &&cell = cells[key];
+
+        if(const auto pos = index_of(entity); !(pos < locations.size())) {
+            locations.resize(pos + 1u);
+        }
+
+        locations[index_of(entity)] = location{key, cell.size()};
+        cell.push_back(entity);
+    }
+
+    void detach(const entity_type entity) {
+        const auto [key, pos] = locations[index_of(entity)];
+        auto &&cell = cells[key];
+
+        locations[index_of(cell.back())].pos = pos;
+        cell[pos] = cell.back();
+        cell.pop_back();
+
+        if(cell.empty()) {
+            cells.erase(key);
+        }
+    }
+
+    template<typename Func>
+    void visit(const point_type &min, const point_type &max, Func func) const {
+        const auto first = cell_of(min);
+        const auto last = cell_of(max);
+        auto curr = first;
+        double count{1.};
+
+        for(std::size_t dim{}; dim < dimensions; ++dim) {
+            // boxes with undefined boundaries contain nothing
+            if(std::isnan(static_cast<double>(min[dim])) || std::isnan(static_cast<double>(max[dim])) || last[dim] < first[dim]) {
+                return;
+            }
+
+            count *= static_cast<double>(last[dim]) - static_cast<double>(first[dim]) + 1.;
+        }
+
+        if(!(count < static_cast<double>(cells.size()))) {
+            // large boxes visit the occupied cells only, entities are tested by the caller anyway
+            for(auto &&elem: cells) {
+                for(const auto entity: elem.second) {
+                    func(entity, point_of(entity));
+                }
+            }
+
+            return;
+        }
+
+        for(std::size_t dim{}; dim < dimensions;) {
+            if(const auto it = cells.find(key_of(curr)); it != cells.cend()) {
+                for(const auto entity: it->second) {
+                    func(entity, point_of(entity));
+                }
+            }
+
+            // odometer-like increment of the current cell
+            for(dim = 0u; dim < dimensions && ++curr[dim] > last[dim]; ++dim) {
+                curr[dim] = first[dim];
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Sets the size of the cells of the grid.
+     *
+     * The grid is rebuilt from scratch if the storage isn't empty.
+     *
+     * @param value The size of the cells, greater than zero.
+     */
+    void cell_size(const coord_type value) {
+        ENTT_ASSERT(value > coord_type{});
+        extent = value;
+        cells.clear();
+
+        for(auto pos = this->size(); pos; --pos) {
+            attach(this->data()[pos - 1u]);
+        }
+    }
+
+    /**
+     * @brief Returns the size of the cells of the grid.
+     * @return The size of the cells.
+     */
+    [[nodiscard]] coord_type cell_size() const ENTT_NOEXCEPT {
+        return extent;
+    }
+
+    /**
+     * @brief Returns the entities within an axis-aligned bounding box.
+     *
+     * The box is closed, that is, entities that lie on its boundaries are also
+     * returned. Entities aren't returned in any particular order.
+     *
+     * @tparam It Type of output iterator.
+     * @param min The corner of the box with the lowest coordinates.
+     * @param max The corner of the box with the highest coordinates.
+     * @param out An output iterator to which to write the entities.
+     * @return An iterator past the last entity written.
+     */
+    template<typename It>
+    It query_aabb(const point_type &min, const point_type &max, It out) const {
+        visit(min, max, [&out, &min, &max](const entity_type entity, const point_type &point) {
+            bool inside = true;
+
+            for(std::size_t dim{}; dim < dimensions; ++dim) {
+                inside = inside && min[dim] <= point[dim] && point[dim] <= max[dim];
+            }
+
+            if(inside) {
+                *(out++) = entity;
+            }
+        });
+
+        return out;
+    }
+
+    /**
+     * @brief Returns the entities within a given distance from a point.
+     *
+     * Entities aren't returned in any particular order.
+     *
+     * @tparam It Type of output iterator.
+     * @param center The point from which to measure distances.
+     * @param radius The maximum distance.
+     * @param out An output iterator to which to write the entities.
+     * @return An iterator past the last entity written.
+     */
+    template<typename It>
+    It query_radius(const point_type &center, const coord_type radius, It out) const {
+        point_type min{};
+        point_type max{};
+
+        for(std::size_t dim{}; dim < dimensions; ++dim) {
+            min[dim] = center[dim] - radius;
+            max[dim] = center[dim] + radius;
+        }
+
+        visit(min, max, [&out, &center, radius](const entity_type entity, const point_type &point) {
+            coord_type distance{};
+
+            for(std::size_t dim{}; dim < dimensions; ++dim) {
+                distance += (point[dim] - center[dim]) * (point[dim] - center[dim]);
+            }
+
+            if(distance <= radius * radius) {
+                *(out++) = entity;
+            }
+        });
+
+        return out;
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::emplace
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
+        decltype(auto) instance = Type::emplace(owner, entity, std::forward<Args>(args)...);
+        attach(entity);
+        return instance;
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::insert
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects
+     * associated with the entities.
+     * @param owner The registry that issued the request.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects associated with
+     * the entities.
+     */
+    template<typename It, typename... Args>
+    void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
+        Type::insert(owner, first, last, std::forward<Args>(args)...);
+
+        for(; first != last; ++first) {
+            attach(*first);
+        }
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::remove
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     */
+    void remove(basic_registry<entity_type> &owner, const entity_type entity) {
+        detach(entity);
+        Type::remove(owner, entity);
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::remove
+     * @tparam It Type of input iterator.
+     * @param owner The registry that issued the request.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void remove(basic_registry<entity_type> &owner, It first, It last) {
+        for(auto it = first; it != last; ++it) {
+            detach(*it);
+        }
+
+        Type::remove(owner, first, last);
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::patch
+     * @tparam Func Types of the function objects to invoke.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, Func &&... func) {
+        decltype(auto) instance = Type::patch(owner, entity, std::forward<Func>(func)...);
+
+        if(key_of(cell_of(point_of(entity))) != locations[index_of(entity)].key) {
+            detach(entity);
+            attach(entity);
+        }
+
+        return instance;
+    }
+
+private:
+    void remap_all(const entity_type *) override {
+        // objects don't move, only the identifiers in the grid are outdated
+        cells.clear();
+        locations.clear();
+
+        for(auto pos = this->size(); pos; --pos) {
+            attach(this->data()[pos - 1u]);
+        }
+    }
+
+    std::unordered_map<std::uint64_t, std::vector<entity_type>> cells{};
+    std::vector<location> locations{};
+    coord_type extent{1};
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef ENTT_ENTITY_SPAWNER_HPP
+#define ENTT_ENTITY_SPAWNER_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include "../config/config.h"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Thread safe entity spawner.
+ *
+ * A spawner reserves blocks of identifiers from a registry in advance, so that
+ * multiple threads can then create entities concurrently. Reserving
+ * identifiers isn't thread safe and should happen at a synchronization point,
+ * while creating entities is a lock-free operation that only bumps an atomic
+ * counter.<br/>
+ * Identifiers are both taken from the list of those available for recycling
+ * and generated from scratch, as if they were created directly from the
+ * registry.
+ *
+ * @warning
+ * All the reserved identifiers are valid entities for the registry, although
+ * they aren't handed out yet. Entities that are never created are returned to
+ * the registry when the spawner is released or destroyed.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_spawner {
+    [[nodiscard]] auto consumed() const ENTT_NOEXCEPT {
+        return (std::min)(next.load(std::memory_order_relaxed), reserved.size());
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = basic_registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a spawner for a given registry.
+     * @param ref A valid reference to a registry.
+     */
+    explicit basic_spawner(registry_type &ref)
+        : reg{&ref},
+          reserved{},
+          next{}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_spawner(const basic_spawner &) = delete;
+
+    /*! @brief Returns the identifiers that were never used to the registry. */
+    ~basic_spawner() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This spawner.
+     */
+    basic_spawner & operator=(const basic_spawner &) = delete;
+
+    /**
+     * @brief Makes sure that a given number of identifiers can be handed out.
+     *
+     * Identifiers that were reserved and never used are kept. New ones are
+     * created from the registry only if required.
+     *
+     * @warning
+     * This function isn't thread safe and it shouldn't be invoked while other
+     * threads are creating entities through the spawner.
+     *
+     * @param count Number of identifiers to make available.
+     */
+    void reserve(const size_type count) {
+        reserved.erase(reserved.begin(), reserved.begin() + consumed());
+        next.store(0u, std::memory_order_relaxed);
+
+        if(const auto sz = reserved.size(); sz < count) {
+            reserved.resize(count);
+            reg->create(reserved.begin() + sz, reserved.end());
+        }
+    }
+
+    /**
+     * @brief Returns the number of identifiers that can still be handed out.
+     * @return Number of identifiers that can still be handed out.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return reserved.size() - consumed();
+    }
+
+    /**
+     * @brief Creates a new entity.
+     *
+     * This function is thread safe with respect to other calls to `create`.
+     *
+     * @return A valid entity identifier if there are still identifiers
+     * available, the null entity otherwise.
+     */
+    [[nodiscard]] entity_type create() ENTT_NOEXCEPT {
+        const auto pos = next.fetch_add(1u, std::memory_order_relaxed);
+        return pos < reserved.size() ? reserved[pos] : entity_type{null};
+    }
+
+    /**
+     * @brief Assigns each element in a range an entity.
+     *
+     * The whole block is claimed at once, regardless of the number of
+     * identifiers still available. Therefore, the range is filled only
+     * partially when this number isn't enough.<br/>
+     * This function is thread safe with respect to other calls to `create`.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     * @return An iterator past the last element assigned an entity.
+     */
+    template<typename It>
+    It create(It first, It last) ENTT_NOEXCEPT {
+        const auto length = static_cast<size_type>(std::distance(first, last));
+        const auto pos = (std::min)(next.fetch_add(length, std::memory_order_relaxed), reserved.size());
+        const auto count = (std::min)(length, reserved.size() - pos);
+        return std::copy_n(reserved.cbegin() + pos, count, first);
+    }
+
+    /**
+     * @brief Returns the identifiers that were never used to the registry.
+     *
+     * @warning
+     * This function isn't thread safe and it shouldn't be invoked while other
+     * threads are creating entities through the spawner.
+     */
+    void release() {
+        if(const auto from = consumed(); from != reserved.size()) {
+            reg->destroy(reserved.cbegin() + from, reserved.cend());
+        }
+
+        reserved.clear();
+        next.store(0u, std::memory_order_relaxed);
+    }
+
+private:
+    registry_type *reg;
+    std::vector<entity_type> reserved;
+    std::atomic<size_type> next;
+};
+
+
+}
+
+
+#endif
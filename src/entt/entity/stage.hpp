@@ -0,0 +1,210 @@
+#ifndef ENTT_ENTITY_STAGE_HPP
+#define ENTT_ENTITY_STAGE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "group.hpp"
+#include "utility.hpp"
+#include "view.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type, typename = void>
+struct has_raw: std::false_type {};
+
+
+template<typename Type>
+struct has_raw<Type, std::void_t<decltype(std::declval<Type &>().raw())>>: std::true_type {};
+
+
+template<typename Component, typename Range>
+[[nodiscard]] std::nullptr_t contiguous_range(const Range &) ENTT_NOEXCEPT {
+    return nullptr;
+}
+
+
+template<typename Component, typename Entity, typename Type>
+[[nodiscard]] auto contiguous_range(const basic_view<Entity, exclude_t<>, Type> &view) ENTT_NOEXCEPT {
+    if constexpr(std::is_same_v<Type, Component> && has_raw<std::remove_reference_t<decltype(view.storage())>>::value) {
+        return std::make_pair(view.data(), static_cast<const Component *>(view.storage().raw()));
+    } else {
+        return nullptr;
+    }
+}
+
+
+template<typename Component, typename Entity, typename... Exclude, typename... Get, typename... Owned>
+[[nodiscard]] auto contiguous_range(const basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> &group) ENTT_NOEXCEPT {
+    if constexpr((std::is_same_v<Owned, Component> || ...)) {
+        return std::make_pair(group.data(), static_cast<const Component *>(group.template raw<Component>()));
+    } else {
+        return nullptr;
+    }
+}
+
+
+template<typename Type>
+void copy_instances(const Type *from, const std::size_t count, Type *to) {
+    if constexpr(std::is_trivially_copyable_v<Type>) {
+        if(count) {
+            std::memcpy(to, from, count * sizeof(Type));
+        }
+    } else {
+        std::copy(from, from + count, to);
+    }
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Copies the instances of a component iterated by a view or a group to
+ * a buffer.
+ *
+ * When the instances are contiguous in memory, that is for single component
+ * views and for the owned types of owning groups, they're copied in a single
+ * pass, with a plain `memcpy` if possible. In this case, the buffer follows the
+ * order of the packed arrays, that is the reverse order of iteration.<br/>
+ * In all other cases, instances are gathered one at a time in the order of
+ * iteration.
+ *
+ * The component must be specified as it appears in the list of types of the
+ * view or group, constness included.
+ *
+ * @warning
+ * The buffer must be large enough to contain all the elements of the view or
+ * group, otherwise the behavior is undefined.
+ *
+ * @tparam Component Type of component to copy.
+ * @tparam Range Type of view or group to copy from.
+ * @param range A view or a group that iterates the given component.
+ * @param buffer A valid buffer, usually a mapped region of a GPU buffer.
+ * @return The number of elements copied.
+ */
+template<typename Component, typename Range>
+std::size_t stage(const Range &range, std::remove_const_t<Component> *buffer) {
+    if constexpr(auto source = internal::contiguous_range<Component>(range); std::is_same_v<decltype(source), std::nullptr_t>) {
+        std::size_t pos{};
+
+        for(const auto entt: range) {
+            buffer[pos++] = range.template get<Component>(entt);
+        }
+
+        return pos;
+    } else {
+        internal::copy_instances(source.second, range.size(), buffer);
+        return range.size();
+    }
+}
+
+
+/**
+ * @brief Copies the instances of a component that changed after a tick to a
+ * buffer and returns the updated subranges.
+ *
+ * The buffer is laid out as in the overload that copies everything, though
+ * only the instances changed after the given tick are written. The storage must
+ * track changes, as an example by means of a `tick_storage_mixin`, and it's
+ * used to test the entities of the view or group.<br/>
+ * The function object is invoked once for each run of contiguous elements
+ * written to the buffer, so that only the changed parts of a mapped region are
+ * flushed. Its signature should be equivalent to the following:
+ *
+ * @code{.cpp}
+ * void(const std::size_t offset, const std::size_t count);
+ * @endcode
+ *
+ * Both the offset and the count are in number of elements.
+ *
+ * @sa tick_storage_mixin
+ *
+ * @tparam Component Type of component to copy.
+ * @tparam Range Type of view or group to copy from.
+ * @tparam Storage Type of storage that tracks the changes.
+ * @tparam Func Type of the function object to invoke.
+ * @param range A view or a group that iterates the given component.
+ * @param buffer A valid buffer, usually a mapped region of a GPU buffer.
+ * @param tracker The storage that tracks the changes of the component.
+ * @param since A tick, usually returned by `basic_registry::advance_tick`.
+ * @param func A valid function object.
+ * @return The number of elements in the view or group.
+ */
+template<typename Component, typename Range, typename Storage, typename Func>
+std::size_t stage(const Range &range, std::remove_const_t<Component> *buffer, const Storage &tracker, const std::uint64_t since, Func func) {
+    std::size_t first{};
+    std::size_t pos{};
+
+    const auto flush = [&func, &first, &pos](const bool changed) {
+        if(!changed) {
+            if(first != pos) {
+                func(first, pos - first);
+            }
+
+            first = pos + 1u;
+        }
+    };
+
+    if constexpr(auto source = internal::contiguous_range<Component>(range); std::is_same_v<decltype(source), std::nullptr_t>) {
+        for(const auto entt: range) {
+            const bool changed = tracker.changed_since(entt, since);
+
+            if(changed) {
+                buffer[pos] = range.template get<Component>(entt);
+            }
+
+            flush(changed);
+            ++pos;
+        }
+    } else {
+        const auto [entities, instances] = source;
+
+        for(const auto last = range.size(); pos < last; ++pos) {
+            const bool changed = tracker.changed_since(entities[pos], since);
+
+            if(!changed) {
+                internal::copy_instances(instances + first, pos - first, buffer + first);
+            }
+
+            flush(changed);
+        }
+
+        internal::copy_instances(instances + first, pos - first, buffer + first);
+    }
+
+    if(first != pos) {
+        func(first, pos - first);
+    }
+
+    return pos;
+}
+
+
+}
+
+
+#endif
@@ -3,8 +3,13 @@
 
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -25,6 +30,52 @@ namespace entt {
 struct empty_storage_tag {};
 /*! @brief Dense storage category tag. */
 struct dense_storage_tag: empty_storage_tag {};
+/*! @brief Split storage category tag. */
+struct split_storage_tag: dense_storage_tag {};
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type>
+void relocate_swap(Type &lhs, Type &rhs) ENTT_NOEXCEPT {
+    static_assert(is_trivially_relocatable_v<Type>, "Invalid type");
+    std::aligned_storage_t<sizeof(Type), alignof(Type)> buffer;
+    std::memcpy(static_cast<void *>(&buffer), static_cast<const void *>(std::addressof(lhs)), sizeof(Type));
+    std::memcpy(static_cast<void *>(std::addressof(lhs)), static_cast<const void *>(std::addressof(rhs)), sizeof(Type));
+    std::memcpy(static_cast<void *>(std::addressof(rhs)), static_cast<const void *>(&buffer), sizeof(Type));
+}
+
+
+template<typename Storage, typename Entity>
+void remap_storage(Storage &cpool, const Entity *table) {
+    using traits_type = entt_traits<Entity>;
+    constexpr auto version_mask = traits_type::version_mask << traits_type::entity_shift;
+
+    for(auto pos = cpool.size(); pos; --pos) {
+        // objects of entities that no longer exist have no replacement with the same version
+        if(const auto entt = cpool.data()[pos - 1u], other = table[to_integral(entt) & traits_type::entity_mask]; other == null || ((to_integral(entt) ^ to_integral(other)) & version_mask)) {
+            cpool.remove(entt);
+        }
+    }
+
+    cpool.remap(table);
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
 
 
 /**
@@ -45,6 +96,13 @@ struct dense_storage_tag: empty_storage_tag {};
  * no guarantees that objects are returned in the insertion order when iterate
  * a storage. Do not make assumption on the order in any case.
  *
+ * @note
+ * The allocator is used for both the objects and the underlying sparse set.
+ * The latter erases it behind a polymorphic allocator, so that storage classes
+ * can be used with the registry and the views regardless of their allocators.
+ * Storage classes use polymorphic allocators by default, the registry hands
+ * them its memory resource.
+ *
  * @warning
  * Empty types aren't explicitly instantiated. Therefore, many of the functions
  * normally available for non-empty types will not be available for empty ones.
@@ -53,19 +111,21 @@ struct dense_storage_tag: empty_storage_tag {};
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Entity, typename Type, typename = void>
+template<typename Entity, typename Type, typename Allocator = std::pmr::polymorphic_allocator<Type>, typename = void>
 class basic_storage: public basic_sparse_set<Entity> {
     static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The managed type must be at least move constructible and assignable");
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, Type>, "Invalid value type");
 
     using underlying_type = basic_sparse_set<Entity>;
     using traits_type = entt_traits<Entity>;
 
     template<typename Value>
     class storage_iterator final {
-        friend class basic_storage<Entity, Type>;
+        friend class basic_storage<Entity, Type, Allocator>;
 
-        using instance_type = constness_as_t<std::vector<Type>, Value>;
+        using instance_type = constness_as_t<std::vector<Type, Allocator>, Value>;
         using index_type = typename traits_type::difference_type;
 
         storage_iterator(instance_type &ref, const index_type idx) ENTT_NOEXCEPT
@@ -165,15 +225,50 @@ class basic_storage: public basic_sparse_set<Entity> {
     };
 
     void swap_at(const std::size_t lhs, const std::size_t rhs) final {
-        std::swap(instances[lhs], instances[rhs]);
+        if constexpr(is_trivially_relocatable_v<Type>) {
+            if(lhs != rhs) {
+                internal::relocate_swap(instances[lhs], instances[rhs]);
+            }
+        } else {
+            std::swap(instances[lhs], instances[rhs]);
+        }
     }
 
     void swap_and_pop(const std::size_t pos) final {
-        auto other = std::move(instances.back());
-        instances[pos] = std::move(other);
+        if constexpr(is_trivially_relocatable_v<Type>) {
+            if(const auto last = instances.size() - 1u; pos != last) {
+                if constexpr(std::is_trivially_copyable_v<Type>) {
+                    std::memcpy(static_cast<void *>(std::addressof(instances[pos])), static_cast<const void *>(std::addressof(instances[last])), sizeof(Type));
+                } else {
+                    // the object removed ends up last and is destroyed in place
+                    internal::relocate_swap(instances[pos], instances[last]);
+                }
+            }
+        } else {
+            auto other = std::move(instances.back());
+            instances[pos] = std::move(other);
+        }
+
         instances.pop_back();
     }
 
+    void compact_all(const std::size_t from) final {
+        const auto *entities = underlying_type::data();
+        auto to = from;
+
+        for(auto pos = from, last = instances.size(); pos < last; ++pos) {
+            if(entities[pos] != null) {
+                if(to != pos) {
+                    instances[to] = std::move(instances[pos]);
+                }
+
+                ++to;
+            }
+        }
+
+        instances.erase(instances.begin() + to, instances.end());
+    }
+
     void clear_all() ENTT_NOEXCEPT final {
         instances.clear();
     }
@@ -193,8 +288,36 @@ public:
     using reverse_iterator = Type *;
     /*! @brief Constant reverse iterator type. */
     using const_reverse_iterator = const Type *;
+    /*! @brief Iterable type returned when splitting a storage in chunks. */
+    using chunked_type = internal::chunked_range<const entity_type, Type>;
+    /*! @brief Constant iterable type returned when splitting a storage in chunks. */
+    using const_chunked_type = internal::chunked_range<const entity_type, const Type>;
     /*! @brief Storage category. */
     using storage_category = dense_storage_tag;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}}
+    {}
+
+    /**
+     * @brief Constructs an empty storage with the given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : underlying_type{std::allocator_arg, allocator},
+          instances(allocator)
+    {}
+
+    /**
+     * @brief Returns the allocator associated with the objects.
+     * @return The allocator associated with the objects.
+     */
+    [[nodiscard]] allocator_type get_allocator() const {
+        return instances.get_allocator();
+    }
 
     /**
      * @brief Increases the capacity of a storage.
@@ -206,7 +329,11 @@ public:
      */
     void reserve(const size_type cap) {
         underlying_type::reserve(cap);
-        instances.reserve(cap);
+
+        if(cap > instances.capacity()) {
+            instances.reserve(cap);
+            ENTT_ALLOC_TRACE("entt::storage::reserve", type_id<value_type>().name(), instances.capacity() * sizeof(value_type));
+        }
     }
 
     /*! @brief Requests the removal of unused capacity. */
@@ -215,6 +342,17 @@ public:
         instances.shrink_to_fit();
     }
 
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+        stats.instances = instances.capacity();
+        stats.instance_bytes = instances.capacity() * sizeof(value_type);
+        return stats;
+    }
+
     /**
      * @brief Direct access to the array of objects.
      *
@@ -331,6 +469,36 @@ public:
         return rbegin() + instances.size();
     }
 
+    /**
+     * @brief Splits the storage in chunks of contiguous entities and objects.
+     *
+     * The iterable object returns tuples that contain a pointer to the first
+     * entity of a chunk, a pointer to the object associated with it and the
+     * number of elements in the chunk. Entities and objects within a chunk
+     * have the same order. All chunks have the requested length, but for the
+     * last one that can be shorter. The chunked object also offers random
+     * access to the chunks by means of `operator[]`.
+     *
+     * Chunks are laid out in the order of the internal arrays, starting from
+     * `data()` and `raw()`. Chunks never overlap and can be safely processed in
+     * parallel by different threads.
+     *
+     * @note
+     * Entities and objects are in the reverse order as returned by the
+     * `begin`/`end` iterators.
+     *
+     * @param len Length of the chunks, in number of elements.
+     * @return An iterable object to use to visit the chunks.
+     */
+    [[nodiscard]] const_chunked_type chunks(const size_type len = underlying_type::chunk_size) const ENTT_NOEXCEPT {
+        return const_chunked_type{len, instances.size(), underlying_type::data(), instances.data()};
+    }
+
+    /*! @copydoc chunks */
+    [[nodiscard]] chunked_type chunks(const size_type len = underlying_type::chunk_size) ENTT_NOEXCEPT {
+        return chunked_type{len, instances.size(), underlying_type::data(), instances.data()};
+    }
+
     /**
      * @brief Returns the object associated with an entity.
      *
@@ -368,12 +536,18 @@ public:
      */
     template<typename... Args>
     value_type & emplace(const entity_type entt, Args &&... args) {
+        const auto cap = instances.capacity();
+
         if constexpr(std::is_aggregate_v<value_type>) {
             instances.push_back(Type{std::forward<Args>(args)...});
         } else {
             instances.emplace_back(std::forward<Args>(args)...);
         }
 
+        if(instances.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::storage::emplace", type_id<value_type>().name(), instances.capacity() * sizeof(value_type));
+        }
+
         // entity goes after component in case constructor throws
         underlying_type::emplace(entt);
         return instances.back();
@@ -394,7 +568,13 @@ public:
      */
     template<typename It>
     void insert(It first, It last, const value_type &value = {}) {
+        const auto cap = instances.capacity();
         instances.insert(instances.end(), std::distance(first, last), value);
+
+        if(instances.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::storage::insert", type_id<value_type>().name(), instances.capacity() * sizeof(value_type));
+        }
+
         // entities go after components in case constructors throw
         underlying_type::insert(first, last);
     }
@@ -414,7 +594,13 @@ public:
      */
     template<typename EIt, typename CIt>
     void insert(EIt first, EIt last, CIt from, CIt to) {
+        const auto cap = instances.capacity();
         instances.insert(instances.end(), from, to);
+
+        if(instances.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::storage::insert", type_id<value_type>().name(), instances.capacity() * sizeof(value_type));
+        }
+
         // entities go after components in case constructors throw
         underlying_type::insert(first, last);
     }
@@ -441,6 +627,11 @@ public:
      * * An iterator past the last element of the range to sort.
      * * A comparison function to use to compare the elements.
      *
+     * Sort function objects that work on keys rather than comparisons, such as
+     * `radix_sort`, accept also a _getter_ in place of the comparison function.
+     * Its signature should be equivalent to `Key(const Type &)` and elements
+     * are then sorted by the key returned for their objects.
+     *
      * @warning
      * Empty types are never instantiated. Therefore, only comparison function
      * objects that require to return entities rather than components are
@@ -460,6 +651,10 @@ public:
             underlying_type::sort_n(count, [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
                 return compare(std::as_const(instances[underlying_type::index(lhs)]), std::as_const(instances[underlying_type::index(rhs)]));
             }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const value_type &>) {
+            underlying_type::sort_n(count, [this, getter = std::move(compare)](const auto entt) {
+                return getter(std::as_const(instances[underlying_type::index(entt)]));
+            }, std::move(algo), std::forward<Args>(args)...);
         } else {
             underlying_type::sort_n(count, std::move(compare), std::move(algo), std::forward<Args>(args)...);
         }
@@ -483,15 +678,17 @@ public:
     }
 
 private:
-    std::vector<value_type> instances;
+    std::vector<value_type, allocator_type> instances;
 };
 
 
 /*! @copydoc basic_storage */
-template<typename Entity, typename Type>
-class basic_storage<Entity, Type, std::enable_if_t<is_empty_v<Type>>>: public basic_sparse_set<Entity> {
+template<typename Entity, typename Type, typename Allocator>
+class basic_storage<Entity, Type, Allocator, std::enable_if_t<is_empty_v<Type>>>: public basic_sparse_set<Entity> {
     using underlying_type = basic_sparse_set<Entity>;
 
+    void compact_all(const std::size_t) ENTT_NOEXCEPT final {}
+
 public:
     /*! @brief Type of the objects associated with the entities. */
     using value_type = Type;
@@ -501,6 +698,25 @@ public:
     using size_type = std::size_t;
     /*! @brief Storage category. */
     using storage_category = empty_storage_tag;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}}
+    {}
+
+    /**
+     * @brief Constructs an empty storage with the given allocator.
+     *
+     * Empty types are never instantiated, therefore the allocator is used by
+     * the underlying sparse set only.
+     *
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : underlying_type{std::allocator_arg, allocator}
+    {}
 
     /**
      * @brief Assigns an entity to a storage and constructs its object.
@@ -538,158 +754,2558 @@ public:
 
 
 /**
- * @brief Mixin type to use to wrap basic storage classes.
- * @tparam Type The type of the underlying storage.
+ * @brief Pointer stable storage implementation.
+ *
+ * Objects are constructed in pages that are never reallocated and don't move
+ * once created. When an entity is removed, its object is destroyed and the
+ * slot goes back to a free list, so that it can be reused later. Therefore,
+ * pointers and references to the objects stay valid until the objects
+ * themselves are removed from the storage.<br/>
+ * A packed array of pointers is used to keep entities and objects in the same
+ * order. This way, iterations don't know about the free slots and visit only
+ * the objects in use, at the price of an extra level of indirection.
+ *
+ * @note
+ * Entities and objects have the same order when using random or input access
+ * iterators. However, objects aren't tightly packed and raw access to them
+ * isn't available.
+ *
+ * @note
+ * Internal data structures arrange elements to maximize performance. There are
+ * no guarantees that objects are returned in the insertion order when iterate
+ * a storage. Do not make assumption on the order in any case.
+ *
+ * @sa basic_storage
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
  */
-template<typename Type>
-struct storage_adapter_mixin: Type {
-    static_assert(std::is_same_v<typename Type::value_type, std::decay_t<typename Type::value_type>>, "Invalid object type");
+template<typename Entity, typename Type, typename Allocator = std::pmr::polymorphic_allocator<Type>>
+class basic_stable_storage: public basic_sparse_set<Entity> {
+    static_assert(!is_empty_v<Type>, "Empty types are never instantiated and don't require a stable storage");
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, Type>, "Invalid value type");
+
+    static constexpr auto objects_per_page = (std::max)(std::size_t{1u}, (basic_sparse_set<Entity>::chunk_size * sizeof(Entity)) / sizeof(Type));
+
+    using underlying_type = basic_sparse_set<Entity>;
+    using traits_type = entt_traits<Entity>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using page_alloc_type = typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>;
+    using slot_alloc_type = typename alloc_traits::template rebind_alloc<Type *>;
+
+    template<typename Value>
+    class stable_storage_iterator final {
+        friend class basic_stable_storage<Entity, Type, Allocator>;
+
+        using instance_type = std::vector<Type *, slot_alloc_type>;
+        using index_type = typename traits_type::difference_type;
+
+        stable_storage_iterator(const instance_type &ref, const index_type idx) ENTT_NOEXCEPT
+            : instances{&ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Value;
+        using pointer = value_type *;
+        using reference = value_type &;
+        using iterator_category = std::random_access_iterator_tag;
+
+        stable_storage_iterator() ENTT_NOEXCEPT = default;
+
+        stable_storage_iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        stable_storage_iterator operator++(int) ENTT_NOEXCEPT {
+            stable_storage_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        stable_storage_iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        stable_storage_iterator operator--(int) ENTT_NOEXCEPT {
+            stable_storage_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        stable_storage_iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        stable_storage_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            stable_storage_iterator copy = *this;
+            return (copy += value);
+        }
+
+        stable_storage_iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        stable_storage_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return *(*instances)[pos];
+        }
+
+        [[nodiscard]] bool operator==(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        [[nodiscard]] bool operator!=(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] bool operator<(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        [[nodiscard]] bool operator>(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        [[nodiscard]] bool operator<=(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        [[nodiscard]] bool operator>=(const stable_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1u);
+            return (*instances)[pos];
+        }
+
+        [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        const instance_type *instances;
+        index_type index;
+    };
+
+    [[nodiscard]] Type * acquire() {
+        if(available.empty()) {
+            auto page = alloc_traits::allocate(allocator, objects_per_page);
+            ENTT_ALLOC_TRACE("entt::storage::page", type_id<Type>().name(), objects_per_page * sizeof(Type));
+
+            try {
+                pages.push_back(page);
+                available.reserve(available.size() + objects_per_page);
+            } catch(...) {
+                if(!pages.empty() && pages.back() == page) {
+                    pages.pop_back();
+                }
+
+                alloc_traits::deallocate(allocator, page, objects_per_page);
+                throw;
+            }
+
+            // slots are handed out in ascending order
+            for(auto pos = objects_per_page; pos; --pos) {
+                available.push_back(std::addressof(page[pos - 1u]));
+            }
+        }
 
+        instances.reserve(instances.size() + 1u);
+        return available.back();
+    }
+
+    template<typename It, typename Func>
+    void construct_n(It first, It last, Func func) {
+        const auto offset = instances.size();
+        reserve(offset + std::distance(first, last));
+
+        try {
+            for(auto it = first; it != last; ++it) {
+                func(available.back());
+                instances.push_back(available.back());
+                available.pop_back();
+            }
+
+            // entities go after objects in case constructors throw
+            underlying_type::insert(first, last);
+        } catch(...) {
+            while(instances.size() != offset) {
+                alloc_traits::destroy(allocator, instances.back());
+                available.push_back(instances.back());
+                instances.pop_back();
+            }
+
+            throw;
+        }
+    }
+
+    void release_pages() {
+        for(auto &&page: pages) {
+            alloc_traits::deallocate(allocator, page, objects_per_page);
+        }
+
+        pages.clear();
+        available.clear();
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        std::swap(instances[lhs], instances[rhs]);
+    }
+
+    void swap_and_pop(const std::size_t pos) final {
+        alloc_traits::destroy(allocator, instances[pos]);
+        // reserved when the object was created, this never throws
+        available.push_back(instances[pos]);
+        instances[pos] = instances.back();
+        instances.pop_back();
+    }
+
+    void clear_all() ENTT_NOEXCEPT final {
+        for(auto *instance: instances) {
+            alloc_traits::destroy(allocator, instance);
+        }
+
+        instances.clear();
+        release_pages();
+    }
+
+public:
     /*! @brief Type of the objects associated with the entities. */
-    using value_type = typename Type::value_type;
+    using value_type = Type;
     /*! @brief Underlying entity identifier. */
-    using entity_type = typename Type::entity_type;
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator = stable_storage_iterator<Type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = stable_storage_iterator<const Type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     /*! @brief Storage category. */
-    using storage_category = typename Type::storage_category;
+    using storage_category = dense_storage_tag;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+    /*! @brief Default constructor. */
+    basic_stable_storage()
+        : basic_stable_storage{allocator_type{}}
+    {}
 
     /**
-     * @brief Assigns entities to a storage.
-     * @tparam Args Types of arguments to use to construct the object.
-     * @param entity A valid entity identifier.
-     * @param args Parameters to use to initialize the object.
-     * @return A reference to the newly created object.
+     * @brief Constructs an empty storage with the given allocator.
+     * @param alloc The allocator to use.
      */
-    template<typename... Args>
-    decltype(auto) emplace(basic_registry<entity_type> &, const entity_type entity, Args &&... args) {
-        return Type::emplace(entity, std::forward<Args>(args)...);
-    }
+    explicit basic_stable_storage(const allocator_type &alloc)
+        : underlying_type{std::allocator_arg, alloc},
+          allocator{alloc},
+          pages(page_alloc_type{alloc}),
+          available(slot_alloc_type{alloc}),
+          instances(slot_alloc_type{alloc})
+    {}
 
     /**
-     * @brief Assigns entities to a storage.
-     * @tparam It Type of input iterator.
-     * @tparam Args Types of arguments to use to construct the objects
-     * associated with the entities.
-     * @param first An iterator to the first element of the range of entities.
-     * @param last An iterator past the last element of the range of entities.
-     * @param args Parameters to use to initialize the objects associated with
-     * the entities.
+     * @brief Move constructor.
+     * @param other The instance to move from.
      */
-    template<typename It, typename... Args>
-    void insert(basic_registry<entity_type> &, It first, It last, Args &&... args) {
-        Type::insert(first, last, std::forward<Args>(args)...);
+    basic_stable_storage(basic_stable_storage &&other)
+        : underlying_type{std::move(other)},
+          allocator{std::move(other.allocator)},
+          pages{std::move(other.pages)},
+          available{std::move(other.available)},
+          instances{std::move(other.instances)}
+    {
+        // objects and pages belong to this storage from now on
+        other.pages.clear();
+        other.available.clear();
+        other.instances.clear();
     }
 
-    /**
+    /*! @brief Destroys all the objects and frees the pages. */
+    ~basic_stable_storage() override {
+        clear_all();
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_stable_storage & operator=(basic_stable_storage &&other) {
+        ENTT_ASSERT(alloc_traits::propagate_on_container_move_assignment::value || allocator == other.allocator);
+
+        clear_all();
+        underlying_type::operator=(std::move(other));
+
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
+
+        pages = std::move(other.pages);
+        available = std::move(other.available);
+        instances = std::move(other.instances);
+
+        // objects and pages belong to this storage from now on
+        other.pages.clear();
+        other.available.clear();
+        other.instances.clear();
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the objects.
+     * @return The allocator associated with the objects.
+     */
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator;
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new pages are
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        instances.reserve(cap);
+
+        while(instances.size() + available.size() < cap) {
+            auto page = alloc_traits::allocate(allocator, objects_per_page);
+            ENTT_ALLOC_TRACE("entt::storage::page", type_id<Type>().name(), objects_per_page * sizeof(Type));
+            pages.push_back(page);
+            available.reserve(available.size() + objects_per_page);
+
+            for(auto pos = objects_per_page; pos; --pos) {
+                available.push_back(std::addressof(page[pos - 1u]));
+            }
+        }
+    }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     *
+     * Pages are released only when the storage is empty, since objects can't
+     * be moved around.
+     */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+
+        if(instances.empty()) {
+            release_pages();
+        }
+
+        pages.shrink_to_fit();
+        available.shrink_to_fit();
+        instances.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     *
+     * The pointers to the objects are accounted as part of the memory used by
+     * the objects themselves.
+     *
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+        stats.instances = pages.size() * objects_per_page;
+        stats.instance_bytes = stats.instances * sizeof(Type) + pages.capacity() * sizeof(typename alloc_traits::pointer) + (available.capacity() + instances.capacity()) * sizeof(Type *);
+        return stats;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the storage. If
+     * the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the storage.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator{instances, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return iterator{instances, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the storage. Attempting to dereference the returned iterator results
+     * in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * storage.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return const_iterator{instances, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return iterator{instances, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * The returned iterator points to the last instance of the storage. If the
+     * storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed storage.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cend()};
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
+        return reverse_iterator{end()};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * The returned iterator points to the element following the first instance
+     * of the storage. Attempting to dereference the returned iterator results
+     * in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * reversed storage.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cbegin()};
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const ENTT_NOEXCEPT {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
+        return reverse_iterator{begin()};
+    }
+
+    /**
+     * @brief Returns the object associated with an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @return The object associated with the entity.
+     */
+    [[nodiscard]] const value_type & get(const entity_type entt) const {
+        return *instances[underlying_type::index(entt)];
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] value_type & get(const entity_type entt) {
+        return const_cast<value_type &>(std::as_const(*this).get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * Free slots are reused, if any. New pages are allocated otherwise.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    value_type & emplace(const entity_type entt, Args &&... args) {
+        auto *instance = acquire();
+
+        if constexpr(std::is_aggregate_v<value_type>) {
+            alloc_traits::construct(allocator, instance, Type{std::forward<Args>(args)...});
+        } else {
+            alloc_traits::construct(allocator, instance, std::forward<Args>(args)...);
+        }
+
+        available.pop_back();
+        instances.push_back(instance);
+
+        try {
+            underlying_type::emplace(entt);
+        } catch(...) {
+            instances.pop_back();
+            alloc_traits::destroy(allocator, instance);
+            available.push_back(instance);
+            throw;
+        }
+
+        return *instance;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename It>
+    void insert(It first, It last, const value_type &value = {}) {
+        construct_n(first, last, [this, &value](auto *instance) {
+            alloc_traits::construct(allocator, instance, value);
+        });
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @param to An iterator past the last element of the range of objects.
+     */
+    template<typename EIt, typename CIt>
+    void insert(EIt first, EIt last, CIt from, [[maybe_unused]] CIt to) {
+        construct_n(first, last, [this, &from](auto *instance) {
+            alloc_traits::construct(allocator, instance, *(from++));
+        });
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * Objects aren't moved around, only the order used to visit them changes.
+     *
+     * @sa basic_storage::sort_n
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param count Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort_n(const size_type count, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        if constexpr(std::is_invocable_v<Compare, const value_type &, const value_type &>) {
+            underlying_type::sort_n(count, [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(*instances[underlying_type::index(lhs)]), std::as_const(*instances[underlying_type::index(rhs)]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const value_type &>) {
+            underlying_type::sort_n(count, [this, getter = std::move(compare)](const auto entt) {
+                return getter(std::as_const(*instances[underlying_type::index(entt)]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::sort_n(count, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function.
+     *
+     * @sa sort_n
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        sort_n(this->size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+private:
+    allocator_type allocator;
+    std::vector<typename alloc_traits::pointer, page_alloc_type> pages;
+    std::vector<Type *, slot_alloc_type> available;
+    std::vector<Type *, slot_alloc_type> instances;
+};
+
+
+/**
+ * @brief Paged storage implementation.
+ *
+ * Objects are tightly packed, much like basic storage classes do. However,
+ * they are split in pages of fixed size that are never reallocated. When the
+ * storage grows, a new page is allocated and the objects already in use don't
+ * move. This way, there are no spikes due to large reallocations and the peak
+ * memory usage doesn't double when a storage exceeds its capacity.<br/>
+ * Removing an entity moves the last object in the hole left, as it happens
+ * with basic storage classes.
+ *
+ * @note
+ * Entities and objects have the same order when using random or input access
+ * iterators. However, objects are contiguous only within a page and raw access
+ * to them isn't available.
+ *
+ * @note
+ * Internal data structures arrange elements to maximize performance. There are
+ * no guarantees that objects are returned in the insertion order when iterate
+ * a storage. Do not make assumption on the order in any case.
+ *
+ * @sa basic_storage
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Type, typename Allocator = std::pmr::polymorphic_allocator<Type>>
+class basic_paged_storage: public basic_sparse_set<Entity> {
+    static_assert(!is_empty_v<Type>, "Empty types are never instantiated and don't require a paged storage");
+    static_assert(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>, "The managed type must be at least move constructible and assignable");
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, Type>, "Invalid value type");
+
+    [[nodiscard]] static constexpr std::size_t page_length() ENTT_NOEXCEPT {
+        // powers of two turn divisions and modulo operations into shifts and masks
+        const auto max = (basic_sparse_set<Entity>::chunk_size * sizeof(Entity)) / sizeof(Type);
+        std::size_t len{1u};
+
+        while((len << 1u) <= max) {
+            len <<= 1u;
+        }
+
+        return len;
+    }
+
+    static constexpr auto objects_per_page = page_length();
+
+    using underlying_type = basic_sparse_set<Entity>;
+    using traits_type = entt_traits<Entity>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using page_alloc_type = typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>;
+    using page_container_type = std::vector<typename alloc_traits::pointer, page_alloc_type>;
+
+    template<typename Value>
+    class paged_storage_iterator final {
+        friend class basic_paged_storage<Entity, Type, Allocator>;
+
+        using index_type = typename traits_type::difference_type;
+
+        paged_storage_iterator(const page_container_type &ref, const index_type idx) ENTT_NOEXCEPT
+            : pages{&ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Value;
+        using pointer = value_type *;
+        using reference = value_type &;
+        using iterator_category = std::random_access_iterator_tag;
+
+        paged_storage_iterator() ENTT_NOEXCEPT = default;
+
+        paged_storage_iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        paged_storage_iterator operator++(int) ENTT_NOEXCEPT {
+            paged_storage_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        paged_storage_iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        paged_storage_iterator operator--(int) ENTT_NOEXCEPT {
+            paged_storage_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        paged_storage_iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        paged_storage_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            paged_storage_iterator copy = *this;
+            return (copy += value);
+        }
+
+        paged_storage_iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        paged_storage_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return (*pages)[pos / objects_per_page][pos & (objects_per_page - 1u)];
+        }
+
+        [[nodiscard]] bool operator==(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        [[nodiscard]] bool operator!=(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] bool operator<(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        [[nodiscard]] bool operator>(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        [[nodiscard]] bool operator<=(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        [[nodiscard]] bool operator>=(const paged_storage_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        [[nodiscard]] pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1u);
+            return std::addressof((*pages)[pos / objects_per_page][pos & (objects_per_page - 1u)]);
+        }
+
+        [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        const page_container_type *pages;
+        index_type index;
+    };
+
+    [[nodiscard]] Type * slot(const std::size_t pos) const ENTT_NOEXCEPT {
+        return std::addressof(pages[pos / objects_per_page][pos & (objects_per_page - 1u)]);
+    }
+
+    void assure(const std::size_t cap) {
+        while(pages.size() * objects_per_page < cap) {
+            auto page = alloc_traits::allocate(allocator, objects_per_page);
+            ENTT_ALLOC_TRACE("entt::storage::page", type_id<Type>().name(), objects_per_page * sizeof(Type));
+
+            try {
+                pages.push_back(page);
+            } catch(...) {
+                alloc_traits::deallocate(allocator, page, objects_per_page);
+                throw;
+            }
+        }
+    }
+
+    template<typename It, typename Func>
+    void construct_n(It first, It last, Func func) {
+        const auto offset = count;
+        reserve(offset + std::distance(first, last));
+
+        try {
+            for(auto it = first; it != last; ++it, ++count) {
+                func(slot(count));
+            }
+
+            // entities go after objects in case constructors throw
+            underlying_type::insert(first, last);
+        } catch(...) {
+            while(count != offset) {
+                alloc_traits::destroy(allocator, slot(--count));
+            }
+
+            throw;
+        }
+    }
+
+    void release_pages(const std::size_t from) {
+        while(pages.size() > from) {
+            alloc_traits::deallocate(allocator, pages.back(), objects_per_page);
+            pages.pop_back();
+        }
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        if constexpr(is_trivially_relocatable_v<Type>) {
+            if(lhs != rhs) {
+                internal::relocate_swap(*slot(lhs), *slot(rhs));
+            }
+        } else {
+            using std::swap;
+            swap(*slot(lhs), *slot(rhs));
+        }
+    }
+
+    void swap_and_pop(const std::size_t pos) final {
+        auto *back = slot(--count);
+        auto *elem = slot(pos);
+
+        if constexpr(is_trivially_relocatable_v<Type>) {
+            // the last object is relocated rather than moved and destroyed
+            alloc_traits::destroy(allocator, elem);
+
+            if(elem != back) {
+                std::memcpy(static_cast<void *>(elem), static_cast<const void *>(back), sizeof(Type));
+            }
+        } else {
+            if(elem != back) {
+                *elem = std::move(*back);
+            }
+
+            alloc_traits::destroy(allocator, back);
+        }
+    }
+
+    void clear_all() ENTT_NOEXCEPT final {
+        while(count) {
+            alloc_traits::destroy(allocator, slot(--count));
+        }
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator = paged_storage_iterator<Type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = paged_storage_iterator<const Type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Storage category. */
+    using storage_category = dense_storage_tag;
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+
+    /*! @brief Default constructor. */
+    basic_paged_storage()
+        : basic_paged_storage{allocator_type{}}
+    {}
+
+    /**
+     * @brief Constructs an empty storage with the given allocator.
+     * @param alloc The allocator to use.
+     */
+    explicit basic_paged_storage(const allocator_type &alloc)
+        : underlying_type{std::allocator_arg, alloc},
+          allocator{alloc},
+          pages(page_alloc_type{alloc}),
+          count{}
+    {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_paged_storage(basic_paged_storage &&other)
+        : underlying_type{std::move(other)},
+          allocator{std::move(other.allocator)},
+          pages{std::move(other.pages)},
+          count{std::exchange(other.count, size_type{})}
+    {
+        // objects and pages belong to this storage from now on
+        other.pages.clear();
+    }
+
+    /*! @brief Destroys all the objects and frees the pages. */
+    ~basic_paged_storage() override {
+        clear_all();
+        release_pages(0u);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_paged_storage & operator=(basic_paged_storage &&other) {
+        ENTT_ASSERT(alloc_traits::propagate_on_container_move_assignment::value || allocator == other.allocator);
+
+        clear_all();
+        release_pages(0u);
+        underlying_type::operator=(std::move(other));
+
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
+
+        pages = std::move(other.pages);
+        count = std::exchange(other.count, size_type{});
+
+        // objects and pages belong to this storage from now on
+        other.pages.clear();
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the objects.
+     * @return The allocator associated with the objects.
+     */
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator;
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new pages are
+     * allocated, otherwise the method does nothing. Objects already in use are
+     * never moved.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        assure(cap);
+    }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     *
+     * Pages that don't contain objects are released.
+     */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        release_pages((count + objects_per_page - 1u) / objects_per_page);
+        pages.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     *
+     * The pointers to the pages are accounted as part of the memory used by
+     * the objects.
+     *
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+        stats.instances = pages.size() * objects_per_page;
+        stats.instance_bytes = stats.instances * sizeof(Type) + pages.capacity() * sizeof(typename alloc_traits::pointer);
+        return stats;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the storage. If
+     * the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the storage.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator{pages, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return iterator{pages, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the storage. Attempting to dereference the returned iterator results
+     * in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * storage.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return const_iterator{pages, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return iterator{pages, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * The returned iterator points to the last instance of the storage. If the
+     * storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed storage.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cend()};
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
+        return reverse_iterator{end()};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * The returned iterator points to the element following the first instance
+     * of the storage. Attempting to dereference the returned iterator results
+     * in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * reversed storage.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cbegin()};
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const ENTT_NOEXCEPT {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
+        return reverse_iterator{begin()};
+    }
+
+    /**
+     * @brief Returns the object associated with an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @return The object associated with the entity.
+     */
+    [[nodiscard]] const value_type & get(const entity_type entt) const {
+        return *slot(underlying_type::index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] value_type & get(const entity_type entt) {
+        return const_cast<value_type &>(std::as_const(*this).get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * A new page is allocated if the last one is full. Objects already in use
+     * are never moved.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    value_type & emplace(const entity_type entt, Args &&... args) {
+        assure(count + 1u);
+        auto *instance = slot(count);
+
+        if constexpr(std::is_aggregate_v<value_type>) {
+            alloc_traits::construct(allocator, instance, Type{std::forward<Args>(args)...});
+        } else {
+            alloc_traits::construct(allocator, instance, std::forward<Args>(args)...);
+        }
+
+        try {
+            // entity goes after object in case constructor throws
+            underlying_type::emplace(entt);
+        } catch(...) {
+            alloc_traits::destroy(allocator, instance);
+            throw;
+        }
+
+        ++count;
+        return *instance;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename It>
+    void insert(It first, It last, const value_type &value = {}) {
+        construct_n(first, last, [this, &value](auto *instance) {
+            alloc_traits::construct(allocator, instance, value);
+        });
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @param to An iterator past the last element of the range of objects.
+     */
+    template<typename EIt, typename CIt>
+    void insert(EIt first, EIt last, CIt from, [[maybe_unused]] CIt to) {
+        construct_n(first, last, [this, &from](auto *instance) {
+            alloc_traits::construct(allocator, instance, *(from++));
+        });
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * @sa basic_storage::sort_n
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param length Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort_n(const size_type length, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        if constexpr(std::is_invocable_v<Compare, const value_type &, const value_type &>) {
+            underlying_type::sort_n(length, [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(*slot(underlying_type::index(lhs))), std::as_const(*slot(underlying_type::index(rhs))));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const value_type &>) {
+            underlying_type::sort_n(length, [this, getter = std::move(compare)](const auto entt) {
+                return getter(std::as_const(*slot(underlying_type::index(entt))));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::sort_n(length, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function.
+     *
+     * @sa sort_n
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        sort_n(this->size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+private:
+    allocator_type allocator;
+    page_container_type pages;
+    size_type count;
+};
+
+
+/**
+ * @brief Split storage implementation.
+ *
+ * This class is a refinement of a sparse set that associates an object to an
+ * entity, much like basic storage classes do. However, the data members of
+ * the objects are stored separately, each of them in its own packed array.<br/>
+ * This way, systems that only access a few data members of large objects don't
+ * have to load the others and they are limited to streaming the arrays of
+ * interest instead.
+ *
+ * Since objects aren't stored as a whole, they are returned by means of proxy
+ * references. A proxy reference gives access to the single data members, can
+ * be converted to a copy of the original object and can be assigned an object
+ * to update all the data members at once.
+ *
+ * @note
+ * Entities and data members have the same order. It's guaranteed both in case
+ * of raw access (either to entities or data members) and when using random or
+ * input access iterators.
+ *
+ * @warning
+ * Data members that aren't listed are neither stored nor returned when objects
+ * are converted back to their original type. Users are responsible for listing
+ * all the data members of interest.
+ *
+ * @sa sparse_set<Entity>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Member Pointers to the data members of the type to store.
+ */
+template<typename Entity, typename Type, auto... Member>
+class basic_split_storage: public basic_sparse_set<Entity> {
+    static_assert(sizeof...(Member) != 0u, "Split storage classes require at least a data member");
+    static_assert((std::is_member_object_pointer_v<decltype(Member)> && ...), "Invalid data member");
+    static_assert(std::is_default_constructible_v<Type>, "The managed type must be default constructible");
+
+    using underlying_type = basic_sparse_set<Entity>;
+    using traits_type = entt_traits<Entity>;
+    using columns_type = std::tuple<std::vector<std::remove_reference_t<decltype(std::declval<Type &>().*Member)>>...>;
+
+    template<auto Field>
+    [[nodiscard]] static constexpr std::size_t column_index() ENTT_NOEXCEPT {
+        constexpr bool match[]{ std::is_same_v<std::integral_constant<decltype(Field), Field>, std::integral_constant<decltype(Member), Member>>... };
+        std::size_t pos{};
+
+        while(pos < sizeof...(Member) && !match[pos]) {
+            ++pos;
+        }
+
+        return pos;
+    }
+
+    template<typename Value>
+    class split_reference final {
+        friend class basic_split_storage<Entity, Type, Member...>;
+
+        template<typename>
+        friend class split_reference;
+
+        using instance_type = constness_as_t<columns_type, Value>;
+
+        split_reference(instance_type &ref, const std::size_t idx) ENTT_NOEXCEPT
+            : columns{&ref}, pos{idx}
+        {}
+
+    public:
+        template<typename Other, typename = std::enable_if_t<std::is_same_v<Value, const Other>>>
+        split_reference(const split_reference<Other> &other) ENTT_NOEXCEPT
+            : columns{other.columns}, pos{other.pos}
+        {}
+
+        template<auto Field>
+        [[nodiscard]] decltype(auto) get() const ENTT_NOEXCEPT {
+            constexpr auto index = column_index<Field>();
+            static_assert(index != sizeof...(Member), "Invalid data member");
+            return std::get<index>(*columns)[pos];
+        }
+
+        [[nodiscard]] operator Type() const {
+            Type value{};
+            std::apply([&value, this](auto &... column) { ((value.*Member = column[pos]), ...); }, *columns);
+            return value;
+        }
+
+        const split_reference & operator=(const Type &value) const {
+            static_assert(!std::is_const_v<Value>, "Cannot assign through a constant reference");
+            std::apply([&value, this](auto &... column) { ((column[pos] = value.*Member), ...); }, *columns);
+            return *this;
+        }
+
+    private:
+        instance_type *columns;
+        std::size_t pos;
+    };
+
+    template<typename Value>
+    class split_iterator final {
+        friend class basic_split_storage<Entity, Type, Member...>;
+
+        using instance_type = constness_as_t<columns_type, Value>;
+        using index_type = typename traits_type::difference_type;
+
+        split_iterator(instance_type &ref, const index_type idx) ENTT_NOEXCEPT
+            : columns{&ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = split_reference<Value>;
+        using pointer = void;
+        using reference = value_type;
+        using iterator_category = std::random_access_iterator_tag;
+
+        split_iterator() ENTT_NOEXCEPT = default;
+
+        split_iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        split_iterator operator++(int) ENTT_NOEXCEPT {
+            split_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        split_iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        split_iterator operator--(int) ENTT_NOEXCEPT {
+            split_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        split_iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        split_iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            split_iterator copy = *this;
+            return (copy += value);
+        }
+
+        split_iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        split_iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const split_iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        [[nodiscard]] reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            return { *columns, size_type(index-value-1) };
+        }
+
+        [[nodiscard]] bool operator==(const split_iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        [[nodiscard]] bool operator!=(const split_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] bool operator<(const split_iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        [[nodiscard]] bool operator>(const split_iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        [[nodiscard]] bool operator<=(const split_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        [[nodiscard]] bool operator>=(const split_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+            return { *columns, size_type(index-1) };
+        }
+
+    private:
+        instance_type *columns;
+        index_type index;
+    };
+
+    void reserve_columns(const std::size_t cap) {
+        if(cap > std::get<0>(columns).capacity()) {
+            std::apply([cap](auto &... column) { (column.reserve(cap), ...); }, columns);
+            ENTT_ALLOC_TRACE("entt::split_storage::reserve", type_id<Type>().name(), std::apply([](const auto &... column) { return (std::size_t{} + ... + (column.capacity() * sizeof(typename std::decay_t<decltype(column)>::value_type))); }, columns));
+        }
+    }
+
+    template<typename Func>
+    void construct_n(const std::size_t count, Func func) {
+        const auto sz = underlying_type::size();
+
+        try {
+            reserve_columns(sz + count);
+
+            for(std::size_t next{}; next < count; ++next) {
+                func();
+            }
+        } catch(...) {
+            std::apply([sz](auto &... column) { (column.resize(sz), ...); }, columns);
+            throw;
+        }
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) final {
+        std::apply([lhs, rhs](auto &... column) { (std::swap(column[lhs], column[rhs]), ...); }, columns);
+    }
+
+    void swap_and_pop(const std::size_t pos) final {
+        std::apply([pos](auto &... column) {
+            ([pos](auto &curr) {
+                auto other = std::move(curr.back());
+                curr[pos] = std::move(other);
+                curr.pop_back();
+            }(column), ...);
+        }, columns);
+    }
+
+    void clear_all() ENTT_NOEXCEPT final {
+        std::apply([](auto &... column) { (column.clear(), ...); }, columns);
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Proxy reference type. */
+    using reference = split_reference<Type>;
+    /*! @brief Constant proxy reference type. */
+    using const_reference = split_reference<const Type>;
+    /*! @brief Random access iterator type. */
+    using iterator = split_iterator<Type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = split_iterator<const Type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Storage category. */
+    using storage_category = split_storage_tag;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        reserve_columns(cap);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        std::apply([](auto &... column) { (column.shrink_to_fit(), ...); }, columns);
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     *
+     * The number of objects is that of the shortest column, while the memory
+     * used by the objects is that of all the columns.
+     *
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = underlying_type::memory_usage();
+
+        std::apply([&stats](const auto &... column) {
+            stats.instances = (std::min)({ column.capacity()... });
+            stats.instance_bytes = ((column.capacity() * sizeof(typename std::decay_t<decltype(column)>::value_type)) + ...);
+        }, columns);
+
+        return stats;
+    }
+
+    /**
+     * @brief Direct access to the array of a data member.
+     *
+     * The returned pointer is such that range `[raw<Field>(), raw<Field>() +
+     * size())` is always a valid range, even if the container is empty.
+     *
+     * @note
+     * Data members are in the reverse order as returned by the `begin`/`end`
+     * iterators.
+     *
+     * @tparam Field Pointer to the data member to return.
+     * @return A pointer to the array of the given data member.
+     */
+    template<auto Field>
+    [[nodiscard]] const auto * raw() const ENTT_NOEXCEPT {
+        constexpr auto index = column_index<Field>();
+        static_assert(index != sizeof...(Member), "Invalid data member");
+        return std::get<index>(columns).data();
+    }
+
+    /*! @copydoc raw */
+    template<auto Field>
+    [[nodiscard]] auto * raw() ENTT_NOEXCEPT {
+        constexpr auto index = column_index<Field>();
+        static_assert(index != sizeof...(Member), "Invalid data member");
+        return std::get<index>(columns).data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the internal
+     * arrays. If the storage is empty, the returned iterator will be equal to
+     * `end()`.
+     *
+     * @return An iterator to the first instance of the internal arrays.
+     */
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator{columns, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return iterator{columns, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the internal arrays. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * internal arrays.
+     */
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return const_iterator{columns, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return iterator{columns, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * The returned iterator points to the first instance of the reversed
+     * internal arrays. If the storage is empty, the returned iterator will be
+     * equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal
+     * arrays.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cend()};
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const ENTT_NOEXCEPT {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() ENTT_NOEXCEPT {
+        return reverse_iterator{end()};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the reversed internal arrays. Attempting to dereference the returned
+     * iterator results in undefined behavior.
+     *
+     * @return An iterator to the element following the last instance of the
+     * reversed internal arrays.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const ENTT_NOEXCEPT {
+        return const_reverse_iterator{cbegin()};
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const ENTT_NOEXCEPT {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() ENTT_NOEXCEPT {
+        return reverse_iterator{begin()};
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid entity identifier.
+     * @return A proxy reference to the object assigned to the entity.
+     */
+    [[nodiscard]] const_reference get(const entity_type entt) const {
+        return { columns, underlying_type::index(entt) };
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] reference get(const entity_type entt) {
+        return { columns, underlying_type::index(entt) };
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * The object is constructed as a whole and its data members are then moved
+     * to their arrays.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A proxy reference to the newly created object.
+     */
+    template<typename... Args>
+    reference emplace(const entity_type entt, Args &&... args) {
+        construct_n(1u, [this, &args...]() {
+            if constexpr(std::is_aggregate_v<value_type>) {
+                Type value{std::forward<Args>(args)...};
+                std::apply([&value](auto &... column) { (column.push_back(std::move(value.*Member)), ...); }, columns);
+            } else {
+                Type value(std::forward<Args>(args)...);
+                std::apply([&value](auto &... column) { (column.push_back(std::move(value.*Member)), ...); }, columns);
+            }
+        });
+
+        // entity goes after data members in case constructors throw
+        underlying_type::emplace(entt);
+        return get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     */
+    template<typename It>
+    void insert(It first, It last, const value_type &value = {}) {
+        construct_n(std::distance(first, last), [&value, this]() {
+            std::apply([&value](auto &... column) { (column.push_back(value.*Member), ...); }, columns);
+        });
+
+        // entities go after data members in case constructors throw
+        underlying_type::insert(first, last);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @param to An iterator past the last element of the range of objects.
+     */
+    template<typename EIt, typename CIt>
+    void insert(EIt first, EIt last, CIt from, CIt to) {
+        construct_n(std::distance(from, to), [&from, this]() {
+            auto &&instance = *(from++);
+            std::apply([&instance](auto &... column) { (column.push_back(std::forward<decltype(instance)>(instance).*Member), ...); }, columns);
+        });
+
+        // entities go after data members in case constructors throw
+        underlying_type::insert(first, last);
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * The comparison function object must return `true` if the first element
+     * is _less_ than the second one, `false` otherwise. The signature of the
+     * comparison function should be equivalent to one of the following:
+     *
+     * @code{.cpp}
+     * bool(const Entity, const Entity);
+     * bool(const_reference, const_reference);
+     * @endcode
+     *
+     * Moreover, the comparison function object shall induce a
+     * _strict weak ordering_ on the values.<br/>
+     * Radix sort algorithms also accept a getter that returns the key of
+     * either an entity or a constant proxy reference.
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param count Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort_n(const size_type count, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        if constexpr(std::is_invocable_v<Compare, const_reference, const_reference>) {
+            underlying_type::sort_n(count, [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(*this).get(lhs), std::as_const(*this).get(rhs));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const_reference>) {
+            underlying_type::sort_n(count, [this, getter = std::move(compare)](const entity_type entt) {
+                return getter(std::as_const(*this).get(entt));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::sort_n(count, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function.
+     *
+     * @sa sort_n
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
+        sort_n(this->size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+private:
+    columns_type columns;
+};
+
+
+/**
+ * @brief Storage implementation for objects that live for a short time.
+ *
+ * This class is meant for components that are assigned in bulk and then
+ * removed from all the entities at once, for example once per frame. Objects
+ * are bump allocated at the end of an array that is never shrunk and they are
+ * never destroyed one by one, since they must be trivially destructible.<br/>
+ * Removing all the entities at once resets the storage without releasing its
+ * memory. The slots of the sparse array aren't touched at all. Instead, the
+ * epoch of the sparse set is bumped and slots tagged with an older epoch are
+ * treated as empty. Therefore, the cost of a reset is constant in amortized
+ * time, while pages and capacity are kept for the next round.
+ *
+ * @sa basic_storage
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_transient_storage: public basic_storage<Entity, Type> {
+    static_assert(std::is_trivially_destructible_v<Type>, "Transient storage classes require trivially destructible types");
+
+    using underlying_type = basic_storage<Entity, Type>;
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using value_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    using underlying_type::remove;
+
+    /**
+     * @brief Removes entities from a storage.
+     *
+     * A range that contains all the entities resets the storage without
+     * releasing its memory.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void remove(It first, It last) {
+        if(size_type(std::distance(first, last)) == this->size()) {
+            // no validity check, as it happens with sparse sets
+            this->reset();
+        } else {
+            underlying_type::remove(first, last);
+        }
+    }
+
+    /*! @brief Removes all the entities and keeps the memory. */
+    void clear() ENTT_NOEXCEPT {
+        this->reset();
+    }
+};
+
+
+/**
+ * @brief Mixin type to use to wrap basic storage classes.
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+struct storage_adapter_mixin: Type {
+    static_assert(std::is_same_v<typename Type::value_type, std::decay_t<typename Type::value_type>>, "Invalid object type");
+
+    using Type::Type;
+
+    /*! @brief Type of the objects associated with the entities. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(basic_registry<entity_type> &, const entity_type entity, Args &&... args) {
+        return Type::emplace(entity, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects
+     * associated with the entities.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects associated with
+     * the entities.
+     */
+    template<typename It, typename... Args>
+    void insert(basic_registry<entity_type> &, It first, It last, Args &&... args) {
+        Type::insert(first, last, std::forward<Args>(args)...);
+    }
+
+    /**
      * @brief Removes entities from a storage.
      * @param entity A valid entity identifier.
      */
-    void remove(basic_registry<entity_type> &, const entity_type entity) {
-        Type::remove(entity);
+    void remove(basic_registry<entity_type> &, const entity_type entity) {
+        Type::remove(entity);
+    }
+
+    /**
+     * @copybrief remove
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void remove(basic_registry<entity_type> &, It first, It last) {
+        Type::remove(first, last);
+    }
+
+    /**
+     * @brief Patches the given instance for an entity.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entity A valid entity identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(basic_registry<entity_type> &, const entity_type entity, [[maybe_unused]] Func &&... func) {
+        decltype(auto) instance = this->get(entity);
+        (std::forward<Func>(func)(instance), ...);
+        return instance;
+    }
+};
+
+
+/**
+ * @brief Mixin type to use to index storage types with a hash table.
+ *
+ * The sparse array of the underlying storage is turned into a hash table as
+ * soon as the storage is created. It's meant for components that are assigned
+ * to few entities with large identifiers, so that the memory used by the
+ * storage doesn't depend on the identifiers.
+ *
+ * @sa basic_sparse_set::hashed
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+struct hashed_storage_mixin: Type {
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
+    /*! @brief Default constructor. */
+    hashed_storage_mixin()
+        : Type{}
+    {
+        this->hashed(true);
+    }
+
+    /**
+     * @brief Constructs an empty storage with the given allocator.
+     * @tparam Allocator Type of allocator to use.
+     * @param allocator The allocator to use.
+     */
+    template<typename Allocator, typename = std::enable_if_t<std::is_constructible_v<Type, const Allocator &>>>
+    explicit hashed_storage_mixin(const Allocator &allocator)
+        : Type{allocator}
+    {
+        this->hashed(true);
+    }
+};
+
+
+/**
+ * @brief Mixin type to use to add signal support to storage types.
+ *
+ * Bulk operations test once whether there are listeners for a signal and skip
+ * it entirely otherwise. Types of components that never require signals can
+ * opt out statically by turning to a plain `storage_adapter_mixin`, at the
+ * price of not being usable with groups, observers and any other construct
+ * that relies on the signals of a storage.
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+struct sigh_storage_mixin: Type {
+    using Type::Type;
+
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever a new instance is created and assigned to an entity.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, entity_type);
+     * @endcode
+     *
+     * Listeners are invoked **after** the object has been assigned to the
+     * entity.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_construct() ENTT_NOEXCEPT {
+        return sink{construction};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever new instances are created and assigned to a range of
+     * entities.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, const entity_type *, const entity_type *);
+     * @endcode
+     *
+     * Listeners are invoked once per operation with the range of entities to
+     * which the objects have been assigned, including operations that involve
+     * a single entity. They are invoked **after** the objects have been
+     * assigned to the entities and **before** the per-entity listeners.
+     *
+     * @warning
+     * The range is valid only for the duration of the call.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_construct_range() ENTT_NOEXCEPT {
+        return sink{range_construction};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever an instance is explicitly updated.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, entity_type);
+     * @endcode
+     *
+     * Listeners are invoked **after** the object has been updated.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_update() ENTT_NOEXCEPT {
+        return sink{update};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever an instance is removed from an entity and thus destroyed.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, entity_type);
+     * @endcode
+     *
+     * Listeners are invoked **before** the object has been removed from the
+     * entity.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_destroy() ENTT_NOEXCEPT {
+        return sink{destruction};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are removed from a range of entities and thus
+     * destroyed.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<entity_type> &, const entity_type *, const entity_type *);
+     * @endcode
+     *
+     * Listeners are invoked once per operation with the range of entities from
+     * which the objects are about to be removed, including operations that
+     * involve a single entity. They are invoked **before** the objects have
+     * been removed from the entities and **before** the per-entity listeners.
+     *
+     * @warning
+     * The range is valid only for the duration of the call.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_destroy_range() ENTT_NOEXCEPT {
+        return sink{range_destruction};
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::emplace
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
+        Type::emplace(owner, entity, std::forward<Args>(args)...);
+
+        if(!range_construction.empty()) {
+            range_construction.publish(owner, &entity, &entity + 1u);
+        }
+
+        construction.publish(owner, entity);
+
+        if constexpr(!std::is_same_v<storage_category, empty_storage_tag>) {
+            return this->get(entity);
+        }
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::insert
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects
+     * associated with the entities.
+     * @param owner The registry that issued the request.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects associated with
+     * the entities.
+     */
+    template<typename It, typename... Args>
+    void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
+        const auto offset = this->size();
+        Type::insert(owner, first, last, std::forward<Args>(args)...);
+
+        if(!range_construction.empty()) {
+            // listeners can rearrange the packed array, entities are copied first
+            const std::vector<entity_type> range(this->data() + offset, this->data() + this->size());
+            range_construction.publish(owner, range.data(), range.data() + range.size());
+        }
+
+        if(!construction.empty()) {
+            for(; first != last; ++first) {
+                construction.publish(owner, *first);
+            }
+        }
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::remove
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     */
+    void remove(basic_registry<entity_type> &owner, const entity_type entity) {
+        if(!range_destruction.empty()) {
+            range_destruction.publish(owner, &entity, &entity + 1u);
+        }
+
+        destruction.publish(owner, entity);
+        Type::remove(owner, entity);
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::remove
+     * @tparam It Type of input iterator.
+     * @param owner The registry that issued the request.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void remove(basic_registry<entity_type> &owner, It first, It last) {
+        if(!range_destruction.empty()) {
+            // listeners can rearrange the packed array, entities are copied first
+            const std::vector<entity_type> range(first, last);
+            range_destruction.publish(owner, range.data(), range.data() + range.size());
+        }
+
+        if(!destruction.empty()) {
+            for(auto it = first; it != last; ++it) {
+                destruction.publish(owner, *it);
+            }
+        }
+
+        Type::remove(owner, first, last);
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::patch
+     * @tparam Func Types of the function objects to invoke.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, [[maybe_unused]] Func &&... func) {
+        if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
+            update.publish(owner, entity);
+        } else {
+            Type::patch(owner, entity, std::forward<Func>(func)...);
+            update.publish(owner, entity);
+            return this->get(entity);
+        }
+    }
+
+    /**
+     * @brief Returns the memory usage and occupancy of a storage.
+     *
+     * Statistics also contain the number of listeners connected to the signals
+     * of the storage.
+     *
+     * @return The memory usage and occupancy of the storage.
+     */
+    [[nodiscard]] pool_stats memory_usage() const override {
+        auto stats = Type::memory_usage();
+        stats.listeners = construction.size() + range_construction.size() + destruction.size() + range_destruction.size() + update.size();
+        return stats;
+    }
+
+private:
+    sigh<void(basic_registry<entity_type> &, const entity_type)> construction{};
+    sigh<void(basic_registry<entity_type> &, const entity_type *, const entity_type *)> range_construction{};
+    sigh<void(basic_registry<entity_type> &, const entity_type)> destruction{};
+    sigh<void(basic_registry<entity_type> &, const entity_type *, const entity_type *)> range_destruction{};
+    sigh<void(basic_registry<entity_type> &, const entity_type)> update{};
+};
+
+
+/**
+ * @brief Mixin type to use to add change tracking to storage types.
+ *
+ * Objects are stamped with the current tick of the registry that issued the
+ * request whenever they are created or explicitly updated. Creations and
+ * updates are tracked separately. Systems can then find out the objects added
+ * or changed since a given tick with an integer comparison, without connecting
+ * any listener to the signals of the storage.<br/>
+ * Stamps are indexed by entity rather than stored along with the objects, so
+ * that they don't move around when a storage is sorted or elements are
+ * removed.
+ *
+ * @note
+ * Objects that are modified in place without notifying the storage aren't
+ * stamped, the same as updates aren't notified in this case.
+ *
+ * @sa basic_registry::tick
+ *
+ * @tparam Type The type of the underlying storage.
+ */
+template<typename Type>
+struct tick_storage_mixin: Type {
+    using Type::Type;
+
+private:
+    struct tick_data {
+        std::uint64_t added;
+        std::uint64_t changed;
+    };
+
+public:
+
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
+    /**
+     * @brief Returns the tick at which the object of an entity was created.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entity A valid entity identifier.
+     * @return The tick at which the object was created.
+     */
+    [[nodiscard]] std::uint64_t added_tick(const entity_type entity) const {
+        ENTT_ASSERT(this->contains(entity));
+        return ticks[index_of(entity)].added;
     }
 
     /**
-     * @copybrief remove
+     * @brief Returns the tick at which the object of an entity was created or
+     * updated last.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @param entity A valid entity identifier.
+     * @return The tick at which the object changed last.
+     */
+    [[nodiscard]] std::uint64_t changed_tick(const entity_type entity) const {
+        ENTT_ASSERT(this->contains(entity));
+        return ticks[index_of(entity)].changed;
+    }
+
+    /**
+     * @brief Checks if the object of an entity was created after a given tick.
+     * @param entity A valid entity identifier.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @return True if the object was created after the given tick, false
+     * otherwise.
+     */
+    [[nodiscard]] bool added_since(const entity_type entity, const std::uint64_t since) const {
+        return this->contains(entity) && added_tick(entity) > since;
+    }
+
+    /**
+     * @brief Checks if the object of an entity was created or updated after a
+     * given tick.
+     * @param entity A valid entity identifier.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @return True if the object changed after the given tick, false
+     * otherwise.
+     */
+    [[nodiscard]] bool changed_since(const entity_type entity, const std::uint64_t since) const {
+        return this->contains(entity) && changed_tick(entity) > since;
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::emplace
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the object.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
+        stamp(owner, entity, true);
+        return Type::emplace(owner, entity, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @copybrief storage_adapter_mixin::insert
      * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to construct the objects
+     * associated with the entities.
+     * @param owner The registry that issued the request.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to initialize the objects associated with
+     * the entities.
      */
-    template<typename It>
-    void remove(basic_registry<entity_type> &, It first, It last) {
-        Type::remove(first, last);
+    template<typename It, typename... Args>
+    void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
+        for(auto it = first; it != last; ++it) {
+            stamp(owner, *it, true);
+        }
+
+        Type::insert(owner, first, last, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Patches the given instance for an entity.
+     * @copybrief storage_adapter_mixin::patch
      * @tparam Func Types of the function objects to invoke.
+     * @param owner The registry that issued the request.
      * @param entity A valid entity identifier.
      * @param func Valid function objects.
      * @return A reference to the patched instance.
      */
     template<typename... Func>
-    decltype(auto) patch(basic_registry<entity_type> &, const entity_type entity, [[maybe_unused]] Func &&... func) {
-        auto &instance = this->get(entity);
-        (std::forward<Func>(func)(instance), ...);
-        return instance;
+    decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, Func &&... func) {
+        stamp(owner, entity, false);
+        return Type::patch(owner, entity, std::forward<Func>(func)...);
+    }
+
+private:
+    // stamps are set in advance, so that listeners of the underlying storage can already see them
+    [[nodiscard]] static std::size_t index_of(const entity_type entity) ENTT_NOEXCEPT {
+        return static_cast<std::size_t>(to_integral(entity) & entt_traits<entity_type>::entity_mask);
+    }
+
+    void stamp(const basic_registry<entity_type> &owner, const entity_type entity, const bool created) {
+        const auto pos = index_of(entity);
+
+        if(!(pos < ticks.size())) {
+            ticks.resize(pos + 1u);
+        }
+
+        auto &&curr = ticks[pos];
+        curr.changed = owner.tick();
+        curr.added = created ? curr.changed : curr.added;
     }
+
+    void remap_all(const entity_type *table) override {
+        // stamps are only set for entities in use, the table covers all of them
+        std::vector<tick_data> other{};
+
+        for(std::size_t pos{}, last = ticks.size(); pos < last; ++pos) {
+            if(const auto entt = table[pos]; entt != null && this->contains(entt)) {
+                if(const auto curr = index_of(entt); !(curr < other.size())) {
+                    other.resize(curr + 1u);
+                }
+
+                other[index_of(entt)] = ticks[pos];
+            }
+        }
+
+        ticks = std::move(other);
+    }
+
+    std::vector<tick_data> ticks{};
 };
 
 
 /**
- * @brief Mixin type to use to add signal support to storage types.
+ * @brief Mixin type to use to enable and disable objects without structural
+ * changes visible to the registry.
+ *
+ * Disabled objects are parked aside in a plain storage and their entities are
+ * no longer part of the underlying storage. Therefore, views and the registry
+ * don't return them until they are enabled again. Both operations take
+ * constant time and don't trigger any signal, as long as this mixin is applied
+ * before the one that emits signals:
+ *
+ * @code{.cpp}
+ * template<typename Entity>
+ * struct entt::storage_traits<Entity, ai_state> {
+ *     using storage_type = entt::sigh_storage_mixin<entt::toggle_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, ai_state>>>>;
+ * };
+ * @endcode
+ *
+ * @warning
+ * Groups aren't notified when objects are enabled or disabled, therefore types
+ * that are toggled shouldn't be used with groups.<br/>
+ * Disabled objects aren't destroyed along with their entities. They are
+ * discarded when the identifier is reused for a new object of the same type or
+ * when the storage itself is destroyed.
+ *
  * @tparam Type The type of the underlying storage.
  */
 template<typename Type>
-struct sigh_storage_mixin: Type {
+struct toggle_storage_mixin: Type {
+    using Type::Type;
+
     /*! @brief Underlying value type. */
     using value_type = typename Type::value_type;
     /*! @brief Underlying entity identifier. */
     using entity_type = typename Type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
     /*! @brief Storage category. */
     using storage_category = typename Type::storage_category;
 
     /**
-     * @brief Returns a sink object.
-     *
-     * The sink returned by this function can be used to receive notifications
-     * whenever a new instance is created and assigned to an entity.<br/>
-     * The function type for a listener is equivalent to:
-     *
-     * @code{.cpp}
-     * void(basic_registry<entity_type> &, entity_type);
-     * @endcode
-     *
-     * Listeners are invoked **after** the object has been assigned to the
-     * entity.
+     * @brief Disables the object of an entity.
      *
-     * @sa sink
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results
+     * in undefined behavior.
      *
-     * @return A temporary sink object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
      */
-    [[nodiscard]] auto on_construct() ENTT_NOEXCEPT {
-        return sink{construction};
+    void disable(basic_registry<entity_type> &owner, const entity_type entity) {
+        ENTT_ASSERT(this->contains(entity));
+
+        if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
+            parked.emplace(entity);
+        } else if constexpr(std::is_same_v<storage_category, split_storage_tag>) {
+            parked.emplace(entity, static_cast<value_type>(this->get(entity)));
+        } else {
+            parked.emplace(entity, std::move(this->get(entity)));
+        }
+
+        Type::remove(owner, entity);
     }
 
     /**
-     * @brief Returns a sink object.
-     *
-     * The sink returned by this function can be used to receive notifications
-     * whenever an instance is explicitly updated.<br/>
-     * The function type for a listener is equivalent to:
-     *
-     * @code{.cpp}
-     * void(basic_registry<entity_type> &, entity_type);
-     * @endcode
-     *
-     * Listeners are invoked **after** the object has been updated.
+     * @brief Enables the object of an entity that was previously disabled.
      *
-     * @sa sink
+     * @warning
+     * Attempting to enable an object that isn't disabled results in undefined
+     * behavior.
      *
-     * @return A temporary sink object.
+     * @param owner The registry that issued the request.
+     * @param entity A valid entity identifier.
      */
-    [[nodiscard]] auto on_update() ENTT_NOEXCEPT {
-        return sink{update};
+    void enable(basic_registry<entity_type> &owner, const entity_type entity) {
+        ENTT_ASSERT(disabled(entity));
+
+        if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
+            Type::emplace(owner, entity);
+        } else {
+            Type::emplace(owner, entity, std::move(parked.get(entity)));
+        }
+
+        parked.remove(entity);
     }
 
     /**
-     * @brief Returns a sink object.
-     *
-     * The sink returned by this function can be used to receive notifications
-     * whenever an instance is removed from an entity and thus destroyed.<br/>
-     * The function type for a listener is equivalent to:
-     *
-     * @code{.cpp}
-     * void(basic_registry<entity_type> &, entity_type);
-     * @endcode
-     *
-     * Listeners are invoked **before** the object has been removed from the
-     * entity.
-     *
-     * @sa sink
-     *
-     * @return A temporary sink object.
+     * @brief Checks if an entity has a disabled object.
+     * @param entity A valid entity identifier.
+     * @return True if the object of the entity is disabled, false otherwise.
      */
-    [[nodiscard]] auto on_destroy() ENTT_NOEXCEPT {
-        return sink{destruction};
+    [[nodiscard]] bool disabled(const entity_type entity) const {
+        return parked.contains(entity) && parked.data()[parked.index(entity)] == entity;
+    }
+
+    /**
+     * @brief Returns the number of disabled objects.
+     * @return Number of disabled objects, including those left behind by
+     * entities that no longer exist.
+     */
+    [[nodiscard]] size_type disabled_size() const ENTT_NOEXCEPT {
+        return parked.size();
     }
 
     /**
@@ -702,12 +3318,8 @@ struct sigh_storage_mixin: Type {
      */
     template<typename... Args>
     decltype(auto) emplace(basic_registry<entity_type> &owner, const entity_type entity, Args &&... args) {
-        Type::emplace(owner, entity, std::forward<Args>(args)...);
-        construction.publish(owner, entity);
-
-        if constexpr(!std::is_same_v<storage_category, empty_storage_tag>) {
-            return this->get(entity);
-        }
+        discard(entity);
+        return Type::emplace(owner, entity, std::forward<Args>(args)...);
     }
 
     /**
@@ -723,66 +3335,136 @@ struct sigh_storage_mixin: Type {
      */
     template<typename It, typename... Args>
     void insert(basic_registry<entity_type> &owner, It first, It last, Args &&... args) {
+        for(auto it = first; it != last; ++it) {
+            discard(*it);
+        }
+
         Type::insert(owner, first, last, std::forward<Args>(args)...);
+    }
 
-        if(!construction.empty()) {
-            for(; first != last; ++first) {
-                construction.publish(owner, *first);
-            }
+private:
+    void discard(const entity_type entity) {
+        // objects left behind by destroyed entities or replaced by new ones
+        if(parked.contains(entity)) {
+            parked.remove(parked.data()[parked.index(entity)]);
         }
     }
 
+    void remap_all(const entity_type *table) override {
+        internal::remap_storage(parked, table);
+    }
+
+    basic_storage<entity_type, value_type> parked{};
+};
+
+
+/**
+ * @brief Mixin type to use to keep the last versions of the objects of a
+ * storage.
+ *
+ * Every time a frame is recorded, the objects of the storage are copied into
+ * the next slot of a ring buffer of fixed length. Each slot is a plain storage
+ * that keeps its objects tightly packed and is reused from frame to frame
+ * without releasing its memory. Interpolation, lag compensation and similar
+ * techniques can then read the past versions of an object without a separate
+ * snapshot system. Recording a frame doesn't trigger any signal:
+ *
+ * @code{.cpp}
+ * template<typename Entity>
+ * struct entt::storage_traits<Entity, position> {
+ *     using storage_type = entt::sigh_storage_mixin<entt::history_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, position>>, 8u>>;
+ * };
+ * @endcode
+ *
+ * @tparam Type The type of the underlying storage.
+ * @tparam Length The number of frames to keep.
+ */
+template<typename Type, std::size_t Length>
+struct history_storage_mixin: Type {
+    static_assert(Length, "Invalid history length");
+    static_assert(!std::is_same_v<typename Type::storage_category, empty_storage_tag>, "Empty types have no history");
+
+    using Type::Type;
+
+    /*! @brief Underlying value type. */
+    using value_type = typename Type::value_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename Type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Storage category. */
+    using storage_category = typename Type::storage_category;
+
     /**
-     * @copybrief storage_adapter_mixin::remove
-     * @param owner The registry that issued the request.
-     * @param entity A valid entity identifier.
+     * @brief Copies all the objects of the storage in a new frame.
+     *
+     * The oldest frame is overwritten when the history is full.
      */
-    void remove(basic_registry<entity_type> &owner, const entity_type entity) {
-        destruction.publish(owner, entity);
-        Type::remove(owner, entity);
+    void record() {
+        head = (head + 1u) % Length;
+        recorded += (recorded < Length);
+
+        auto &&slot = slots[head];
+        slot.reset();
+        slot.reserve(this->size());
+
+        for(auto pos = this->size(); pos; --pos) {
+            const auto entt = this->data()[pos - 1u];
+            slot.emplace(entt, static_cast<const value_type &>(this->get(entt)));
+        }
     }
 
     /**
-     * @copybrief storage_adapter_mixin::remove
-     * @tparam It Type of input iterator.
-     * @param owner The registry that issued the request.
-     * @param first An iterator to the first element of the range of entities.
-     * @param last An iterator past the last element of the range of entities.
+     * @brief Returns the version of the object of an entity recorded a given
+     * number of frames ago, if any.
+     *
+     * A value of zero refers to the most recent frame recorded, not to the
+     * object currently in the storage.
+     *
+     * @param entity A valid entity identifier.
+     * @param frames_ago The number of frames to go back from the most recent
+     * one.
+     * @return A pointer to the recorded object if any, a null pointer
+     * otherwise.
      */
-    template<typename It>
-    void remove(basic_registry<entity_type> &owner, It first, It last) {
-        if(!destruction.empty()) {
-            for(auto it = first; it != last; ++it) {
-                destruction.publish(owner, *it);
+    [[nodiscard]] const value_type * history(const entity_type entity, const size_type frames_ago = 0u) const {
+        if(frames_ago < recorded) {
+            if(auto &&slot = slots[(head + Length - frames_ago) % Length]; slot.contains(entity) && slot.data()[slot.index(entity)] == entity) {
+                return &slot.get(entity);
             }
         }
 
-        Type::remove(owner, first, last);
+        return nullptr;
     }
 
     /**
-     * @copybrief storage_adapter_mixin::patch
-     * @tparam Func Types of the function objects to invoke.
-     * @param owner The registry that issued the request.
-     * @param entity A valid entity identifier.
-     * @param func Valid function objects.
-     * @return A reference to the patched instance.
+     * @brief Returns the number of frames recorded so far.
+     * @return Number of frames available, never greater than the length of
+     * the history.
      */
-    template<typename... Func>
-    decltype(auto) patch(basic_registry<entity_type> &owner, const entity_type entity, [[maybe_unused]] Func &&... func) {
-        if constexpr(std::is_same_v<storage_category, empty_storage_tag>) {
-            update.publish(owner, entity);
-        } else {
-            Type::patch(owner, entity, std::forward<Func>(func)...);
-            update.publish(owner, entity);
-            return this->get(entity);
+    [[nodiscard]] size_type frames() const ENTT_NOEXCEPT {
+        return recorded;
+    }
+
+    /*! @brief Discards all the frames recorded so far. */
+    void forget() {
+        for(auto &&slot: slots) {
+            slot.clear();
         }
+
+        recorded = {};
     }
 
 private:
-    sigh<void(basic_registry<entity_type> &, const entity_type)> construction{};
-    sigh<void(basic_registry<entity_type> &, const entity_type)> destruction{};
-    sigh<void(basic_registry<entity_type> &, const entity_type)> update{};
+    void remap_all(const entity_type *table) override {
+        for(auto &&slot: slots) {
+            internal::remap_storage(slot, table);
+        }
+    }
+
+    std::array<basic_storage<entity_type, value_type>, Length> slots{};
+    size_type head{};
+    size_type recorded{};
 };
 
 
@@ -797,6 +3479,11 @@ private:
  * * If the component type is a const one, the member typedef type is the
  *   declared storage type, except it has a const-qualifier added.
  *
+ * Specializations of this class can be used to provide a registry with storage
+ * classes that manage their objects by means of custom allocators. In this
+ * case, allocators must be default constructible, since the registry creates
+ * pools on demand.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Type of objects assigned to the entities.
  */
@@ -819,8 +3506,13 @@ template<typename Type>
     if constexpr(std::is_same_v<typename Type::storage_category, empty_storage_tag>) {
         return std::make_tuple();
     } else {
-        static_assert(std::is_same_v<typename Type::storage_category, dense_storage_tag>, "Unknown storage category");
-        return std::forward_as_tuple(container.get(entity));
+        if constexpr(std::is_same_v<typename Type::storage_category, split_storage_tag>) {
+            // proxy references are returned by copy
+            return std::make_tuple(container.get(entity));
+        } else {
+            static_assert(std::is_same_v<typename Type::storage_category, dense_storage_tag>, "Unknown storage category");
+            return std::forward_as_tuple(container.get(entity));
+        }
     }
 }
 
@@ -0,0 +1,248 @@
+#ifndef ENTT_ENTITY_TELEMETRY_HPP
+#define ENTT_ENTITY_TELEMETRY_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "fwd.hpp"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Lock-free buffer of statistics sampled from a registry.
+ *
+ * A telemetry buffer is written by a single thread, usually at frame
+ * boundaries, and read by any number of other threads. It contains the number
+ * of entities of the registry, the size, memory usage and number of listeners
+ * of each pool and the size of each group.<br/>
+ * The writer never waits for the readers. A reader that overlaps with a write
+ * detects it and tries again, so that it never gets a torn sample. Queries
+ * don't touch the registry at all and cost as much as copying the buffer.
+ *
+ * The buffer has a fixed size and doesn't allocate. It can be constructed in
+ * memory shared between processes, as long as the atomic counters it uses are
+ * lock-free. Pools and groups that exceed the capacity are ignored.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Pools Maximum number of pools to sample.
+ * @tparam Groups Maximum number of groups to sample.
+ */
+template<typename Entity, std::size_t Pools, std::size_t Groups>
+class basic_telemetry {
+    using word_type = std::atomic<std::size_t>;
+
+    static_assert(word_type::is_always_lock_free, "Atomic counters must be lock-free");
+
+    static constexpr std::size_t pool_words = 5u;
+    static constexpr std::size_t group_words = 2u;
+    static constexpr std::size_t header_words = 5u;
+
+    void store(std::size_t &pos, const std::size_t value) ENTT_NOEXCEPT {
+        buffer[pos++].store(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t load(std::size_t &pos) const ENTT_NOEXCEPT {
+        return buffer[pos++].load(std::memory_order_relaxed);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Statistics of a pool. */
+    struct pool_record {
+        /*! @brief Hash of the type of components. */
+        id_type id;
+        /*! @brief Number of entities in the pool. */
+        size_type size;
+        /*! @brief Number of entities for which the pool has room. */
+        size_type capacity;
+        /*! @brief Memory used by the pool, in bytes. */
+        size_type bytes;
+        /*! @brief Number of listeners connected to the pool. */
+        size_type listeners;
+    };
+
+    /*! @brief Statistics of a group. */
+    struct group_record {
+        /*! @brief Number of types the group refers to. */
+        size_type types;
+        /*! @brief Number of entities in the group. */
+        size_type size;
+    };
+
+    /*! @brief Consistent copy of the last sample written to the buffer. */
+    struct sample_type {
+        /*! @brief Number of samples written before this one. */
+        size_type frame;
+        /*! @brief Number of entities created so far. */
+        size_type entities;
+        /*! @brief Number of entities still in use. */
+        size_type alive;
+        /*! @brief Number of valid elements in the array of pools. */
+        size_type pool_count;
+        /*! @brief Number of valid elements in the array of groups. */
+        size_type group_count;
+        /*! @brief Statistics of the pools. */
+        std::array<pool_record, Pools> pools;
+        /*! @brief Statistics of the groups. */
+        std::array<group_record, Groups> groups;
+    };
+
+    /*! @brief Default constructor. */
+    basic_telemetry() ENTT_NOEXCEPT
+        : sequence{},
+          buffer{}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_telemetry(const basic_telemetry &) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This telemetry buffer.
+     */
+    basic_telemetry & operator=(const basic_telemetry &) = delete;
+
+    /**
+     * @brief Samples a registry and publishes the result.
+     *
+     * This function must be invoked by a single thread at a time. Its cost is
+     * proportional to the number of pools and groups of the registry rather
+     * than to the number of entities.
+     *
+     * @param reg A valid reference to a registry.
+     */
+    void sample(const basic_registry<Entity> &reg) {
+        const auto seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        size_type pos = header_words;
+        size_type pool_count{};
+        size_type group_count{};
+
+        reg.stats([this, &pos, &pool_count](const type_info info, const pool_stats &stats) {
+            if(pool_count < Pools) {
+                store(pos, info.hash());
+                store(pos, stats.size);
+                store(pos, stats.capacity);
+                store(pos, stats.bytes());
+                store(pos, stats.listeners);
+                ++pool_count;
+            }
+        });
+
+        pos = header_words + Pools * pool_words;
+
+        reg.group_stats([this, &pos, &group_count](const size_type types, const size_type size) {
+            if(group_count < Groups) {
+                store(pos, types);
+                store(pos, size);
+                ++group_count;
+            }
+        });
+
+        pos = 0u;
+        store(pos, seq / 2u);
+        store(pos, reg.size());
+        store(pos, reg.alive());
+        store(pos, pool_count);
+        store(pos, group_count);
+
+        sequence.store(seq + 2u, std::memory_order_release);
+    }
+
+    /**
+     * @brief Tries to copy the last sample written to the buffer.
+     *
+     * This function doesn't wait. It fails if no sample was published yet or
+     * if the writer updated the buffer in the meantime.
+     *
+     * @param out The object in which to copy the sample.
+     * @return True in case of success, false otherwise.
+     */
+    [[nodiscard]] bool try_read(sample_type &out) const ENTT_NOEXCEPT {
+        const auto seq = sequence.load(std::memory_order_acquire);
+
+        if(seq == 0u || (seq & 1u)) {
+            return false;
+        }
+
+        size_type pos{};
+        out.frame = load(pos);
+        out.entities = load(pos);
+        out.alive = load(pos);
+        // counts are clamped in case of torn reads, the sample is discarded anyway
+        out.pool_count = (std::min)(load(pos), Pools);
+        out.group_count = (std::min)(load(pos), Groups);
+
+        for(size_type next{}; next < out.pool_count; ++next) {
+            auto &elem = out.pools[next];
+            elem.id = static_cast<id_type>(load(pos));
+            elem.size = load(pos);
+            elem.capacity = load(pos);
+            elem.bytes = load(pos);
+            elem.listeners = load(pos);
+        }
+
+        pos = header_words + Pools * pool_words;
+
+        for(size_type next{}; next < out.group_count; ++next) {
+            auto &elem = out.groups[next];
+            elem.types = load(pos);
+            elem.size = load(pos);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence.load(std::memory_order_relaxed) == seq;
+    }
+
+    /**
+     * @brief Returns a copy of the last sample written to the buffer.
+     *
+     * The reader tries again until it gets a consistent sample. It never
+     * blocks the writer.
+     *
+     * @warning
+     * Attempting to read a buffer that was never written results in undefined
+     * behavior.
+     *
+     * @return A copy of the last sample written to the buffer.
+     */
+    [[nodiscard]] sample_type read() const ENTT_NOEXCEPT {
+        ENTT_ASSERT(samples());
+        sample_type out{};
+        while(!try_read(out));
+        return out;
+    }
+
+    /**
+     * @brief Returns the number of samples written so far.
+     * @return Number of samples written so far.
+     */
+    [[nodiscard]] size_type samples() const ENTT_NOEXCEPT {
+        return sequence.load(std::memory_order_acquire) / 2u;
+    }
+
+private:
+    word_type sequence;
+    std::array<word_type, header_words + Pools * pool_words + Groups * group_words> buffer;
+};
+
+
+}
+
+
+#endif
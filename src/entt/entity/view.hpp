@@ -4,11 +4,16 @@
 
 #include <iterator>
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <algorithm>
 #include <type_traits>
+#include <vector>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
@@ -20,6 +25,38 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Iterable, typename Pred, typename Func>
+void traverse_since(Iterable iterable, Pred pred, Func func) {
+    for(auto &&curr: iterable) {
+        if(pred(std::get<0>(curr))) {
+            if constexpr(is_applicable_v<Func, std::decay_t<decltype(curr)>>) {
+                std::apply(func, curr);
+            } else {
+                std::apply([&func](const auto, auto &&... component) { func(std::forward<decltype(component)>(component)...); }, curr);
+            }
+        }
+    }
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief View.
  *
@@ -103,6 +140,13 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
         view_iterator() ENTT_NOEXCEPT = default;
 
         view_iterator & operator++() ENTT_NOEXCEPT {
+            if constexpr(ENTT_PREFETCH_DISTANCE != 0) {
+                if(last - it > ENTT_PREFETCH_DISTANCE) {
+                    const auto entt = it[ENTT_PREFETCH_DISTANCE];
+                    std::for_each(unchecked.cbegin(), unchecked.cend(), [entt](const basic_sparse_set<Entity> *curr) { curr->prefetch(entt); });
+                }
+            }
+
             while(++it != last && !valid());
             return *this;
         }
@@ -117,13 +161,828 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
             return *this;
         }
 
-        view_iterator operator--(int) ENTT_NOEXCEPT {
+        view_iterator operator--(int) ENTT_NOEXCEPT {
+            view_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        [[nodiscard]] bool operator==(const view_iterator &other) const ENTT_NOEXCEPT {
+            return other.it == it;
+        }
+
+        [[nodiscard]] bool operator!=(const view_iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] pointer operator->() const {
+            return &*it;
+        }
+
+        [[nodiscard]] reference operator*() const {
+            return *operator->();
+        }
+
+    private:
+        It first;
+        It last;
+        It it;
+        unchecked_type unchecked;
+        std::tuple<const storage_type<Exclude> *...> filter;
+    };
+
+    class iterable_view final {
+        friend class basic_view<Entity, exclude_t<Exclude...>, Component...>;
+
+        template<typename It>
+        class iterable_view_iterator final {
+            friend class iterable_view;
+
+            iterable_view_iterator(It from, const basic_view &parent) ENTT_NOEXCEPT
+                : it{from},
+                  view{parent}
+            {}
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = decltype(std::tuple_cat(std::tuple<Entity>{}, std::declval<basic_view>().get({})));
+            using pointer = void;
+            using reference = value_type;
+            using iterator_category = std::input_iterator_tag;
+
+            iterable_view_iterator & operator++() ENTT_NOEXCEPT {
+                return ++it, *this;
+            }
+
+            iterable_view_iterator operator++(int) ENTT_NOEXCEPT {
+                iterable_view_iterator orig = *this;
+                return ++(*this), orig;
+            }
+
+            [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
+                return std::tuple_cat(std::make_tuple(*it), view.get(*it));
+            }
+
+            [[nodiscard]] bool operator==(const iterable_view_iterator &other) const ENTT_NOEXCEPT {
+                return other.it == it;
+            }
+
+            [[nodiscard]] bool operator!=(const iterable_view_iterator &other) const ENTT_NOEXCEPT {
+                return !(*this == other);
+            }
+
+        private:
+            It it;
+            const basic_view view;
+        };
+
+        iterable_view(const basic_view &parent)
+            : view{parent}
+        {}
+
+    public:
+        using iterator = iterable_view_iterator<view_iterator<typename basic_sparse_set<Entity>::iterator>>;
+        using reverse_iterator = iterable_view_iterator<view_iterator<typename basic_sparse_set<Entity>::reverse_iterator>>;
+
+        [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
+            return { view.begin(), view };
+        }
+
+        [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
+            return { view.end(), view };
+        }
+
+        [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
+            return { view.rbegin(), view };
+        }
+
+        [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
+            return { view.rend(), view };
+        }
+
+    private:
+        const basic_view view;
+    };
+
+    [[nodiscard]] const basic_sparse_set<Entity> * candidate() const ENTT_NOEXCEPT {
+        return (std::min)({ static_cast<const basic_sparse_set<entity_type> *>(std::get<storage_type<Component> *>(pools))... }, [](const auto *lhs, const auto *rhs) {
+            return lhs->size() < rhs->size();
+        });
+    }
+
+    [[nodiscard]] unchecked_type unchecked(const basic_sparse_set<Entity> *cpool) const {
+        std::size_t pos{};
+        unchecked_type other{};
+        (static_cast<void>(std::get<storage_type<Component> *>(pools) == cpool ? nullptr : (other[pos] = std::get<storage_type<Component> *>(pools), other[pos++])), ...);
+
+        // smaller pools are more likely to reject entities and are tested first
+        std::sort(other.begin(), other.end(), [](const auto *lhs, const auto *rhs) {
+            return lhs->size() < rhs->size();
+        });
+
+        return other;
+    }
+
+    template<typename Comp, typename It>
+    [[nodiscard]] auto dispatch_get([[maybe_unused]] It &it, [[maybe_unused]] const Entity entt) const {
+        if constexpr(std::is_same_v<typename std::iterator_traits<It>::value_type, typename storage_type<Comp>::value_type>) {
+            return std::forward_as_tuple(*it);
+        } else {
+            return get_as_tuple(*std::get<storage_type<Comp> *>(pools), entt);
+        }
+    }
+
+    template<typename Comp, typename Func, typename It>
+    void invoke(Func &func, const Entity entt, [[maybe_unused]] It &it) const {
+        if constexpr(std::is_same_v<typename storage_type<Comp>::storage_category, empty_storage_tag>) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+            } else {
+                std::apply(func, get(entt));
+            }
+        } else {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Component>(it, entt)...));
+            } else {
+                std::apply(func, std::tuple_cat(dispatch_get<Component>(it, entt)...));
+            }
+        }
+    }
+
+    template<typename Comp, typename It>
+    void prefetch([[maybe_unused]] It curr, [[maybe_unused]] const std::size_t pos, [[maybe_unused]] const std::size_t to) const {
+        if constexpr(ENTT_PREFETCH_DISTANCE != 0) {
+            constexpr std::size_t distance = ENTT_PREFETCH_DISTANCE;
+
+            // sparse arrays are prefetched first, so that components can be located later on without stalls
+            if(pos + 2u * distance < to) {
+                const auto entt = curr[2u * distance];
+                ((std::is_same_v<Comp, Component> ? void() : std::get<storage_type<Component> *>(pools)->prefetch(entt)), ...);
+            }
+
+            if(pos + distance < to) {
+                const auto entt = curr[distance];
+
+                ([entt](const auto *cpool, auto leading) {
+                    using pool_type = std::remove_const_t<std::remove_pointer_t<decltype(cpool)>>;
+
+                    if constexpr(!decltype(leading)::value && std::is_same_v<typename pool_type::storage_category, dense_storage_tag>) {
+                        if(cpool->contains(entt)) {
+                            ENTT_PREFETCH(&cpool->get(entt));
+                        }
+                    }
+                }(std::get<storage_type<Component> *>(pools), std::is_same<Comp, Component>{}), ...);
+            }
+        }
+    }
+
+    template<typename Comp, typename Func>
+    void traverse(Func &func, const std::size_t from, const std::size_t to) const {
+        auto curr = std::get<storage_type<Comp> *>(pools)->basic_sparse_set<entity_type>::begin() + from;
+        auto it = std::get<storage_type<Comp> *>(pools)->begin() + from;
+
+        if constexpr((sizeof...(Component) + sizeof...(Exclude)) < 3u) {
+            for(auto pos = from; pos < to; ++pos, ++curr, ++it) {
+                prefetch<Comp>(curr, pos, to);
+
+                if(const auto entt = *curr; ((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
+                    && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
+                {
+                    invoke<Comp>(func, entt, it);
+                }
+            }
+        } else {
+            // with three or more pools, testing entities in batches one pool at a time pays off
+            using mask_type = typename basic_sparse_set<entity_type>::mask_type;
+            constexpr std::size_t length = std::numeric_limits<mask_type>::digits;
+            const auto other = unchecked(std::get<storage_type<Comp> *>(pools));
+            entity_type batch[length];
+
+            for(auto pos = from; pos < to;) {
+                const auto count = (std::min)(length, to - pos);
+                auto mask = static_cast<mask_type>(~mask_type{} >> (length - count));
+
+                for(std::size_t next{}; next < count; ++next, ++curr) {
+                    prefetch<Comp>(curr, pos + next, to);
+                    batch[next] = *curr;
+                }
+
+                for(auto next = other.cbegin(); mask && next != other.cend(); ++next) {
+                    mask = (*next)->contains(batch, mask);
+                }
+
+                ((mask &= static_cast<mask_type>(~std::get<const storage_type<Exclude> *>(filter)->contains(batch, mask))), ...);
+
+                for(std::size_t next{}; next < count; ++next, ++it) {
+                    if(mask & (mask_type{1u} << next)) {
+                        invoke<Comp>(func, batch[next], it);
+                    }
+                }
+
+                pos += count;
+            }
+        }
+    }
+
+    template<typename Comp, typename Exec, typename Func>
+    void par_traverse(Exec &executor, Func &func, const std::size_t chunk) const {
+        ENTT_ASSERT(chunk);
+        const auto length = std::get<storage_type<Comp> *>(pools)->size();
+
+        if(const auto count = (length + chunk - 1u) / chunk; count) {
+            executor(count, [this, &func, length, chunk](const std::size_t pos) {
+                const auto from = pos * chunk;
+                traverse<Comp>(func, from, (std::min)(from + chunk, length));
+            });
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Bidirectional iterator type. */
+    using iterator = view_iterator<typename basic_sparse_set<entity_type>::iterator>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = view_iterator<typename basic_sparse_set<entity_type>::reverse_iterator>;
+
+    /**
+     * @brief Constructs a multi-type view from a set of storage classes.
+     * @param component The storage for the types to iterate.
+     * @param epool The storage for the types used to filter the view.
+     */
+    basic_view(storage_type<Component> &... component, const storage_type<Exclude> &... epool) ENTT_NOEXCEPT
+        : pools{&component...},
+          filter{&epool...},
+          view{candidate()}
+    {}
+
+    /**
+     * @brief Forces the type to use to drive iterations.
+     * @tparam Comp Type of component to use to drive the iteration.
+     */
+    template<typename Comp>
+    void use() const ENTT_NOEXCEPT {
+        view = std::get<storage_type<Comp> *>(pools);
+    }
+
+    /**
+     * @brief Picks again the smallest pool to drive iterations, as it happens
+     * when a view is constructed.
+     */
+    void refresh() const ENTT_NOEXCEPT {
+        view = candidate();
+    }
+
+    /**
+     * @brief Estimates the number of entities iterated by the view.
+     * @return Estimated number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type size_hint() const ENTT_NOEXCEPT {
+        return (std::min)({ std::get<storage_type<Component> *>(pools)->size()... });
+    }
+
+    /**
+     * @brief Returns the exact number of entities iterated by the view.
+     *
+     * Entities of the pool that drives the view are tested in batches, one
+     * pool at a time, and matches are counted rather than visited. Components
+     * are never accessed, therefore this is cheaper than iterating the view.
+     *
+     * @return Number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type count() const {
+        using mask_type = typename basic_sparse_set<entity_type>::mask_type;
+        constexpr std::size_t length = std::numeric_limits<mask_type>::digits;
+        const auto other = unchecked(view);
+        const auto *first = view->data();
+        size_type sz{};
+
+        for(size_type pos{}, last = view->size(); pos < last; pos += length) {
+            const auto step = (std::min)(length, last - pos);
+            auto mask = static_cast<mask_type>(~mask_type{} >> (length - step));
+
+            for(auto next = other.cbegin(); mask && next != other.cend(); ++next) {
+                mask = (*next)->contains(first + pos, mask);
+            }
+
+            ((mask &= static_cast<mask_type>(~std::get<const storage_type<Exclude> *>(filter)->contains(first + pos, mask))), ...);
+            sz += internal::popcount(mask);
+        }
+
+        return sz;
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the view.
+     *
+     * The returned iterator points to the first entity of the view. If the view
+     * is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the view.
+     */
+    [[nodiscard]] iterator begin() const {
+        return { view->begin(), view->end(), view->begin(), unchecked(view), filter };
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the view.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the view. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity of the view.
+     */
+    [[nodiscard]] iterator end() const {
+        return { view->begin(), view->end(), view->end(), unchecked(view), filter };
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the reversed view.
+     *
+     * The returned iterator points to the first entity of the reversed view. If
+     * the view is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first entity of the reversed view.
+     */
+    [[nodiscard]] reverse_iterator rbegin() const {
+        return { view->rbegin(), view->rend(), view->rbegin(), unchecked(view), filter };
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the reversed
+     * view.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the reversed view. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity of the
+     * reversed view.
+     */
+    [[nodiscard]] reverse_iterator rend() const {
+        return { view->rbegin(), view->rend(), view->rend(), unchecked(view), filter };
+    }
+
+    /**
+     * @brief Returns the first entity of the view, if any.
+     * @return The first entity of the view if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type front() const {
+        const auto it = begin();
+        return it != end() ? *it : null;
+    }
+
+    /**
+     * @brief Returns the last entity of the view, if any.
+     * @return The last entity of the view if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type back() const {
+        const auto it = rbegin();
+        return it != rend() ? *it : null;
+    }
+
+    /**
+     * @brief Finds an entity.
+     * @param entt A valid entity identifier.
+     * @return An iterator to the given entity if it's found, past the end
+     * iterator otherwise.
+     */
+    [[nodiscard]] iterator find(const entity_type entt) const {
+        iterator it{view->begin(), view->end(), view->find(entt), unchecked(view), filter};
+        return (it != end() && *it == entt) ? it : end();
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entt A valid entity identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const {
+        return (std::get<storage_type<Component> *>(pools)->contains(entt) && ...) && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...);
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `registry::get` during iterations. It has
+     * far better performance than its counterpart.
+     *
+     * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the view
+     * results in undefined behavior.
+     *
+     * @tparam Comp Types of components to get.
+     * @param entt A valid entity identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    [[nodiscard]] decltype(auto) get([[maybe_unused]] const entity_type entt) const {
+        ENTT_ASSERT(contains(entt));
+
+        if constexpr(sizeof...(Comp) == 0) {
+            return std::tuple_cat(get_as_tuple(*std::get<storage_type<Component> *>(pools), entt)...);
+        } else if constexpr(sizeof...(Comp) == 1) {
+            return (std::get<storage_type<Comp> *>(pools)->get(entt), ...);
+        } else {
+            return std::tuple_cat(get_as_tuple(*std::get<storage_type<Comp> *>(pools), entt)...);        }
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to non-empty components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &...);
+     * void(Type &...);
+     * @endcode
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned during iterations.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        ENTT_TRACE("entt::view::each", type_id<basic_view>().name());
+        ((std::get<storage_type<Component> *>(pools) == view ? traverse<Component>(func, 0u, view->size()) : void()), ...);
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The pool of the suggested component is used to lead the iterations. The
+     * returned entities will therefore respect the order of the pool associated
+     * with that type.<br/>
+     * It is no longer guaranteed that the performance is the best possible, but
+     * there will be greater control over the order of iteration.
+     *
+     * @sa each
+     *
+     * @tparam Comp Type of component to use to drive the iteration.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    void each(Func func) const {
+        ENTT_TRACE("entt::view::each", type_id<basic_view>().name());
+        use<Comp>();
+        traverse<Comp>(func, 0u, view->size());
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool used to drive the iterations is split in chunks of contiguous
+     * elements and each chunk is offered to the executor as a separate task.
+     * Every task performs its own checks against the other pools and the
+     * exclusion list.<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying components of the iterated types during a
+     * parallel iteration results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        ((std::get<storage_type<Component> *>(pools) == view ? par_traverse<Component>(executor, func, chunk) : void()), ...);
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool of the suggested component is used to lead the iterations.
+     *
+     * @sa par_each
+     *
+     * @tparam Comp Type of component to use to drive the iteration.
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Comp, typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        use<Comp>();
+        par_traverse<Comp>(executor, func, chunk);
+    }
+
+    /**
+     * @brief Iterates entities and components in ascending order of their
+     * identifiers and applies the given function object to them.
+     *
+     * The matching entities are gathered from the pool that leads the
+     * iteration and sorted by entity number before invoking the function
+     * object. This way, lookups into all the pools walk their sparse arrays
+     * and pages in sequence, no matter how the leading pool is arranged.<br/>
+     * It pays off when pools are large and their packed arrays are scattered
+     * with respect to the identifiers, at the price of a temporary buffer and
+     * a linear time sort per call.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_ascending(Func func) const {
+        ENTT_TRACE("entt::view::each_ascending", type_id<basic_view>().name());
+        using traits_type = entt_traits<entity_type>;
+        std::vector<entity_type> entities{};
+        entities.reserve(view->size());
+
+        for(const auto entt: *view) {
+            if(contains(entt)) {
+                entities.push_back(entt);
+            }
+        }
+
+        radix_sort<8u, (traits_type::entity_shift + 7u) / 8u * 8u>{}(entities.begin(), entities.end(), [](const auto entt) {
+            return to_integral(entt) & traits_type::entity_mask;
+        });
+
+        for(const auto entt: entities) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+            } else {
+                std::apply(func, get(entt));
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in batches and applies the
+     * given function object to them.
+     *
+     * Matching entities are gathered in batches of `Size` elements, the last
+     * of which can be shorter. The function object is invoked once per batch
+     * and it's provided with a pointer to the entities, an array of pointers
+     * for each non-empty component and the number of elements in the batch.
+     * The signature of the function must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, Type *const *..., Count);
+     * @endcode
+     *
+     * Where `Count` is `std::integral_constant<size_type, Size>` for full
+     * batches and `size_type` for the last one, if shorter. Both convert to
+     * `size_type`, though generic function objects get loops with a trip count
+     * known at compile-time for full batches.
+     *
+     * @note
+     * Components aren't contiguous in memory in general. Single component
+     * views and owning groups offer contiguous batches instead.
+     *
+     * @sa each
+     *
+     * @tparam Size Number of elements in full batches.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<size_type Size, typename Func>
+    void each_batch(Func func) const {
+        static_assert(Size != 0u, "Invalid batch size");
+        static_assert(!(std::is_same_v<typename storage_type<Component>::storage_category, split_storage_tag> || ...), "Split storage cannot be iterated in batches");
+        ENTT_TRACE("entt::view::each_batch", type_id<basic_view>().name());
+
+        std::array<entity_type, Size> entities;
+        typename internal::batch_pointers<Size, decltype(std::declval<basic_view>().get({}))>::type pointers;
+        size_type count{};
+
+        const auto invoke = [&func, &entities, &pointers](const auto length) {
+            std::apply([&func, &entities, length](auto &... array) { func(entities.data(), array.data()..., length); }, pointers);
+        };
+
+        each([&entities, &pointers, &count, &invoke](const entity_type entt, auto &... component) {
+            entities[count] = entt;
+            std::apply([count, &component...](auto &... array) { ((array[count] = &component), ...); }, pointers);
+
+            if(++count == Size) {
+                invoke(std::integral_constant<size_type, Size>{});
+                count = {};
+            }
+        });
+
+        if(count) {
+            invoke(count);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ the view.
+     *
+     * The iterable object returns tuples that contain the current entity and a
+     * set of references to its non-empty components. The _constness_ of the
+     * components is as requested.
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned during iterations.
+     *
+     * @return An iterable object to use to _visit_ the view.
+     */
+    [[nodiscard]] iterable_view each() const ENTT_NOEXCEPT {
+        return iterable_view{*this};
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ the view.
+     *
+     * The pool of the suggested component is used to lead the iterations. The
+     * returned elements will therefore respect the order of the pool associated
+     * with that type.<br/>
+     * It is no longer guaranteed that the performance is the best possible, but
+     * there will be greater control over the order of iteration.
+     *
+     * @sa each
+     *
+     * @tparam Comp Type of component to use to drive the iteration.
+     * @return An iterable object to use to _visit_ the view.
+     */
+    template<typename Comp>
+    [[nodiscard]] iterable_view each() const ENTT_NOEXCEPT {
+        use<Comp>();
+        return iterable_view{*this};
+    }
+
+    /**
+     * @brief Iterates entities and components whose given component changed
+     * after a tick and applies the given function object to them.
+     *
+     * The pool of the suggested component is used to lead the iterations and
+     * it must track changes, as an example by means of a `tick_storage_mixin`.
+     *
+     * @sa each
+     * @sa tick_storage_mixin
+     *
+     * @tparam Comp Type of component whose changes are of interest.
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    void each_changed_since(const std::uint64_t since, Func func) const {
+        const auto *cpool = std::get<storage_type<Comp> *>(pools);
+        internal::traverse_since(each<Comp>(), [cpool, since](const auto entt) { return cpool->changed_since(entt, since); }, std::move(func));
+    }
+
+    /**
+     * @brief Iterates entities and components whose given component was
+     * created after a tick and applies the given function object to them.
+     *
+     * @sa each_changed_since
+     *
+     * @tparam Comp Type of component whose creations are of interest.
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    void each_added_since(const std::uint64_t since, Func func) const {
+        const auto *cpool = std::get<storage_type<Comp> *>(pools);
+        internal::traverse_since(each<Comp>(), [cpool, since](const auto entt) { return cpool->added_since(entt, since); }, std::move(func));
+    }
+
+private:
+    const std::tuple<storage_type<Component> *...> pools;
+    const std::tuple<const storage_type<Exclude> *...> filter;
+    mutable const basic_sparse_set<entity_type>* view;
+};
+
+
+/**
+ * @brief Exclusion-only view specialization.
+ *
+ * Exclusion-only views iterate all the entities in use, except for those that
+ * have at least one of the given components in their bags. The list of entities
+ * of the registry is scanned directly. Destroyed entities are skipped by means
+ * of the bitset of the identifiers in use that the registry keeps, so that
+ * ranges of destroyed entities are jumped over a word at a time.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New instances of the given components are created and assigned to entities.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is assigned to the entity to which the iterator points).
+ * * The entity currently pointed is destroyed.
+ *
+ * In all other cases, creating entities or modifying the pools of the given
+ * components in any way invalidates all the iterators and using them results in
+ * undefined behavior.
+ *
+ * @note
+ * Views share references to the underlying data structures of the registry that
+ * generated them. Therefore any change to the entities and to the components
+ * made by means of the registry are immediately reflected by views.
+ *
+ * @warning
+ * Lifetime of a view must not overcome that of the registry that generated it.
+ * In any other case, attempting to use a view results in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Exclude Types of components used to filter the view.
+ */
+template<typename Entity, typename... Exclude>
+class basic_view<Entity, exclude_t<Exclude...>> final {
+    template<typename Comp>
+    using storage_type = constness_as_t<typename storage_traits<Entity, std::remove_const_t<Comp>>::storage_type, Comp>;
+
+    using traits_type = entt_traits<Entity>;
+
+    template<bool Reverse>
+    class view_iterator final {
+        friend class basic_view<Entity, exclude_t<Exclude...>>;
+
+        view_iterator(const basic_registry<Entity> &ref, const std::tuple<const storage_type<Exclude> *...> &ignore, const std::size_t from, const std::size_t to) ENTT_NOEXCEPT
+            : reg{&ref},
+              filter{ignore},
+              pos{from},
+              last{to}
+        {
+            if(pos != last) {
+                seek();
+            }
+        }
+
+        void seek() ENTT_NOEXCEPT {
+            // identifiers not in use are skipped in bulk by the registry
+            if constexpr(Reverse) {
+                for(pos = reg->prev_in_use(pos); pos != last && filtered(filter, reg->data()[index()]); pos = reg->prev_in_use(pos - 1u));
+            } else {
+                for(pos = reg->next_in_use(pos); pos != last && filtered(filter, reg->data()[index()]); pos = reg->next_in_use(pos + 1u));
+            }
+        }
+
+        [[nodiscard]] std::size_t index() const ENTT_NOEXCEPT {
+            if constexpr(Reverse) {
+                return pos - 1u;
+            } else {
+                return pos;
+            }
+        }
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = Entity;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+        using iterator_category = std::forward_iterator_tag;
+
+        view_iterator() ENTT_NOEXCEPT = default;
+
+        view_iterator & operator++() ENTT_NOEXCEPT {
+            if constexpr(Reverse) {
+                --pos;
+            } else {
+                ++pos;
+            }
+
+            return seek(), *this;
+        }
+
+        view_iterator operator++(int) ENTT_NOEXCEPT {
             view_iterator orig = *this;
-            return operator--(), orig;
+            return ++(*this), orig;
         }
 
         [[nodiscard]] bool operator==(const view_iterator &other) const ENTT_NOEXCEPT {
-            return other.it == it;
+            return other.pos == pos;
         }
 
         [[nodiscard]] bool operator!=(const view_iterator &other) const ENTT_NOEXCEPT {
@@ -131,7 +990,7 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
         }
 
         [[nodiscard]] pointer operator->() const {
-            return &*it;
+            return reg->data() + index();
         }
 
         [[nodiscard]] reference operator*() const {
@@ -139,28 +998,26 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
         }
 
     private:
-        It first;
-        It last;
-        It it;
-        unchecked_type unchecked;
+        const basic_registry<Entity> *reg;
         std::tuple<const storage_type<Exclude> *...> filter;
+        std::size_t pos;
+        std::size_t last;
     };
 
     class iterable_view final {
-        friend class basic_view<Entity, exclude_t<Exclude...>, Component...>;
+        friend class basic_view<Entity, exclude_t<Exclude...>>;
 
         template<typename It>
         class iterable_view_iterator final {
             friend class iterable_view;
 
-            iterable_view_iterator(It from, const basic_view &parent) ENTT_NOEXCEPT
-                : it{from},
-                  view{parent}
+            iterable_view_iterator(It from) ENTT_NOEXCEPT
+                : it{from}
             {}
 
         public:
             using difference_type = std::ptrdiff_t;
-            using value_type = decltype(std::tuple_cat(std::tuple<Entity>{}, std::declval<basic_view>().get({})));
+            using value_type = std::tuple<Entity>;
             using pointer = void;
             using reference = value_type;
             using iterator_category = std::input_iterator_tag;
@@ -175,7 +1032,7 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
             }
 
             [[nodiscard]] reference operator*() const ENTT_NOEXCEPT {
-                return std::tuple_cat(std::make_tuple(*it), view.get(*it));
+                return std::make_tuple(*it);
             }
 
             [[nodiscard]] bool operator==(const iterable_view_iterator &other) const ENTT_NOEXCEPT {
@@ -188,7 +1045,6 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
 
         private:
             It it;
-            const basic_view view;
         };
 
         iterable_view(const basic_view &parent)
@@ -196,82 +1052,31 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> final {
         {}
 
     public:
-        using iterator = iterable_view_iterator<view_iterator<typename basic_sparse_set<Entity>::iterator>>;
-        using reverse_iterator = iterable_view_iterator<view_iterator<typename basic_sparse_set<Entity>::reverse_iterator>>;
+        using iterator = iterable_view_iterator<view_iterator<false>>;
+        using reverse_iterator = iterable_view_iterator<view_iterator<true>>;
 
         [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-            return { view.begin(), view };
+            return { view.begin() };
         }
 
         [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-            return { view.end(), view };
+            return { view.end() };
         }
 
         [[nodiscard]] reverse_iterator rbegin() const ENTT_NOEXCEPT {
-            return { view.rbegin(), view };
+            return { view.rbegin() };
         }
 
         [[nodiscard]] reverse_iterator rend() const ENTT_NOEXCEPT {
-            return { view.rend(), view };
+            return { view.rend() };
         }
 
     private:
         const basic_view view;
     };
 
-    [[nodiscard]] const basic_sparse_set<Entity> * candidate() const ENTT_NOEXCEPT {
-        return (std::min)({ static_cast<const basic_sparse_set<entity_type> *>(std::get<storage_type<Component> *>(pools))... }, [](const auto *lhs, const auto *rhs) {
-            return lhs->size() < rhs->size();
-        });
-    }
-
-    [[nodiscard]] unchecked_type unchecked(const basic_sparse_set<Entity> *cpool) const {
-        std::size_t pos{};
-        unchecked_type other{};
-        (static_cast<void>(std::get<storage_type<Component> *>(pools) == cpool ? nullptr : (other[pos] = std::get<storage_type<Component> *>(pools), other[pos++])), ...);
-        return other;
-    }
-
-    template<typename Comp, typename It>
-    [[nodiscard]] auto dispatch_get([[maybe_unused]] It &it, [[maybe_unused]] const Entity entt) const {
-        if constexpr(std::is_same_v<typename std::iterator_traits<It>::value_type, typename storage_type<Comp>::value_type>) {
-            return std::forward_as_tuple(*it);
-        } else {
-            return get_as_tuple(*std::get<storage_type<Comp> *>(pools), entt);
-        }
-    }
-
-    template<typename Comp, typename Func>
-    void traverse(Func func) const {
-        if constexpr(std::is_same_v<typename storage_type<Comp>::storage_category, empty_storage_tag>) {
-            for(const auto entt: static_cast<const basic_sparse_set<entity_type> &>(*std::get<storage_type<Comp> *>(pools))) {
-                if(((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
-                    && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
-                {
-                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                        std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
-                    } else {
-                        std::apply(func, get(entt));
-                    }
-                }
-            }
-        } else {
-            auto it = std::get<storage_type<Comp> *>(pools)->begin();
-
-            for(const auto entt: static_cast<const basic_sparse_set<entity_type> &>(*std::get<storage_type<Comp> *>(pools))) {
-                if(((std::is_same_v<Comp, Component> || std::get<storage_type<Component> *>(pools)->contains(entt)) && ...)
-                    && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...))
-                {
-                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                        std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Component>(it, entt)...));
-                    } else {
-                        std::apply(func, std::tuple_cat(dispatch_get<Component>(it, entt)...));
-                    }
-                }
-
-                ++it;
-            }
-        }
+    [[nodiscard]] static bool filtered(const std::tuple<const storage_type<Exclude> *...> &ignore, [[maybe_unused]] const Entity entt) ENTT_NOEXCEPT {
+        return (std::get<const storage_type<Exclude> *>(ignore)->contains(entt) || ...);
     }
 
 public:
@@ -279,37 +1084,27 @@ public:
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
-    /*! @brief Bidirectional iterator type. */
-    using iterator = view_iterator<typename basic_sparse_set<entity_type>::iterator>;
-    /*! @brief Reverse iterator type. */
-    using reverse_iterator = view_iterator<typename basic_sparse_set<entity_type>::reverse_iterator>;
+    /*! @brief Forward iterator type. */
+    using iterator = view_iterator<false>;
+    /*! @brief Reversed iterator type. */
+    using reverse_iterator = view_iterator<true>;
 
     /**
-     * @brief Constructs a multi-type view from a set of storage classes.
-     * @param component The storage for the types to iterate.
+     * @brief Constructs an exclusion-only view from a registry.
+     * @param ref The registry that owns the entities to iterate.
      * @param epool The storage for the types used to filter the view.
      */
-    basic_view(storage_type<Component> &... component, const storage_type<Exclude> &... epool) ENTT_NOEXCEPT
-        : pools{&component...},
-          filter{&epool...},
-          view{candidate()}
+    basic_view(const basic_registry<Entity> &ref, const storage_type<Exclude> &... epool) ENTT_NOEXCEPT
+        : reg{&ref},
+          filter{&epool...}
     {}
 
-    /**
-     * @brief Forces the type to use to drive iterations.
-     * @tparam Comp Type of component to use to drive the iteration.
-     */
-    template<typename Comp>
-    void use() const ENTT_NOEXCEPT {
-        view = std::get<storage_type<Comp> *>(pools);
-    }
-
     /**
      * @brief Estimates the number of entities iterated by the view.
      * @return Estimated number of entities iterated by the view.
      */
-    [[nodiscard]] size_type size_hint() const ENTT_NOEXCEPT {
-        return (std::min)({ std::get<storage_type<Component> *>(pools)->size()... });
+    [[nodiscard]] size_type size_hint() const {
+        return reg->size();
     }
 
     /**
@@ -321,7 +1116,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const {
-        return { view->begin(), view->end(), view->begin(), unchecked(view), filter };
+        return iterator{*reg, filter, {}, reg->size()};
     }
 
     /**
@@ -334,19 +1129,19 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const {
-        return { view->begin(), view->end(), view->end(), unchecked(view), filter };
+        return iterator{*reg, filter, reg->size(), reg->size()};
     }
 
     /**
      * @brief Returns an iterator to the first entity of the reversed view.
      *
-     * The returned iterator points to the first entity of the reversed view. If
-     * the view is empty, the returned iterator will be equal to `rend()`.
+     * The returned iterator points to the first entity of the reversed view.
+     * If the view is empty, the returned iterator will be equal to `rend()`.
      *
      * @return An iterator to the first entity of the reversed view.
      */
     [[nodiscard]] reverse_iterator rbegin() const {
-        return { view->rbegin(), view->rend(), view->rbegin(), unchecked(view), filter };
+        return reverse_iterator{*reg, filter, reg->size(), {}};
     }
 
     /**
@@ -361,7 +1156,7 @@ public:
      * reversed view.
      */
     [[nodiscard]] reverse_iterator rend() const {
-        return { view->rbegin(), view->rend(), view->rend(), unchecked(view), filter };
+        return reverse_iterator{*reg, filter, {}, {}};
     }
 
     /**
@@ -391,8 +1186,8 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const {
-        iterator it{view->begin(), view->end(), view->find(entt), unchecked(view), filter};
-        return (it != end() && *it == entt) ? it : end();
+        const auto pos = size_type{to_integral(entt) & traits_type::entity_mask};
+        return contains(entt) ? iterator{*reg, filter, pos, reg->size()} : end();
     }
 
     /**
@@ -401,126 +1196,62 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     [[nodiscard]] bool contains(const entity_type entt) const {
-        return (std::get<storage_type<Component> *>(pools)->contains(entt) && ...) && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...);
+        return reg->valid(entt) && !(std::get<const storage_type<Exclude> *>(filter)->contains(entt) || ...);
     }
 
     /**
      * @brief Returns the components assigned to the given entity.
      *
-     * Prefer this function instead of `registry::get` during iterations. It has
-     * far better performance than its counterpart.
-     *
-     * @warning
-     * Attempting to use an invalid component type results in a compilation
-     * error. Attempting to use an entity that doesn't belong to the view
-     * results in undefined behavior.
+     * Exclusion-only views don't iterate any type of component. Therefore,
+     * this function always returns an empty tuple.
      *
      * @tparam Comp Types of components to get.
-     * @param entt A valid entity identifier.
-     * @return The components assigned to the entity.
+     * @return An empty tuple.
      */
     template<typename... Comp>
-    [[nodiscard]] decltype(auto) get([[maybe_unused]] const entity_type entt) const {
-        ENTT_ASSERT(contains(entt));
-
-        if constexpr(sizeof...(Comp) == 0) {
-            return std::tuple_cat(get_as_tuple(*std::get<storage_type<Component> *>(pools), entt)...);
-        } else if constexpr(sizeof...(Comp) == 1) {
-            return (std::get<storage_type<Comp> *>(pools)->get(entt), ...);
-        } else {
-            return std::tuple_cat(get_as_tuple(*std::get<storage_type<Comp> *>(pools), entt)...);        }
+    [[nodiscard]] std::tuple<> get(const entity_type) const ENTT_NOEXCEPT {
+        static_assert(sizeof...(Comp) == 0, "Invalid component type");
+        return {};
     }
 
     /**
-     * @brief Iterates entities and components and applies the given function
-     * object to them.
+     * @brief Iterates entities and applies the given function object to them.
      *
-     * The function object is invoked for each entity. It is provided with the
-     * entity itself and a set of references to non-empty components. The
-     * _constness_ of the components is as requested.<br/>
-     * The signature of the function must be equivalent to one of the following
-     * forms:
+     * The function object is invoked for each entity. The signature of the
+     * function must be equivalent to the following form:
      *
      * @code{.cpp}
-     * void(const entity_type, Type &...);
-     * void(Type &...);
+     * void(const entity_type);
      * @endcode
      *
-     * @note
-     * Empty types aren't explicitly instantiated and therefore they are never
-     * returned during iterations.
-     *
      * @tparam Func Type of the function object to invoke.
      * @param func A valid function object.
      */
     template<typename Func>
     void each(Func func) const {
-        ((std::get<storage_type<Component> *>(pools) == view ? traverse<Component>(std::move(func)) : void()), ...);
-    }
-
-    /**
-     * @brief Iterates entities and components and applies the given function
-     * object to them.
-     *
-     * The pool of the suggested component is used to lead the iterations. The
-     * returned entities will therefore respect the order of the pool associated
-     * with that type.<br/>
-     * It is no longer guaranteed that the performance is the best possible, but
-     * there will be greater control over the order of iteration.
-     *
-     * @sa each
-     *
-     * @tparam Comp Type of component to use to drive the iteration.
-     * @tparam Func Type of the function object to invoke.
-     * @param func A valid function object.
-     */
-    template<typename Comp, typename Func>
-    void each(Func func) const {
-        use<Comp>();
-        traverse<Comp>(std::move(func));
-    }
+        ENTT_TRACE("entt::view::each", type_id<basic_view>().name());
 
-    /**
-     * @brief Returns an iterable object to use to _visit_ the view.
-     *
-     * The iterable object returns tuples that contain the current entity and a
-     * set of references to its non-empty components. The _constness_ of the
-     * components is as requested.
-     *
-     * @note
-     * Empty types aren't explicitly instantiated and therefore they are never
-     * returned during iterations.
-     *
-     * @return An iterable object to use to _visit_ the view.
-     */
-    [[nodiscard]] iterable_view each() const ENTT_NOEXCEPT {
-        return iterable_view{*this};
+        for(auto pos = reg->next_in_use({}), last = reg->size(); pos < last; pos = reg->next_in_use(pos + 1u)) {
+            if(const auto entt = reg->data()[pos]; !filtered(filter, entt)) {
+                func(entt);
+            }
+        }
     }
 
     /**
      * @brief Returns an iterable object to use to _visit_ the view.
      *
-     * The pool of the suggested component is used to lead the iterations. The
-     * returned elements will therefore respect the order of the pool associated
-     * with that type.<br/>
-     * It is no longer guaranteed that the performance is the best possible, but
-     * there will be greater control over the order of iteration.
-     *
-     * @sa each
+     * The iterable object returns tuples that contain the current entity.
      *
-     * @tparam Comp Type of component to use to drive the iteration.
      * @return An iterable object to use to _visit_ the view.
      */
-    template<typename Comp>
     [[nodiscard]] iterable_view each() const ENTT_NOEXCEPT {
-        use<Comp>();
         return iterable_view{*this};
     }
 
 private:
-    const std::tuple<storage_type<Component> *...> pools;
+    const basic_registry<Entity> *reg;
     const std::tuple<const storage_type<Exclude> *...> filter;
-    mutable const basic_sparse_set<entity_type>* view;
 };
 
 
@@ -667,6 +1398,17 @@ public:
         return pool->size();
     }
 
+    /**
+     * @brief Returns the exact number of entities iterated by the view.
+     *
+     * @sa size
+     *
+     * @return Number of entities iterated by the view.
+     */
+    [[nodiscard]] size_type count() const ENTT_NOEXCEPT {
+        return size();
+    }
+
     /**
      * @brief Checks whether a view is empty.
      * @return True if the view is empty, false otherwise.
@@ -699,6 +1441,18 @@ public:
         return pool->data();
     }
 
+    /**
+     * @brief Returns the storage for the given component.
+     *
+     * Useful to access the features of custom storage classes, such as the
+     * queries of a spatial storage.
+     *
+     * @return The storage for the given component.
+     */
+    [[nodiscard]] storage_type & storage() const ENTT_NOEXCEPT {
+        return *pool;
+    }
+
     /**
      * @brief Returns an iterator to the first entity of the view.
      *
@@ -818,11 +1572,7 @@ public:
     template<typename... Comp>
     [[nodiscard]] decltype(auto) get(const entity_type entt) const {
         if constexpr(sizeof...(Comp) == 0) {
-            if constexpr(std::is_same_v<typename storage_type::storage_category, empty_storage_tag>) {
-                return std::make_tuple();
-            } else {
-                return std::forward_as_tuple(pool->get(entt));
-            }
+            return get_as_tuple(*pool, entt);
         } else {
             static_assert(std::is_same_v<Comp..., Component>, "Invalid component type");
             return pool->get(entt);
@@ -853,6 +1603,8 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
+        ENTT_TRACE("entt::view::each", type_id<basic_view>().name());
+
         if constexpr(std::is_same_v<typename storage_type::storage_category, empty_storage_tag>) {
             if constexpr(std::is_invocable_v<Func>) {
                 for(auto pos = pool->size(); pos; --pos) {
@@ -893,6 +1645,160 @@ public:
         return iterable_view{*pool};
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool is split in chunks of contiguous elements and each chunk is
+     * offered to the executor as a separate task.<br/>
+     * The executor must offer an `operator()` that accepts the number of tasks
+     * and a function object to invoke once for each index in `[0, count)`. The
+     * signature of the executor should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Tasks can run concurrently but the executor must not return before all
+     * of them have completed.
+     *
+     * @sa each
+     *
+     * @warning
+     * The function object is invoked concurrently from different threads.
+     * Creating or destroying components of the iterated type during a parallel
+     * iteration results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param chunk Number of elements iterated by each task.
+     */
+    template<typename Exec, typename Func>
+    void par_each(Exec executor, Func func, const size_type chunk = basic_sparse_set<entity_type>::chunk_size) const {
+        ENTT_ASSERT(chunk);
+        const auto length = pool->size();
+
+        if(const auto count = (length + chunk - 1u) / chunk; count) {
+            executor(count, [this, &func, length, chunk](const size_type pos) {
+                const auto from = pos * chunk;
+                const auto first = begin() + from;
+                const auto last = first + ((std::min)(from + chunk, length) - from);
+
+                if constexpr(std::is_same_v<typename storage_type::storage_category, empty_storage_tag>) {
+                    for(auto curr = first; curr != last; ++curr) {
+                        if constexpr(std::is_invocable_v<Func, entity_type>) {
+                            func(*curr);
+                        } else {
+                            func();
+                        }
+                    }
+                } else {
+                    auto it = pool->begin() + from;
+
+                    for(auto curr = first; curr != last; ++curr, ++it) {
+                        if constexpr(is_applicable_v<Func, decltype(*each().begin())>) {
+                            func(*curr, *it);
+                        } else {
+                            func(*it);
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in batches and applies the
+     * given function object to them.
+     *
+     * The pool is split in batches of `Size` contiguous elements, the last of
+     * which can be shorter. The function object is invoked once per batch and
+     * it's provided with a pointer to the entities, a pointer to the components
+     * if the type is non-empty and the number of elements in the batch. The
+     * signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, Component *, Count);
+     * void(const entity_type *, Count);
+     * @endcode
+     *
+     * Where `Count` is `std::integral_constant<size_type, Size>` for full
+     * batches and `size_type` for the last one, if shorter. Both convert to
+     * `size_type`, though generic function objects get loops with a trip count
+     * known at compile-time for full batches, that compilers can unroll and
+     * vectorize.
+     *
+     * @note
+     * Batches follow the order of the packed arrays, that is the reverse of the
+     * one of the iterators returned by `begin` and `end`.
+     *
+     * @tparam Size Number of elements in full batches.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<size_type Size, typename Func>
+    void each_batch(Func func) const {
+        static_assert(Size != 0u, "Invalid batch size");
+        static_assert(!std::is_same_v<typename storage_type::storage_category, split_storage_tag>, "Split storage cannot be iterated in batches");
+        ENTT_TRACE("entt::view::each_batch", type_id<basic_view>().name());
+
+        const auto invoke = [this, &func](const size_type from, const auto count) {
+            if constexpr(std::is_same_v<typename storage_type::storage_category, empty_storage_tag>) {
+                func(pool->data() + from, count);
+            } else {
+                func(pool->data() + from, pool->raw() + from, count);
+            }
+        };
+
+        const auto length = pool->size();
+        size_type pos{};
+
+        for(; (length - pos) >= Size; pos += Size) {
+            invoke(pos, std::integral_constant<size_type, Size>{});
+        }
+
+        if(pos != length) {
+            invoke(pos, length - pos);
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components that changed after a tick and
+     * applies the given function object to them.
+     *
+     * The pool must track changes, as an example by means of a
+     * `tick_storage_mixin`.
+     *
+     * @sa each
+     * @sa tick_storage_mixin
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_changed_since(const std::uint64_t since, Func func) const {
+        internal::traverse_since(each(), [this, since](const auto entt) { return pool->changed_since(entt, since); }, std::move(func));
+    }
+
+    /**
+     * @brief Iterates entities and components that were created after a tick
+     * and applies the given function object to them.
+     *
+     * @sa each_changed_since
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick, usually returned by `basic_registry::advance_tick`.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_added_since(const std::uint64_t since, Func func) const {
+        internal::traverse_since(each(), [this, since](const auto entt) { return pool->added_since(entt, since); }, std::move(func));
+    }
+
 private:
     storage_type *pool;
 };
@@ -24,8 +24,20 @@ namespace entt {
  * intended primary use is for custom storage and views, but it can also be very
  * convenient in everyday use.
  *
- * @tparam View Type of the leading view of the pack.
- * @tparam Other Types of all other views of the pack.
+ * Groups can be combined in a pack as well. In particular, a full-owning group
+ * that leads a pack makes it iterate entities in the packed order of the group
+ * and filter them with the other members.
+ *
+ * Iterators are bidirectional when those of the leading view are at least
+ * bidirectional and forward iterators otherwise, so that packs can be used also
+ * with the algorithms of the standard library that make multiple passes.
+ *
+ * @warning
+ * Iterators refer to the pack that returned them. Therefore, they are
+ * invalidated as soon as the pack is destroyed.
+ *
+ * @tparam View Type of the leading view or group of the pack.
+ * @tparam Other Types of all other views or groups of the pack.
  */
 template<typename View, typename... Other>
 class view_pack {
@@ -33,10 +45,13 @@ class view_pack {
     class view_pack_iterator final {
         friend class view_pack<View, Other...>;
 
-        view_pack_iterator(It from, It to, const std::tuple<View, Other...> &ref) ENTT_NOEXCEPT
-            : it{from},
+        using category = typename std::iterator_traits<It>::iterator_category;
+
+        view_pack_iterator(It from, It to, It curr, const std::tuple<View, Other...> &ref) ENTT_NOEXCEPT
+            : first{from},
               last{to},
-              pack{std::get<Other>(ref)...}
+              it{curr},
+              pack{&ref}
         {
             if(it != last && !valid()) {
                 ++(*this);
@@ -45,7 +60,7 @@ class view_pack {
 
         [[nodiscard]] bool valid() const {
             const auto entity = *it;
-            return (std::get<Other>(pack).contains(entity) && ...);
+            return (std::get<Other>(*pack).contains(entity) && ...);
         }
 
     public:
@@ -53,7 +68,9 @@ class view_pack {
         using value_type = typename std::iterator_traits<It>::value_type;
         using pointer = typename std::iterator_traits<It>::pointer;
         using reference = typename std::iterator_traits<It>::reference;
-        using iterator_category = std::input_iterator_tag;
+        using iterator_category = std::conditional_t<std::is_base_of_v<std::bidirectional_iterator_tag, category>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+
+        view_pack_iterator() ENTT_NOEXCEPT = default;
 
         view_pack_iterator & operator++() ENTT_NOEXCEPT {
             while(++it != last && !valid());
@@ -65,6 +82,24 @@ class view_pack {
             return ++(*this), orig;
         }
 
+        template<typename Category = category>
+        std::enable_if_t<std::is_base_of_v<std::bidirectional_iterator_tag, Category>, view_pack_iterator &>
+        operator--() ENTT_NOEXCEPT {
+            while(--it != first && !valid());
+            return *this;
+        }
+
+        template<typename Category = category>
+        std::enable_if_t<std::is_base_of_v<std::bidirectional_iterator_tag, Category>, view_pack_iterator>
+        operator--(int) ENTT_NOEXCEPT {
+            view_pack_iterator orig = *this;
+            return operator--(), orig;
+        }
+
+        [[nodiscard]] pointer operator->() const {
+            return &*it;
+        }
+
         [[nodiscard]] reference operator*() const {
             return *it;
         }
@@ -78,9 +113,10 @@ class view_pack {
         }
 
     private:
+        It first;
+        It last;
         It it;
-        const It last;
-        const std::tuple<Other...> pack;
+        const std::tuple<View, Other...> *pack;
     };
 
     class iterable_view_pack final {
@@ -173,12 +209,22 @@ class view_pack {
         std::tuple<Other...> pack;
     };
 
+    template<typename Type>
+    [[nodiscard]] static auto estimate(const Type &view, choice_t<1>) -> decltype(view.size()) {
+        return view.size();
+    }
+
+    template<typename Type>
+    [[nodiscard]] static auto estimate(const Type &view, choice_t<0>) -> decltype(view.size_hint()) {
+        return view.size_hint();
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = std::common_type_t<typename View::entity_type, typename Other::entity_type...>;
     /*! @brief Underlying entity identifier. */
     using size_type = std::common_type_t<typename View::size_type, typename Other::size_type...>;
-    /*! @brief Input iterator type. */
+    /*! @brief Bidirectional or forward iterator type. */
     using iterator = view_pack_iterator<typename View::iterator>;
     /*! @brief Reversed iterator type. */
     using reverse_iterator = view_pack_iterator<typename View::reverse_iterator>;
@@ -192,6 +238,18 @@ public:
         : pack{view, other...}
     {}
 
+    /**
+     * @brief Estimates the number of entities iterated by the pack.
+     *
+     * The estimate is the number of entities of the leading view, that is an
+     * upper bound for the number of entities returned by the pack.
+     *
+     * @return Estimated number of entities iterated by the pack.
+     */
+    [[nodiscard]] size_type size_hint() const {
+        return estimate(std::get<View>(pack), choice<1>);
+    }
+
     /**
      * @brief Returns an iterator to the first entity of the pack.
      *
@@ -201,7 +259,7 @@ public:
      * @return An iterator to the first entity of the pack.
      */
     [[nodiscard]] iterator begin() const ENTT_NOEXCEPT {
-        return { std::get<View>(pack).begin(), std::get<View>(pack).end(), pack };
+        return { std::get<View>(pack).begin(), std::get<View>(pack).end(), std::get<View>(pack).begin(), pack };
     }
 
     /**
@@ -214,7 +272,7 @@ public:
      * @return An iterator to the entity following the last entity of the pack.
      */
     [[nodiscard]] iterator end() const ENTT_NOEXCEPT {
-        return { std::get<View>(pack).end(), std::get<View>(pack).end(), pack };
+        return { std::get<View>(pack).begin(), std::get<View>(pack).end(), std::get<View>(pack).end(), pack };
     }
 
     /**
@@ -226,7 +284,7 @@ public:
      * @return An iterator to the first entity of the pack.
      */
     [[nodiscard]] reverse_iterator rbegin() const {
-        return { std::get<View>(pack).rbegin(), std::get<View>(pack).rend(), pack };
+        return { std::get<View>(pack).rbegin(), std::get<View>(pack).rend(), std::get<View>(pack).rbegin(), pack };
     }
 
     /**
@@ -241,7 +299,7 @@ public:
      * reversed pack.
      */
     [[nodiscard]] reverse_iterator rend() const {
-        return { std::get<View>(pack).rend(), std::get<View>(pack).rend(), pack };
+        return { std::get<View>(pack).rbegin(), std::get<View>(pack).rend(), std::get<View>(pack).rend(), pack };
     }
 
     /**
@@ -271,7 +329,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const {
-        iterator it{std::get<View>(pack).find(entt), std::get<View>(pack).end(), pack};
+        iterator it{std::get<View>(pack).begin(), std::get<View>(pack).end(), std::get<View>(pack).find(entt), pack};
         return (it != end() && *it == entt) ? it : end();
     }
 
@@ -388,6 +446,17 @@ public:
         return std::make_from_tuple<view_pack<View, Other..., basic_view<Args...>>>(std::tuple_cat(pack, std::make_tuple(view)));
     }
 
+    /**
+     * @brief Appends a group to a pack.
+     * @tparam Args Group template arguments.
+     * @param group A reference to a group to append to the pack.
+     * @return The extended pack.
+     */
+    template<typename... Args>
+    [[nodiscard]] auto operator|(const basic_group<Args...> &group) const {
+        return std::make_from_tuple<view_pack<View, Other..., basic_group<Args...>>>(std::tuple_cat(pack, std::make_tuple(group)));
+    }
+
     /**
      * @brief Appends a pack and therefore all its views to another pack.
      * @tparam Pack Types of views of the pack to append.
@@ -432,6 +501,64 @@ template<typename... Args, typename... Pack>
 }
 
 
+/**
+ * @brief Combines a group and a view in a pack.
+ * @tparam Args Group template arguments.
+ * @tparam Other View template arguments.
+ * @param lhs A reference to the group with which to create the pack.
+ * @param rhs A reference to the view with which to create the pack.
+ * @return A pack that combines the group and the view in a single iterable
+ * object.
+ */
+template<typename... Args, typename... Other>
+[[nodiscard]] auto operator|(const basic_group<Args...> &lhs, const basic_view<Other...> &rhs) {
+    return view_pack{lhs, rhs};
+}
+
+
+/**
+ * @brief Combines a view and a group in a pack.
+ * @tparam Args View template arguments.
+ * @tparam Other Group template arguments.
+ * @param lhs A reference to the view with which to create the pack.
+ * @param rhs A reference to the group with which to create the pack.
+ * @return A pack that combines the view and the group in a single iterable
+ * object.
+ */
+template<typename... Args, typename... Other>
+[[nodiscard]] auto operator|(const basic_view<Args...> &lhs, const basic_group<Other...> &rhs) {
+    return view_pack{lhs, rhs};
+}
+
+
+/**
+ * @brief Combines two groups in a pack.
+ * @tparam Args Template arguments of the first group.
+ * @tparam Other Template arguments of the second group.
+ * @param lhs A reference to the first group with which to create the pack.
+ * @param rhs A reference to the second group with which to create the pack.
+ * @return A pack that combines the two groups in a single iterable object.
+ */
+template<typename... Args, typename... Other>
+[[nodiscard]] auto operator|(const basic_group<Args...> &lhs, const basic_group<Other...> &rhs) {
+    return view_pack{lhs, rhs};
+}
+
+
+/**
+ * @brief Combines a group with a pack.
+ * @tparam Args Group template arguments.
+ * @tparam Pack Types of views of the pack.
+ * @param group A reference to the group to combine with the pack.
+ * @param pack A reference to the pack to combine with the group.
+ * @return The extended pack.
+ */
+template<typename... Args, typename... Pack>
+[[nodiscard]] auto operator|(const basic_group<Args...> &group, const view_pack<Pack...> &pack) {
+    return view_pack{group} | pack;
+}
+
+
 }
 
 
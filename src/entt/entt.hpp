@@ -4,27 +4,46 @@
 #include "core/family.hpp"
 #include "core/hashed_string.hpp"
 #include "core/ident.hpp"
+#include "core/memory.hpp"
 #include "core/monostate.hpp"
+#include "core/string_pool.hpp"
+#include "core/thread_pool.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/command_buffer.hpp"
 #include "entity/entity.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
+#include "entity/image.hpp"
+#include "entity/mailbox.hpp"
+#include "entity/meta_view.hpp"
+#include "entity/multi_storage.hpp"
 #include "entity/observer.hpp"
 #include "entity/organizer.hpp"
+#include "entity/query.hpp"
 #include "entity/registry.hpp"
+#include "entity/rollback.hpp"
+#include "entity/runtime_storage.hpp"
 #include "entity/runtime_view.hpp"
+#include "entity/sharded.hpp"
+#include "entity/signature.hpp"
 #include "entity/snapshot.hpp"
+#include "entity/spatial.hpp"
+#include "entity/spawner.hpp"
 #include "entity/sparse_set.hpp"
+#include "entity/stage.hpp"
 #include "entity/storage.hpp"
+#include "entity/telemetry.hpp"
 #include "entity/utility.hpp"
 #include "entity/view.hpp"
 #include "entity/view_pack.hpp"
 #include "locator/locator.hpp"
+#include "meta/archive.hpp"
 #include "meta/container.hpp"
 #include "meta/ctx.hpp"
+#include "meta/descriptor.hpp"
 #include "meta/factory.hpp"
 #include "meta/internal.hpp"
 #include "meta/meta.hpp"
@@ -34,11 +53,14 @@
 #include "meta/resolve.hpp"
 #include "meta/type_traits.hpp"
 #include "platform/android-ndk-r17.hpp"
+#include "process/co_process.hpp"
 #include "process/process.hpp"
 #include "process/scheduler.hpp"
 #include "resource/cache.hpp"
 #include "resource/handle.hpp"
 #include "resource/loader.hpp"
+#include "resource/pool.hpp"
+#include "signal/concurrent_dispatcher.hpp"
 #include "signal/delegate.hpp"
 #include "signal/dispatcher.hpp"
 #include "signal/emitter.hpp"
@@ -2,6 +2,7 @@
 #define ENTT_LOCATOR_LOCATOR_HPP
 
 
+#include <atomic>
 #include <memory>
 #include <utility>
 #include "../config/config.h"
@@ -105,6 +106,115 @@ private:
 };
 
 
+/**
+ * @brief Service locator based on plain pointers.
+ *
+ * Lightweight alternative to the shared pointer based service locator. The
+ * service is published through an atomic pointer, therefore accessing it
+ * doesn't touch any reference count and is lock-free.<br/>
+ * Services are either owned by the locator or provided by the users, in which
+ * case the latter are in charge of their lifetime.
+ *
+ * @warning
+ * Replacing or resetting a service while other threads are using it results in
+ * undefined behavior. Only lookups are safe to run concurrently.
+ *
+ * @tparam Service Type of service managed by the locator.
+ */
+template<typename Service>
+struct atomic_service_locator {
+    /*! @brief Type of service offered. */
+    using service_type = Service;
+
+    /*! @brief Default constructor, deleted on purpose. */
+    atomic_service_locator() = delete;
+    /*! @brief Default destructor, deleted on purpose. */
+    ~atomic_service_locator() = delete;
+
+    /**
+     * @brief Tests if a valid service implementation is set.
+     * @return True if the service is set, false otherwise.
+     */
+    [[nodiscard]] static bool empty() ENTT_NOEXCEPT {
+        return (service.load(std::memory_order_acquire) == nullptr);
+    }
+
+    /**
+     * @brief Returns a pointer to a service implementation, if any.
+     *
+     * Clients of a service shouldn't retain references to it. The recommended
+     * way is to retrieve the service implementation currently set each and
+     * every time the need of using it arises. Otherwise users can incur in
+     * unexpected behaviors.
+     *
+     * @return A pointer to the service implementation currently set, if any.
+     */
+    [[nodiscard]] static Service * get() ENTT_NOEXCEPT {
+        return service.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns a reference to a service implementation.
+     *
+     * @warning
+     * In case no service implementation has been set, a call to this function
+     * results in undefined behavior.
+     *
+     * @return A reference to the service implementation currently set.
+     */
+    [[nodiscard]] static Service & ref() ENTT_NOEXCEPT {
+        auto *instance = service.load(std::memory_order_acquire);
+        ENTT_ASSERT(instance);
+        return *instance;
+    }
+
+    /**
+     * @brief Sets or replaces a service owned by the locator.
+     * @tparam Impl Type of the new service to use.
+     * @tparam Args Types of arguments to use to construct the service.
+     * @param args Parameters to use to construct the service.
+     */
+    template<typename Impl = Service, typename... Args>
+    static void set(Args &&... args) {
+        owner_type other{new Impl(std::forward<Args>(args)...), [](Service *instance) { delete static_cast<Impl *>(instance); }};
+        service.store(other.get(), std::memory_order_release);
+        owner.swap(other);
+    }
+
+    /**
+     * @brief Sets or replaces a service not owned by the locator.
+     *
+     * The locator isn't responsible for the service. Users must guarantee that
+     * its lifetime overcomes the one of the locator or that the service is
+     * reset before it's destroyed.
+     *
+     * @param instance Service to use to replace the current one.
+     */
+    static void set(Service *instance) {
+        ENTT_ASSERT(instance);
+        service.store(instance, std::memory_order_release);
+        owner.reset();
+    }
+
+    /**
+     * @brief Resets a service.
+     *
+     * The service is no longer valid after a reset. Services owned by the
+     * locator are also destroyed.
+     */
+    static void reset() {
+        service.store(nullptr, std::memory_order_release);
+        owner.reset();
+    }
+
+private:
+    using owner_type = std::unique_ptr<Service, void(*)(Service *)>;
+
+    inline static std::atomic<Service *> service = nullptr;
+    inline static owner_type owner{nullptr, [](Service *) {}};
+};
+
+
 }
 
 
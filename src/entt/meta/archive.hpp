@@ -0,0 +1,364 @@
+#ifndef ENTT_META_ARCHIVE_HPP
+#define ENTT_META_ARCHIVE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "internal.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Flat layout of the reflected data members of a type.
+ *
+ * A layout is a list of byte ranges within an instance of a type, one for
+ * each reflected data member. Members of reflected types and of the reflected
+ * base classes are expanded recursively, adjacent ranges are merged. Once
+ * compiled, a layout copies arrays of objects to and from a buffer without
+ * resorting to `meta_any`.<br/>
+ * Types made of a single range as large as the type itself are copied with a
+ * single `memcpy` for the whole array.
+ *
+ * @warning
+ * Reflected data members must be plain data members of arithmetic types,
+ * enums, arrays thereof or other reflected types of the same kind. Data
+ * members with custom setters or getters can't be accessed in place and
+ * result in undefined behavior.
+ */
+class meta_layout {
+    struct step_type {
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    [[nodiscard]] static bool is_flat(const internal::meta_type_node *node) ENTT_NOEXCEPT {
+        return node->is_integral || node->is_floating_point || node->is_enum || (node->is_array && is_flat(node->remove_extent()));
+    }
+
+    void compile(const internal::meta_type_node *node, const void *object, const void *instance) {
+        if(is_flat(node)) {
+            const auto offset = static_cast<const std::byte *>(instance) - static_cast<const std::byte *>(object);
+            steps.push_back({static_cast<std::size_t>(offset), node->size_of});
+        } else {
+            ENTT_ASSERT(node->base || node->data);
+
+            for(auto &&curr: internal::meta_range{node->base}) {
+                compile(curr.type(), object, curr.cast(instance));
+            }
+
+            for(auto &&curr: internal::meta_range{node->data}) {
+                if(!curr.is_static) {
+                    ENTT_ASSERT(curr.address);
+                    compile(curr.type(), object, curr.address(instance));
+                }
+            }
+        }
+    }
+
+    void merge() {
+        std::sort(steps.begin(), steps.end(), [](const auto &lhs, const auto &rhs) { return lhs.offset < rhs.offset; });
+
+        for(auto pos = steps.size(); pos > 1u; --pos) {
+            if(auto &prev = steps[pos - 2u]; prev.offset + prev.size == steps[pos - 1u].offset) {
+                prev.size += steps[pos - 1u].size;
+                steps.erase(steps.begin() + (pos - 1u));
+            }
+        }
+
+        for(auto &&curr: steps) {
+            length += curr.size;
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    meta_layout() = default;
+
+    /**
+     * @brief Compiles the layout of a type.
+     *
+     * An instance is required to find out where data members are, the layout
+     * is valid for all the instances of the same type.
+     *
+     * @tparam Type Type of the instance.
+     * @param instance A valid instance of the type to compile.
+     */
+    template<typename Type>
+    explicit meta_layout(const Type &instance)
+        : steps{},
+          stride{sizeof(Type)},
+          length{}
+    {
+        compile(internal::meta_info<Type>::resolve(), &instance, &instance);
+        merge();
+    }
+
+    /**
+     * @brief Returns the number of bytes written per object.
+     * @return The number of bytes written per object.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+    /**
+     * @brief Checks whether objects are copied with a single range.
+     * @return True if objects have no padding nor unreflected members.
+     */
+    [[nodiscard]] bool packed() const ENTT_NOEXCEPT {
+        return (length == stride) && (steps.size() == 1u);
+    }
+
+    /**
+     * @brief Copies the reflected members of an array of objects to a buffer.
+     * @param first A pointer to the first element of the array of objects.
+     * @param count The number of objects to copy.
+     * @param out A buffer large enough to contain the objects.
+     */
+    void save(const void *first, const size_type count, std::byte *out) const {
+        const auto *src = static_cast<const std::byte *>(first);
+
+        if(packed()) {
+            std::memcpy(out, src, count * stride);
+        } else {
+            for(size_type pos{}; pos < count; ++pos, src += stride) {
+                for(auto &&curr: steps) {
+                    std::memcpy(out, src + curr.offset, curr.size);
+                    out += curr.size;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the reflected members of an array of objects from a
+     * buffer.
+     * @param in A buffer that contains the objects.
+     * @param count The number of objects to copy.
+     * @param first A pointer to the first element of the array of objects.
+     */
+    void load(const std::byte *in, const size_type count, void *first) const {
+        auto *dst = static_cast<std::byte *>(first);
+
+        if(packed()) {
+            std::memcpy(dst, in, count * stride);
+        } else {
+            for(size_type pos{}; pos < count; ++pos, dst += stride) {
+                for(auto &&curr: steps) {
+                    std::memcpy(dst + curr.offset, in, curr.size);
+                    in += curr.size;
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<step_type> steps{};
+    size_type stride{};
+    size_type length{};
+};
+
+
+/**
+ * @brief Binary output archive driven by reflection.
+ *
+ * Arithmetic types and enums, entity identifiers among them, are written as
+ * they are. Objects of any other type are written by means of their layouts,
+ * that are compiled the first time a type is met.<br/>
+ * The archive offers the block interface of snapshots, therefore pools are
+ * written one array at a time rather than one object at a time.
+ *
+ * @sa meta_layout
+ */
+class meta_output_archive {
+    template<typename Type>
+    void write(const Type *instance, const std::size_t count) {
+        if constexpr(std::is_arithmetic_v<Type> || std::is_enum_v<Type>) {
+            const auto offset = storage.size();
+            storage.resize(offset + count * sizeof(Type));
+            std::memcpy(storage.data() + offset, instance, count * sizeof(Type));
+        } else if constexpr(!std::is_empty_v<Type>) {
+            if(count) {
+                auto it = layouts.find(type_hash<Type>::value());
+
+                if(it == layouts.end()) {
+                    it = layouts.emplace(type_hash<Type>::value(), meta_layout{*instance}).first;
+                }
+
+                const auto offset = storage.size();
+                storage.resize(offset + count * it->second.size());
+                it->second.save(instance, count, storage.data() + offset);
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Writes the given values.
+     * @tparam Type Types of values to write.
+     * @param value Values to write.
+     */
+    template<typename... Type>
+    void operator()(const Type &... value) {
+        (write(&value, 1u), ...);
+    }
+
+    /**
+     * @brief Writes a range of entities and their components, if any.
+     * @tparam Entity Type of entities to write.
+     * @tparam Type Type of components to write.
+     * @param first A pointer to the first entity of the range.
+     * @param last A pointer past the last entity of the range.
+     * @param instance A pointer to the first component, if any.
+     */
+    template<typename Entity, typename Type>
+    void block(const Entity *first, const Entity *last, const Type *instance) {
+        const auto count = static_cast<size_type>(last - first);
+        write(first, count);
+
+        if(instance) {
+            write(instance, count);
+        }
+    }
+
+    /**
+     * @brief Returns the bytes written so far.
+     * @return A pointer to the bytes written so far.
+     */
+    [[nodiscard]] const std::byte * data() const ENTT_NOEXCEPT {
+        return storage.data();
+    }
+
+    /**
+     * @brief Returns the number of bytes written so far.
+     * @return The number of bytes written so far.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return storage.size();
+    }
+
+    /*! @brief Discards the bytes written so far. */
+    void clear() ENTT_NOEXCEPT {
+        storage.clear();
+    }
+
+private:
+    std::vector<std::byte> storage{};
+    std::unordered_map<id_type, meta_layout> layouts{};
+};
+
+
+/**
+ * @brief Binary input archive driven by reflection.
+ *
+ * Counterpart of the output archive. It reads the values and the blocks of
+ * objects written by an output archive in the same order, by means of the same
+ * layouts.
+ *
+ * @warning
+ * The buffer must outlive the archive. Reading past its end results in
+ * undefined behavior.
+ *
+ * @sa meta_output_archive
+ */
+class meta_input_archive {
+    template<typename Type>
+    void read(Type *instance, const std::size_t count) {
+        if constexpr(std::is_arithmetic_v<Type> || std::is_enum_v<Type>) {
+            ENTT_ASSERT(pos + count * sizeof(Type) <= length);
+            std::memcpy(instance, buffer + pos, count * sizeof(Type));
+            pos += count * sizeof(Type);
+        } else if constexpr(!std::is_empty_v<Type>) {
+            if(count) {
+                auto it = layouts.find(type_hash<Type>::value());
+
+                if(it == layouts.end()) {
+                    it = layouts.emplace(type_hash<Type>::value(), meta_layout{*instance}).first;
+                }
+
+                ENTT_ASSERT(pos + count * it->second.size() <= length);
+                it->second.load(buffer + pos, count, instance);
+                pos += count * it->second.size();
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an archive that reads from a given buffer.
+     * @param data A pointer to the first byte of the buffer.
+     * @param size The size of the buffer, in bytes.
+     */
+    meta_input_archive(const std::byte *data, const size_type size) ENTT_NOEXCEPT
+        : buffer{data},
+          length{size},
+          pos{},
+          layouts{}
+    {}
+
+    /**
+     * @brief Reads the given values.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &... value) {
+        (read(&value, 1u), ...);
+    }
+
+    /**
+     * @brief Reads a range of entities and their components, if any.
+     * @tparam Entity Type of entities to read.
+     * @tparam Type Type of components to read.
+     * @param first A pointer to the first entity of the range.
+     * @param last A pointer past the last entity of the range.
+     * @param instance A pointer to the first component, if any.
+     */
+    template<typename Entity, typename Type>
+    void block(Entity *first, Entity *last, Type *instance) {
+        const auto count = static_cast<size_type>(last - first);
+        read(first, count);
+
+        if(instance) {
+            read(instance, count);
+        }
+    }
+
+    /**
+     * @brief Returns the number of bytes still to read.
+     * @return The number of bytes still to read.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return length - pos;
+    }
+
+private:
+    const std::byte *buffer;
+    size_type length;
+    size_type pos;
+    std::unordered_map<id_type, meta_layout> layouts;
+};
+
+
+}
+
+
+#endif
@@ -144,6 +144,23 @@ struct basic_sequence_container {
 };
 
 
+/**
+ * @brief STL-compatible contiguous sequence container traits
+ * @tparam Container The type of the container.
+ */
+template<typename Container>
+struct contiguous_sequence_container {
+    /**
+     * @brief Returns a pointer to the underlying array of the given container.
+     * @param cont The container for which to return the array.
+     * @return A pointer to the first element of the given container.
+     */
+    [[nodiscard]] static auto data(Container &cont) ENTT_NOEXCEPT -> decltype(cont.data()) {
+        return cont.data();
+    }
+};
+
+
 /**
  * @brief STL-compatible dynamic associative key-only container traits
  * @tparam Container The type of the container.
@@ -277,6 +294,7 @@ struct meta_sequence_container_traits<std::vector<Type, Args...>>
             basic_container,
             basic_dynamic_container,
             basic_sequence_container,
+            contiguous_sequence_container,
             dynamic_sequence_container
         >
 {};
@@ -293,6 +311,7 @@ struct meta_sequence_container_traits<std::array<Type, N>>
             std::array<Type, N>,
             basic_container,
             basic_sequence_container,
+            contiguous_sequence_container,
             fixed_sequence_container
         >
 {};
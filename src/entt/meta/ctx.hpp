@@ -2,8 +2,10 @@
 #define ENTT_META_CTX_HPP
 
 
+#include <cstddef>
 #include "../core/attribute.h"
 #include "../config/config.h"
+#include "internal.hpp"
 
 
 namespace entt {
@@ -18,10 +20,21 @@ namespace entt {
 namespace internal {
 
 
-struct meta_type_node;
+struct ENTT_API meta_context {
+    struct type_index {
+        void rebuild(meta_type_node **chain) {
+            ctx = chain;
+            types.clear();
 
+            for(auto &&curr: meta_range{*chain}) {
+                types.insert(&curr);
+            }
+        }
+
+        meta_type_node **ctx{nullptr};
+        meta_index<meta_type_node> types{};
+    };
 
-struct ENTT_API meta_context {
     // we could use the lines below but VS2017 returns with an ICE if combined with ENTT_API despite the code being valid C++
     //     inline static meta_type_node *local = nullptr;
     //     inline static meta_type_node **global = &local;
@@ -35,6 +48,18 @@ struct ENTT_API meta_context {
         static meta_type_node **chain = &local();
         return chain;
     }
+
+    // types registered from other contexts aren't indexed, lookups fall back to a linear search for them
+    [[nodiscard]] static type_index & index() ENTT_NOEXCEPT {
+        static type_index instance{};
+        return instance;
+    }
+
+    // bumped whenever functions, bases or conversions change, so as to invalidate the caches of overloads
+    [[nodiscard]] static std::size_t & revision() ENTT_NOEXCEPT {
+        static std::size_t value{};
+        return value;
+    }
 };
 
 
@@ -0,0 +1,215 @@
+#ifndef ENTT_META_DESCRIPTOR_HPP
+#define ENTT_META_DESCRIPTOR_HPP
+
+
+#include <tuple>
+#include <utility>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "factory.hpp"
+#include "policy.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Describes a base class of a reflected type.
+ * @tparam Base Type of the base class.
+ */
+template<typename Base>
+struct meta_base_desc {};
+
+
+/**
+ * @brief Describes a conversion function of a reflected type.
+ * @tparam To Type of the conversion function.
+ */
+template<typename To>
+struct meta_conv_desc {};
+
+
+/**
+ * @brief Describes a constructor of a reflected type.
+ * @tparam Args Types of arguments to use to construct an instance.
+ */
+template<typename... Args>
+struct meta_ctor_desc {};
+
+
+/**
+ * @brief Describes a data member of a reflected type.
+ * @tparam Id Unique identifier of the data member.
+ * @tparam Data The actual variable to attach to the meta type.
+ * @tparam Policy Optional policy (no policy set by default).
+ */
+template<id_type Id, auto Data, typename Policy = as_is_t>
+struct meta_data_desc {};
+
+
+/**
+ * @brief Describes a member function of a reflected type.
+ * @tparam Id Unique identifier of the member function.
+ * @tparam Candidate The actual function to attach to the meta type.
+ * @tparam Policy Optional policy (no policy set by default).
+ */
+template<id_type Id, auto Candidate, typename Policy = as_is_t>
+struct meta_func_desc {};
+
+
+/**
+ * @brief Describes a property of a reflected type.
+ * @tparam Key Key of the property.
+ * @tparam Value Optional value of the property.
+ */
+template<auto Key, auto... Value>
+struct meta_prop_desc {
+    static_assert(sizeof...(Value) < 2u, "Invalid property");
+};
+
+
+/**
+ * @brief Compile-time description of a reflected type.
+ *
+ * A descriptor is a plain type that lists all the meta objects to attach to a
+ * meta type. It holds no data and it doesn't require any static initialization.
+ * The meta objects are created only when the descriptor is loaded.
+ *
+ * @sa meta_load
+ *
+ * @tparam Id Unique identifier of the reflected type.
+ * @tparam Part Types of meta objects to attach to the meta type.
+ */
+template<id_type Id, typename... Part>
+struct meta_descriptor {};
+
+
+/**
+ * @brief Customization point for compile-time descriptors.
+ *
+ * Users can specialize this class for their types and make the
+ * specializations inherit from a meta descriptor.
+ *
+ * @tparam Type Type to describe.
+ */
+template<typename Type>
+struct meta_type_t;
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type, typename Base>
+void meta_load_part(meta_base_desc<Base>) {
+    meta<Type>().template base<Base>();
+}
+
+
+template<typename Type, typename To>
+void meta_load_part(meta_conv_desc<To>) {
+    meta<Type>().template conv<To>();
+}
+
+
+template<typename Type, typename... Args>
+void meta_load_part(meta_ctor_desc<Args...>) {
+    meta<Type>().template ctor<Args...>();
+}
+
+
+template<typename Type, id_type Id, auto Data, typename Policy>
+void meta_load_part(meta_data_desc<Id, Data, Policy>) {
+    meta<Type>().template data<Data, Policy>(Id);
+}
+
+
+template<typename Type, id_type Id, auto Candidate, typename Policy>
+void meta_load_part(meta_func_desc<Id, Candidate, Policy>) {
+    meta<Type>().template func<Candidate, Policy>(Id);
+}
+
+
+template<typename Type, auto Key, auto... Value>
+void meta_load_part(meta_prop_desc<Key, Value...>) {}
+
+
+template<typename Part>
+[[nodiscard]] constexpr std::tuple<> meta_prop_of(Part) ENTT_NOEXCEPT {
+    return {};
+}
+
+
+template<auto Key, auto... Value>
+[[nodiscard]] constexpr auto meta_prop_of(meta_prop_desc<Key, Value...>) ENTT_NOEXCEPT {
+    if constexpr(sizeof...(Value) == 0) {
+        return std::make_tuple(Key);
+    } else {
+        return std::make_tuple(std::make_pair(Key, Value...));
+    }
+}
+
+
+template<typename Type, id_type Id, typename... Part>
+void meta_load(meta_descriptor<Id, Part...>) {
+    // properties are assigned all at once, so that the factory of the type can tell them apart
+    [[maybe_unused]] auto property = std::tuple_cat(meta_prop_of(Part{})...);
+
+    if constexpr(std::tuple_size_v<decltype(property)> == 0u) {
+        meta<Type>().type(Id);
+    } else {
+        std::apply([](auto... curr) { meta<Type>().type(Id).props(curr...); }, property);
+    }
+
+    (meta_load_part<Type>(Part{}), ...);
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Reflects a set of types from their compile-time descriptors.
+ *
+ * Descriptors are walked once and the meta objects they list are attached to
+ * the meta types in a single pass. This function invokes the meta factories
+ * under the hood, therefore the meta nodes are created and linked at runtime,
+ * exactly as if the types were reflected by hand.
+ *
+ * Example of use:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::meta_type_t<my_type>: entt::meta_descriptor<
+ *     "my_type"_hs,
+ *     entt::meta_ctor_desc<int>,
+ *     entt::meta_data_desc<"value"_hs, &my_type::value>,
+ *     entt::meta_func_desc<"get"_hs, &my_type::get>
+ * > {};
+ *
+ * entt::meta_load<my_type>();
+ * @endcode
+ *
+ * @tparam Type Types to reflect.
+ */
+template<typename... Type>
+void meta_load() {
+    (internal::meta_load<Type>(meta_type_t<Type>{}), ...);
+}
+
+
+}
+
+
+#endif
@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -189,6 +190,38 @@ template<typename Type, auto Candidate, typename Policy, std::size_t... Indexes>
 }
 
 
+template<typename Type, auto Candidate, typename Policy, std::size_t... Indexes>
+void invoke_raw([[maybe_unused]] void *instance, [[maybe_unused]] void * const *args, [[maybe_unused]] void *ret, std::index_sequence<Indexes...>) {
+    using helper_type = meta_function_helper_t<Type, decltype(Candidate)>;
+
+    auto dispatch = [ret](auto &&... params) {
+        if constexpr(std::is_void_v<typename helper_type::return_type> || std::is_same_v<Policy, as_void_t>) {
+            std::invoke(Candidate, std::forward<decltype(params)>(params)...);
+        } else if constexpr(std::is_same_v<Policy, as_ref_t>) {
+            auto &&value = std::invoke(Candidate, std::forward<decltype(params)>(params)...);
+
+            if(ret) {
+                new (ret) std::remove_reference_t<decltype(value)> *{&value};
+            }
+        } else {
+            static_assert(std::is_same_v<Policy, as_is_t>, "Policy not supported");
+
+            if(ret) {
+                new (ret) typename helper_type::return_type(std::invoke(Candidate, std::forward<decltype(params)>(params)...));
+            } else {
+                std::invoke(Candidate, std::forward<decltype(params)>(params)...);
+            }
+        }
+    };
+
+    if constexpr(std::is_invocable_v<decltype(Candidate), std::add_lvalue_reference_t<Type>, std::tuple_element_t<Indexes, typename helper_type::args_type>...>) {
+        dispatch(*static_cast<Type *>(instance), *static_cast<std::tuple_element_t<Indexes, typename helper_type::args_type> *>(args[Indexes])...);
+    } else {
+        dispatch(*static_cast<std::tuple_element_t<Indexes, typename helper_type::args_type> *>(args[Indexes])...);
+    }
+}
+
+
 }
 
 
@@ -218,7 +251,7 @@ class meta_factory;
 template<typename Type, typename... Spec>
 class meta_factory<Type, Spec...>: public meta_factory<Type> {
     [[nodiscard]] bool exists(const meta_any &key, const internal::meta_prop_node *node) ENTT_NOEXCEPT {
-        return node && (node->key() == key || exists(key, node->next));
+        return node && (node->compare(key) || exists(key, node->next));
     }
 
     template<std::size_t Step = 0, std::size_t... Index, typename... Property, typename... Other>
@@ -255,6 +288,7 @@ class meta_factory<Type, Spec...>: public meta_factory<Type> {
     template<std::size_t = 0, typename Key, typename... Value>
     void assign(Key &&key, Value &&... value) {
         static const auto property{std::make_tuple(std::forward<Key>(key), std::forward<Value>(value)...)};
+        using key_type = std::tuple_element_t<0, std::remove_const_t<decltype(property)>>;
 
         static internal::meta_prop_node node{
             nullptr,
@@ -267,6 +301,11 @@ class meta_factory<Type, Spec...>: public meta_factory<Type> {
                 } else {
                     return std::get<1>(property);
                 }
+            },
+            [](const meta_any &other) {
+                // the stored key is compared in place, without copying it into a meta_any
+                const auto *type = internal::meta_info<key_type>::resolve();
+                return other && (other.type().info() == type->info) && type->compare(other.data(), &std::get<0>(property));
             }
         };
 
@@ -358,6 +397,12 @@ public:
         node->next = *internal::meta_context::global();
         *internal::meta_context::global() = node;
 
+        if(auto &&index = internal::meta_context::index(); index.ctx == internal::meta_context::global()) {
+            index.types.insert(node);
+        } else {
+            index.rebuild(internal::meta_context::global());
+        }
+
         return meta_factory<Type, Type>{&node->prop};
     }
 
@@ -386,6 +431,7 @@ public:
         ENTT_ASSERT(!exists(&node, type->base));
         node.next = type->base;
         type->base = &node;
+        ++internal::meta_context::revision();
 
         return meta_factory<Type>{};
     }
@@ -416,6 +462,7 @@ public:
         ENTT_ASSERT(!exists(&node, type->conv));
         node.next = type->conv;
         type->conv = &node;
+        ++internal::meta_context::revision();
 
         return meta_factory<Type>{};
     }
@@ -449,6 +496,7 @@ public:
         ENTT_ASSERT(!exists(&node, type->conv));
         node.next = type->conv;
         type->conv = &node;
+        ++internal::meta_context::revision();
 
         return meta_factory<Type>{};
     }
@@ -590,7 +638,8 @@ public:
                         return &internal::setter<Type, Data>;
                     }
                 }(),
-                &internal::getter<Type, Data, Policy>
+                &internal::getter<Type, Data, Policy>,
+                nullptr
             };
 
             ENTT_ASSERT(!exists(id, type->data));
@@ -598,6 +647,7 @@ public:
             node.id = id;
             node.next = type->data;
             type->data = &node;
+            type->data_index.insert(&node);
 
             return meta_factory<Type, std::integral_constant<decltype(Data), Data>>{&node.prop};
         }
@@ -642,7 +692,19 @@ public:
                     return &internal::setter<Type, Setter>;
                 }
             }(),
-            &internal::getter<Type, Getter, Policy>
+            &internal::getter<Type, Getter, Policy>,
+            []() -> std::remove_const_t<decltype(internal::meta_data_node::address)> {
+                // only plain data members can be accessed in place
+                if constexpr(std::is_member_object_pointer_v<decltype(Getter)> && std::is_same_v<decltype(Setter), decltype(Getter)>) {
+                    if constexpr(Setter == Getter) {
+                        return [](const void *instance) ENTT_NOEXCEPT -> const void * {
+                            return &(static_cast<const Type *>(instance)->*Getter);
+                        };
+                    }
+                }
+
+                return nullptr;
+            }()
         };
 
         ENTT_ASSERT(!exists(id, type->data));
@@ -650,6 +712,7 @@ public:
         node.id = id;
         node.next = type->data;
         type->data = &node;
+        type->data_index.insert(&node);
 
         return meta_factory<Type, std::integral_constant<decltype(Setter), Setter>, std::integral_constant<decltype(Getter), Getter>>{&node.prop};
     }
@@ -684,6 +747,9 @@ public:
             &helper_type::arg,
             [](meta_handle instance, meta_any *args) {
                 return internal::invoke<Type, Candidate, Policy>(std::move(instance), args, std::make_index_sequence<std::tuple_size_v<typename helper_type::args_type>>{});
+            },
+            [](void *instance, void * const *args, void *ret) {
+                internal::invoke_raw<Type, Candidate, Policy>(instance, args, ret, std::make_index_sequence<std::tuple_size_v<typename helper_type::args_type>>{});
             }
         };
 
@@ -696,6 +762,11 @@ public:
         node.id = id;
         node.next = *it;
         *it = &node;
+        ++internal::meta_context::revision();
+
+        // the index refers to the first overload, that is the one with the fewest arguments
+        for(it = &type->func; (*it)->id != id; it = &(*it)->next);
+        type->func_index.insert(*it);
 
         return meta_factory<Type, std::integral_constant<decltype(Candidate), Candidate>>{&node.prop};
     }
@@ -721,6 +792,38 @@ template<typename Type>
 }
 
 
+/**
+ * @brief Resets a type and all its parts.
+ *
+ * @sa meta_type::reset
+ *
+ * @tparam Type Type to reset.
+ */
+template<typename Type>
+void meta_reset() ENTT_NOEXCEPT {
+    meta_type{internal::meta_info<Type>::resolve()}.reset();
+}
+
+
+/**
+ * @brief Resets all searchable types of the current context at once.
+ *
+ * This is the function to use to release all the reflection data of a context,
+ * as an example before unloading a plugin that registered them. Once done, no
+ * meta object that belongs to the types of the context is reachable anymore.
+ * However, types that aren't searchable and therefore aren't part of the
+ * context (as an example, those implicitly generated for function parameters)
+ * are left untouched.
+ *
+ * @sa meta_type::reset
+ */
+inline void meta_reset() ENTT_NOEXCEPT {
+    while(*internal::meta_context::global()) {
+        meta_type{*internal::meta_context::global()}.reset();
+    }
+}
+
+
 }
 
 
@@ -2,11 +2,13 @@
 #define ENTT_META_INTERNAL_HPP
 
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../core/attribute.h"
 #include "../config/config.h"
 #include "../core/fwd.hpp"
@@ -32,63 +34,52 @@ namespace internal {
 
 
 class meta_storage {
-    using storage_type = std::aligned_storage_t<sizeof(void *), alignof(void *)>;
-    using copy_fn_type = void(meta_storage &, const meta_storage &);
-    using steal_fn_type = void(meta_storage &, meta_storage &);
-    using destroy_fn_type = void(meta_storage &);
-
-    template<typename Type, typename = void>
-    struct type_traits {
-        template<typename... Args>
-        static void instance(meta_storage &buffer, Args &&... args) {
-            buffer.instance = new Type{std::forward<Args>(args)...};
-            new (&buffer.storage) Type *{static_cast<Type *>(buffer.instance)};
-        }
-
-        static void destroy(meta_storage &buffer) {
-            delete static_cast<Type *>(buffer.instance);
-        }
+    static_assert(ENTT_META_SBO_SIZE >= sizeof(void *), "Invalid buffer size");
+    using storage_type = std::aligned_storage_t<ENTT_META_SBO_SIZE>;
 
-        static void copy(meta_storage &to, const meta_storage &from) {
-            to.instance = new Type{*static_cast<const Type *>(from.instance)};
-            new (&to.storage) Type *{static_cast<Type *>(to.instance)};
-        }
-
-        static void steal(meta_storage &to, meta_storage &from) {
-            new (&to.storage) Type *{static_cast<Type *>(from.instance)};
-            to.instance = from.instance;
-        }
-    };
+    enum class operation { COPY, STEAL, DESTROY };
+    using vtable_type = void(const operation, const meta_storage &, meta_storage *);
 
     template<typename Type>
-    struct type_traits<Type, std::enable_if_t<sizeof(Type) <= sizeof(void *) && std::is_nothrow_move_constructible_v<Type>>> {
-        template<typename... Args>
-        static void instance(meta_storage &buffer, Args &&... args) {
-            buffer.instance = new (&buffer.storage) Type{std::forward<Args>(args)...};
-        }
+    static constexpr bool in_situ = sizeof(Type) <= sizeof(storage_type) && alignof(Type) <= alignof(storage_type) && std::is_nothrow_move_constructible_v<Type>;
 
-        static void destroy(meta_storage &buffer) {
-            static_cast<Type *>(buffer.instance)->~Type();
-        }
-
-        static void copy(meta_storage &to, const meta_storage &from) {
-            to.instance = new (&to.storage) Type{*static_cast<const Type *>(from.instance)};
-        }
-
-        static void steal(meta_storage &to, meta_storage &from) {
-            to.instance = new (&to.storage) Type{std::move(*static_cast<Type *>(from.instance))};
-            destroy(from);
+    template<typename Type>
+    static void basic_vtable(const operation op, const meta_storage &from, meta_storage *to) {
+        if constexpr(in_situ<Type>) {
+            switch(op) {
+            case operation::COPY:
+                to->instance = new (&to->storage) Type{*static_cast<const Type *>(from.instance)};
+                break;
+            case operation::STEAL:
+                to->instance = new (&to->storage) Type{std::move(*static_cast<Type *>(from.instance))};
+                static_cast<Type *>(from.instance)->~Type();
+                break;
+            case operation::DESTROY:
+                static_cast<Type *>(from.instance)->~Type();
+                break;
+            }
+        } else {
+            switch(op) {
+            case operation::COPY:
+                to->instance = new Type{*static_cast<const Type *>(from.instance)};
+                ENTT_ALLOC_TRACE("entt::meta_any", type_id<Type>().name(), sizeof(Type));
+                break;
+            case operation::STEAL:
+                to->instance = from.instance;
+                break;
+            case operation::DESTROY:
+                delete static_cast<Type *>(from.instance);
+                break;
+            }
         }
-    };
+    }
 
 public:
     /*! @brief Default constructor. */
     meta_storage() ENTT_NOEXCEPT
         : storage{},
           instance{},
-          destroy_fn{},
-          copy_fn{},
-          steal_fn{}
+          vtable{}
     {}
 
     template<typename Type, typename... Args>
@@ -96,10 +87,14 @@ public:
         : meta_storage{}
     {
         if constexpr(!std::is_void_v<Type>) {
-            type_traits<Type>::instance(*this, std::forward<Args>(args)...);
-            destroy_fn = &type_traits<Type>::destroy;
-            copy_fn = &type_traits<Type>::copy;
-            steal_fn = &type_traits<Type>::steal;
+            if constexpr(in_situ<Type>) {
+                instance = new (&storage) Type{std::forward<Args>(args)...};
+            } else {
+                instance = new Type{std::forward<Args>(args)...};
+                ENTT_ALLOC_TRACE("entt::meta_any", type_id<Type>().name(), sizeof(Type));
+            }
+
+            vtable = &basic_vtable<Type>;
         }
     }
 
@@ -118,10 +113,13 @@ public:
     meta_storage(const meta_storage &other)
         : meta_storage{}
     {
-        (other.copy_fn ? other.copy_fn : [](auto &to, const auto &from) { to.instance = from.instance; })(*this, other);
-        destroy_fn = other.destroy_fn;
-        copy_fn = other.copy_fn;
-        steal_fn = other.steal_fn;
+        if(other.vtable) {
+            other.vtable(operation::COPY, other, this);
+        } else {
+            instance = other.instance;
+        }
+
+        vtable = other.vtable;
     }
 
     meta_storage(meta_storage &&other)
@@ -131,8 +129,8 @@ public:
     }
 
     ~meta_storage() {
-        if(destroy_fn) {
-            destroy_fn(*this);
+        if(vtable) {
+            vtable(operation::DESTROY, *this, nullptr);
         }
     }
 
@@ -167,40 +165,179 @@ public:
     friend void swap(meta_storage &lhs, meta_storage &rhs) {
         using std::swap;
 
-        if(lhs.steal_fn && rhs.steal_fn) {
+        if(lhs.vtable && rhs.vtable) {
             meta_storage buffer{};
-            lhs.steal_fn(buffer, lhs);
-            rhs.steal_fn(lhs, rhs);
-            lhs.steal_fn(rhs, buffer);
-        } else if(lhs.steal_fn) {
-            lhs.steal_fn(rhs, lhs);
-        } else if(rhs.steal_fn) {
-            rhs.steal_fn(lhs, rhs);
+            lhs.vtable(operation::STEAL, lhs, &buffer);
+            rhs.vtable(operation::STEAL, rhs, &lhs);
+            lhs.vtable(operation::STEAL, buffer, &rhs);
+        } else if(lhs.vtable) {
+            lhs.vtable(operation::STEAL, lhs, &rhs);
+        } else if(rhs.vtable) {
+            rhs.vtable(operation::STEAL, rhs, &lhs);
         } else {
             swap(lhs.instance, rhs.instance);
         }
 
-        swap(lhs.destroy_fn, rhs.destroy_fn);
-        swap(lhs.copy_fn, rhs.copy_fn);
-        swap(lhs.steal_fn, rhs.steal_fn);
+        swap(lhs.vtable, rhs.vtable);
     }
 
 private:
     storage_type storage;
     void *instance;
-    destroy_fn_type *destroy_fn;
-    copy_fn_type *copy_fn;
-    steal_fn_type *steal_fn;
+    vtable_type *vtable;
 };
 
 
 struct meta_type_node;
 
 
+template<typename Node>
+class meta_index {
+    [[nodiscard]] std::size_t slot(const id_type id) const ENTT_NOEXCEPT {
+        auto pos = static_cast<std::size_t>(id) & (slots.size() - 1u);
+        for(; slots[pos] && slots[pos]->id != id; pos = (pos + 1u) & (slots.size() - 1u));
+        return pos;
+    }
+
+public:
+    [[nodiscard]] Node * find(const id_type id) const ENTT_NOEXCEPT {
+        return slots.empty() ? nullptr : slots[slot(id)];
+    }
+
+    void insert(Node *node) {
+        if(2u * (count + 1u) > slots.size()) {
+            auto other = std::exchange(slots, std::vector<Node *>((std::max)(slots.size() * 2u, std::size_t{8u}), nullptr));
+            count = {};
+
+            for(auto *curr: other) {
+                if(curr) {
+                    insert(curr);
+                }
+            }
+        }
+
+        auto &&elem = slots[slot(node->id)];
+        count += !elem;
+        elem = node;
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        slots.clear();
+        count = {};
+    }
+
+private:
+    std::vector<Node *> slots{};
+    std::size_t count{};
+};
+
+
+template<typename Value>
+class meta_cache {
+    struct entry_type {
+        const meta_type_node *parent;
+        id_type id;
+        std::size_t hash;
+        std::vector<id_type> args;
+        Value value;
+    };
+
+    template<typename Func>
+    [[nodiscard]] std::size_t slot(const meta_type_node *parent, const id_type id, const std::size_t hash, const std::size_t sz, Func &arg) const {
+        auto pos = hash & (slots.size() - 1u);
+
+        for(; slots[pos].parent; pos = (pos + 1u) & (slots.size() - 1u)) {
+            if(auto &&curr = slots[pos]; curr.hash == hash && curr.parent == parent && curr.id == id && curr.args.size() == sz) {
+                std::size_t next{};
+                for(; next < sz && curr.args[next] == arg(next); ++next);
+
+                if(next == sz) {
+                    break;
+                }
+            }
+        }
+
+        return pos;
+    }
+
+public:
+    template<typename Func>
+    [[nodiscard]] static std::size_t hash(const meta_type_node *parent, const id_type id, const std::size_t sz, Func arg) {
+        auto value = std::hash<const void *>{}(parent) ^ (std::size_t{id} * 0x9e3779b9u);
+
+        for(std::size_t pos{}; pos < sz; ++pos) {
+            // the usual hash_combine, nothing fancy
+            value ^= std::size_t{arg(pos)} + 0x9e3779b9u + (value << 6u) + (value >> 2u);
+        }
+
+        return value;
+    }
+
+    void sync(const std::size_t curr) ENTT_NOEXCEPT {
+        if(curr != revision) {
+            clear();
+            revision = curr;
+        }
+    }
+
+    template<typename Func>
+    [[nodiscard]] const Value * find(const meta_type_node *parent, const id_type id, const std::size_t hash, const std::size_t sz, Func arg) const {
+        if(!slots.empty()) {
+            if(auto &&curr = slots[slot(parent, id, hash, sz, arg)]; curr.parent) {
+                return &curr.value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename Func>
+    const Value & insert(const meta_type_node *parent, const id_type id, const std::size_t hash, const std::size_t sz, Func arg, Value value) {
+        if(2u * (count + 1u) > slots.size()) {
+            auto other = std::exchange(slots, std::vector<entry_type>((std::max)(slots.size() * 2u, std::size_t{8u})));
+
+            for(auto &&curr: other) {
+                if(curr.parent) {
+                    const auto args = [&curr](const std::size_t pos) { return curr.args[pos]; };
+                    slots[slot(curr.parent, curr.id, curr.hash, curr.args.size(), args)] = std::move(curr);
+                }
+            }
+        }
+
+        auto &&elem = slots[slot(parent, id, hash, sz, arg)];
+
+        if(elem.parent) {
+            elem.value = std::move(value);
+        } else {
+            elem = entry_type{parent, id, hash, std::vector<id_type>(sz), std::move(value)};
+
+            for(std::size_t pos{}; pos < sz; ++pos) {
+                elem.args[pos] = arg(pos);
+            }
+
+            ++count;
+        }
+
+        return elem.value;
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        slots.clear();
+        count = {};
+    }
+
+private:
+    std::vector<entry_type> slots{};
+    std::size_t count{};
+    std::size_t revision{};
+};
+
+
 struct meta_prop_node {
     meta_prop_node * next;
     meta_any(* const key)();
     meta_any(* const value)();
+    bool(* const compare)(const meta_any &);
 };
 
 
@@ -240,6 +377,7 @@ struct meta_data_node {
     meta_type_node *(* const type)() ENTT_NOEXCEPT;
     bool(* const set)(meta_handle, meta_any);
     meta_any(* const get)(meta_handle);
+    const void *(* const address)(const void *) ENTT_NOEXCEPT;
 };
 
 
@@ -255,6 +393,7 @@ struct meta_func_node {
     meta_type_node *(* const ret)() ENTT_NOEXCEPT;
     meta_type_node *(* const arg)(size_type) ENTT_NOEXCEPT;
     meta_any(* const invoke)(meta_handle, meta_any *);
+    void(* const thunk)(void *, void * const *, void *);
 };
 
 
@@ -290,6 +429,8 @@ struct meta_type_node {
     meta_data_node *data{nullptr};
     meta_func_node *func{nullptr};
     void(* dtor)(void *){nullptr};
+    meta_index<meta_data_node> data_index{};
+    meta_index<meta_func_node> func_index{};
 };
 
 
@@ -378,6 +519,23 @@ auto find_if(const Op &op, const meta_type_node *node)
 }
 
 
+template<auto Member>
+auto find(const id_type id, const meta_type_node *node)
+-> decltype((node->*Member).find(id)) {
+    if(auto *ret = (node->*Member).find(id); ret) {
+        return ret;
+    }
+
+    for(auto &&curr: meta_range{node->base}) {
+        if(auto *ret = find<Member>(id, curr.type()); ret) {
+            return ret;
+        }
+    }
+
+    return nullptr;
+}
+
+
 template<typename Type>
 class ENTT_API meta_node {
     static_assert(std::is_same_v<Type, std::remove_cv_t<std::remove_reference_t<Type>>>, "Invalid type");
@@ -9,6 +9,7 @@
 #include <functional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/fwd.hpp"
 #include "../core/utility.hpp"
@@ -26,6 +27,101 @@ class meta_type;
 class meta_any;
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+struct meta_cast_path {
+    [[nodiscard]] const void * cast(const void *instance) const ENTT_NOEXCEPT {
+        for(auto *curr: bases) {
+            instance = curr->cast(instance);
+        }
+
+        return instance;
+    }
+
+    std::vector<const meta_base_node *> bases{};
+    const meta_conv_node *conv{};
+    bool valid{};
+};
+
+
+[[nodiscard]] inline bool find_base_path(const meta_type_node *node, const type_info info, std::vector<const meta_base_node *> &bases) {
+    for(auto &&curr: meta_range{node->base}) {
+        bases.push_back(&curr);
+
+        if(curr.type()->info == info || find_base_path(curr.type(), info, bases)) {
+            return true;
+        }
+
+        bases.pop_back();
+    }
+
+    return false;
+}
+
+
+[[nodiscard]] inline const meta_conv_node * find_conv_path(const meta_type_node *node, const type_info info, std::vector<const meta_base_node *> &bases) {
+    for(auto &&curr: meta_range{node->conv}) {
+        if(curr.type()->info == info) {
+            return &curr;
+        }
+    }
+
+    for(auto &&curr: meta_range{node->base}) {
+        bases.push_back(&curr);
+
+        if(auto *conv = find_conv_path(curr.type(), info, bases); conv) {
+            return conv;
+        }
+
+        bases.pop_back();
+    }
+
+    return nullptr;
+}
+
+
+template<bool Conv>
+[[nodiscard]] const meta_cast_path & lookup_path(const meta_type_node *node, const type_info info) {
+    // paths are flattened once per pair of types, bases are adjusted in turn since virtual ones have no fixed offset
+    thread_local meta_cache<meta_cast_path> cache{};
+    const auto none = [](const std::size_t) { return id_type{}; };
+    const auto hash = meta_cache<meta_cast_path>::hash(node, info.hash(), 0u, none);
+
+    cache.sync(meta_context::revision());
+
+    if(const auto *path = cache.find(node, info.hash(), hash, 0u, none); path) {
+        return *path;
+    }
+
+    meta_cast_path path{};
+
+    if constexpr(Conv) {
+        path.conv = find_conv_path(node, info, path.bases);
+        path.valid = (path.conv != nullptr);
+    } else {
+        path.valid = find_base_path(node, info, path.bases);
+    }
+
+    return cache.insert(node, info.hash(), hash, 0u, none, std::move(path));
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /*! @brief Proxy object for sequence containers. */
 class meta_sequence_container {
     template<typename>
@@ -41,7 +137,8 @@ public:
 
     /*! @brief Default constructor. */
     meta_sequence_container() ENTT_NOEXCEPT
-        : instance{nullptr}
+        : vtable{nullptr},
+          instance{nullptr}
     {}
 
     /**
@@ -51,15 +148,7 @@ public:
      */
     template<typename Type>
     meta_sequence_container(Type *container) ENTT_NOEXCEPT
-        : value_type_fn{&meta_sequence_container_proxy<Type>::value_type},
-          size_fn{&meta_sequence_container_proxy<Type>::size},
-          resize_fn{&meta_sequence_container_proxy<Type>::resize},
-          clear_fn{&meta_sequence_container_proxy<Type>::clear},
-          begin_fn{&meta_sequence_container_proxy<Type>::begin},
-          end_fn{&meta_sequence_container_proxy<Type>::end},
-          insert_fn{&meta_sequence_container_proxy<Type>::insert},
-          erase_fn{&meta_sequence_container_proxy<Type>::erase},
-          get_fn{&meta_sequence_container_proxy<Type>::get},
+        : vtable{&meta_sequence_container_proxy<Type>::table},
           instance{container}
     {}
 
@@ -72,18 +161,25 @@ public:
     inline std::pair<iterator, bool> insert(iterator, meta_any);
     inline std::pair<iterator, bool> erase(iterator);
     [[nodiscard]] inline meta_any operator[](size_type);
+    [[nodiscard]] inline bool is_contiguous() const ENTT_NOEXCEPT;
+    [[nodiscard]] inline void * data() ENTT_NOEXCEPT;
     [[nodiscard]] inline explicit operator bool() const ENTT_NOEXCEPT;
 
 private:
-    meta_type(* value_type_fn)() ENTT_NOEXCEPT;
-    size_type(* size_fn)(const void *) ENTT_NOEXCEPT;
-    bool(* resize_fn)(void *, size_type);
-    bool(* clear_fn)(void *);
-    iterator(* begin_fn)(void *);
-    iterator(* end_fn)(void *);
-    std::pair<iterator, bool>(* insert_fn)(void *, iterator, meta_any);
-    std::pair<iterator, bool>(* erase_fn)(void *, iterator);
-    meta_any(* get_fn)(void *, size_type);
+    struct vtable_type {
+        meta_type(* value_type_fn)() ENTT_NOEXCEPT;
+        size_type(* size_fn)(const void *) ENTT_NOEXCEPT;
+        void *(* data_fn)(void *) ENTT_NOEXCEPT;
+        bool(* resize_fn)(void *, size_type);
+        bool(* clear_fn)(void *);
+        iterator(* begin_fn)(void *);
+        iterator(* end_fn)(void *);
+        std::pair<iterator, bool>(* insert_fn)(void *, iterator, meta_any);
+        std::pair<iterator, bool>(* erase_fn)(void *, iterator);
+        meta_any(* get_fn)(void *, size_type);
+    };
+
+    const vtable_type *vtable;
     void *instance;
 };
 
@@ -103,7 +199,9 @@ public:
 
     /*! @brief Default constructor. */
     meta_associative_container() ENTT_NOEXCEPT
-        : instance{nullptr}
+        : key_only_container{},
+          vtable{nullptr},
+          instance{nullptr}
     {}
 
     /**
@@ -114,16 +212,7 @@ public:
     template<typename Type>
     meta_associative_container(Type *container) ENTT_NOEXCEPT
         : key_only_container{is_key_only_meta_associative_container_v<Type>},
-          key_type_fn{&meta_associative_container_proxy<Type>::key_type},
-          mapped_type_fn{&meta_associative_container_proxy<Type>::mapped_type},
-          value_type_fn{&meta_associative_container_proxy<Type>::value_type},
-          size_fn{&meta_associative_container_proxy<Type>::size},
-          clear_fn{&meta_associative_container_proxy<Type>::clear},
-          begin_fn{&meta_associative_container_proxy<Type>::begin},
-          end_fn{&meta_associative_container_proxy<Type>::end},
-          insert_fn{&meta_associative_container_proxy<Type>::insert},
-          erase_fn{&meta_associative_container_proxy<Type>::erase},
-          find_fn{&meta_associative_container_proxy<Type>::find},
+          vtable{&meta_associative_container_proxy<Type>::table},
           instance{container}
     {}
 
@@ -142,16 +231,20 @@ public:
 
 private:
     bool key_only_container;
-    meta_type(* key_type_fn)() ENTT_NOEXCEPT;
-    meta_type(* mapped_type_fn)() ENTT_NOEXCEPT;
-    meta_type(* value_type_fn)() ENTT_NOEXCEPT;
-    size_type(* size_fn)(const void *) ENTT_NOEXCEPT;
-    bool(* clear_fn)(void *);
-    iterator(* begin_fn)(void *);
-    iterator(* end_fn)(void *);
-    bool(* insert_fn)(void *, meta_any, meta_any);
-    bool(* erase_fn)(void *, meta_any);
-    iterator(* find_fn)(void *, meta_any);
+    struct vtable_type {
+        meta_type(* key_type_fn)() ENTT_NOEXCEPT;
+        meta_type(* mapped_type_fn)() ENTT_NOEXCEPT;
+        meta_type(* value_type_fn)() ENTT_NOEXCEPT;
+        size_type(* size_fn)(const void *) ENTT_NOEXCEPT;
+        bool(* clear_fn)(void *);
+        iterator(* begin_fn)(void *);
+        iterator(* end_fn)(void *);
+        bool(* insert_fn)(void *, meta_any, meta_any);
+        bool(* erase_fn)(void *, meta_any);
+        iterator(* find_fn)(void *, meta_any);
+    };
+
+    const vtable_type *vtable;
     void *instance;
 };
 
@@ -347,8 +440,8 @@ public:
         if(node) {
             if(const auto info = internal::meta_info<Type>::resolve()->info; node->info == info) {
                 return static_cast<const Type *>(storage.data());
-            } else if(const auto *base = internal::find_if<&internal::meta_type_node::base>([info](const auto *curr) { return curr->type()->info == info; }, node); base) {
-                return static_cast<const Type *>(base->cast(storage.data()));
+            } else if(const auto &path = internal::lookup_path<false>(node, info); path.valid) {
+                return static_cast<const Type *>(path.cast(storage.data()));
             }
         }
 
@@ -397,8 +490,8 @@ public:
         if(node) {
             if(const auto info = internal::meta_info<Type>::resolve()->info; node->info == info) {
                 return *this;
-            } else if(const auto * const conv = internal::find_if<&internal::meta_type_node::conv>([info](const auto *curr) { return curr->type()->info == info; }, node); conv) {
-                return conv->conv(storage.data());
+            } else if(const auto &path = internal::lookup_path<true>(node, info); path.valid) {
+                return path.conv->conv(path.cast(storage.data()));
             }
         }
 
@@ -769,7 +862,7 @@ struct meta_ctor {
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
         internal::meta_range range{node->prop};
-        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.key() == key; }).operator->();
+        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.compare(key); }).operator->();
     }
 
     /**
@@ -866,7 +959,7 @@ struct meta_data {
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
         internal::meta_range range{node->prop};
-        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.key() == key; }).operator->();
+        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.compare(key); }).operator->();
     }
 
     /**
@@ -888,6 +981,8 @@ struct meta_func {
     using node_type = internal::meta_func_node;
     /*! @brief Unsigned integer type. */
     using size_type = typename node_type::size_type;
+    /*! @brief Type of function returned by `thunk`. */
+    using thunk_type = void(void *, void * const *, void *);
 
     /*! @copydoc meta_prop::meta_prop */
     meta_func(const node_type *curr = nullptr) ENTT_NOEXCEPT
@@ -974,6 +1069,50 @@ struct meta_func {
         return invoke(std::move(instance), arguments.data(), sizeof...(Args));
     }
 
+    /**
+     * @brief Returns a function that invokes the underlying function with raw
+     * pointers to its arguments, if the meta types of the arguments match.
+     *
+     * The signature is checked once, when the thunk is requested. Invoking the
+     * returned function doesn't perform any further check, cast or conversion
+     * and doesn't construct any `meta_any` object. Its signature is equivalent
+     * to the following:
+     *
+     * @code{.cpp}
+     * void(void *instance, void * const *args, void *ret);
+     * @endcode
+     *
+     * The instance is ignored for static functions, while the i-th element of
+     * `args` must point to an object of the exact type of the i-th argument.
+     * If not null, the result is constructed in the storage pointed by `ret`,
+     * that is a pointer to the returned object for functions reflected with
+     * the `as_ref_t` policy. Nothing is written for functions that return
+     * `void` or that are reflected with the `as_void_t` policy.
+     *
+     * @warning
+     * Types are compared exactly, no conversion is ever taken in account.
+     * Attempting to invoke a thunk with objects of the wrong types results in
+     * undefined behavior.
+     *
+     * @param types Meta types of the arguments to use to invoke the function.
+     * @param sz Number of arguments to use to invoke the function.
+     * @return The function to use to invoke the underlying function if the
+     * types match, a null pointer otherwise.
+     */
+    [[nodiscard]] inline thunk_type * thunk(const meta_type * const types, const size_type sz) const ENTT_NOEXCEPT;
+
+    /**
+     * @copybrief thunk
+     *
+     * @sa thunk
+     *
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @return The function to use to invoke the underlying function if the
+     * types match, a null pointer otherwise.
+     */
+    template<typename... Args>
+    [[nodiscard]] thunk_type * thunk() const ENTT_NOEXCEPT;
+
     /*! @copydoc meta_ctor::prop */
     [[nodiscard]] meta_range<meta_prop> prop() const ENTT_NOEXCEPT {
         return node->prop;
@@ -986,7 +1125,7 @@ struct meta_func {
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
         internal::meta_range range{node->prop};
-        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.key() == key; }).operator->();
+        return std::find_if(range.begin(), range.end(), [&key](const auto &curr) { return curr.compare(key); }).operator->();
     }
 
     /**
@@ -1004,20 +1143,8 @@ private:
 
 /*! @brief Opaque wrapper for meta types. */
 class meta_type {
-    bool can_cast_or_convert(const meta_type type, const type_info info) const ENTT_NOEXCEPT {
-        for(auto curr: type.conv()) {
-            if(curr.type().info() == info) {
-                return true;
-            }
-        }
-
-        for(auto curr: type.base()) {
-            if(curr.type().info() == info || can_cast_or_convert(curr.type(), info)) {
-                return true;
-            }
-        }
-
-        return false;
+    bool can_cast_or_convert(const meta_type type, const type_info info) const {
+        return internal::lookup_path<false>(type.node, info).valid || internal::lookup_path<true>(type.node, info).valid;
     }
 
 public:
@@ -1297,9 +1424,7 @@ public:
      * @return The meta data associated with the given identifier, if any.
      */
     [[nodiscard]] meta_data data(const id_type id) const {
-        return internal::find_if<&node_type::data>([id](const auto *curr) {
-            return curr->id == id;
-        }, node);
+        return internal::find<&node_type::data_index>(id, node);
     }
 
     /**
@@ -1321,9 +1446,7 @@ public:
      * @return The meta function associated with the given identifier, if any.
      */
     [[nodiscard]] meta_func func(const id_type id) const {
-        return internal::find_if<&node_type::func>([id](const auto *curr) {
-            return curr->id == id;
-        }, node);
+        return internal::find<&node_type::func_index>(id, node);
     }
 
     /**
@@ -1379,6 +1502,17 @@ public:
      * @return A meta any containing the returned value, if any.
      */
     meta_any invoke(const id_type id, meta_handle instance, meta_any * const args, const size_type sz) const {
+        // overloads are resolved once per signature, the choice is cached per thread until the meta types change
+        thread_local internal::meta_cache<const internal::meta_func_node *> cache{};
+        const auto arg = [args](const size_type pos) { const auto type = args[pos].type(); return type ? type.info().hash() : id_type{}; };
+        const auto hash = internal::meta_cache<const internal::meta_func_node *>::hash(node, id, sz, arg);
+
+        cache.sync(internal::meta_context::revision());
+
+        if(const auto *cached = cache.find(node, id, hash, sz, arg); cached) {
+            return *cached ? (*cached)->invoke(instance, args) : meta_any{};
+        }
+
         const internal::meta_func_node* candidate{};
         size_type extent{sz + 1u};
         bool ambiguous{};
@@ -1404,7 +1538,12 @@ public:
             }
         }
 
-        return (candidate && !ambiguous) ? candidate->invoke(instance, args) : meta_any{};
+        if(ambiguous) {
+            candidate = nullptr;
+        }
+
+        cache.insert(node, id, hash, sz, arg, candidate);
+        return candidate ? candidate->invoke(instance, args) : meta_any{};
     }
 
     /**
@@ -1478,7 +1617,7 @@ public:
      */
     [[nodiscard]] meta_prop prop(meta_any key) const {
         return internal::find_if<&node_type::prop>([key = std::move(key)](const auto *curr) {
-            return curr->key() == key;
+            return curr->compare(key);
         }, node);
     }
 
@@ -1521,6 +1660,10 @@ public:
             *it = (*it)->next;
         }
 
+        if(auto &&index = internal::meta_context::index(); index.ctx == internal::meta_context::global()) {
+            index.rebuild(index.ctx);
+        }
+
         const auto unregister_all = y_combinator{
             [](auto &&self, auto **curr, auto... member) {
                 while(*curr) {
@@ -1539,8 +1682,11 @@ public:
         unregister_all(&node->data, &internal::meta_data_node::prop);
         unregister_all(&node->func, &internal::meta_func_node::prop);
 
+        node->data_index.clear();
+        node->func_index.clear();
         node->id = {};
         node->dtor = nullptr;
+        ++internal::meta_context::revision();
     }
 
 private:
@@ -1636,6 +1782,20 @@ bool meta_any::set(const id_type id, Type &&value) const {
 }
 
 
+[[nodiscard]] inline meta_func::thunk_type * meta_func::thunk(const meta_type * const types, const size_type sz) const ENTT_NOEXCEPT {
+    size_type pos{};
+    for(; sz == size() && pos < sz && types[pos] == arg(pos); ++pos);
+    return (sz == size() && pos == sz) ? node->thunk : nullptr;
+}
+
+
+template<typename... Args>
+[[nodiscard]] meta_func::thunk_type * meta_func::thunk() const ENTT_NOEXCEPT {
+    const std::array<meta_type, sizeof...(Args) + 1u> types{{internal::meta_info<Args>::resolve()...}};
+    return thunk(types.data(), sizeof...(Args));
+}
+
+
 /*! @brief Opaque iterator for meta sequence containers. */
 class meta_sequence_container::meta_iterator {
     /*! @brief A meta sequence container can access the underlying iterator. */
@@ -1740,6 +1900,12 @@ template<typename Type>
 struct meta_sequence_container::meta_sequence_container_proxy {
     using traits_type = meta_sequence_container_traits<Type>;
 
+    template<typename Traits, typename = void>
+    struct has_data: std::false_type {};
+
+    template<typename Traits>
+    struct has_data<Traits, std::void_t<decltype(Traits::data(std::declval<Type &>()))>>: std::true_type {};
+
     [[nodiscard]] static meta_type value_type() ENTT_NOEXCEPT {
         return internal::meta_info<typename traits_type::value_type>::resolve();
     }
@@ -1748,6 +1914,10 @@ struct meta_sequence_container::meta_sequence_container_proxy {
         return traits_type::size(*static_cast<const Type *>(container));
     }
 
+    [[nodiscard]] static void * data(void *container) ENTT_NOEXCEPT {
+        return traits_type::data(*static_cast<Type *>(container));
+    }
+
     [[nodiscard]] static bool resize(void *container, size_type sz) {
         return traits_type::resize(*static_cast<Type *>(container), sz);
     }
@@ -1781,6 +1951,8 @@ struct meta_sequence_container::meta_sequence_container_proxy {
     [[nodiscard]] static meta_any get(void *container, size_type pos) {
         return std::ref(traits_type::get(*static_cast<Type *>(container), pos));
     }
+
+    inline static constexpr vtable_type table{&value_type, &size, [] { if constexpr(has_data<traits_type>::value) { return &data; } else { return nullptr; } }(), &resize, &clear, &begin, &end, &insert, &erase, &get};
 };
 
 
@@ -1789,7 +1961,7 @@ struct meta_sequence_container::meta_sequence_container_proxy {
  * @return The value meta type of the wrapped container type.
  */
 [[nodiscard]] inline meta_type meta_sequence_container::value_type() const ENTT_NOEXCEPT {
-    return value_type_fn();
+    return vtable->value_type_fn();
 }
 
 
@@ -1798,7 +1970,7 @@ struct meta_sequence_container::meta_sequence_container_proxy {
  * @return The size of the wrapped container.
  */
 [[nodiscard]] inline meta_sequence_container::size_type meta_sequence_container::size() const ENTT_NOEXCEPT {
-    return size_fn(instance);
+    return vtable->size_fn(instance);
 }
 
 
@@ -1808,7 +1980,7 @@ struct meta_sequence_container::meta_sequence_container_proxy {
  * @return True in case of success, false otherwise.
  */
 inline bool meta_sequence_container::resize(size_type sz) const {
-    return resize_fn(instance, sz);
+    return vtable->resize_fn(instance, sz);
 }
 
 
@@ -1817,7 +1989,7 @@ inline bool meta_sequence_container::resize(size_type sz) const {
  * @return True in case of success, false otherwise.
  */
 inline bool meta_sequence_container::clear() {
-    return clear_fn(instance);
+    return vtable->clear_fn(instance);
 }
 
 
@@ -1826,7 +1998,7 @@ inline bool meta_sequence_container::clear() {
  * @return A meta iterator to the first element of the wrapped container.
  */
 [[nodiscard]] inline meta_sequence_container::iterator meta_sequence_container::begin() {
-    return begin_fn(instance);
+    return vtable->begin_fn(instance);
 }
 
 
@@ -1837,7 +2009,7 @@ inline bool meta_sequence_container::clear() {
  * container.
  */
 [[nodiscard]] inline meta_sequence_container::iterator meta_sequence_container::end() {
-    return end_fn(instance);
+    return vtable->end_fn(instance);
 }
 
 
@@ -1849,7 +2021,7 @@ inline bool meta_sequence_container::clear() {
  * case of success) and a bool denoting whether the insertion took place.
  */
 inline std::pair<meta_sequence_container::iterator, bool> meta_sequence_container::insert(iterator it, meta_any value) {
-    return insert_fn(instance, it, value.ref());
+    return vtable->insert_fn(instance, it, value.ref());
 }
 
 
@@ -1861,7 +2033,7 @@ inline std::pair<meta_sequence_container::iterator, bool> meta_sequence_containe
  * took place.
  */
 inline std::pair<meta_sequence_container::iterator, bool> meta_sequence_container::erase(iterator it) {
-    return erase_fn(instance, it);
+    return vtable->erase_fn(instance, it);
 }
 
 
@@ -1872,7 +2044,32 @@ inline std::pair<meta_sequence_container::iterator, bool> meta_sequence_containe
  * @return A reference to the requested element properly wrapped.
  */
 [[nodiscard]] inline meta_any meta_sequence_container::operator[](size_type pos) {
-    return get_fn(instance, pos);
+    return vtable->get_fn(instance, pos);
+}
+
+
+/**
+ * @brief Indicates whether the elements of the wrapped container are stored
+ * contiguously in memory.
+ * @return True if the wrapped container is contiguous, false otherwise.
+ */
+[[nodiscard]] inline bool meta_sequence_container::is_contiguous() const ENTT_NOEXCEPT {
+    return (vtable->data_fn != nullptr);
+}
+
+
+/**
+ * @brief Returns a pointer to the underlying array of the wrapped container.
+ *
+ * Elements are of the type returned by `value_type` and there are exactly
+ * `size` of them. Therefore, trivially copyable elements can be copied in a
+ * single pass.
+ *
+ * @return A pointer to the first element of the wrapped container if it's
+ * contiguous, a null pointer otherwise.
+ */
+[[nodiscard]] inline void * meta_sequence_container::data() ENTT_NOEXCEPT {
+    return vtable->data_fn ? vtable->data_fn(instance) : nullptr;
 }
 
 
@@ -2060,6 +2257,7 @@ struct meta_associative_container::meta_associative_container_proxy {
 
         return {};
     }
+    inline static constexpr vtable_type table{&key_type, &mapped_type, &value_type, &size, &clear, &begin, &end, &insert, &erase, &find};
 };
 
 
@@ -2078,7 +2276,7 @@ struct meta_associative_container::meta_associative_container_proxy {
  * @return The key meta type of the wrapped container type.
  */
 [[nodiscard]] inline meta_type meta_associative_container::key_type() const ENTT_NOEXCEPT {
-    return key_type_fn();
+    return vtable->key_type_fn();
 }
 
 
@@ -2087,37 +2285,37 @@ struct meta_associative_container::meta_associative_container_proxy {
  * @return The mapped meta type of the wrapped container type.
  */
 [[nodiscard]] inline meta_type meta_associative_container::mapped_type() const ENTT_NOEXCEPT {
-    return mapped_type_fn();
+    return vtable->mapped_type_fn();
 }
 
 
 /*! @copydoc meta_sequence_container::value_type */
 [[nodiscard]] inline meta_type meta_associative_container::value_type() const ENTT_NOEXCEPT {
-    return value_type_fn();
+    return vtable->value_type_fn();
 }
 
 
 /*! @copydoc meta_sequence_container::size */
 [[nodiscard]] inline meta_associative_container::size_type meta_associative_container::size() const ENTT_NOEXCEPT {
-    return size_fn(instance);
+    return vtable->size_fn(instance);
 }
 
 
 /*! @copydoc meta_sequence_container::clear */
 inline bool meta_associative_container::clear() {
-    return clear_fn(instance);
+    return vtable->clear_fn(instance);
 }
 
 
 /*! @copydoc meta_sequence_container::begin */
 [[nodiscard]] inline meta_associative_container::iterator meta_associative_container::begin() {
-    return begin_fn(instance);
+    return vtable->begin_fn(instance);
 }
 
 
 /*! @copydoc meta_sequence_container::end */
 [[nodiscard]] inline meta_associative_container::iterator meta_associative_container::end() {
-    return end_fn(instance);
+    return vtable->end_fn(instance);
 }
 
 
@@ -2128,7 +2326,7 @@ inline bool meta_associative_container::clear() {
  * @return A bool denoting whether the insertion took place.
  */
 inline bool meta_associative_container::insert(meta_any key, meta_any value = {}) {
-    return insert_fn(instance, key.ref(), value.ref());
+    return vtable->insert_fn(instance, key.ref(), value.ref());
 }
 
 
@@ -2138,7 +2336,7 @@ inline bool meta_associative_container::insert(meta_any key, meta_any value = {}
  * @return A bool denoting whether the removal took place.
  */
 inline bool meta_associative_container::erase(meta_any key) {
-    return erase_fn(instance, key.ref());
+    return vtable->erase_fn(instance, key.ref());
 }
 
 
@@ -2149,7 +2347,7 @@ inline bool meta_associative_container::erase(meta_any key) {
  * @return An iterator to the element with the given key, if any.
  */
 [[nodiscard]] inline meta_associative_container::iterator meta_associative_container::find(meta_any key) {
-    return find_fn(instance, key.ref());
+    return vtable->find_fn(instance, key.ref());
 }
 
 
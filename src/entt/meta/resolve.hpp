@@ -38,6 +38,12 @@ template<typename Type>
  * @return The meta type associated with the given identifier, if any.
  */
 [[nodiscard]] inline meta_type resolve(const id_type id) ENTT_NOEXCEPT {
+    if(auto &&index = internal::meta_context::index(); index.ctx == internal::meta_context::global()) {
+        if(auto *node = index.types.find(id); node) {
+            return node;
+        }
+    }
+
     internal::meta_range range{*internal::meta_context::global()};
     return std::find_if(range.begin(), range.end(), [id](const auto &curr) { return curr.id == id; }).operator->();
 }
@@ -0,0 +1,439 @@
+#ifndef ENTT_PROCESS_CO_PROCESS_HPP
+#define ENTT_PROCESS_CO_PROCESS_HPP
+
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+
+#include <coroutine>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../signal/delegate.hpp"
+#include "../signal/dispatcher.hpp"
+#include "../signal/sigh.hpp"
+#include "process.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+class frame_pool {
+    static constexpr std::size_t granularity = 64u;
+    static constexpr std::size_t classes = 16u;
+
+    frame_pool() = default;
+
+public:
+    ~frame_pool() {
+        for(auto &&bucket: buckets) {
+            for(auto *frame: bucket) {
+                ::operator delete(frame);
+            }
+        }
+    }
+
+    [[nodiscard]] static frame_pool & instance() {
+        thread_local frame_pool pool{};
+        return pool;
+    }
+
+    [[nodiscard]] void * allocate(const std::size_t size) {
+        if(const auto index = (size + granularity - 1u) / granularity; index && index <= classes) {
+            if(auto &&bucket = buckets[index - 1u]; !bucket.empty()) {
+                auto *frame = bucket.back();
+                bucket.pop_back();
+                return frame;
+            }
+
+            return ::operator new(index * granularity);
+        }
+
+        return ::operator new(size);
+    }
+
+    // frames released by a thread other than the one that allocated them are simply recycled by the former
+    void deallocate(void *frame, const std::size_t size) {
+        if(const auto index = (size + granularity - 1u) / granularity; index && index <= classes) {
+            buckets[index - 1u].push_back(frame);
+        } else {
+            ::operator delete(frame);
+        }
+    }
+
+private:
+    std::vector<void *> buckets[classes]{};
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Return type of the coroutines run by a coroutine process.
+ *
+ * A task owns the frame of its coroutine. Frames are recycled by means of
+ * per-thread pools rather than being released to the system when a coroutine
+ * terminates.
+ *
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Delta>
+class co_task {
+    template<typename>
+    friend class co_process;
+
+public:
+    /*! @brief Promise type required by the coroutine machinery. */
+    struct promise_type {
+        /**
+         * @brief Allocates a coroutine frame from a pool.
+         * @param size Size of the frame.
+         * @return A pointer to the newly allocated frame.
+         */
+        [[nodiscard]] static void * operator new(const std::size_t size) {
+            return internal::frame_pool::instance().allocate(size);
+        }
+
+        /**
+         * @brief Returns a coroutine frame to its pool.
+         * @param frame A pointer to the frame to release.
+         * @param size Size of the frame.
+         */
+        static void operator delete(void *frame, const std::size_t size) {
+            internal::frame_pool::instance().deallocate(frame, size);
+        }
+
+        /**
+         * @brief Returns the task bound to the coroutine.
+         * @return A newly created task.
+         */
+        [[nodiscard]] co_task get_return_object() ENTT_NOEXCEPT {
+            return co_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        /**
+         * @brief Coroutines are suspended until the first tick.
+         * @return An awaitable object.
+         */
+        [[nodiscard]] std::suspend_always initial_suspend() const ENTT_NOEXCEPT {
+            return {};
+        }
+
+        /**
+         * @brief Coroutines are suspended when they terminate.
+         * @return An awaitable object.
+         */
+        [[nodiscard]] std::suspend_always final_suspend() const noexcept {
+            return {};
+        }
+
+        /*! @brief Coroutines return no values. */
+        void return_void() const ENTT_NOEXCEPT {}
+
+        /*! @brief Exceptions are propagated to the caller. */
+        void unhandled_exception() const {
+            throw;
+        }
+
+        /*! @brief Checks if a suspended coroutine is ready to resume. */
+        delegate<bool(const Delta)> ready{};
+    };
+
+    /*! @brief Default constructor. */
+    co_task() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    co_task(co_task &&other) ENTT_NOEXCEPT
+        : handle{std::exchange(other.handle, nullptr)}
+    {}
+
+    /*! @brief Destroys the coroutine frame, if any. */
+    ~co_task() {
+        if(handle) {
+            handle.destroy();
+        }
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This task.
+     */
+    co_task & operator=(co_task &&other) ENTT_NOEXCEPT {
+        co_task{std::move(*this)};
+        handle = std::exchange(other.handle, nullptr);
+        return *this;
+    }
+
+    /**
+     * @brief Checks if a task has terminated or is empty.
+     * @return True if the task has terminated or is empty, false otherwise.
+     */
+    [[nodiscard]] bool done() const ENTT_NOEXCEPT {
+        return !handle || handle.done();
+    }
+
+private:
+    explicit co_task(std::coroutine_handle<promise_type> ref) ENTT_NOEXCEPT
+        : handle{ref}
+    {}
+
+    std::coroutine_handle<promise_type> handle{};
+};
+
+
+/*! @brief Awaitable object that suspends a coroutine until the next tick. */
+struct next_tick_t {
+    /**
+     * @brief Coroutines are always suspended.
+     * @return False.
+     */
+    [[nodiscard]] constexpr bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /**
+     * @brief Suspends a coroutine until the next tick.
+     * @tparam Promise Type of promise of the coroutine.
+     */
+    template<typename Promise>
+    constexpr void await_suspend(std::coroutine_handle<Promise>) const ENTT_NOEXCEPT {}
+
+    /*! @brief Nothing to return. */
+    constexpr void await_resume() const ENTT_NOEXCEPT {}
+};
+
+
+/*! @brief Suspends a coroutine until the next tick. */
+inline constexpr next_tick_t next_tick{};
+
+
+/**
+ * @brief Awaitable object that suspends a coroutine for a given time.
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Delta>
+class wait_t {
+    [[nodiscard]] bool elapsed(const Delta delta) ENTT_NOEXCEPT {
+        return !((remaining -= delta) > Delta{});
+    }
+
+public:
+    /**
+     * @brief Constructs an awaitable object for a given time.
+     * @param duration Time to wait, in the same unit of the elapsed times.
+     */
+    constexpr explicit wait_t(const Delta duration) ENTT_NOEXCEPT
+        : remaining{duration}
+    {}
+
+    /**
+     * @brief Waiting for no time doesn't suspend a coroutine.
+     * @return True if the duration isn't positive, false otherwise.
+     */
+    [[nodiscard]] constexpr bool await_ready() const ENTT_NOEXCEPT {
+        return !(remaining > Delta{});
+    }
+
+    /**
+     * @brief Suspends a coroutine until the given time has elapsed.
+     * @tparam Promise Type of promise of the coroutine.
+     * @param handle Handle to the coroutine to suspend.
+     */
+    template<typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) ENTT_NOEXCEPT {
+        handle.promise().ready.template connect<&wait_t::elapsed>(*this);
+    }
+
+    /*! @brief Nothing to return. */
+    constexpr void await_resume() const ENTT_NOEXCEPT {}
+
+private:
+    Delta remaining;
+};
+
+
+/**
+ * @brief Suspends a coroutine for a given time.
+ *
+ * The elapsed times of the ticks that follow the suspension are accumulated
+ * and the coroutine is resumed as soon as they reach the given duration.
+ *
+ * @tparam Delta Type to use to provide elapsed time.
+ * @param duration Time to wait, in the same unit of the elapsed times.
+ * @return An awaitable object.
+ */
+template<typename Delta>
+[[nodiscard]] constexpr wait_t<Delta> wait(const Delta duration) ENTT_NOEXCEPT {
+    return wait_t<Delta>{duration};
+}
+
+
+/**
+ * @brief Awaitable object that suspends a coroutine until an event is
+ * delivered.
+ * @tparam Event Type of event to wait for.
+ */
+template<typename Event>
+class event_t {
+    void receive(const Event &event) {
+        if(!value) {
+            value.emplace(event);
+        }
+    }
+
+    [[nodiscard]] bool received() const ENTT_NOEXCEPT {
+        return value.has_value();
+    }
+
+public:
+    /**
+     * @brief Constructs an awaitable object for a given dispatcher.
+     * @param ref A valid reference to a dispatcher.
+     */
+    explicit event_t(dispatcher &ref) ENTT_NOEXCEPT
+        : owner{&ref}
+    {}
+
+    /**
+     * @brief Coroutines are always suspended.
+     * @return False.
+     */
+    [[nodiscard]] constexpr bool await_ready() const ENTT_NOEXCEPT {
+        return false;
+    }
+
+    /**
+     * @brief Suspends a coroutine until an event is delivered.
+     * @tparam Promise Type of promise of the coroutine.
+     * @param handle Handle to the coroutine to suspend.
+     */
+    template<typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        conn = owner->sink<Event>().template connect<&event_t::receive>(*this);
+        handle.promise().ready.template connect<&event_t::received>(*this);
+    }
+
+    /**
+     * @brief Returns the event that resumed the coroutine.
+     * @return A copy of the first event delivered after the suspension.
+     */
+    [[nodiscard]] Event await_resume() {
+        conn.release();
+        return std::move(*value);
+    }
+
+private:
+    dispatcher *owner;
+    std::optional<Event> value{};
+    scoped_connection conn{};
+};
+
+
+/**
+ * @brief Suspends a coroutine until an event is delivered by a dispatcher.
+ *
+ * The coroutine is resumed during the first tick after the event is delivered,
+ * rather than by the dispatcher itself.
+ *
+ * @tparam Event Type of event to wait for.
+ * @param ref A valid reference to a dispatcher.
+ * @return An awaitable object.
+ */
+template<typename Event>
+[[nodiscard]] event_t<Event> next_event(dispatcher &ref) ENTT_NOEXCEPT {
+    return event_t<Event>{ref};
+}
+
+
+/**
+ * @brief Process that runs a coroutine.
+ *
+ * The coroutine is resumed once per tick, as long as the operation it's
+ * waiting for has completed. The process succeeds when the coroutine returns,
+ * while aborting the process destroys the coroutine.
+ *
+ * Example of use:
+ *
+ * @code{.cpp}
+ * entt::co_task<float> blink(entt::dispatcher &dispatcher) {
+ *     co_await entt::next_event<open_event>(dispatcher);
+ *
+ *     for(auto count = 0; count < 3; ++count) {
+ *         // ...
+ *         co_await entt::wait(.5f);
+ *     }
+ * }
+ *
+ * scheduler.attach<entt::co_process<float>>(blink(dispatcher));
+ * @endcode
+ *
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Delta>
+struct co_process: process<co_process<Delta>, Delta> {
+    /*! @brief Type of coroutine run by the process. */
+    using task_type = co_task<Delta>;
+
+    /**
+     * @brief Constructs a process from a coroutine.
+     * @param coroutine A valid coroutine.
+     */
+    co_process(task_type coroutine) ENTT_NOEXCEPT
+        : task{std::move(coroutine)}
+    {}
+
+    /**
+     * @brief Resumes the coroutine if it's ready.
+     * @param delta Elapsed time.
+     */
+    void update(const Delta delta, void *) {
+        if(auto &&promise = task.handle.promise(); !promise.ready || promise.ready(delta)) {
+            promise.ready.reset();
+            task.handle.resume();
+        }
+
+        if(task.done()) {
+            this->succeed();
+        }
+    }
+
+    /*! @brief Destroys the coroutine. */
+    void aborted() {
+        task = {};
+    }
+
+private:
+    task_type task;
+};
+
+
+}
+
+
+#endif
+
+
+#endif
@@ -2,12 +2,18 @@
 #define ENTT_PROCESS_SCHEDULER_HPP
 
 
+#include <array>
+#include <chrono>
 #include <vector>
 #include <memory>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <algorithm>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/type_info.hpp"
 #include "process.hpp"
 
 
@@ -25,6 +31,15 @@ namespace entt {
  * its child when it terminates if it returns with success. In case of errors,
  * both the process and its child are discarded.
  *
+ * Processes are allocated from per-type pools owned by the scheduler and their
+ * memory is recycled once they terminate. Similarly, handlers are kept in a
+ * contiguous array that is compacted in place during updates.
+ *
+ * Processes can also wait for some time before starting. Waiting doesn't cost
+ * anything per tick, since delays are parked in a hierarchical timer wheel and
+ * they are only touched when they are due or, rarely, when they move down to a
+ * finer level of the wheel.
+ *
  * Example of use (pseudocode):
  *
  * @code{.cpp}
@@ -42,31 +57,86 @@ namespace entt {
  */
 template<typename Delta>
 class scheduler {
+    static constexpr auto page_size = 64u;
+    static constexpr auto null = (std::numeric_limits<std::size_t>::max)();
+    static constexpr auto wheel_bits = 6u;
+    static constexpr auto wheel_slots = 1u << wheel_bits;
+    static constexpr auto wheel_levels = 4u;
+
+    struct basic_pool {
+        virtual ~basic_pool() = default;
+    };
+
+    template<typename Proc>
+    struct process_pool final: basic_pool {
+        using slot_type = std::aligned_storage_t<sizeof(Proc), alignof(Proc)>;
+
+        template<typename... Args>
+        [[nodiscard]] Proc * allocate(Args &&... args) {
+            if(available.empty()) {
+                auto &&page = pages.emplace_back(new slot_type[page_size]);
+                ENTT_ALLOC_TRACE("entt::scheduler::attach", type_id<Proc>().name(), page_size * sizeof(slot_type));
+
+                for(auto pos = page_size; pos; --pos) {
+                    available.push_back(&page[pos - 1u]);
+                }
+            }
+
+            auto *instance = new (available.back()) Proc{std::forward<Args>(args)...};
+            available.pop_back();
+            return instance;
+        }
+
+        void release(Proc *instance) {
+            instance->~Proc();
+            available.push_back(reinterpret_cast<slot_type *>(instance));
+        }
+
+        std::vector<std::unique_ptr<slot_type[]>> pages{};
+        std::vector<slot_type *> available{};
+    };
+
     struct process_handler {
-        using instance_type = std::unique_ptr<void, void(*)(void *)>;
-        using update_fn_type = bool(process_handler &, Delta, void *);
+        using tick_fn_type = bool(process_handler &, Delta, void *);
+        using settle_fn_type = void(scheduler &, process_handler &);
         using abort_fn_type = void(process_handler &, bool);
-        using next_type = std::unique_ptr<process_handler>;
+        using release_fn_type = void(scheduler &, void *);
 
-        instance_type instance;
-        update_fn_type *update;
+        void *instance;
+        tick_fn_type *tick;
+        settle_fn_type *settle;
         abort_fn_type *abort;
-        next_type next;
+        release_fn_type *release;
+        std::size_t next;
+        bool dead;
+        bool background;
+        std::uint64_t stamp;
+        Delta offset;
+    };
+
+    struct sleeper {
+        Delta delay;
+    };
+
+    struct timer {
+        std::uint64_t deadline;
+        std::size_t index;
     };
 
     struct continuation {
-        continuation(process_handler *ref)
-            : handler{ref}
-        {
-            ENTT_ASSERT(handler);
-        }
+        continuation(scheduler *ref, const std::size_t pos, const bool parked = false)
+            : owner{ref},
+              chained{parked},
+              index{pos}
+        {}
 
         template<typename Proc, typename... Args>
         continuation then(Args &&... args) {
             static_assert(std::is_base_of_v<process<Proc, Delta>, Proc>, "Invalid process type");
-            auto proc = typename process_handler::instance_type{new Proc{std::forward<Args>(args)...}, &scheduler::deleter<Proc>};
-            handler->next.reset(new process_handler{std::move(proc), &scheduler::update<Proc>, &scheduler::abort<Proc>, nullptr});
-            handler = handler->next.get();
+            const auto pos = owner->template chain<Proc>(std::forward<Args>(args)...);
+            (chained ? owner->chains[index] : owner->handlers[index]).next = pos;
+            chained = true;
+            index = pos;
             return *this;
         }
 
@@ -75,38 +145,315 @@ class scheduler {
             return then<process_adaptor<std::decay_t<Func>, Delta>>(std::forward<Func>(func));
         }
 
+        continuation background() {
+            (chained ? owner->chains[index] : owner->handlers[index]).background = true;
+            return *this;
+        }
+
+        continuation wait(const Delta delay) {
+            const auto pos = owner->store(owner->make_sleeper(delay));
+            (chained ? owner->chains[index] : owner->handlers[index]).next = pos;
+            chained = true;
+            index = pos;
+            return *this;
+        }
+
     private:
-        process_handler *handler;
+        scheduler *owner;
+        bool chained;
+        std::size_t index;
     };
 
     template<typename Proc>
-    [[nodiscard]] static bool update(process_handler &handler, const Delta delta, void *data) {
-        auto *process = static_cast<Proc *>(handler.instance.get());
-        process->tick(delta, data);
+    [[nodiscard]] process_pool<Proc> & assure() {
+        const auto index = type_seq<Proc>::value();
+
+        if(!(index < pools.size())) {
+            pools.resize(std::size_t(index)+1u);
+        }
+
+        if(!pools[index]) {
+            pools[index].reset(new process_pool<Proc>{});
+        }
+
+        return static_cast<process_pool<Proc> &>(*pools[index]);
+    }
+
+    template<typename Proc, typename... Args>
+    [[nodiscard]] process_handler make(Args &&... args) {
+        return { assure<Proc>().allocate(std::forward<Args>(args)...), &scheduler::tick<Proc>, &scheduler::settle<Proc>, &scheduler::abort<Proc>, &scheduler::release<Proc>, null, false, false, clock, residue };
+    }
+
+    [[nodiscard]] process_handler make_sleeper(const Delta delay) {
+        return { assure<sleeper>().allocate(delay), &scheduler::sleep, nullptr, nullptr, &scheduler::release<sleeper>, null, false, false, clock, residue };
+    }
+
+    template<typename Proc, typename... Args>
+    [[nodiscard]] std::size_t chain(Args &&... args) {
+        return store(make<Proc>(std::forward<Args>(args)...));
+    }
+
+    [[nodiscard]] std::size_t store(const process_handler &handler) {
+        if(available.empty()) {
+            const auto cap = chains.capacity();
+            chains.push_back(handler);
+
+            if(chains.capacity() != cap) {
+                ENTT_ALLOC_TRACE("entt::scheduler::chain", type_id<process_handler>().name(), chains.capacity() * sizeof(process_handler));
+            }
+
+            return chains.size() - 1u;
+        }
+
+        const auto pos = available.back();
+        available.pop_back();
+        chains[pos] = handler;
+        return pos;
+    }
+
+    void discard(process_handler &handler) {
+        if(handler.instance) {
+            handler.release(*this, handler.instance);
+            handler.instance = nullptr;
+        }
+
+        for(auto pos = std::exchange(handler.next, null); pos != null; pos = std::exchange(chains[pos].next, null)) {
+            chains[pos].release(*this, chains[pos].instance);
+            available.push_back(pos);
+        }
+    }
+
+    void run(process_handler &handler, const Delta delta, void *data) {
+        if(handler.tick == &scheduler::sleep) {
+            park(handler);
+            handler.instance = nullptr;
+            handler.next = null;
+        } else if(handler.tick(handler, delta, data)) {
+            handler.settle(*this, handler);
+        }
+    }
+
+    void forward(const Delta delta) {
+        // whole ticks are counted apart, so that the time elapsed doesn't lose precision over long runs
+        const auto total = residue + delta;
+        const auto whole = static_cast<std::uint64_t>(total / resolution);
+        residue = (std::max)(Delta{}, Delta(total - resolution * whole));
+        clock += whole;
+    }
+
+    void stamp(process_handler &handler) const {
+        handler.stamp = clock;
+        handler.offset = residue;
+    }
+
+    [[nodiscard]] Delta since(const process_handler &handler) const {
+        return Delta(resolution * (clock - handler.stamp) + residue - handler.offset);
+    }
+
+    void step(process_handler &handler, const Delta delta, void *data) {
+        // background processes can skip updates, they receive the time elapsed since they last ran
+        run(handler, handler.background ? since(handler) : delta, data);
+        stamp(handler);
+    }
+
+    std::size_t park(const process_handler &handler) {
+        const auto span = residue + static_cast<sleeper *>(handler.instance)->delay;
+        auto length = static_cast<std::uint64_t>(span / resolution);
+        // delays are rounded up to the resolution of the wheel, they never expire early
+        length += (Delta(resolution * length) < span);
+        const auto deadline = clock + length;
+        const auto pos = store(handler);
+        schedule(timer{deadline, pos});
+        ++sleeping;
+        return pos;
+    }
+
+    static void push(std::vector<timer> &timers, const timer elem) {
+        const auto cap = timers.capacity();
+        timers.push_back(elem);
+
+        if(timers.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::scheduler::wait", type_id<timer>().name(), timers.capacity() * sizeof(timer));
+        }
+    }
+
+    void schedule(const timer elem) {
+        if(elem.deadline <= ticks) {
+            push(due, elem);
+        } else {
+            const auto diff = elem.deadline - ticks;
+            auto level = 0u;
+
+            while(level < wheel_levels && !(diff < (std::uint64_t{1u} << (wheel_bits * (level + 1u))))) {
+                ++level;
+            }
+
+            if(level == wheel_levels) {
+                push(overflow, elem);
+            } else {
+                push(wheel[level][(elem.deadline >> (wheel_bits * level)) & (wheel_slots - 1u)], elem);
+            }
+        }
+    }
+
+    void cascade(std::vector<timer> &from) {
+        std::vector<timer> pending{};
+        pending.swap(from);
+
+        for(auto &&elem: pending) {
+            schedule(elem);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t next_tick() const {
+        auto next = clock;
+
+        if(!overflow.empty()) {
+            next = (std::min)(next, (ticks | ((std::uint64_t{1u} << (wheel_bits * wheel_levels)) - 1u)) + 1u);
+        }
+
+        // slots of a level are cascaded when the ticks cross their boundaries, empty slots are skipped
+        for(auto level = 0u; level < wheel_levels; ++level) {
+            const auto shift = wheel_bits * level;
+            auto curr = ((ticks >> shift) + 1u) << shift;
+
+            for(auto count = 0u; count < wheel_slots && curr < next; ++count, curr += (std::uint64_t{1u} << shift)) {
+                if(!wheel[level][(curr >> shift) & (wheel_slots - 1u)].empty()) {
+                    next = curr;
+                }
+            }
+        }
+
+        return next;
+    }
+
+    void advance() {
+        if(!sleeping) {
+            ticks = (std::max)(ticks, clock);
+        } else {
+            while(ticks < clock) {
+                // nothing happens in between, the wheel jumps to the first tick with timers to move or wake up
+                ticks = next_tick();
+
+                if(!(ticks & ((std::uint64_t{1u} << (wheel_bits * wheel_levels)) - 1u))) {
+                    cascade(overflow);
+                }
+
+                // coarser levels first, so that timers can move down more than one level at once
+                for(auto level = wheel_levels - 1u; level; --level) {
+                    if(!(ticks & ((std::uint64_t{1u} << (wheel_bits * level)) - 1u))) {
+                        cascade(wheel[level][(ticks >> (wheel_bits * level)) & (wheel_slots - 1u)]);
+                    }
+                }
+
+                cascade(wheel[0u][ticks & (wheel_slots - 1u)]);
+                wake();
+            }
+        }
 
-        auto dead = process->dead();
+        wake();
+    }
+
+    void wake() {
+        // processes started by a delay can wait in turn, timers due in the meantime are woken up as well
+        for(std::size_t next{}; next < due.size(); ++next) {
+            const auto pos = due[next].index;
+            auto handler = chains[pos];
+            available.push_back(pos);
+            --sleeping;
+
+            handler.release(*this, handler.instance);
 
-        if(dead) {
-            if(handler.next && !process->rejected()) {
-                handler = std::move(*handler.next);
+            if(handler.next != null) {
+                auto child = chains[handler.next];
+                stamp(child);
+                available.push_back(handler.next);
                 // forces the process to exit the uninitialized state
-                dead = handler.update(handler, {}, nullptr);
+                run(child, {}, nullptr);
+
+                if(child.instance) {
+                    handlers.push_back(child);
+                }
+            }
+        }
+
+        due.clear();
+    }
+
+    void discard_sleepers() {
+        const auto release = [this](std::vector<timer> &elems) {
+            for(auto &&elem: elems) {
+                discard(chains[elem.index]);
+                available.push_back(elem.index);
+            }
+
+            elems.clear();
+        };
+
+        for(auto &&level: wheel) {
+            for(auto &&slot: level) {
+                release(slot);
+            }
+        }
+
+        release(overflow);
+        release(due);
+        sleeping = {};
+    }
+
+    void compact(const std::size_t length) {
+        std::size_t last{};
+
+        // handlers are compacted in place, processes attached in the meantime are moved down after the loop
+        for(std::size_t pos{}; pos < length; ++pos) {
+            cursor = (pos == cursor) ? last : cursor;
+
+            if(handlers[pos].instance) {
+                handlers[last++] = handlers[pos];
             } else {
-                handler.instance.reset();
+                discard(handlers[pos]);
             }
         }
 
-        return dead;
+        cursor = (cursor < length) ? cursor : last;
+
+        handlers.erase(std::copy(handlers.begin() + length, handlers.end(), handlers.begin() + last), handlers.end());
+    }
+
+    [[nodiscard]] static bool sleep(process_handler &, const Delta, void *) {
+        return false;
+    }
+
+    template<typename Proc>
+    [[nodiscard]] static bool tick(process_handler &handler, const Delta delta, void *data) {
+        auto *process = static_cast<Proc *>(handler.instance);
+        process->tick(delta, data);
+        return process->dead();
+    }
+
+    template<typename Proc>
+    static void settle(scheduler &owner, process_handler &handler) {
+        if(handler.next != null && !static_cast<Proc *>(handler.instance)->rejected()) {
+            const auto pos = handler.next;
+            owner.template release<Proc>(owner, handler.instance);
+            handler = owner.chains[pos];
+            owner.stamp(handler);
+            owner.available.push_back(pos);
+            // forces the process to exit the uninitialized state
+            owner.run(handler, {}, nullptr);
+        } else {
+            owner.discard(handler);
+        }
     }
 
     template<typename Proc>
     static void abort(process_handler &handler, const bool immediately) {
-        static_cast<Proc *>(handler.instance.get())->abort(immediately);
+        static_cast<Proc *>(handler.instance)->abort(immediately);
     }
 
     template<typename Proc>
-    static void deleter(void *proc) {
-        delete static_cast<Proc *>(proc);
+    static void release(scheduler &owner, void *proc) {
+        owner.assure<Proc>().release(static_cast<Proc *>(proc));
     }
 
 public:
@@ -114,20 +461,78 @@ public:
     using size_type = std::size_t;
 
     /*! @brief Default constructor. */
-    scheduler() = default;
+    scheduler()
+        : scheduler{Delta{1}}
+    {}
 
-    /*! @brief Default move constructor. */
-    scheduler(scheduler &&) = default;
+    /**
+     * @brief Constructs a scheduler with a given resolution for delays.
+     *
+     * Delays are rounded up to a multiple of the resolution. The default
+     * resolution is one unit of time.
+     *
+     * @param res The resolution of the timer wheel.
+     */
+    explicit scheduler(const Delta res)
+        : resolution{res}
+    {
+        ENTT_ASSERT(resolution > Delta{});
+    }
 
-    /*! @brief Default move assignment operator. @return This scheduler. */
-    scheduler & operator=(scheduler &&) = default;
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    scheduler(scheduler &&other)
+        : handlers{std::move(other.handlers)},
+          chains{std::move(other.chains)},
+          available{std::move(other.available)},
+          pools{std::move(other.pools)},
+          wheel{std::move(other.wheel)},
+          overflow{std::move(other.overflow)},
+          due{std::move(other.due)},
+          resolution{other.resolution},
+          residue{other.residue},
+          clock{other.clock},
+          ticks{other.ticks},
+          sleeping{std::exchange(other.sleeping, 0u)},
+          cursor{std::exchange(other.cursor, 0u)}
+    {}
+
+    /*! @brief Discards all scheduled processes. */
+    ~scheduler() {
+        clear();
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This scheduler.
+     */
+    scheduler & operator=(scheduler &&other) {
+        clear();
+        handlers = std::move(other.handlers);
+        chains = std::move(other.chains);
+        available = std::move(other.available);
+        pools = std::move(other.pools);
+        wheel = std::move(other.wheel);
+        overflow = std::move(other.overflow);
+        due = std::move(other.due);
+        resolution = other.resolution;
+        residue = other.residue;
+        clock = other.clock;
+        ticks = other.ticks;
+        sleeping = std::exchange(other.sleeping, 0u);
+        cursor = std::exchange(other.cursor, 0u);
+        return *this;
+    }
 
     /**
      * @brief Number of processes currently scheduled.
      * @return Number of processes currently scheduled.
      */
     [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
-        return handlers.size();
+        return handlers.size() + sleeping;
     }
 
     /**
@@ -135,7 +540,7 @@ public:
      * @return True if there are scheduled processes, false otherwise.
      */
     [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
-        return handlers.empty();
+        return handlers.empty() && !sleeping;
     }
 
     /**
@@ -145,7 +550,12 @@ public:
      * and never executed again.
      */
     void clear() {
+        for(auto &&handler: handlers) {
+            discard(handler);
+        }
+
         handlers.clear();
+        discard_sleepers();
     }
 
     /**
@@ -176,11 +586,17 @@ public:
     template<typename Proc, typename... Args>
     auto attach(Args &&... args) {
         static_assert(std::is_base_of_v<process<Proc, Delta>, Proc>, "Invalid process type");
-        auto proc = typename process_handler::instance_type{new Proc{std::forward<Args>(args)...}, &scheduler::deleter<Proc>};
-        process_handler handler{std::move(proc), &scheduler::update<Proc>, &scheduler::abort<Proc>, nullptr};
+        auto handler = make<Proc>(std::forward<Args>(args)...);
         // forces the process to exit the uninitialized state
-        handler.update(handler, {}, nullptr);
-        return continuation{&handlers.emplace_back(std::move(handler))};
+        run(handler, {}, nullptr);
+        const auto cap = handlers.capacity();
+        handlers.push_back(handler);
+
+        if(handlers.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::scheduler::attach", type_id<scheduler>().name(), handlers.capacity() * sizeof(process_handler));
+        }
+
+        return continuation{this, handlers.size() - 1u};
     }
 
     /**
@@ -240,6 +656,29 @@ public:
         return attach<Proc>(std::forward<Func>(func));
     }
 
+    /**
+     * @brief Schedules a delay.
+     *
+     * Returned value is an opaque object that can be used to attach a child to
+     * the delay. The child is scheduled once the given time has elapsed.<br/>
+     * Delays can also be appended to other processes by means of the `wait`
+     * member function of the returned object:
+     *
+     * @code{.cpp}
+     * scheduler.attach<my_process>().wait(cooldown).then<my_other_process>();
+     * @endcode
+     *
+     * Delays aren't executed during updates. They are kept in a timer wheel
+     * and their children are scheduled when they are due. Therefore, waiting
+     * processes don't cost anything per tick.
+     *
+     * @param delay The time to wait.
+     * @return An opaque object to use to concatenate processes.
+     */
+    auto wait(const Delta delay) {
+        return continuation{this, park(make_sleeper(delay)), true};
+    }
+
     /**
      * @brief Updates all scheduled processes.
      *
@@ -252,19 +691,130 @@ public:
      * @param data Optional data.
      */
     void update(const Delta delta, void *data = nullptr) {
-        bool clean = false;
+        ENTT_TRACE("entt::scheduler::update", type_id<scheduler>().name());
+        const auto length = handlers.size();
+        // delays that start during the update are measured from its end
+        forward(delta);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            // processes can attach other processes, handlers must not be accessed by reference
+            if(auto handler = handlers[pos]; handler.instance) {
+                step(handler, delta, data);
+                handlers[pos] = handler;
+            }
+        }
+
+        advance();
+        compact(length);
+    }
+
+    /**
+     * @brief Updates the scheduled processes within a time budget.
+     *
+     * Processes marked as background ones by means of the `background` member
+     * function of the objects returned by `attach` are sliced across updates.
+     * All the other processes run every time, no matter the budget.<br/>
+     * Background processes run in round-robin order until the budget is used
+     * up and the next update resumes from the first one left out. At least one
+     * of them runs every time, so that they always make progress. They receive
+     * the time elapsed since the last time they ran rather than the time
+     * elapsed since the last update.
+     *
+     * @sa update
+     *
+     * @tparam Rep Type of the number of ticks of the duration.
+     * @tparam Period Type of the tick period of the duration.
+     * @param delta Elapsed time.
+     * @param budget The time available for the processes.
+     * @param data Optional data.
+     */
+    template<typename Rep, typename Period>
+    void update(const Delta delta, const std::chrono::duration<Rep, Period> budget, void *data = nullptr) {
+        ENTT_TRACE("entt::scheduler::update", type_id<scheduler>().name());
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        const auto length = handlers.size();
+        forward(delta);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            if(auto handler = handlers[pos]; handler.instance && !handler.background) {
+                step(handler, delta, data);
+                handlers[pos] = handler;
+            }
+        }
+
+        const auto first = (cursor < length) ? cursor : size_type{};
+
+        for(size_type offset{}, count{}; offset < length; ++offset) {
+            const auto pos = (first + offset) % length;
 
-        for(auto pos = handlers.size(); pos; --pos) {
-            auto &handler = handlers[pos-1];
-            const bool dead = handler.update(handler, delta, data);
-            clean = clean || dead;
+            if(auto handler = handlers[pos]; handler.instance && handler.background) {
+                if(count && !(std::chrono::steady_clock::now() < deadline)) {
+                    cursor = pos;
+                    break;
+                }
+
+                step(handler, delta, data);
+                handlers[pos] = handler;
+                ++count;
+            }
         }
 
-        if(clean) {
-            handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](auto &handler) {
-                return !handler.instance;
-            }), handlers.end());
+        advance();
+        compact(length);
+    }
+
+    /**
+     * @brief Updates all scheduled processes in parallel.
+     *
+     * Processes are split in chunks and the executor is invoked with the number
+     * of chunks and a function object that accepts the index of a chunk. It's
+     * a suitable argument for a `thread_pool`. Tasks can run concurrently but
+     * the executor must not return before all of them have completed.<br/>
+     * Processes that terminate during the parallel step are handled afterwards
+     * by the calling thread, in the same order as they would be by `update`.
+     * Therefore, children are initialized and processes are destroyed
+     * sequentially and deterministically.
+     *
+     * @sa update
+     *
+     * @warning
+     * Processes are ticked concurrently from different threads and they share
+     * the user data. Attaching processes to the scheduler from within a process
+     * during a parallel update results in undefined behavior.
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @param executor A valid executor.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     * @param chunk Number of processes ticked by each task.
+     */
+    template<typename Exec>
+    void par_update(Exec executor, const Delta delta, void *data = nullptr, const size_type chunk = page_size) {
+        ENTT_ASSERT(chunk);
+        const auto length = handlers.size();
+        forward(delta);
+
+        if(const auto count = (length + chunk - 1u) / chunk; count) {
+            executor(count, [this, delta, data, length, chunk](const size_type index) {
+                for(auto pos = index * chunk, last = (std::min)(pos + chunk, length); pos < last; ++pos) {
+                    if(auto &&handler = handlers[pos]; handler.instance) {
+                        handler.dead = handler.tick(handler, handler.background ? since(handler) : delta, data);
+                        stamp(handler);
+                    }
+                }
+            });
         }
+
+        for(size_type pos{}; pos < length; ++pos) {
+            if(auto handler = handlers[pos]; handler.dead) {
+                handler.dead = false;
+                handler.settle(*this, handler);
+                handlers[pos] = handler;
+            }
+        }
+
+        advance();
+        compact(length);
     }
 
     /**
@@ -282,15 +832,31 @@ public:
         exec.swap(handlers);
 
         for(auto &&handler: exec) {
-            handler.abort(handler, immediately);
+            if(handler.instance) {
+                handler.abort(handler, immediately);
+            }
         }
 
         std::move(handlers.begin(), handlers.end(), std::back_inserter(exec));
         handlers.swap(exec);
+        // delays have nothing to abort, they are discarded along with their children
+        discard_sleepers();
     }
 
 private:
     std::vector<process_handler> handlers{};
+    std::vector<process_handler> chains{};
+    std::vector<size_type> available{};
+    std::vector<std::unique_ptr<basic_pool>> pools{};
+    std::array<std::array<std::vector<timer>, wheel_slots>, wheel_levels> wheel{};
+    std::vector<timer> overflow{};
+    std::vector<timer> due{};
+    Delta resolution;
+    Delta residue{};
+    std::uint64_t clock{};
+    std::uint64_t ticks{};
+    size_type sleeping{};
+    size_type cursor{};
 };
 
 
@@ -2,12 +2,20 @@
 #define ENTT_RESOURCE_CACHE_HPP
 
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <list>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
 #include "handle.hpp"
 #include "loader.hpp"
 #include "fwd.hpp"
@@ -24,6 +32,11 @@ namespace entt {
  * applications and can be freely inherited to add targeted functionalities for
  * large sized applications.
  *
+ * A cache can also be given a memory budget. In this case, resources that
+ * aren't referenced by any handle are discarded in least recently used order
+ * as soon as the budget is exceeded. The amount of memory used by a resource is
+ * reported by its loader.
+ *
  * @tparam Resource Type of resources managed by a cache.
  */
 template<typename Resource>
@@ -33,6 +46,46 @@ struct resource_cache {
     /*! @brief Type of resources managed by a cache. */
     using resource_type = Resource;
 
+    /*! @brief Statistics of a cache. */
+    struct stats_type {
+        /*! @brief Amount of memory used by the resources. */
+        size_type usage;
+        /*! @brief Memory budget of the cache. */
+        size_type budget;
+        /*! @brief Number of loads satisfied by the cache. */
+        size_type hits;
+        /*! @brief Number of loads that required a loader. */
+        size_type misses;
+        /*! @brief Number of resources discarded to stay within the budget. */
+        size_type evictions;
+    };
+
+private:
+    struct entry_type {
+        std::shared_ptr<Resource> resource;
+        size_type cost;
+        typename std::list<id_type>::iterator pos;
+    };
+
+    void insert(const id_type id, std::shared_ptr<Resource> resource, const size_type cost) {
+        ENTT_ASSERT(!contains(id));
+        resources.emplace(id, entry_type{std::move(resource), cost, order.insert(order.end(), id)});
+        ENTT_ALLOC_TRACE("entt::resource_cache::load", type_id<Resource>().name(), sizeof(typename decltype(resources)::value_type));
+        usage += cost;
+    }
+
+    void touch(typename std::unordered_map<id_type, entry_type>::iterator it) {
+        // the most recently used resources are kept at the end of the list
+        order.splice(order.end(), order, it->second.pos);
+    }
+
+    void erase(typename std::unordered_map<id_type, entry_type>::iterator it) {
+        usage -= it->second.cost;
+        order.erase(it->second.pos);
+        resources.erase(it);
+    }
+
+public:
     /*! @brief Default constructor. */
     resource_cache() = default;
 
@@ -66,6 +119,57 @@ struct resource_cache {
      */
     void clear() ENTT_NOEXCEPT {
         resources.clear();
+        requests.clear();
+        order.clear();
+        usage = {};
+    }
+
+    /**
+     * @brief Sets the memory budget of a cache.
+     *
+     * Resources that aren't referenced by any handle are discarded immediately
+     * if the new budget is exceeded.
+     *
+     * @param bytes Amount of memory the resources are allowed to use.
+     */
+    void budget(const size_type bytes) {
+        limit = bytes;
+        trim();
+    }
+
+    /**
+     * @brief Returns the memory budget of a cache.
+     * @return Amount of memory the resources are allowed to use.
+     */
+    [[nodiscard]] size_type budget() const ENTT_NOEXCEPT {
+        return limit;
+    }
+
+    /**
+     * @brief Returns the statistics of a cache.
+     * @return The statistics of the cache.
+     */
+    [[nodiscard]] stats_type stats() const ENTT_NOEXCEPT {
+        return { usage, limit, hits, misses, evictions };
+    }
+
+    /**
+     * @brief Discards the least recently used resources until the memory
+     * budget is satisfied.
+     *
+     * Only resources that aren't referenced by any handle are discarded.
+     * Caches invoke this function on their own whenever they load resources.
+     * It's mostly useful when handles are released and resources become
+     * unreferenced.
+     */
+    void trim() {
+        for(auto curr = order.begin(); curr != order.end() && usage > limit;) {
+            // the node of the list is erased along with the resource, the iterator is moved forward first
+            if(auto it = resources.find(*curr++); it->second.resource.use_count() == 1) {
+                erase(it);
+                ++evictions;
+            }
+        }
     }
 
     /**
@@ -78,7 +182,9 @@ struct resource_cache {
      *
      * @note
      * If the identifier is already present in the cache, this function does
-     * nothing and the arguments are simply discarded.
+     * nothing and the arguments are simply discarded.<br/>
+     * Loading a resource can discard other resources in case the memory budget
+     * of the cache is exceeded.
      *
      * @warning
      * If the resource cannot be loaded correctly, the returned handle will be
@@ -96,17 +202,176 @@ struct resource_cache {
         resource_handle<Resource> resource{};
 
         if(auto it = resources.find(id); it == resources.cend()) {
-            if(auto instance = Loader{}.get(std::forward<Args>(args)...); instance) {
-                resources[id] = instance;
+            ++misses;
+
+            if(const Loader loader{}; auto instance = loader.get(std::forward<Args>(args)...)) {
+                insert(id, instance, loader.cost(*instance));
                 resource = std::move(instance);
+                trim();
             }
         } else {
-            resource = it->second;
+            ++hits;
+            touch(it);
+            resource = it->second.resource;
         }
 
         return resource;
     }
 
+    /**
+     * @brief Loads the resources that correspond to a range of identifiers
+     * at once.
+     *
+     * Identifiers already present in the cache are skipped, as well as
+     * duplicates. The loader receives all the remaining ones in a single
+     * batch, so that it can sort them, read them in one pass and decode them
+     * in parallel if it wishes. The cache makes room for the new resources
+     * once before storing them.
+     *
+     * @note
+     * Arguments are shared by all the resources of the batch. Preloading
+     * resources can discard other resources in case the memory budget of the
+     * cache is exceeded.
+     *
+     * @sa resource_loader
+     *
+     * @tparam Loader Type of loader to use to load the resources if required.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to load the resources.
+     * @param first An iterator to the first element of the range of
+     * identifiers.
+     * @param last An iterator past the last element of the range of
+     * identifiers.
+     * @param args Arguments to use to load the resources if required.
+     * @return The number of resources loaded.
+     */
+    template<typename Loader, typename It, typename... Args>
+    size_type preload(It first, It last, Args &&... args) {
+        static_assert(std::is_base_of_v<resource_loader<Loader, Resource>, Loader>, "Invalid loader type");
+        std::vector<id_type> ids{};
+
+        for(; first != last; ++first) {
+            if(auto it = resources.find(*first); it == resources.cend()) {
+                ids.push_back(*first);
+            } else {
+                ++hits;
+                touch(it);
+            }
+        }
+
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        misses += ids.size();
+
+        const Loader loader{};
+        std::vector<std::shared_ptr<Resource>> loaded(ids.size());
+        loader.get_batch(ids.data(), ids.size(), loaded.data(), std::forward<Args>(args)...);
+        resources.reserve(resources.size() + ids.size());
+        size_type count{};
+
+        for(size_type pos{}, end = ids.size(); pos < end; ++pos) {
+            if(auto &&instance = loaded[pos]; instance) {
+                const auto cost = loader.cost(*instance);
+                insert(ids[pos], std::move(instance), cost);
+                ++count;
+            }
+        }
+
+        trim();
+        return count;
+    }
+
+    /**
+     * @brief Loads the resource that corresponds to a given identifier
+     * asynchronously.
+     *
+     * The loader runs as a task that is handed to the given function object,
+     * rather than on the calling thread. The signature of the function object
+     * should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Task task);
+     * @endcode
+     *
+     * Where the task is a copyable function object with signature `void()`.
+     * As an example, the `submit` member function of a thread pool fits the
+     * purpose.<br/>
+     * Requests for identifiers that are already present in the cache are
+     * satisfied immediately, while those for identifiers that are already
+     * being loaded are coalesced with the pending ones. Ready resources are
+     * published in the cache by invoking `sync`.
+     *
+     * @note
+     * Arguments are copied into the task and must be copyable. Moreover, the
+     * loader runs concurrently with the thread that owns the cache.
+     *
+     * @tparam Loader Type of loader to use to load the resource if required.
+     * @tparam Submit Type of function object to use to run the loader.
+     * @tparam Args Types of arguments to use to load the resource if required.
+     * @param submit A valid function object.
+     * @param id Unique resource identifier.
+     * @param args Arguments to use to load the resource if required.
+     * @return A future for the given resource.
+     */
+    template<typename Loader, typename Submit, typename... Args>
+    resource_future<Resource> load_async(Submit &&submit, const id_type id, Args &&... args) {
+        static_assert(std::is_base_of_v<resource_loader<Loader, Resource>, Loader>, "Invalid loader type");
+
+        if(auto it = requests.find(id); it != requests.cend()) {
+            return { it->second };
+        }
+
+        auto request = std::make_shared<internal::resource_request<Resource>>();
+
+        if(auto it = resources.find(id); it != resources.cend()) {
+            ++hits;
+            touch(it);
+            request->resource = it->second.resource;
+            request->ready.store(true, std::memory_order_relaxed);
+        } else {
+            ++misses;
+            requests.emplace(id, request);
+
+            submit([request, args = std::make_tuple(std::forward<Args>(args)...)]() {
+                const Loader loader{};
+                request->resource = std::apply([&loader](auto &&... curr) { return loader.get(curr...); }, args);
+                request->cost = request->resource ? loader.cost(*request->resource) : size_type{};
+                request->ready.store(true, std::memory_order_release);
+            });
+        }
+
+        return { std::move(request) };
+    }
+
+    /**
+     * @brief Publishes in the cache the resources loaded asynchronously so
+     * far.
+     *
+     * Requests whose loaders failed are discarded, as well as those for
+     * identifiers that were loaded synchronously in the meantime. Requests
+     * that are still pending are left untouched.<br/>
+     * Publishing resources can discard other resources in case the memory
+     * budget of the cache is exceeded.
+     *
+     * @return The number of requests that are still pending.
+     */
+    size_type sync() {
+        for(auto it = requests.begin(); it != requests.end();) {
+            if(auto &&request = *it->second; request.ready.load(std::memory_order_acquire)) {
+                if(request.resource && !contains(it->first)) {
+                    insert(it->first, request.resource, request.cost);
+                }
+
+                it = requests.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        trim();
+        return requests.size();
+    }
+
     /**
      * @brief Reloads a resource or loads it for the first time if not present.
      *
@@ -158,16 +423,41 @@ struct resource_cache {
      * A resource handle can be in a either valid or invalid state. In other
      * terms, a resource handle is properly initialized with a resource if the
      * cache contains the resource itself. Otherwise the returned handle is
-     * uninitialized and accessing it results in undefined behavior.
+     * uninitialized and accessing it results in undefined behavior.<br/>
+     * The resource counts as recently used when the memory budget of the cache
+     * is enforced.
      *
      * @sa resource_handle
      *
      * @param id Unique resource identifier.
      * @return A handle for the given resource.
      */
+    [[nodiscard]] resource_handle<Resource> handle(const id_type id) {
+        if(auto it = resources.find(id); it != resources.end()) {
+            touch(it);
+            return { it->second.resource };
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Creates a handle for a given resource identifier.
+     *
+     * Unlike its non-const counterpart, this function doesn't update the order
+     * in which resources are discarded to stay within the memory budget.
+     * Therefore, it's safe to invoke it concurrently with other const member
+     * functions.
+     *
+     * @param id Unique resource identifier.
+     * @return A handle for the given resource.
+     */
     [[nodiscard]] resource_handle<Resource> handle(const id_type id) const {
-        auto it = resources.find(id);
-        return { it == resources.end() ? nullptr : it->second };
+        if(auto it = resources.find(id); it != resources.cend()) {
+            return { it->second.resource };
+        }
+
+        return {};
     }
 
     /**
@@ -189,8 +479,11 @@ struct resource_cache {
      */
     void discard(const id_type id) {
         if(auto it = resources.find(id); it != resources.end()) {
-            resources.erase(it);
+            erase(it);
         }
+
+        // pending requests don't publish their resources anymore
+        requests.erase(id);
     }
 
     /**
@@ -221,15 +514,22 @@ struct resource_cache {
             if constexpr(std::is_invocable_v<Func, id_type>) {
                 func(curr->first);
             } else if constexpr(std::is_invocable_v<Func, resource_handle<Resource>>) {
-                func(resource_handle{ curr->second });
+                func(resource_handle{ curr->second.resource });
             } else {
-                func(curr->first, resource_handle{ curr->second });
+                func(curr->first, resource_handle{ curr->second.resource });
             }
         }
     }
 
 private:
-    std::unordered_map<id_type, std::shared_ptr<Resource>> resources;
+    std::unordered_map<id_type, entry_type> resources;
+    std::unordered_map<id_type, std::shared_ptr<internal::resource_request<Resource>>> requests;
+    std::list<id_type> order;
+    size_type limit{(std::numeric_limits<size_type>::max)()};
+    size_type usage{};
+    size_type hits{};
+    size_type misses{};
+    size_type evictions{};
 };
 
 
@@ -13,10 +13,22 @@ template<typename>
 class resource_handle;
 
 
+template<typename>
+class resource_future;
+
+
 template<typename, typename>
 class resource_loader;
 
 
+template<typename>
+class resource_pool;
+
+
+template<typename>
+class resource_ref;
+
+
 }
 
 
@@ -2,6 +2,9 @@
 #define ENTT_RESOURCE_HANDLE_HPP
 
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include "../config/config.h"
@@ -28,6 +31,9 @@ class resource_handle {
     /*! @brief Resource handles are friends of their caches. */
     friend struct resource_cache<Resource>;
 
+    /*! @brief Resource handles are friends of their futures. */
+    friend class resource_future<Resource>;
+
     resource_handle(std::shared_ptr<Resource> res) ENTT_NOEXCEPT
         : resource{std::move(res)}
     {}
@@ -106,6 +112,187 @@ private:
 };
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Resource>
+struct resource_request {
+    std::atomic<bool> ready{};
+    std::shared_ptr<Resource> resource{};
+    std::size_t cost{};
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
+/**
+ * @brief Handle for a resource that is loaded asynchronously.
+ *
+ * A future is pending until the loader has run. Then it's ready and it offers
+ * a shared resource handle for the resource, unless the loader failed. All the
+ * futures created for the same identifier share the same request.
+ *
+ * @tparam Resource Type of resource managed by a future.
+ */
+template<typename Resource>
+class resource_future {
+    /*! @brief Resource futures are friends of their caches. */
+    friend struct resource_cache<Resource>;
+
+    resource_future(std::shared_ptr<internal::resource_request<Resource>> req) ENTT_NOEXCEPT
+        : request{std::move(req)}
+    {}
+
+public:
+    /*! @brief Default constructor. */
+    resource_future() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Checks if the loader has run.
+     * @return True if the future is ready, false otherwise.
+     */
+    [[nodiscard]] bool ready() const ENTT_NOEXCEPT {
+        return request && request->ready.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns a handle for the resource, if it's ready.
+     * @return A handle that is invalid if the future is pending or if the
+     * resource couldn't be loaded.
+     */
+    [[nodiscard]] resource_handle<Resource> handle() const ENTT_NOEXCEPT {
+        return ready() ? resource_handle<Resource>{request->resource} : resource_handle<Resource>{};
+    }
+
+    /**
+     * @brief Returns true if a future refers to a request, false otherwise.
+     * @return True if the future refers to a request, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return static_cast<bool>(request);
+    }
+
+private:
+    std::shared_ptr<internal::resource_request<Resource>> request;
+};
+
+
+/**
+ * @brief Lightweight resource handle.
+ *
+ * A lightweight resource handle refers to a resource managed by a pool by
+ * means of its slot and of the generation of the slot. It's trivially copyable
+ * and doesn't keep the resource alive. Instead, it's invalidated as soon as the
+ * resource is discarded, even if another resource takes over its slot.<br/>
+ * Accessing a resource from a handle doesn't require any lookup.
+ *
+ * @sa resource_pool
+ *
+ * @tparam Resource Type of resource managed by a handle.
+ */
+template<typename Resource>
+class resource_ref {
+    /*! @brief Resource handles are friends of their pools. */
+    friend class resource_pool<Resource>;
+
+    resource_ref(resource_pool<Resource> *ref, const std::size_t pos, const std::uint32_t gen) ENTT_NOEXCEPT
+        : pool{ref},
+          index{pos},
+          generation{gen}
+    {}
+
+public:
+    /*! @brief Default constructor. */
+    resource_ref() ENTT_NOEXCEPT
+        : pool{},
+          index{},
+          generation{}
+    {}
+
+    /**
+     * @brief Gets a reference to the managed resource.
+     *
+     * @warning
+     * The behavior is undefined if the handle isn't valid.
+     *
+     * @return A reference to the managed resource.
+     */
+    [[nodiscard]] const Resource & get() const ENTT_NOEXCEPT {
+        ENTT_ASSERT(static_cast<bool>(*this));
+        return pool->at(index);
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] Resource & get() ENTT_NOEXCEPT {
+        return const_cast<Resource &>(std::as_const(*this).get());
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] operator const Resource & () const ENTT_NOEXCEPT {
+        return get();
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] operator Resource & () ENTT_NOEXCEPT {
+        return get();
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] const Resource & operator *() const ENTT_NOEXCEPT {
+        return get();
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] Resource & operator *() ENTT_NOEXCEPT {
+        return get();
+    }
+
+    /**
+     * @brief Gets a pointer to the managed resource.
+     *
+     * @warning
+     * The behavior is undefined if the handle isn't valid.
+     *
+     * @return A pointer to the managed resource.
+     */
+    [[nodiscard]] const Resource * operator->() const ENTT_NOEXCEPT {
+        return &get();
+    }
+
+    /*! @copydoc operator-> */
+    [[nodiscard]] Resource * operator->() ENTT_NOEXCEPT {
+        return const_cast<Resource *>(std::as_const(*this).operator->());
+    }
+
+    /**
+     * @brief Returns true if a handle refers to a resource that still exists,
+     * false otherwise.
+     * @return True if the handle is valid, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return pool && pool->valid(index, generation);
+    }
+
+private:
+    resource_pool<Resource> *pool;
+    std::size_t index;
+    std::uint32_t generation;
+};
+
+
 }
 
 
@@ -2,7 +2,11 @@
 #define ENTT_RESOURCE_LOADER_HPP
 
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include "../core/fwd.hpp"
 #include "fwd.hpp"
 
 
@@ -29,6 +33,16 @@ namespace entt {
  * };
  * @endcode
  *
+ * Optionally, a resource loader can also expose a public, const member function
+ * named `size` that accepts a resource and returns the amount of memory it
+ * uses, so that caches can account for it. Otherwise, the size of resource type
+ * is used.<br/>
+ * Resources preloaded in batches are loaded by invoking `load` once for each of
+ * them, with the identifier of the resource as the first argument. A loader
+ * can expose a public, const member function named `load_batch` that accepts
+ * the array of identifiers, their number, an array of shared pointers to fill
+ * and the remaining arguments, so as to load all the resources at once, for
+ * example sorted by position and from a single file.<br/>
  * In general, resource loaders should not have a state or retain data of any
  * type. They should let the cache manage their resources instead.
  *
@@ -43,6 +57,28 @@ namespace entt {
  */
 template<typename Loader, typename Resource>
 class resource_loader {
+    template<typename Type>
+    static auto measure(const Type &loader, const Resource &resource, int) -> decltype(static_cast<std::size_t>(loader.size(resource))) {
+        return static_cast<std::size_t>(loader.size(resource));
+    }
+
+    template<typename Type>
+    static std::size_t measure(const Type &, const Resource &, char) {
+        return sizeof(Resource);
+    }
+
+    template<typename Type, typename... Args>
+    static auto fill(const Type &loader, const id_type *ids, const std::size_t count, std::shared_ptr<Resource> *out, int, Args &&... args) -> decltype(loader.load_batch(ids, count, out, std::forward<Args>(args)...), void()) {
+        loader.load_batch(ids, count, out, std::forward<Args>(args)...);
+    }
+
+    template<typename Type, typename... Args>
+    static void fill(const Type &loader, const id_type *ids, const std::size_t count, std::shared_ptr<Resource> *out, char, Args &&... args) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            out[pos] = loader.load(ids[pos], args...);
+        }
+    }
+
     /*! @brief Resource loaders are friends of their caches. */
     friend struct resource_cache<Resource>;
 
@@ -56,6 +92,28 @@ class resource_loader {
     [[nodiscard]] std::shared_ptr<Resource> get(Args &&... args) const {
         return static_cast<const Loader *>(this)->load(std::forward<Args>(args)...);
     }
+
+    /**
+     * @brief Loads a batch of resources at once.
+     * @tparam Args Types of arguments for the loader.
+     * @param ids Identifiers of the resources to load.
+     * @param count Number of resources to load.
+     * @param out Array in which to store the resources just loaded.
+     * @param args Arguments for the loader.
+     */
+    template<typename... Args>
+    void get_batch(const id_type *ids, const std::size_t count, std::shared_ptr<Resource> *out, Args &&... args) const {
+        fill(*static_cast<const Loader *>(this), ids, count, out, 0, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns the amount of memory used by a resource.
+     * @param resource A valid resource.
+     * @return The amount of memory used by the resource.
+     */
+    [[nodiscard]] std::size_t cost(const Resource &resource) const {
+        return measure(*static_cast<const Loader *>(this), resource, 0);
+    }
 };
 
 
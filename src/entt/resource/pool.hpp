@@ -0,0 +1,298 @@
+#ifndef ENTT_RESOURCE_POOL_HPP
+#define ENTT_RESOURCE_POOL_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "handle.hpp"
+#include "fwd.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Pool of resources of a given type.
+ *
+ * A pool constructs its resources in place, within pages of slots. Resources
+ * are never moved nor copied once created and they don't require a dedicated
+ * allocation each.<br/>
+ * Identifiers are only used to look up resources the first time. After that,
+ * resources are accessed through lightweight handles that refer directly to
+ * their slots. Handles are trivially copyable and don't keep resources alive.
+ * Discarding a resource invalidates all its handles.
+ *
+ * @sa resource_ref
+ *
+ * @warning
+ * Handles refer to the pool that created them, whose lifetime must overcome
+ * that of the handles themselves.
+ *
+ * @tparam Resource Type of resources managed by a pool.
+ */
+template<typename Resource>
+class resource_pool {
+    /*! @brief Resource pools are friends of their handles. */
+    friend class resource_ref<Resource>;
+
+    static constexpr std::size_t page_size = 64u;
+
+    struct slot_type {
+        std::aligned_storage_t<sizeof(Resource), alignof(Resource)> storage;
+        id_type id;
+        std::uint32_t generation;
+        bool alive;
+    };
+
+    [[nodiscard]] slot_type & slot(const std::size_t pos) const ENTT_NOEXCEPT {
+        return pages[pos / page_size][pos % page_size];
+    }
+
+    [[nodiscard]] Resource & at(const std::size_t pos) const ENTT_NOEXCEPT {
+        return *std::launder(reinterpret_cast<Resource *>(&slot(pos).storage));
+    }
+
+    [[nodiscard]] bool valid(const std::size_t pos, const std::uint32_t generation) const ENTT_NOEXCEPT {
+        return pos < pages.size() * page_size && slot(pos).alive && slot(pos).generation == generation;
+    }
+
+    void release(const std::size_t pos) {
+        auto &&curr = slot(pos);
+        at(pos).~Resource();
+        curr.alive = false;
+        ++curr.generation;
+        available.push_back(pos);
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of resources managed by a pool. */
+    using resource_type = Resource;
+    /*! @brief Type of handles returned by a pool. */
+    using handle_type = resource_ref<Resource>;
+
+    /*! @brief Default constructor. */
+    resource_pool() = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    resource_pool(const resource_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    resource_pool(resource_pool &&) = delete;
+
+    /*! @brief Destroys all the resources. */
+    ~resource_pool() {
+        clear();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    resource_pool & operator=(const resource_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    resource_pool & operator=(resource_pool &&) = delete;
+
+    /**
+     * @brief Number of resources managed by a pool.
+     * @return Number of resources currently stored.
+     */
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return lookup.size();
+    }
+
+    /**
+     * @brief Returns true if a pool contains no resources, false otherwise.
+     * @return True if the pool contains no resources, false otherwise.
+     */
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return lookup.empty();
+    }
+
+    /**
+     * @brief Discards all the resources.
+     *
+     * Handles are invalidated while the pages of slots are kept for later
+     * uses.
+     */
+    void clear() {
+        for(auto &&curr: lookup) {
+            release(curr.second);
+        }
+
+        lookup.clear();
+    }
+
+    /**
+     * @brief Loads the resource that corresponds to a given identifier.
+     *
+     * In case an identifier isn't already present in the pool, its resource is
+     * constructed in place from the given arguments.
+     *
+     * @note
+     * If the identifier is already present in the pool, this function does
+     * nothing and the arguments are simply discarded.
+     *
+     * @tparam Args Types of arguments to use to construct the resource.
+     * @param id Unique resource identifier.
+     * @param args Arguments to use to construct the resource.
+     * @return A handle for the given resource.
+     */
+    template<typename... Args>
+    handle_type load(const id_type id, Args &&... args) {
+        if(const auto it = lookup.find(id); it != lookup.cend()) {
+            return { this, it->second, slot(it->second).generation };
+        }
+
+        if(available.empty()) {
+            const auto base = pages.size() * page_size;
+            pages.emplace_back(new slot_type[page_size]{});
+
+            for(auto pos = page_size; pos; --pos) {
+                available.push_back(base + pos - 1u);
+            }
+        }
+
+        const auto pos = available.back();
+        auto &&curr = slot(pos);
+
+        if constexpr(std::is_aggregate_v<Resource>) {
+            new (&curr.storage) Resource{std::forward<Args>(args)...};
+        } else {
+            new (&curr.storage) Resource(std::forward<Args>(args)...);
+        }
+
+        available.pop_back();
+        curr.id = id;
+        curr.alive = true;
+        lookup.emplace(id, pos);
+
+        return { this, pos, curr.generation };
+    }
+
+    /**
+     * @brief Reloads a resource or loads it for the first time if not present.
+     *
+     * Equivalent to the following snippet (pseudocode):
+     *
+     * @code{.cpp}
+     * pool.discard(id);
+     * pool.load(id, args...);
+     * @endcode
+     *
+     * @tparam Args Types of arguments to use to construct the resource.
+     * @param id Unique resource identifier.
+     * @param args Arguments to use to construct the resource.
+     * @return A handle for the given resource.
+     */
+    template<typename... Args>
+    handle_type reload(const id_type id, Args &&... args) {
+        return (discard(id), load(id, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Creates a handle for a given resource identifier.
+     *
+     * The returned handle is invalid if the pool doesn't contain the resource.
+     *
+     * @param id Unique resource identifier.
+     * @return A handle for the given resource.
+     */
+    [[nodiscard]] handle_type handle(const id_type id) {
+        if(const auto it = lookup.find(id); it != lookup.cend()) {
+            return { this, it->second, slot(it->second).generation };
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Checks if a pool contains a given identifier.
+     * @param id Unique resource identifier.
+     * @return True if the pool contains the resource, false otherwise.
+     */
+    [[nodiscard]] bool contains(const id_type id) const {
+        return (lookup.find(id) != lookup.cend());
+    }
+
+    /**
+     * @brief Discards the resource that corresponds to a given identifier.
+     *
+     * All the handles of the resource are invalidated.
+     *
+     * @param id Unique resource identifier.
+     */
+    void discard(const id_type id) {
+        if(const auto it = lookup.find(id); it != lookup.end()) {
+            release(it->second);
+            lookup.erase(it);
+        }
+    }
+
+    /**
+     * @brief Discards the resource to which a handle refers, if any.
+     * @param ref A handle created by this pool.
+     */
+    void discard(const handle_type ref) {
+        if(ref) {
+            ENTT_ASSERT(ref.pool == this);
+            discard(slot(ref.index).id);
+        }
+    }
+
+    /**
+     * @brief Iterates all resources.
+     *
+     * The function object is invoked for each resource. It is provided with
+     * either the resource identifier, the resource handle or both of them.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entt::id_type);
+     * void(entt::resource_ref<Resource>);
+     * void(const entt::id_type, entt::resource_ref<Resource>);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        for(auto first = lookup.begin(), last = lookup.end(); first != last;) {
+            const auto [id, pos] = *(first++);
+
+            if constexpr(std::is_invocable_v<Func, id_type>) {
+                func(id);
+            } else if constexpr(std::is_invocable_v<Func, handle_type>) {
+                func(handle_type{this, pos, slot(pos).generation});
+            } else {
+                func(id, handle_type{this, pos, slot(pos).generation});
+            }
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<slot_type[]>> pages{};
+    std::vector<size_type> available{};
+    std::unordered_map<id_type, size_type> lookup{};
+};
+
+
+}
+
+
+#endif
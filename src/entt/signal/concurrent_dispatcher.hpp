@@ -0,0 +1,325 @@
+#ifndef ENTT_SIGNAL_CONCURRENT_DISPATCHER_HPP
+#define ENTT_SIGNAL_CONCURRENT_DISPATCHER_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "dispatcher.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Dispatcher that accepts events from multiple threads.
+ *
+ * A concurrent dispatcher offers the same functionalities of a dispatcher to
+ * the thread that owns it. In addition, it hands out producers, that is
+ * per-thread append buffers with which other threads can enqueue events
+ * concurrently.<br/>
+ * Enqueuing an event through a producer never takes a lock. Each producer
+ * fills one of two sets of buffers, while the dispatcher drains the other one
+ * during an update. Before an update, producers are asked to swap their
+ * buffers and the dispatcher only waits for the events currently being
+ * enqueued, if any.
+ *
+ * Events are delivered in a deterministic order: those enqueued directly to the
+ * dispatcher come first, then those of the producers in the order in which
+ * producers were created. The events of a given producer are delivered in the
+ * order in which they were enqueued.
+ *
+ * @warning
+ * Producers must be created at a synchronization point, since creating them
+ * isn't thread safe. Similarly, listeners must be registered and updates must
+ * be performed by the owning thread only.<br/>
+ * Identifiers for the types of events are assigned on first use. Define
+ * `ENTT_USE_ATOMIC` when new types of events can show up from multiple threads
+ * at the same time. When a type table is bound, types of events must be
+ * registered with it before it's frozen and shared instead.
+ */
+class concurrent_dispatcher {
+    struct basic_queue {
+        virtual ~basic_queue() = default;
+        virtual void flush(dispatcher &) = 0;
+    };
+
+    template<typename Event>
+    struct queue_handler final: basic_queue {
+        static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
+
+        void flush(dispatcher &owner) override {
+            for(auto &&event: events) {
+                owner.enqueue(std::move(event));
+            }
+
+            events.clear();
+        }
+
+        std::vector<Event> events;
+    };
+
+public:
+    /*! @brief Per-thread append buffer for a concurrent dispatcher. */
+    class producer {
+        friend class concurrent_dispatcher;
+
+        template<typename Event>
+        [[nodiscard]] queue_handler<Event> & assure(std::vector<std::unique_ptr<basic_queue>> &queues) {
+            const auto index = type_seq<Event>::value();
+
+            if(!(index < queues.size())) {
+                queues.resize(std::size_t(index)+1u);
+            }
+
+            if(!queues[index]) {
+                queues[index].reset(new queue_handler<Event>{});
+            }
+
+            return static_cast<queue_handler<Event> &>(*queues[index]);
+        }
+
+        void swap_and_flush(dispatcher &owner) {
+            const auto curr = active.fetch_xor(1u, std::memory_order_seq_cst);
+
+            // waits for the event currently being enqueued, if any, rather than for the producer to be idle
+            if(const auto epoch = sequence.load(std::memory_order_seq_cst); epoch % 2u) {
+                while(sequence.load(std::memory_order_acquire) == epoch) {
+                    std::this_thread::yield();
+                }
+            }
+
+            for(auto &&queue: buffers[curr]) {
+                if(queue) {
+                    queue->flush(owner);
+                }
+            }
+        }
+
+    public:
+        /*! @brief Default constructor. */
+        producer() = default;
+
+        /*! @brief Default copy constructor, deleted on purpose. */
+        producer(const producer &) = delete;
+
+        /**
+         * @brief Default copy assignment operator, deleted on purpose.
+         * @return This producer.
+         */
+        producer & operator=(const producer &) = delete;
+
+        /**
+         * @brief Enqueues an event of the given type.
+         *
+         * This function is lock-free and it can be invoked safely while the
+         * dispatcher is being updated. However, a producer is meant to be used
+         * by a single thread at a time.
+         *
+         * @tparam Event Type of event to enqueue.
+         * @tparam Args Types of arguments to use to construct the event.
+         * @param args Arguments to use to construct the event.
+         */
+        template<typename Event, typename... Args>
+        void enqueue(Args &&... args) {
+            sequence.fetch_add(1u, std::memory_order_seq_cst);
+            auto &&events = assure<Event>(buffers[active.load(std::memory_order_seq_cst)]).events;
+
+            if constexpr(std::is_aggregate_v<Event>) {
+                events.push_back(Event{std::forward<Args>(args)...});
+            } else {
+                events.emplace_back(std::forward<Args>(args)...);
+            }
+
+            sequence.fetch_add(1u, std::memory_order_release);
+        }
+
+        /**
+         * @brief Enqueues an event of the given type.
+         * @sa enqueue
+         * @tparam Event Type of event to enqueue.
+         * @param event An instance of the given type of event.
+         */
+        template<typename Event>
+        void enqueue(Event &&event) {
+            enqueue<std::decay_t<Event>, Event>(std::forward<Event>(event));
+        }
+
+    private:
+        std::vector<std::unique_ptr<basic_queue>> buffers[2u]{};
+        std::atomic<std::size_t> active{};
+        std::atomic<std::size_t> sequence{};
+    };
+
+    /**
+     * @brief Creates a new producer.
+     *
+     * Producers are owned by the dispatcher and are destroyed along with it.
+     *
+     * @warning
+     * This function isn't thread safe and it should be invoked only at a
+     * synchronization point.
+     *
+     * @return A reference to the newly created producer.
+     */
+    [[nodiscard]] producer & make_producer() {
+        return *producers.emplace_back(new producer{});
+    }
+
+    /**
+     * @brief Increases the capacity of the queue for the given event.
+     * @sa dispatcher::reserve
+     * @tparam Event Type of event for which to reserve room.
+     * @param cap Desired capacity.
+     */
+    template<typename Event>
+    void reserve(const std::size_t cap) {
+        events.reserve<Event>(cap);
+    }
+
+    /**
+     * @brief Returns a sink object for the given event.
+     * @sa dispatcher::sink
+     * @tparam Event Type of event of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Event>
+    [[nodiscard]] auto sink() {
+        return events.sink<Event>();
+    }
+
+    /**
+     * @brief Returns a sink object for batches of the given event.
+     * @sa dispatcher::batch_sink
+     * @tparam Event Type of event of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Event>
+    [[nodiscard]] auto batch_sink() {
+        return events.batch_sink<Event>();
+    }
+
+    /**
+     * @brief Triggers an immediate event of the given type.
+     * @sa dispatcher::trigger
+     * @tparam Event Type of event to trigger.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Arguments to use to construct the event.
+     */
+    template<typename Event, typename... Args>
+    void trigger(Args &&... args) {
+        events.trigger<Event>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Triggers an immediate event of the given type.
+     * @sa dispatcher::trigger
+     * @tparam Event Type of event to trigger.
+     * @param event An instance of the given type of event.
+     */
+    template<typename Event>
+    void trigger(Event &&event) {
+        events.trigger(std::forward<Event>(event));
+    }
+
+    /**
+     * @brief Enqueues an event of the given type from the owning thread.
+     * @sa dispatcher::enqueue
+     * @tparam Event Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Arguments to use to construct the event.
+     */
+    template<typename Event, typename... Args>
+    void enqueue(Args &&... args) {
+        events.enqueue<Event>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Enqueues an event of the given type from the owning thread.
+     * @sa dispatcher::enqueue
+     * @tparam Event Type of event to enqueue.
+     * @param event An instance of the given type of event.
+     */
+    template<typename Event>
+    void enqueue(Event &&event) {
+        events.enqueue(std::forward<Event>(event));
+    }
+
+    /**
+     * @brief Utility function to disconnect everything related to a given value
+     * or instance from a dispatcher.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type &value_or_instance) {
+        events.disconnect(value_or_instance);
+    }
+
+    /**
+     * @brief Utility function to disconnect everything related to a given value
+     * or instance from a dispatcher.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    template<typename Type>
+    void disconnect(Type *value_or_instance) {
+        events.disconnect(value_or_instance);
+    }
+
+    /**
+     * @brief Discards all the events queued so far.
+     *
+     * Events that producers are enqueuing concurrently aren't affected.
+     *
+     * @tparam Event Type of events to discard.
+     */
+    template<typename... Event>
+    void clear() {
+        collect();
+        events.clear<Event...>();
+    }
+
+    /**
+     * @brief Delivers all the pending events of the given type.
+     *
+     * Events of other types collected from the producers are kept until they
+     * are delivered or discarded.
+     *
+     * @tparam Event Type of events to send.
+     */
+    template<typename Event>
+    void update() {
+        collect();
+        events.update<Event>();
+    }
+
+    /*! @brief Delivers all the pending events. */
+    void update() {
+        collect();
+        events.update();
+    }
+
+private:
+    void collect() {
+        for(auto &&curr: producers) {
+            curr->swap_and_flush(events);
+        }
+    }
+
+    dispatcher events{};
+    std::vector<std::unique_ptr<producer>> producers{};
+};
+
+
+}
+
+
+#endif
@@ -6,8 +6,10 @@
 #include <cstddef>
 #include <utility>
 #include <functional>
+#include <new>
 #include <type_traits>
 #include "../config/config.h"
+#include "fwd.hpp"
 
 
 namespace entt {
@@ -358,6 +360,209 @@ delegate(Ret(*)(const void *, Args...), const void * = nullptr) ENTT_NOEXCEPT
 -> delegate<Ret(Args...)>;
 
 
+/**
+ * @brief Basic owning delegate implementation.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ */
+template<typename, std::size_t>
+class owning_delegate;
+
+
+/**
+ * @brief Utility class to use to send around callable objects with their state.
+ *
+ * Owning counterpart of a delegate. Callable objects, such as capturing lambdas
+ * or delegates themselves, are copied in an inline buffer and their lifetime
+ * is bound to that of the owning delegate. No allocation ever takes place and
+ * invoking the delegate results in a single indirect call.<br/>
+ * Callable objects must fit the buffer, must be copy constructible and nothrow
+ * move constructible. Otherwise, a compile-time error is raised.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the inline buffer in bytes.
+ */
+template<typename Ret, typename... Args, std::size_t Len>
+class owning_delegate<Ret(Args...), Len> {
+    using storage_type = std::aligned_storage_t<Len>;
+
+    enum class operation { COPY, MOVE, DESTROY };
+
+    template<typename Func>
+    static void basic_vtable(const operation op, const void *from, void *to) {
+        auto *instance = static_cast<Func *>(const_cast<void *>(from));
+
+        switch(op) {
+        case operation::COPY:
+            new (to) Func{std::as_const(*instance)};
+            break;
+        case operation::MOVE:
+            new (to) Func{std::move(*instance)};
+            [[fallthrough]];
+        case operation::DESTROY:
+            instance->~Func();
+            break;
+        }
+    }
+
+    template<typename Func>
+    static Ret basic_invoke(const void *instance, Args... args) {
+        return Ret(std::invoke(*static_cast<Func *>(const_cast<void *>(instance)), std::forward<Args>(args)...));
+    }
+
+    void steal(owning_delegate &other) ENTT_NOEXCEPT {
+        if(other.vtable) {
+            other.vtable(operation::MOVE, &other.storage, &storage);
+        }
+
+        fn = std::exchange(other.fn, nullptr);
+        vtable = std::exchange(other.vtable, nullptr);
+    }
+
+public:
+    /*! @brief Function type of the delegate. */
+    using type = Ret(Args...);
+    /*! @brief Return type of the delegate. */
+    using result_type = Ret;
+
+    /*! @brief Default constructor. */
+    owning_delegate() ENTT_NOEXCEPT
+        : storage{}, fn{nullptr}, vtable{nullptr}
+    {}
+
+    /**
+     * @brief Constructs an owning delegate from a callable object.
+     * @tparam Func Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, owning_delegate>>>
+    owning_delegate(Func &&func)
+        : owning_delegate{}
+    {
+        emplace(std::forward<Func>(func));
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    owning_delegate(const owning_delegate &other)
+        : owning_delegate{}
+    {
+        if(other.vtable) {
+            other.vtable(operation::COPY, &other.storage, &storage);
+        }
+
+        fn = other.fn;
+        vtable = other.vtable;
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    owning_delegate(owning_delegate &&other) ENTT_NOEXCEPT
+        : owning_delegate{}
+    {
+        steal(other);
+    }
+
+    /*! @brief Destroys the callable object, if any. */
+    ~owning_delegate() {
+        reset();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This owning delegate.
+     */
+    owning_delegate & operator=(const owning_delegate &other) {
+        if(this != &other) {
+            *this = owning_delegate{other};
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This owning delegate.
+     */
+    owning_delegate & operator=(owning_delegate &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            reset();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the callable object of an owning delegate.
+     * @tparam Func Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Func>
+    void emplace(Func &&func) {
+        using callable_type = std::decay_t<Func>;
+        static_assert(sizeof(callable_type) <= sizeof(storage_type) && alignof(callable_type) <= alignof(storage_type), "Callable object too large");
+        static_assert(std::is_nothrow_move_constructible_v<callable_type> && std::is_copy_constructible_v<callable_type>, "Invalid callable object");
+        static_assert(std::is_invocable_r_v<Ret, callable_type &, Args...>, "Invalid signature");
+
+        reset();
+        new (&storage) callable_type{std::forward<Func>(func)};
+        fn = &basic_invoke<callable_type>;
+        vtable = &basic_vtable<callable_type>;
+    }
+
+    /**
+     * @brief Resets an owning delegate and destroys its callable object.
+     *
+     * After a reset, an owning delegate cannot be invoked anymore.
+     */
+    void reset() ENTT_NOEXCEPT {
+        if(vtable) {
+            vtable(operation::DESTROY, &storage, nullptr);
+        }
+
+        fn = nullptr;
+        vtable = nullptr;
+    }
+
+    /**
+     * @brief Triggers an owning delegate.
+     *
+     * @warning
+     * Attempting to trigger an invalid delegate results in undefined
+     * behavior.
+     *
+     * @param args Arguments to use to invoke the underlying function.
+     * @return The value returned by the underlying function.
+     */
+    Ret operator()(Args... args) const {
+        ENTT_ASSERT(fn);
+        return fn(&storage, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether an owning delegate actually stores a callable.
+     * @return False if the delegate is empty, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const ENTT_NOEXCEPT {
+        return !(fn == nullptr);
+    }
+
+private:
+    storage_type storage;
+    Ret(* fn)(const void *, Args...);
+    void(* vtable)(const operation, const void *, void *);
+};
+
+
 }
 
 
@@ -2,6 +2,9 @@
 #define ENTT_SIGNAL_DISPATCHER_HPP
 
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
@@ -9,6 +12,7 @@
 #include <vector>
 #include "../config/config.h"
 #include "../core/fwd.hpp"
+#include "../core/memory.hpp"
 #include "../core/type_info.hpp"
 #include "sigh.hpp"
 
@@ -32,8 +36,15 @@ class dispatcher {
     struct basic_pool {
         virtual ~basic_pool() = default;
         virtual void publish() = 0;
+        virtual void refill() = 0;
+        virtual std::size_t deliver(const std::size_t) = 0;
+        [[nodiscard]] virtual bool carried() const ENTT_NOEXCEPT = 0;
         virtual void disconnect(void *) = 0;
         virtual void clear() ENTT_NOEXCEPT = 0;
+
+        std::vector<std::pair<id_type, bool>> resources{};
+        int precedence{};
+        bool tracked{};
     };
 
     template<typename Event>
@@ -42,47 +53,102 @@ class dispatcher {
 
         using signal_type = sigh<void(Event &)>;
         using sink_type = typename signal_type::sink_type;
+        using batch_signal_type = sigh<void(Event *, const std::size_t)>;
+        using batch_sink_type = typename batch_signal_type::sink_type;
 
         void publish() override {
-            const auto length = events.size();
+            // events carried over from a previous update go first
+            deliver(delivering.size());
+            refill();
+            deliver(delivering.size());
+        }
+
+        void refill() override {
+            // events enqueued by the listeners go in the other buffer and wait for the next update
+            if(offset == delivering.size()) {
+                delivering.clear();
+                delivering.swap(events);
+                offset = {};
+            }
+        }
+
+        std::size_t deliver(const std::size_t count) override {
+            const auto length = (std::min)(count, delivering.size() - offset);
+
+            if(length) {
+                ENTT_TRACE("entt::dispatcher::update", type_id<Event>().name());
+                // the offset is moved in advance, so that clear can drop the events not yet delivered
+                auto *first = delivering.data() + std::exchange(offset, offset + length);
+                batch.publish(first, length);
+
+                for(auto *last = first + length; first != last; ++first) {
+                    signal.publish(*first);
+                }
 
-            for(std::size_t pos{}; pos < length; ++pos) {
-                signal.publish(events[pos]);
+                if(offset == delivering.size()) {
+                    delivering.clear();
+                    offset = {};
+                }
             }
 
-            events.erase(events.cbegin(), events.cbegin()+length);
+            return length;
+        }
+
+        [[nodiscard]] bool carried() const ENTT_NOEXCEPT override {
+            return offset != delivering.size();
         }
 
         void disconnect(void *instance) override {
             sink().disconnect(instance);
+            batch_sink().disconnect(instance);
         }
 
         void clear() ENTT_NOEXCEPT override {
+            delivering.erase(delivering.begin() + offset, delivering.end());
             events.clear();
         }
 
+        void reserve(const std::size_t cap) {
+            events.reserve(cap);
+            delivering.reserve(cap);
+        }
+
         [[nodiscard]] sink_type sink() ENTT_NOEXCEPT {
             return entt::sink{signal};
         }
 
+        [[nodiscard]] batch_sink_type batch_sink() ENTT_NOEXCEPT {
+            return entt::sink{batch};
+        }
+
         template<typename... Args>
         void trigger(Args &&... args) {
             Event instance{std::forward<Args>(args)...};
+            batch.publish(&instance, 1u);
             signal.publish(instance);
         }
 
         template<typename... Args>
         void enqueue(Args &&... args) {
+            const auto cap = events.capacity();
+
             if constexpr(std::is_aggregate_v<Event>) {
                 events.push_back(Event{std::forward<Args>(args)...});
             } else {
                 events.emplace_back(std::forward<Args>(args)...);
             }
+
+            if(events.capacity() != cap) {
+                ENTT_ALLOC_TRACE("entt::dispatcher::enqueue", type_id<Event>().name(), events.capacity() * sizeof(Event));
+            }
         }
 
     private:
         signal_type signal{};
+        batch_signal_type batch{};
         std::vector<Event> events;
+        std::vector<Event> delivering;
+        std::size_t offset{};
     };
 
     template<typename Event>
@@ -95,11 +161,109 @@ class dispatcher {
 
         if(!pools[index]) {
             pools[index].reset(new pool_handler<Event>{});
+            ENTT_ALLOC_TRACE("entt::dispatcher::assure", type_id<Event>().name(), sizeof(pool_handler<Event>));
+            reorder(index);
         }
 
         return static_cast<pool_handler<Event> &>(*pools[index]);
     }
 
+    [[nodiscard]] auto position(const std::size_t index) const {
+        // higher priorities first, ties are delivered in reverse order of type
+        return std::upper_bound(order.cbegin(), order.cend(), index, [this](const auto lhs, const auto rhs) {
+            return pools[lhs]->precedence > pools[rhs]->precedence || (pools[lhs]->precedence == pools[rhs]->precedence && lhs > rhs);
+        });
+    }
+
+    void place(const std::size_t index) {
+        const auto cap = order.capacity();
+        order.insert(position(index), index);
+
+        if(order.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::dispatcher::assure", type_id<dispatcher>().name(), order.capacity() * sizeof(std::size_t));
+        }
+    }
+
+    void reorder(const std::size_t index) {
+        // listeners can't invalidate the order while it's being visited
+        if(dispatching) {
+            deferred.push_back(index);
+        } else {
+            if(const auto it = std::find(order.cbegin(), order.cend(), index); it != order.cend()) {
+                order.erase(it);
+            }
+
+            place(index);
+        }
+    }
+
+    void begin_dispatch() ENTT_NOEXCEPT {
+        ++dispatching;
+    }
+
+    void end_dispatch() {
+        if(!--dispatching && !deferred.empty()) {
+            std::sort(deferred.begin(), deferred.end());
+            deferred.erase(std::unique(deferred.begin(), deferred.end()), deferred.end());
+            order.erase(std::remove_if(order.begin(), order.end(), [this](const auto index) { return std::binary_search(deferred.cbegin(), deferred.cend(), index); }), order.end());
+
+            for(auto &&index: deferred) {
+                place(index);
+            }
+
+            deferred.clear();
+        }
+    }
+
+    [[nodiscard]] bool carried() const {
+        return std::any_of(order.cbegin(), order.cend(), [this](const auto index) { return pools[index]->carried(); });
+    }
+
+    [[nodiscard]] bool independent(const std::size_t first, const std::size_t last) const {
+        const auto &curr = *pools[order[last]];
+
+        // resources written by an event can be neither read nor written by the others
+        return curr.tracked && std::all_of(order.cbegin() + first, order.cbegin() + last, [this, &curr](const auto index) {
+            return std::none_of(curr.resources.cbegin(), curr.resources.cend(), [&other = pools[index]->resources](const auto &lhs) {
+                return std::any_of(other.cbegin(), other.cend(), [&lhs](const auto &rhs) { return lhs.first == rhs.first && (lhs.second || rhs.second); });
+            });
+        });
+    }
+
+    template<typename Func>
+    std::size_t drain(Func func) {
+        std::size_t count{};
+
+        // arenas are swapped only when all the events allocated so far are about to be delivered
+        if(!carried()) {
+            current = !current;
+        }
+
+        begin_dispatch();
+
+        for(auto &&index: order) {
+            pools[index]->refill();
+        }
+
+        for(auto &&index: order) {
+            for(std::size_t length = func(count); length; length = func(count)) {
+                if(const auto curr = pools[index]->deliver(length); curr) {
+                    count += curr;
+                } else {
+                    break;
+                }
+            }
+        }
+
+        end_dispatch();
+
+        if(!carried()) {
+            arenas[!current].reset();
+        }
+
+        return count;
+    }
+
 public:
     /**
      * @brief Returns a sink object for the given event.
@@ -123,6 +287,107 @@ public:
         return assure<Event>().sink();
     }
 
+    /**
+     * @brief Returns a sink object for batches of the given event.
+     *
+     * A sink is an opaque object used to connect listeners to events.<br/>
+     * Batch listeners receive all the events of the given type delivered by an
+     * update at once, before the listeners connected to the sink returned by
+     * `sink`. Immediate events are delivered as batches of a single element.
+     *
+     * The function type for a listener is _compatible_ with:
+     * @code{.cpp}
+     * void(Event *, const std::size_t);
+     * @endcode
+     *
+     * Where the first argument points to the first event of a contiguous
+     * array and the second one is the number of events of the batch.<br/>
+     * The order of invocation of the listeners isn't guaranteed.
+     *
+     * @sa sink
+     *
+     * @tparam Event Type of event of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Event>
+    [[nodiscard]] auto batch_sink() {
+        return assure<Event>().batch_sink();
+    }
+
+    /**
+     * @brief Increases the capacity of the queue for the given event.
+     *
+     * Queues are double-buffered and reuse their capacity across updates.
+     * Therefore, reserving enough room for the events of a tick upfront
+     * prevents any further allocation.
+     *
+     * @tparam Event Type of event for which to reserve room.
+     * @param cap Desired capacity.
+     */
+    template<typename Event>
+    void reserve(const std::size_t cap) {
+        assure<Event>().reserve(cap);
+    }
+
+    /**
+     * @brief Sets the priority of the given event.
+     *
+     * Queued events are delivered in order of priority, from the highest to
+     * the lowest one. Events with the same priority are delivered in reverse
+     * order of type. The default priority is zero.
+     *
+     * @tparam Event Type of event of which to set the priority.
+     * @param value The priority of the event.
+     */
+    template<typename Event>
+    void priority(const int value) {
+        auto &cpool = assure<Event>();
+        cpool.precedence = value;
+        reorder(static_cast<std::size_t>(type_seq<Event>::value()));
+    }
+
+    /**
+     * @brief Declares the resources accessed by the listeners of an event.
+     *
+     * Resources are usually component types, although any type works for this
+     * purpose. Const-qualified types are only read by the listeners, all the
+     * other types are also written.<br/>
+     * Events that declare their resources can be delivered at the same time
+     * by `par_update`, as long as none of them writes a resource that another
+     * one reads or writes. Events that never declared their resources are
+     * always delivered alone.
+     *
+     * @tparam Event Type of event for which to declare the resources.
+     * @tparam Type Types of resources accessed by the listeners.
+     */
+    template<typename Event, typename... Type>
+    void resources() {
+        auto &cpool = assure<Event>();
+        cpool.resources = { { type_hash<std::remove_const_t<Type>>::value(), !std::is_const_v<Type> }... };
+        cpool.tracked = true;
+    }
+
+    /**
+     * @brief Returns the arena to use for the payloads of the queued events.
+     *
+     * Events can store strings or arrays allocated from the arena instead of
+     * owning containers, so that enqueuing them doesn't allocate in steady
+     * state. The arena is reset in bulk once all the events allocated from it
+     * have been delivered by an update.<br/>
+     * Arenas are double-buffered. Listeners can then allocate from the arena
+     * the payloads of the events they enqueue during an update.
+     *
+     * @warning
+     * Views allocated from the arena are invalidated when the events are
+     * delivered and shouldn't be kept any further. Events delivered by
+     * `update<Event>` don't reset the arena.
+     *
+     * @return A reference to the arena for the events queued at the moment.
+     */
+    [[nodiscard]] entt::arena & arena() ENTT_NOEXCEPT {
+        return arenas[current];
+    }
+
     /**
      * @brief Triggers an immediate event of the given type.
      *
@@ -233,7 +498,9 @@ public:
      *
      * This method is blocking and it doesn't return until all the events are
      * delivered to the registered listeners. It's responsibility of the users
-     * to reduce at a minimum the time spent in the bodies of the listeners.
+     * to reduce at a minimum the time spent in the bodies of the listeners.<br/>
+     * Events enqueued by the listeners during an update are delivered with the
+     * next one.
      *
      * @tparam Event Type of events to send.
      */
@@ -249,16 +516,112 @@ public:
      * delivered to the registered listeners. It's responsibility of the users
      * to reduce at a minimum the time spent in the bodies of the listeners.
      */
-    void update() const {
-        for(auto pos = pools.size(); pos; --pos) {
-            if(auto &&cpool = pools[pos-1]; cpool) {
-                cpool->publish();
+    void update() {
+        if(!carried()) {
+            current = !current;
+        }
+
+        begin_dispatch();
+
+        for(auto &&index: order) {
+            pools[index]->publish();
+        }
+
+        end_dispatch();
+        arenas[!current].reset();
+    }
+
+    /**
+     * @brief Delivers all the pending events, independent events in parallel.
+     *
+     * Events are visited in order of priority. Consecutive events that don't
+     * conflict on their resources are delivered at the same time, one task for
+     * each type of event. The signature of the executor should be equivalent
+     * to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t count, Task task);
+     * @endcode
+     *
+     * Where `task` must be invoked once for each index in `[0, count)` and the
+     * executor doesn't return until all tasks are completed.
+     *
+     * @warning
+     * Listeners invoked in parallel must not trigger nor enqueue events and
+     * must not allocate from the arena of the dispatcher.
+     *
+     * @sa resources
+     *
+     * @tparam Exec Type of executor to use to run the tasks.
+     * @param executor A valid executor.
+     */
+    template<typename Exec>
+    void par_update(Exec executor) {
+        if(!carried()) {
+            current = !current;
+        }
+
+        begin_dispatch();
+
+        for(std::size_t first{}, last{}; first < order.size(); first = last) {
+            for(last = first + 1u; pools[order[first]]->tracked && last < order.size() && independent(first, last); ++last);
+
+            if(last - first == 1u) {
+                pools[order[first]]->publish();
+            } else {
+                executor(last - first, [this, first](const std::size_t pos) {
+                    pools[order[first + pos]]->publish();
+                });
             }
         }
+
+        end_dispatch();
+        arenas[!current].reset();
+    }
+
+    /**
+     * @brief Delivers the pending events until a budget is used up.
+     *
+     * Events are delivered in order of priority. Those that don't fit the
+     * budget are kept aside and delivered first by the next update, before
+     * the events enqueued in the meantime.<br/>
+     * Events enqueued by the listeners during an update are never delivered
+     * by the same update.
+     *
+     * @param budget The maximum number of events to deliver.
+     * @return The number of events delivered.
+     */
+    std::size_t update(const std::size_t budget) {
+        return drain([budget](const std::size_t count) { return budget - count; });
+    }
+
+    /**
+     * @brief Delivers the pending events until a budget is used up.
+     *
+     * Events are delivered one at a time and the time elapsed is checked after
+     * each of them. Batch listeners receive batches of a single element in
+     * this case.
+     *
+     * @sa update
+     *
+     * @tparam Rep Type of the number of ticks of the duration.
+     * @tparam Period Type of the tick period of the duration.
+     * @param budget The maximum time to spend delivering events.
+     * @return The number of events delivered.
+     */
+    template<typename Rep, typename Period>
+    std::size_t update(const std::chrono::duration<Rep, Period> budget) {
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        return drain([deadline](const std::size_t) { return std::size_t{std::chrono::steady_clock::now() < deadline}; });
     }
 
 private:
     std::vector<std::unique_ptr<basic_pool>> pools;
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> deferred;
+    std::array<entt::arena, 2u> arenas;
+    std::size_t current{};
+    std::size_t dispatching{};
 };
 
 
@@ -3,9 +3,9 @@
 
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
-#include <list>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -45,6 +45,7 @@ class emitter {
         virtual ~basic_pool() = default;
         virtual bool empty() const ENTT_NOEXCEPT = 0;
         virtual void clear() ENTT_NOEXCEPT = 0;
+        virtual void update(Derived &) = 0;
     };
 
     template<typename Event>
@@ -52,73 +53,143 @@ class emitter {
         static_assert(std::is_same_v<Event, std::decay_t<Event>>, "Invalid event type");
 
         using listener_type = std::function<void(Event &, Derived &)>;
-        using element_type = std::pair<bool, listener_type>;
-        using container_type = std::list<element_type>;
-        using connection_type = typename container_type::iterator;
+        using connection_type = std::size_t;
 
-        [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
-            auto pred = [](auto &&element) { return element.first; };
+        struct element_type {
+            connection_type id;
+            bool once;
+            bool dead;
+            listener_type listener;
+        };
+
+        using container_type = std::vector<element_type>;
 
-            return std::all_of(once_list.cbegin(), once_list.cend(), pred) &&
-                    std::all_of(on_list.cbegin(), on_list.cend(), pred);
+        [[nodiscard]] static auto find(container_type &container, const connection_type id) {
+            // identifiers only grow and compacting a container doesn't alter the order of its elements
+            const auto it = std::lower_bound(container.begin(), container.end(), id, [](const auto &element, const auto value) { return element.id < value; });
+            return (it != container.end() && it->id == id) ? it : container.end();
+        }
+
+        [[nodiscard]] bool empty() const ENTT_NOEXCEPT override {
+            auto pred = [](auto &&element) { return element.dead; };
+            return std::all_of(listeners.cbegin(), listeners.cend(), pred) && std::all_of(pending.cbegin(), pending.cend(), pred);
         }
 
         void clear() ENTT_NOEXCEPT override {
             if(publishing) {
-                for(auto &&element: once_list) {
-                    element.first = true;
+                for(auto &&element: listeners) {
+                    element.dead = true;
                 }
 
-                for(auto &&element: on_list) {
-                    element.first = true;
+                for(auto &&element: pending) {
+                    element.dead = true;
                 }
+
+                tombstones = listeners.size() + pending.size();
             } else {
-                once_list.clear();
-                on_list.clear();
+                listeners.clear();
+                tombstones = {};
             }
         }
 
         connection_type once(listener_type listener) {
-            return once_list.emplace(once_list.cend(), false, std::move(listener));
+            // listeners registered while publishing are parked aside, the container mustn't grow during a publish
+            (publishing ? pending : listeners).push_back({ ++next, true, false, std::move(listener) });
+            return next;
         }
 
         connection_type on(listener_type listener) {
-            return on_list.emplace(on_list.cend(), false, std::move(listener));
+            (publishing ? pending : listeners).push_back({ ++next, false, false, std::move(listener) });
+            return next;
         }
 
-        void erase(connection_type conn) {
-            conn->first = true;
+        void erase(const connection_type conn) {
+            if(auto it = find(listeners, conn); it != listeners.end() && !it->dead) {
+                it->dead = true;
+                ++tombstones;
+            } else if(auto other = find(pending, conn); other != pending.end() && !other->dead) {
+                other->dead = true;
+                ++tombstones;
+            }
 
-            if(!publishing) {
-                auto pred = [](auto &&element) { return element.first; };
-                once_list.remove_if(pred);
-                on_list.remove_if(pred);
+            if(!publishing && (tombstones * 2u > listeners.size())) {
+                compact();
             }
         }
 
         void publish(Event &event, Derived &ref) {
-            container_type swap_list;
-            once_list.swap(swap_list);
+            ++publishing;
+            invoke(event, ref);
 
-            publishing = true;
+            if(!--publishing) {
+                compact();
+            }
+        }
+
+        void update(Derived &ref) override {
+            // events enqueued by the listeners wait for the next update
+            auto batch = std::exchange(events, std::vector<Event>{});
+            ++publishing;
 
-            for(auto &&element: on_list) {
-                element.first ? void() : element.second(event, ref);
+            for(auto &&event: batch) {
+                invoke(event, ref);
             }
 
-            for(auto &&element: swap_list) {
-                element.first ? void() : element.second(event, ref);
+            if(!--publishing) {
+                compact();
             }
 
-            publishing = false;
+            if(events.empty()) {
+                // the capacity is kept for the events of the next update
+                batch.clear();
+                events.swap(batch);
+            }
+        }
 
-            on_list.remove_if([](auto &&element) { return element.first; });
+        template<typename... Args>
+        void enqueue(Args &&... args) {
+            if constexpr(std::is_aggregate_v<Event>) {
+                events.push_back(Event{std::forward<Args>(args)...});
+            } else {
+                events.emplace_back(std::forward<Args>(args)...);
+            }
         }
 
     private:
-        bool publishing{false};
-        container_type once_list{};
-        container_type on_list{};
+        void invoke(Event &event, Derived &ref) {
+            for(std::size_t pos{}, last = listeners.size(); pos < last; ++pos) {
+                if(auto &&element = listeners[pos]; !element.dead) {
+                    if(element.once) {
+                        element.dead = true;
+                        ++tombstones;
+                    }
+
+                    element.listener(event, ref);
+                }
+            }
+        }
+
+        void compact() {
+            if(tombstones) {
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(), [](auto &&element) { return element.dead; }), listeners.end());
+                tombstones = {};
+            }
+
+            for(auto &&element: pending) {
+                if(!element.dead) {
+                    listeners.push_back(std::move(element));
+                }
+            }
+
+            pending.clear();
+        }
+
+        std::size_t publishing{};
+        std::size_t tombstones{};
+        connection_type next{};
+        container_type listeners{};
+        container_type pending{};
+        std::vector<Event> events{};
     };
 
     template<typename Event>
@@ -156,7 +227,7 @@ public:
      * @tparam Event Type of event for which the connection is created.
      */
     template<typename Event>
-    struct connection: private pool_handler<Event>::connection_type {
+    struct connection {
         /** @brief Event emitters are friend classes of connections. */
         friend class emitter;
 
@@ -168,8 +239,11 @@ public:
          * @param conn A connection object to wrap.
          */
         connection(typename pool_handler<Event>::connection_type conn)
-            : pool_handler<Event>::connection_type{std::move(conn)}
+            : value{conn}
         {}
+
+    private:
+        typename pool_handler<Event>::connection_type value{};
     };
 
     /*! @brief Default constructor. */
@@ -203,6 +277,51 @@ public:
         assure<Event>().publish(instance, *static_cast<Derived *>(this));
     }
 
+    /**
+     * @brief Enqueues an event of the given type.
+     *
+     * No listener is invoked. Events are stored contiguously per type and
+     * delivered all together by the `update` member function, so that the
+     * listeners are cleaned up once per batch rather than once per event.
+     *
+     * @tparam Event Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param args Parameters to use to initialize the event.
+     */
+    template<typename Event, typename... Args>
+    void enqueue(Args &&... args) {
+        assure<Event>().enqueue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Delivers all the pending events of the given type.
+     *
+     * Events enqueued by the listeners during an update are delivered with
+     * the next one. Short-lived listeners only receive the first event.
+     *
+     * @tparam Event Type of events to deliver.
+     */
+    template<typename Event>
+    void update() {
+        assure<Event>().update(*static_cast<Derived *>(this));
+    }
+
+    /**
+     * @brief Delivers all the pending events.
+     *
+     * Events are delivered one type at a time, in no particular order.
+     *
+     * @sa update
+     */
+    void update() {
+        for(std::size_t pos{}; pos < pools.size(); ++pos) {
+            // listeners can create new pools, the container can grow in the meantime
+            if(auto &&cpool = pools[pos]; cpool) {
+                cpool->update(*static_cast<Derived *>(this));
+            }
+        }
+    }
+
     /**
      * @brief Registers a long-lived listener with the event emitter.
      *
@@ -264,7 +383,7 @@ public:
      */
     template<typename Event>
     void erase(connection<Event> conn) {
-        assure<Event>().erase(std::move(conn));
+        assure<Event>().erase(conn.value);
     }
 
     /**
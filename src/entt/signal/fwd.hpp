@@ -2,6 +2,9 @@
 #define ENTT_SIGNAL_FWD_HPP
 
 
+#include <cstddef>
+
+
 namespace entt {
 
 
@@ -9,9 +12,16 @@ template<typename>
 class delegate;
 
 
+template<typename, std::size_t = 3u * sizeof(void *)>
+class owning_delegate;
+
+
 class dispatcher;
 
 
+class concurrent_dispatcher;
+
+
 template<typename>
 class emitter;
 
@@ -2,6 +2,7 @@
 #define ENTT_SIGNAL_SIGH_HPP
 
 
+#include <cstddef>
 #include <vector>
 #include <utility>
 #include <iterator>
@@ -9,6 +10,7 @@
 #include <functional>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/type_info.hpp"
 #include "delegate.hpp"
 #include "fwd.hpp"
 
@@ -16,6 +18,124 @@
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type, std::size_t Size>
+class small_vector {
+    static_assert(std::is_trivially_copyable_v<Type>, "Invalid element type");
+
+public:
+    using size_type = std::size_t;
+    using iterator = Type *;
+    using const_iterator = const Type *;
+
+    [[nodiscard]] size_type size() const ENTT_NOEXCEPT {
+        return heap.empty() ? length : heap.size();
+    }
+
+    [[nodiscard]] bool empty() const ENTT_NOEXCEPT {
+        return !size();
+    }
+
+    [[nodiscard]] size_type capacity() const ENTT_NOEXCEPT {
+        // heap memory is kept once allocated and is reused in place of the buffer
+        return (std::max)(Size, heap.capacity());
+    }
+
+    [[nodiscard]] const Type * data() const ENTT_NOEXCEPT {
+        return heap.empty() ? buffer : heap.data();
+    }
+
+    [[nodiscard]] Type * data() ENTT_NOEXCEPT {
+        return const_cast<Type *>(std::as_const(*this).data());
+    }
+
+    [[nodiscard]] const_iterator cbegin() const ENTT_NOEXCEPT {
+        return data();
+    }
+
+    [[nodiscard]] const_iterator begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    [[nodiscard]] iterator begin() ENTT_NOEXCEPT {
+        return data();
+    }
+
+    [[nodiscard]] const_iterator cend() const ENTT_NOEXCEPT {
+        return data() + size();
+    }
+
+    [[nodiscard]] const_iterator end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    [[nodiscard]] iterator end() ENTT_NOEXCEPT {
+        return data() + size();
+    }
+
+    iterator insert(const_iterator pos, const Type value) {
+        const auto offset = pos - cbegin();
+
+        if(heap.empty() && length < Size) {
+            std::copy_backward(buffer + offset, buffer + length, buffer + length + 1u);
+            buffer[offset] = value;
+            ++length;
+        } else {
+            if(heap.empty()) {
+                // spills the elements on the heap and keeps them there even if they become less than the size of the buffer
+                heap.reserve(Size * 2u);
+                heap.assign(buffer, buffer + length);
+                length = {};
+            }
+
+            heap.insert(heap.begin() + offset, value);
+        }
+
+        return begin() + offset;
+    }
+
+    iterator erase(iterator first, iterator last) {
+        const auto offset = first - begin();
+
+        if(heap.empty()) {
+            std::copy(last, end(), first);
+            length -= static_cast<size_type>(last - first);
+        } else {
+            heap.erase(heap.begin() + offset, heap.begin() + (last - begin()));
+        }
+
+        return begin() + offset;
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        heap.clear();
+        length = {};
+    }
+
+private:
+    Type buffer[Size]{};
+    size_type length{};
+    std::vector<Type> heap{};
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond
+ */
+
+
 /**
  * @brief Sink class.
  *
@@ -138,7 +258,8 @@ public:
     }
 
 private:
-    std::vector<delegate<Ret(Args...)>> calls;
+    internal::small_vector<delegate<Ret(Args...)>, 2u> calls;
+    internal::small_vector<int, 2u> priorities;
 };
 
 
@@ -280,6 +401,43 @@ class sink<Ret(Args...)> {
         sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
     }
 
+    void insert(delegate<Ret(Args...)> call) {
+        auto &calls = signal->calls;
+        auto &priorities = signal->priorities;
+
+        // listeners are sorted by priority, connecting before another listener means inheriting its priority
+        const auto length = std::min(offset, static_cast<difference_type>(priorities.size()));
+        auto pos = length ? (priorities.cend() - length) : std::upper_bound(priorities.cbegin(), priorities.cend(), precedence, std::greater<int>{});
+        const auto value = length ? *pos : precedence;
+        const auto index = pos - priorities.cbegin();
+
+        const auto cap = calls.capacity();
+        priorities.insert(pos, value);
+        calls.insert(calls.cbegin() + index, std::move(call));
+
+        if(calls.capacity() != cap) {
+            ENTT_ALLOC_TRACE("entt::sink::connect", type_id<Ret(Args...)>().name(), calls.capacity() * sizeof(delegate<Ret(Args...)>) + priorities.capacity() * sizeof(int));
+        }
+    }
+
+    template<typename Func>
+    void erase_if(Func func) {
+        auto &calls = signal->calls;
+        auto &priorities = signal->priorities;
+        difference_type last{};
+
+        for(difference_type pos{}, end = calls.end() - calls.begin(); pos < end; ++pos) {
+            if(!func(calls.begin()[pos])) {
+                calls.begin()[last] = calls.begin()[pos];
+                priorities.begin()[last] = priorities.begin()[pos];
+                ++last;
+            }
+        }
+
+        calls.erase(calls.begin() + last, calls.end());
+        priorities.erase(priorities.begin() + last, priorities.end());
+    }
+
 public:
     /**
      * @brief Constructs a sink that is allowed to modify a given signal.
@@ -287,6 +445,7 @@ public:
      */
     sink(sigh<Ret(Args...)> &ref) ENTT_NOEXCEPT
         : offset{},
+          precedence{},
           signal{&ref}
     {}
 
@@ -383,6 +542,23 @@ public:
         return other;
     }
 
+    /**
+     * @brief Returns a sink that connects listeners with a given priority.
+     *
+     * Listeners with greater priority are invoked first. Listeners with the
+     * same priority are invoked in connection order. Unless otherwise
+     * specified, listeners are connected with priority zero.<br/>
+     * Listeners connected before other listeners inherit their priority.
+     *
+     * @param value The priority to assign to the listeners.
+     * @return A properly initialized sink object.
+     */
+    [[nodiscard]] sink priority(const int value) {
+        sink other{*signal};
+        other.precedence = value;
+        return other;
+    }
+
     /**
      * @brief Connects a free function or an unbound member to a signal.
      *
@@ -398,7 +574,7 @@ public:
 
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>();
-        signal->calls.insert(signal->calls.end() - offset, std::move(call));
+        insert(std::move(call));
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate>>();
@@ -428,7 +604,7 @@ public:
 
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>(value_or_instance);
-        signal->calls.insert(signal->calls.end() - offset, std::move(call));
+        insert(std::move(call));
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate, Type>>(value_or_instance);
@@ -441,10 +617,9 @@ public:
      */
     template<auto Candidate>
     void disconnect() {
-        auto &calls = signal->calls;
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>();
-        calls.erase(std::remove(calls.begin(), calls.end(), std::move(call)), calls.end());
+        erase_if([&call](const auto &other) { return other == call; });
     }
 
     /**
@@ -456,10 +631,9 @@ public:
      */
     template<auto Candidate, typename Type>
     void disconnect(Type &&value_or_instance) {
-        auto &calls = signal->calls;
         delegate<Ret(Args...)> call{};
         call.template connect<Candidate>(value_or_instance);
-        calls.erase(std::remove(calls.begin(), calls.end(), std::move(call)), calls.end());
+        erase_if([&call](const auto &other) { return other == call; });
     }
 
     /**
@@ -482,20 +656,21 @@ public:
     template<typename Type>
     void disconnect(Type *value_or_instance) {
         if(value_or_instance) {
-            auto &calls = signal->calls;
-            calls.erase(std::remove_if(calls.begin(), calls.end(), [value_or_instance](const auto &delegate) {
+            erase_if([value_or_instance](const auto &delegate) {
                 return delegate.instance() == value_or_instance;
-            }), calls.end());
+            });
         }
     }
 
     /*! @brief Disconnects all the listeners from a signal. */
     void disconnect() {
         signal->calls.clear();
+        signal->priorities.clear();
     }
 
 private:
     difference_type offset;
+    int precedence;
     signal_type *signal;
 };
 
@@ -1,11 +1,30 @@
 #include <iostream>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <chrono>
+#include <fstream>
 #include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include <entt/process/process.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/resource/cache.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/sigh.hpp>
 
 struct position {
     std::uint64_t x;
@@ -20,1191 +39,1846 @@ struct velocity {
 template<std::size_t>
 struct comp { int x; };
 
-struct timer final {
-    timer(): start{std::chrono::system_clock::now()} {}
+template<std::size_t Size>
+struct payload {
+    std::uint64_t x;
+    std::byte padding[Size - sizeof(std::uint64_t)];
+};
 
-    void elapsed() {
-        auto now = std::chrono::system_clock::now();
-        std::cout << std::chrono::duration<double>(now - start).count() << " seconds" << std::endl;
+struct relationship {
+    entt::entity parent;
+};
+
+struct output_archive {
+    template<typename... Value>
+    void operator()(const Value &... value) {
+        (buffer.insert(buffer.end(), reinterpret_cast<const std::byte *>(&value), reinterpret_cast<const std::byte *>(&value) + sizeof(Value)), ...);
     }
 
-private:
-    std::chrono::time_point<std::chrono::system_clock> start;
+    std::vector<std::byte> buffer{};
 };
 
-template<typename Func>
-void pathological(Func func) {
-    entt::registry registry;
-
-    for(std::uint64_t i = 0; i < 500000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
+struct input_archive {
+    template<typename... Value>
+    void operator()(Value &... value) {
+        ((std::memcpy(&value, buffer->data() + offset, sizeof(Value)), offset += sizeof(Value)), ...);
     }
 
-    for(auto i = 0; i < 10; ++i) {
-        registry.each([i = 0, &registry](const auto entity) mutable {
-            if(!(++i % 7)) { registry.remove_if_exists<position>(entity); }
-            if(!(++i % 11)) { registry.remove_if_exists<velocity>(entity); }
-            if(!(++i % 13)) { registry.remove_if_exists<comp<0>>(entity); }
-            if(!(++i % 17)) { registry.destroy(entity); }
-        });
+    const std::vector<std::byte> *buffer;
+    std::size_t offset{};
+};
 
-        for(std::uint64_t j = 0; j < 50000L; j++) {
-            const auto entity = registry.create();
-            registry.emplace<position>(entity);
-            registry.emplace<velocity>(entity);
-            registry.emplace<comp<0>>(entity);
-        }
-    }
+struct counter {
+    void receive(const std::uint64_t value) { total += value; }
+    std::uint64_t total{};
+};
 
-    func(registry, [](auto &... comp) {
-        ((comp.x = {}), ...);
-    });
-}
+struct an_event { std::uint64_t value; };
 
-TEST(Benchmark, Create) {
-    entt::registry registry;
+struct event_receiver {
+    void receive(const an_event &event) { total += event.value; }
+    std::uint64_t total{};
+};
+
+struct event_emitter: entt::emitter<event_emitter> {};
 
-    std::cout << "Creating 1000000 entities" << std::endl;
+struct ticking_process: entt::process<ticking_process, std::uint32_t> {
+    void update(std::uint32_t delta, void *) { total += delta; }
+    std::uint64_t total{};
+};
+
+struct reflected {
+    std::uint64_t add(const std::uint64_t value) { return total += value; }
+    std::uint64_t total{};
+};
 
-    timer timer;
+struct resource { std::uint64_t value; };
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        registry.create();
+struct resource_builder: entt::resource_loader<resource_builder, resource> {
+    std::shared_ptr<resource> load(const std::uint64_t value) const {
+        return std::make_shared<resource>(resource{value});
     }
+};
 
-    timer.elapsed();
+std::size_t setting(const char *name, const std::size_t value) {
+    const char *str = std::getenv(name);
+    return str ? static_cast<std::size_t>(std::strtoull(str, nullptr, 10)) : value;
 }
 
-TEST(Benchmark, CreateMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+const std::size_t entity_count = setting("ENTT_BENCHMARK_ENTITIES", 1000000u);
+const std::size_t warmup_runs = setting("ENTT_BENCHMARK_WARMUP", 1u);
+const std::size_t measured_runs = (std::max)(setting("ENTT_BENCHMARK_RUNS", 5u), std::size_t{1u});
 
-    std::cout << "Creating 1000000 entities at once" << std::endl;
+struct report final {
+    struct entry {
+        std::string name;
+        std::string label;
+        std::vector<double> samples;
+    };
 
-    timer timer;
-    registry.create(entities.begin(), entities.end());
-    timer.elapsed();
-}
+    ~report() {
+        if(const char *path = std::getenv("ENTT_BENCHMARK_JSON"); path) {
+            std::ofstream out{path};
+            out << "{\n  \"entities\": " << entity_count << ",\n  \"warmup\": " << warmup_runs << ",\n  \"runs\": " << measured_runs << ",\n  \"benchmarks\": [";
 
-TEST(Benchmark, CreateManyAndEmplaceComponents) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+            for(std::size_t pos{}; pos < entries.size(); ++pos) {
+                const auto &curr = entries[pos];
+                out << (pos ? "," : "") << "\n    {\"name\": " << quoted(curr.name) << ", \"label\": " << quoted(curr.label);
+                out << ", \"median\": " << percentile(curr.samples, .5) << ", \"p90\": " << percentile(curr.samples, .9);
+                out << ", \"min\": " << curr.samples.front() << ", \"max\": " << curr.samples.back() << ", \"samples\": [";
 
-    std::cout << "Creating 1000000 entities at once and emplace components" << std::endl;
+                for(std::size_t next{}; next < curr.samples.size(); ++next) {
+                    out << (next ? ", " : "") << curr.samples[next];
+                }
 
-    timer timer;
+                out << "]}";
+            }
 
-    registry.create(entities.begin(), entities.end());
+            out << "\n  ]\n}\n";
+        }
+    }
 
-    for(const auto entity: entities) {
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
+    static report & instance() {
+        static report elem{};
+        return elem;
     }
 
-    timer.elapsed();
-}
+    static std::string quoted(const std::string &str) {
+        std::string result{"\""};
 
-TEST(Benchmark, CreateManyWithComponents) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+        for(auto chr: str) {
+            if(chr == '"' || chr == '\\') {
+                result.push_back('\\');
+            }
 
-    std::cout << "Creating 1000000 entities at once with components" << std::endl;
+            result.push_back(chr);
+        }
 
-    timer timer;
-    registry.create(entities.begin(), entities.end());
-    registry.insert<position>(entities.begin(), entities.end());
-    registry.insert<velocity>(entities.begin(), entities.end());
-    timer.elapsed();
-}
+        return result.append("\"");
+    }
 
-TEST(Benchmark, Remove) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+    static double percentile(const std::vector<double> &sorted, const double value) {
+        // nearest-rank definition, samples are sorted in ascending order
+        const auto rank = static_cast<std::size_t>(std::ceil(value * sorted.size()));
+        return sorted[rank ? (rank - 1u) : 0u];
+    }
 
-    std::cout << "Removing 1000000 components from their entities" << std::endl;
+    std::vector<entry> entries{};
+};
 
-    registry.create(entities.begin(), entities.end());
-    registry.insert<int>(entities.begin(), entities.end());
+struct timer final {
+    timer(): start{std::chrono::steady_clock::now()} {}
 
-    timer timer;
+    void elapsed() {
+        auto now = std::chrono::steady_clock::now();
+        samples().push_back(std::chrono::duration<double>(now - start).count());
+    }
 
-    for(auto entity: registry.view<int>()) {
-        registry.remove<int>(entity);
+    static std::vector<double> & samples() {
+        static std::vector<double> elem{};
+        return elem;
     }
 
-    timer.elapsed();
-}
+private:
+    std::chrono::time_point<std::chrono::steady_clock> start;
+};
 
-TEST(Benchmark, RemoveMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+template<typename Func>
+void measure(const std::string &label, Func func) {
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::vector<std::vector<double>> regions{};
 
-    std::cout << "Removing 999999 components from their entities at once" << std::endl;
+    std::cout << label << std::endl;
 
-    registry.create(entities.begin(), entities.end());
-    registry.insert<int>(entities.begin(), entities.end());
+    for(std::size_t run{}; run < warmup_runs + measured_runs; ++run) {
+        timer::samples().clear();
+        func();
 
-    timer timer;
-    auto view = registry.view<int>();
-    registry.remove<int>(++view.begin(), view.end());
-    timer.elapsed();
-}
+        if(run >= warmup_runs) {
+            const auto &samples = timer::samples();
+            regions.resize((std::max)(regions.size(), samples.size()));
 
-TEST(Benchmark, RemoveAll) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+            for(std::size_t pos{}; pos < samples.size(); ++pos) {
+                regions[pos].push_back(samples[pos]);
+            }
+        }
+    }
 
-    std::cout << "Removing 1000000 components from their entities at once" << std::endl;
+    for(std::size_t pos{}; pos < regions.size(); ++pos) {
+        auto &&samples = regions[pos];
+        std::sort(samples.begin(), samples.end());
 
-    registry.create(entities.begin(), entities.end());
-    registry.insert<int>(entities.begin(), entities.end());
+        std::cout << "  median " << report::percentile(samples, .5) << " seconds, p90 " << report::percentile(samples, .9)
+                  << ", min " << samples.front() << ", max " << samples.back() << " (" << samples.size() << " runs)" << std::endl;
 
-    timer timer;
-    auto view = registry.view<int>();
-    registry.remove<int>(view.begin(), view.end());
-    timer.elapsed();
+        auto name = std::string{info->test_suite_name()} + '.' + info->name() + (regions.size() == 1u ? "" : '#' + std::to_string(pos));
+        report::instance().entries.push_back({std::move(name), label, std::move(samples)});
+    }
 }
 
-TEST(Benchmark, Recycle) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
-
-    std::cout << "Recycling 1000000 entities" << std::endl;
+void throughput(const std::size_t bytes, const std::size_t count) {
+    // samples of the last region measured are sorted in ascending order
+    const auto median = report::percentile(report::instance().entries.back().samples, .5);
+    std::cout << "  " << (bytes / median / 1e6) << " MB/s, " << (count / median) << " entities/s" << std::endl;
+}
 
+void populate(entt::registry &registry) {
+    std::vector<entt::entity> entities(entity_count);
     registry.create(entities.begin(), entities.end());
 
-    registry.each([&registry](auto entity) {
-        registry.destroy(entity);
-    });
-
-    timer timer;
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        // one entity out of ten has no components and is an orphan once restored
+        if(pos % 10u) {
+            registry.emplace<position>(entities[pos], pos, pos);
+            registry.emplace<relationship>(entities[pos], entities[(pos * 7u) % entities.size()]);
 
-    for(auto next = entities.size(); next; --next) {
-        registry.create();
+            if(pos % 2u) {
+                registry.emplace<velocity>(entities[pos], pos, pos);
+            }
+        }
     }
-
-    timer.elapsed();
 }
 
-TEST(Benchmark, RecycleMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+std::vector<std::byte> save(const entt::registry &registry) {
+    output_archive output{};
+    entt::snapshot{registry}.entities(output).component<position, velocity, relationship>(output);
+    return std::move(output.buffer);
+}
 
-    std::cout << "Recycling 1000000 entities" << std::endl;
+template<typename Component>
+void shake(entt::registry &registry, const entt::entity entity, const std::uint_fast32_t value) {
+    switch(value % 8u) {
+    case 0u:
+        registry.remove_if_exists<Component>(entity);
+        break;
+    case 1u:
+        // moves the component to the end of its pool
+        registry.remove_if_exists<Component>(entity);
+        registry.emplace<Component>(entity);
+        break;
+    default:
+        static_cast<void>(registry.get_or_emplace<Component>(entity));
+        break;
+    }
+}
 
-    registry.create(entities.begin(), entities.end());
+template<typename Setup, typename Func>
+void churned(Setup setup, Func func) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(entity_count);
+    std::mt19937 generator{42u};
 
-    registry.each([&registry](auto entity) {
-        registry.destroy(entity);
-    });
+    // groups are created upfront and kept up-to-date while the registry is churned
+    setup(registry);
 
-    timer timer;
     registry.create(entities.begin(), entities.end());
-    timer.elapsed();
-}
+    registry.insert<position>(entities.begin(), entities.end());
+    registry.insert<velocity>(entities.begin(), entities.end());
+    registry.insert<comp<0>>(entities.begin(), entities.end());
 
-TEST(Benchmark, Destroy) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+    for(auto round = 0; round < 10; ++round) {
+        std::shuffle(entities.begin(), entities.end(), generator);
 
-    std::cout << "Destroying 1000000 entities" << std::endl;
+        // identifiers are recycled and get a new version
+        for(std::size_t pos{}, last = entities.size() / 10u; pos < last; ++pos) {
+            registry.destroy(entities[pos]);
+        }
 
-    registry.create(entities.begin(), entities.end());
-    registry.insert<int>(entities.begin(), entities.end());
+        for(std::size_t pos{}, last = entities.size() / 10u; pos < last; ++pos) {
+            entities[pos] = registry.create();
+        }
 
-    timer timer;
+        std::shuffle(entities.begin(), entities.end(), generator);
 
-    for(auto entity: registry.view<int>()) {
-        registry.destroy(entity);
+        for(const auto entity: entities) {
+            const auto value = generator();
+            shake<position>(registry, entity, value);
+            shake<velocity>(registry, entity, value >> 3u);
+            shake<comp<0>>(registry, entity, value >> 6u);
+        }
     }
 
-    timer.elapsed();
+    func(registry, [](auto &... comp) {
+        ((comp.x = {}), ...);
+    });
 }
 
-TEST(Benchmark, DestroyMany) {
-    entt::registry registry;
-    std::vector<entt::entity> entities(1000000);
+template<std::size_t Size>
+void iterate_payload() {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, one component of " + std::to_string(Size) + " bytes", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    std::cout << "Destroying 1000000 entities" << std::endl;
+        registry.create(entities.begin(), entities.end());
+        registry.insert<payload<Size>>(entities.begin(), entities.end());
 
-    registry.create(entities.begin(), entities.end());
-    registry.insert<int>(entities.begin(), entities.end());
+        timer timer;
+
+        registry.view<payload<Size>>().each([](auto &comp) {
+            comp.x = {};
+        });
 
-    timer timer;
-    auto view = registry.view<int>();
-    registry.destroy(view.begin(), view.end());
-    timer.elapsed();
+        timer.elapsed();
+    });
 }
 
-TEST(Benchmark, IterateSingleComponent1M) {
+template<typename Func>
+void pathological(Func func) {
     entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, one component" << std::endl;
-
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
+    for(std::uint64_t i = 0; i < 500000L; i++) {
         const auto entity = registry.create();
         registry.emplace<position>(entity);
+        registry.emplace<velocity>(entity);
+        registry.emplace<comp<0>>(entity);
     }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position>().each(func);
-        timer.elapsed();
-    };
+    for(auto i = 0; i < 10; ++i) {
+        registry.each([i = 0, &registry](const auto entity) mutable {
+            if(!(++i % 7)) { registry.remove_if_exists<position>(entity); }
+            if(!(++i % 11)) { registry.remove_if_exists<velocity>(entity); }
+            if(!(++i % 13)) { registry.remove_if_exists<comp<0>>(entity); }
+            if(!(++i % 17)) { registry.destroy(entity); }
+        });
+
+        for(std::uint64_t j = 0; j < 50000L; j++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
+    }
 
-    test([](auto &... comp) {
+    func(registry, [](auto &... comp) {
         ((comp.x = {}), ...);
     });
 }
 
-TEST(Benchmark, IterateSingleComponentRuntime1M) {
-    entt::registry registry;
-
-    std::cout << "Iterating over 1000000 entities, one component, runtime view" << std::endl;
+TEST(Benchmark, Create) {
+    measure("Creating " + std::to_string(entity_count) + " entities", [] {
+        entt::registry registry;
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-    }
+        timer timer;
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = { entt::type_hash<position>::value() };
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            registry.create();
+        }
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
         timer.elapsed();
-    };
-
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
     });
 }
 
-TEST(Benchmark, IterateTwoComponents1M) {
-    entt::registry registry;
-
-    std::cout << "Iterating over 1000000 entities, two components" << std::endl;
-
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-    }
+TEST(Benchmark, CreateMany) {
+    measure("Creating " + std::to_string(entity_count) + " entities at once", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    auto test = [&](auto func) {
         timer timer;
-        registry.view<position, velocity>().each(func);
+        registry.create(entities.begin(), entities.end());
         timer.elapsed();
-    };
-
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
     });
 }
 
-TEST(Benchmark, IterateTwoComponents1MHalf) {
-    entt::registry registry;
+TEST(Benchmark, CreateManyAndEmplaceComponents) {
+    measure("Creating " + std::to_string(entity_count) + " entities at once and emplace components", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components" << std::endl;
+        timer timer;
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
+        registry.create(entities.begin(), entities.end());
 
-        if(i % 2) {
+        for(const auto entity: entities) {
             registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity>().each(func);
         timer.elapsed();
-    };
+    });
+}
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+TEST(Benchmark, CreateManyWithComponents) {
+    measure("Creating " + std::to_string(entity_count) + " entities at once with components", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
+
+        timer timer;
+        registry.create(entities.begin(), entities.end());
+        registry.insert<position>(entities.begin(), entities.end());
+        registry.insert<velocity>(entities.begin(), entities.end());
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateTwoComponents1MOne) {
-    entt::registry registry;
+TEST(Benchmark, Remove) {
+    measure("Removing " + std::to_string(entity_count) + " components from their entities", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components" << std::endl;
+        registry.create(entities.begin(), entities.end());
+        registry.insert<int>(entities.begin(), entities.end());
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
+        timer timer;
 
-        if(i == 500000L) {
-            registry.emplace<position>(entity);
+        for(auto entity: registry.view<int>()) {
+            registry.remove<int>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity>().each(func);
         timer.elapsed();
-    };
-
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<>(entt::get<position, velocity>);
-
-    std::cout << "Iterating over 1000000 entities, two components, non owning group" << std::endl;
+TEST(Benchmark, RemoveMany) {
+    measure("Removing " + std::to_string(entity_count - 1u) + " components from their entities at once", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-    }
+        registry.create(entities.begin(), entities.end());
+        registry.insert<int>(entities.begin(), entities.end());
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
+        auto view = registry.view<int>();
+        registry.remove<int>(++view.begin(), view.end());
         timer.elapsed();
-    };
-
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity>();
-
-    std::cout << "Iterating over 1000000 entities, two components, full owning group" << std::endl;
+TEST(Benchmark, RemoveAll) {
+    measure("Removing " + std::to_string(entity_count) + " components from their entities at once", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-    }
+        registry.create(entities.begin(), entities.end());
+        registry.insert<int>(entities.begin(), entities.end());
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
+        auto view = registry.view<int>();
+        registry.remove<int>(view.begin(), view.end());
         timer.elapsed();
-    };
-
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position>(entt::get<velocity>);
+TEST(Benchmark, Recycle) {
+    measure("Recycling " + std::to_string(entity_count) + " entities", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    std::cout << "Iterating over 1000000 entities, two components, partial owning group" << std::endl;
+        registry.create(entities.begin(), entities.end());
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-    }
+        registry.each([&registry](auto entity) {
+            registry.destroy(entity);
+        });
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        for(auto next = entities.size(); next; --next) {
+            registry.create();
+        }
+
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1M) {
-    entt::registry registry;
-
-    std::cout << "Iterating over 1000000 entities, two components, runtime view" << std::endl;
+TEST(Benchmark, RecycleMany) {
+    measure("Recycling " + std::to_string(entity_count) + " entities", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-    }
+        registry.create(entities.begin(), entities.end());
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value()
-        };
+        registry.each([&registry](auto entity) {
+            registry.destroy(entity);
+        });
 
         timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
+        registry.create(entities.begin(), entities.end());
         timer.elapsed();
-    };
-
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
-    entt::registry registry;
+TEST(Benchmark, Destroy) {
+    measure("Destroying " + std::to_string(entity_count) + " entities", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components, runtime view" << std::endl;
+        registry.create(entities.begin(), entities.end());
+        registry.insert<int>(entities.begin(), entities.end());
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
+        timer timer;
 
-        if(i % 2) {
-            registry.emplace<position>(entity);
+        for(auto entity: registry.view<int>()) {
+            registry.destroy(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value()
-        };
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, DestroyMany) {
+    measure("Destroying " + std::to_string(entity_count) + " entities", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
+
+        registry.create(entities.begin(), entities.end());
+        registry.insert<int>(entities.begin(), entities.end());
 
         timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
+        auto view = registry.view<int>();
+        registry.destroy(view.begin(), view.end());
         timer.elapsed();
-    };
+    });
+}
+
+TEST(Benchmark, IterateSingleComponent1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, one component", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position>().each(func);
+            timer.elapsed();
+        };
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
-    entt::registry registry;
+TEST(Benchmark, IterateSingleComponent16Bytes1M) {
+    iterate_payload<16u>();
+}
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components, runtime view" << std::endl;
+TEST(Benchmark, IterateSingleComponent64Bytes1M) {
+    iterate_payload<64u>();
+}
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
+TEST(Benchmark, IterateSingleComponent256Bytes1M) {
+    iterate_payload<256u>();
+}
 
-        if(i == 500000L) {
+TEST(Benchmark, IterateSingleComponentRuntime1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, one component, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
             registry.emplace<position>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value()
+        auto test = [&](auto func) {
+            entt::id_type types[] = { entt::type_hash<position>::value() };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
         };
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+        });
+    });
+}
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
+TEST(Benchmark, IterateTwoComponents1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponents1M) {
-    entt::registry registry;
+TEST(Benchmark, IterateTwoComponents1MHalf) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, half of the entities have all the components", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-    }
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>>().each(func);
-        timer.elapsed();
-    };
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity>().each(func);
+            timer.elapsed();
+        };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponents1MHalf) {
-    entt::registry registry;
+TEST(Benchmark, IterateTwoComponents1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, only one entity has all the components", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
 
-        if(i % 2) {
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateTwoComponents1MRandomOrder) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, random order", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
+        std::mt19937 generator{42u};
+
+        registry.create(entities.begin(), entities.end());
+        registry.insert<position>(entities.begin(), entities.end());
+        std::shuffle(entities.begin(), entities.end(), generator);
+        registry.insert<velocity>(entities.begin(), entities.end());
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, non owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<>(entt::get<position, velocity>);
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
             registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>>().each(func);
-        timer.elapsed();
-    };
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponents1MOne) {
-    entt::registry registry;
+TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, full owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity>();
 
-    std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, partial owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position>(entt::get<velocity>);
 
-        if(i == 500000L) {
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
             registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>>().each(func);
-        timer.elapsed();
-    };
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<>(entt::get<position, velocity, comp<0>>);
+TEST(Benchmark, IterateTwoComponentsRuntime1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, runtime view", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, non owning group" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-    }
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value()
+            };
 
-    auto test = [&](auto func) {
-        timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity, comp<0>>();
+TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, half of the entities have all the components, runtime view", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, full owning group" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-    }
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
 
-    auto test = [&](auto func) {
-        timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value()
+            };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity>(entt::get<comp<0>>);
+TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, two components, only one entity has all the components, runtime view", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, partial owning group" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-    }
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
 
-    auto test = [&](auto func) {
-        timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value()
+            };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponentsRuntime1M) {
-    entt::registry registry;
+TEST(Benchmark, IterateThreeComponents1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, runtime view" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-    }
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponents1MHalf) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, half of the entities have all the components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value()
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
         };
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
+TEST(Benchmark, IterateThreeComponents1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, only one entity has all the components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponents1MRandomOrder) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, random order", [] {
+        entt::registry registry;
+        std::vector<entt::entity> entities(entity_count);
+        std::mt19937 generator{42u};
+
+        registry.create(entities.begin(), entities.end());
+        registry.insert<position>(entities.begin(), entities.end());
+        std::shuffle(entities.begin(), entities.end(), generator);
+        registry.insert<velocity>(entities.begin(), entities.end());
+        std::shuffle(entities.begin(), entities.end(), generator);
+        registry.insert<comp<0>>(entities.begin(), entities.end());
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, non owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<>(entt::get<position, velocity, comp<0>>);
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, full owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity, comp<0>>();
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, partial owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity>(entt::get<comp<0>>);
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsRuntime1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+        });
     });
 }
 
 TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
-    entt::registry registry;
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, half of the entities have all the components, runtime view", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components, runtime view" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+        });
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, three components, only one entity has all the components, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponents1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponents1MHalf) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, half of the entities have all the components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, CountFiveComponents1MHalf) {
+    entt::registry registry;
+
+    for(std::uint64_t i = 0; i < entity_count; i++) {
         const auto entity = registry.create();
         registry.emplace<velocity>(entity);
         registry.emplace<comp<0>>(entity);
+        registry.emplace<comp<1>>(entity);
+        registry.emplace<comp<2>>(entity);
 
         if(i % 2) {
             registry.emplace<position>(entity);
         }
     }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value()
+    const auto view = registry.view<position, velocity, comp<0>, comp<1>, comp<2>>();
+
+    measure("Counting " + std::to_string(entity_count) + " entities, five components, half of the entities have all the components", [&view] {
+        timer distance;
+        [[maybe_unused]] volatile auto iterated = std::distance(view.begin(), view.end());
+        distance.elapsed();
+
+        timer count;
+        [[maybe_unused]] volatile auto counted = view.count();
+        count.elapsed();
+    });
+}
+
+TEST(Benchmark, IterateFiveComponents1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, only one entity has all the components", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
+            timer.elapsed();
         };
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
+TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, non owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<>(entt::get<position, velocity, comp<0>, comp<1>, comp<2>>);
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
     });
 }
 
-TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
-    entt::registry registry;
+TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, full owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity, comp<0>, comp<1>, comp<2>>();
 
-    std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components, runtime view" << std::endl;
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, partial (4 of 5) owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity, comp<0>, comp<1>>(entt::get<comp<2>>);
 
-        if(i == 500000L) {
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
             registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
         }
-    }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value()
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
         };
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, partial (3 of 5) owning group", [] {
+        entt::registry registry;
+        const auto group = registry.group<position, velocity, comp<0>>(entt::get<comp<1>, comp<2>>);
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        };
+
+        test([](auto &... comp) {
+            ((comp.x = {}), ...);
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsRuntime1M) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity);
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+        }
+
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value(),
+                entt::type_hash<comp<1>>::value(),
+                entt::type_hash<comp<2>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+            registry.get<comp<1>>(entity).x = {};
+            registry.get<comp<2>>(entity).x = {};
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, half of the entities have all the components, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+
+            if(i % 2) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value(),
+                entt::type_hash<comp<1>>::value(),
+                entt::type_hash<comp<2>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+            registry.get<comp<1>>(entity).x = {};
+            registry.get<comp<2>>(entity).x = {};
+        });
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
+    measure("Iterating over " + std::to_string(entity_count) + " entities, five components, only one entity has all the components, runtime view", [] {
+        entt::registry registry;
+
+        for(std::uint64_t i = 0; i < entity_count; i++) {
+            const auto entity = registry.create();
+            registry.emplace<velocity>(entity);
+            registry.emplace<comp<0>>(entity);
+            registry.emplace<comp<1>>(entity);
+            registry.emplace<comp<2>>(entity);
+
+            if(i == entity_count / 2u) {
+                registry.emplace<position>(entity);
+            }
+        }
+
+        auto test = [&](auto func) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value(),
+                entt::type_hash<comp<1>>::value(),
+                entt::type_hash<comp<2>>::value()
+            };
+
+            timer timer;
+            registry.runtime_view(std::begin(types), std::end(types)).each(func);
+            timer.elapsed();
+        };
+
+        test([&registry](auto entity) {
+            registry.get<position>(entity).x = {};
+            registry.get<velocity>(entity).x = {};
+            registry.get<comp<0>>(entity).x = {};
+            registry.get<comp<1>>(entity).x = {};
+            registry.get<comp<2>>(entity).x = {};
+        });
+    });
+}
+
+TEST(Benchmark, IteratePathological) {
+    measure("Pathological case", [] {
+        pathological([](auto &registry, auto func) {
+            timer timer;
+            registry.template view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
+        });
+    });
+}
+
+TEST(Benchmark, IteratePathologicalNonOwningGroup) {
+    measure("Pathological case (non-owning group)", [] {
+        pathological([](auto &registry, auto func) {
+            auto group = registry.template group<>(entt::get<position, velocity, comp<0>>);
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
     });
 }
 
-TEST(Benchmark, IterateFiveComponents1M) {
-    entt::registry registry;
-
-    std::cout << "Iterating over 1000000 entities, five components" << std::endl;
+TEST(Benchmark, IteratePathologicalFullOwningGroup) {
+    measure("Pathological case (full-owning group)", [] {
+        pathological([](auto &registry, auto func) {
+            auto group = registry.template group<position, velocity, comp<0>>();
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
+    });
+}
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
-        timer.elapsed();
-    };
+TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
+    measure("Pathological case (partial-owning group)", [] {
+        pathological([](auto &registry, auto func) {
+            auto group = registry.template group<position, velocity>(entt::get<comp<0>>);
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
     });
 }
 
-TEST(Benchmark, IterateFiveComponents1MHalf) {
-    entt::registry registry;
-
-    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components" << std::endl;
+TEST(Benchmark, IterateChurned1M) {
+    measure("Churned registry with " + std::to_string(entity_count) + " entities (view)", [] {
+        churned([](auto &) {}, [](auto &registry, auto func) {
+            timer timer;
+            registry.template view<position, velocity, comp<0>>().each(func);
+            timer.elapsed();
+        });
+    });
+}
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
+TEST(Benchmark, IterateChurnedNonOwningGroup1M) {
+    measure("Churned registry with " + std::to_string(entity_count) + " entities (non-owning group)", [] {
+        churned([](auto &registry) { static_cast<void>(registry.template group<>(entt::get<position, velocity, comp<0>>)); }, [](auto &registry, auto func) {
+            auto group = registry.template group<>(entt::get<position, velocity, comp<0>>);
 
-        if(i % 2) {
-            registry.emplace<position>(entity);
-        }
-    }
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
+    });
+}
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
-        timer.elapsed();
-    };
+TEST(Benchmark, IterateChurnedFullOwningGroup1M) {
+    measure("Churned registry with " + std::to_string(entity_count) + " entities (full-owning group)", [] {
+        churned([](auto &registry) { static_cast<void>(registry.template group<position, velocity, comp<0>>()); }, [](auto &registry, auto func) {
+            auto group = registry.template group<position, velocity, comp<0>>();
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
     });
 }
 
-TEST(Benchmark, IterateFiveComponents1MOne) {
-    entt::registry registry;
+TEST(Benchmark, IterateChurnedPartialOwningGroup1M) {
+    measure("Churned registry with " + std::to_string(entity_count) + " entities (partial-owning group)", [] {
+        churned([](auto &registry) { static_cast<void>(registry.template group<position, velocity>(entt::get<comp<0>>)); }, [](auto &registry, auto func) {
+            auto group = registry.template group<position, velocity>(entt::get<comp<0>>);
 
-    std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components" << std::endl;
+            timer timer;
+            group.each(func);
+            timer.elapsed();
+        });
+    });
+}
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
+TEST(Benchmark, IterateChurnedRuntime1M) {
+    measure("Churned registry with " + std::to_string(entity_count) + " entities (runtime view)", [] {
+        churned([](auto &) {}, [](auto &registry, auto) {
+            entt::id_type types[] = {
+                entt::type_hash<position>::value(),
+                entt::type_hash<velocity>::value(),
+                entt::type_hash<comp<0>>::value()
+            };
 
-        if(i == 500000L) {
-            registry.emplace<position>(entity);
-        }
-    }
+            timer timer;
 
-    auto test = [&](auto func) {
-        timer timer;
-        registry.view<position, velocity, comp<0>, comp<1>, comp<2>>().each(func);
-        timer.elapsed();
-    };
+            registry.runtime_view(std::begin(types), std::end(types)).each([&registry](auto entity) {
+                registry.template get<position>(entity).x = {};
+                registry.template get<velocity>(entity).x = {};
+                registry.template get<comp<0>>(entity).x = {};
+            });
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+            timer.elapsed();
+        });
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<>(entt::get<position, velocity, comp<0>, comp<1>, comp<2>>);
-
-    std::cout << "Iterating over 1000000 entities, five components, non owning group" << std::endl;
+TEST(Benchmark, SortSingle) {
+    measure("Sort 150000 entities, one component", [] {
+        entt::registry registry;
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, i, i);
+        }
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        registry.sort<position>([](const auto &lhs, const auto &rhs) {
+            return lhs.x < rhs.x && lhs.y < rhs.y;
+        });
+
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity, comp<0>, comp<1>, comp<2>>();
+TEST(Benchmark, SortMulti) {
+    measure("Sort 150000 entities, two components", [] {
+        entt::registry registry;
 
-    std::cout << "Iterating over 1000000 entities, five components, full owning group" << std::endl;
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, i, i);
+            registry.emplace<velocity>(entity, i, i);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+        registry.sort<position>([](const auto &lhs, const auto &rhs) {
+            return lhs.x < rhs.x && lhs.y < rhs.y;
+        });
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        registry.sort<velocity, position>();
+
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity, comp<0>, comp<1>>(entt::get<comp<2>>);
+TEST(Benchmark, AlmostSortedStdSort) {
+    measure("Sort 150000 entities, almost sorted, std::sort", [] {
+        entt::registry registry;
+        entt::entity entities[3]{};
 
-    std::cout << "Iterating over 1000000 entities, five components, partial (4 of 5) owning group" << std::endl;
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, i, i);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+            if(!(i % 50000)) {
+                entities[i / 50000] = entity;
+            }
+        }
+
+        for(std::uint64_t i = 0; i < 3; ++i) {
+            registry.destroy(entities[i]);
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, 50000 * i, 50000 * i);
+        }
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        registry.sort<position>([](const auto &lhs, const auto &rhs) {
+            return lhs.x > rhs.x && lhs.y > rhs.y;
+        });
+
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
-    entt::registry registry;
-    const auto group = registry.group<position, velocity, comp<0>>(entt::get<comp<1>, comp<2>>);
+TEST(Benchmark, AlmostSortedInsertionSort) {
+    measure("Sort 150000 entities, almost sorted, insertion sort", [] {
+        entt::registry registry;
+        entt::entity entities[3]{};
 
-    std::cout << "Iterating over 1000000 entities, five components, partial (3 of 5) owning group" << std::endl;
+        for(std::uint64_t i = 0; i < 150000L; i++) {
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, i, i);
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+            if(!(i % 50000)) {
+                entities[i / 50000] = entity;
+            }
+        }
+
+        for(std::uint64_t i = 0; i < 3; ++i) {
+            registry.destroy(entities[i]);
+            const auto entity = registry.create();
+            registry.emplace<position>(entity, 50000 * i, 50000 * i);
+        }
 
-    auto test = [&](auto func) {
         timer timer;
-        group.each(func);
-        timer.elapsed();
-    };
 
-    test([](auto &... comp) {
-        ((comp.x = {}), ...);
+        registry.sort<position>([](const auto &lhs, const auto &rhs) {
+            return lhs.x > rhs.x && lhs.y > rhs.y;
+        }, entt::insertion_sort{});
+
+        timer.elapsed();
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsRuntime1M) {
-    entt::registry registry;
+template<std::size_t Listeners>
+void publish() {
+    measure("Publishing 1000000 signals, " + std::to_string(Listeners) + " listeners", [] {
+        entt::sigh<void(std::uint64_t)> sigh;
+        entt::sink sink{sigh};
+        counter listeners[(std::max)(Listeners, std::size_t{1u})]{};
 
-    std::cout << "Iterating over 1000000 entities, five components, runtime view" << std::endl;
+        for(std::size_t pos{}; pos < Listeners; ++pos) {
+            sink.connect<&counter::receive>(listeners[pos]);
+        }
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity);
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
-    }
+        timer timer;
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value(),
-            entt::type_hash<comp<1>>::value(),
-            entt::type_hash<comp<2>>::value()
-        };
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            sigh.publish(i);
+        }
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
         timer.elapsed();
-    };
-
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
-        registry.get<comp<1>>(entity).x = {};
-        registry.get<comp<2>>(entity).x = {};
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
-    entt::registry registry;
+TEST(Benchmark, SighPublishNoListeners) {
+    publish<0u>();
+}
 
-    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, runtime view" << std::endl;
+TEST(Benchmark, SighPublishOneListener) {
+    publish<1u>();
+}
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
+TEST(Benchmark, SighPublishEightListeners) {
+    publish<8u>();
+}
 
-        if(i % 2) {
-            registry.emplace<position>(entity);
+TEST(Benchmark, DispatcherEnqueueAndUpdate) {
+    measure("Enqueuing 1000000 events, then delivering them", [] {
+        entt::dispatcher dispatcher;
+        event_receiver receiver;
+
+        dispatcher.sink<an_event>().connect<&event_receiver::receive>(receiver);
+
+        timer enqueue;
+
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            dispatcher.enqueue<an_event>(i);
         }
-    }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value(),
-            entt::type_hash<comp<1>>::value(),
-            entt::type_hash<comp<2>>::value()
-        };
+        enqueue.elapsed();
+        timer update;
 
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+        dispatcher.update();
 
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
-        registry.get<comp<1>>(entity).x = {};
-        registry.get<comp<2>>(entity).x = {};
+        update.elapsed();
     });
 }
 
-TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
-    entt::registry registry;
+TEST(Benchmark, EmitterPublish) {
+    measure("Emitting 1000000 events", [] {
+        event_emitter emitter;
+        std::uint64_t total{};
 
-    std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components, runtime view" << std::endl;
+        emitter.on<an_event>([&total](const an_event &event, event_emitter &) {
+            total += event.value;
+        });
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<velocity>(entity);
-        registry.emplace<comp<0>>(entity);
-        registry.emplace<comp<1>>(entity);
-        registry.emplace<comp<2>>(entity);
+        timer timer;
 
-        if(i == 500000L) {
-            registry.emplace<position>(entity);
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            emitter.publish<an_event>(i);
         }
-    }
 
-    auto test = [&](auto func) {
-        entt::id_type types[] = {
-            entt::type_hash<position>::value(),
-            entt::type_hash<velocity>::value(),
-            entt::type_hash<comp<0>>::value(),
-            entt::type_hash<comp<1>>::value(),
-            entt::type_hash<comp<2>>::value()
-        };
-
-        timer timer;
-        registry.runtime_view(std::begin(types), std::end(types)).each(func);
         timer.elapsed();
-    };
-
-    test([&registry](auto entity) {
-        registry.get<position>(entity).x = {};
-        registry.get<velocity>(entity).x = {};
-        registry.get<comp<0>>(entity).x = {};
-        registry.get<comp<1>>(entity).x = {};
-        registry.get<comp<2>>(entity).x = {};
     });
 }
 
-TEST(Benchmark, IteratePathological) {
-    std::cout << "Pathological case" << std::endl;
+TEST(Benchmark, SchedulerUpdate) {
+    measure("Updating 100000 processes, 10 times", [] {
+        entt::scheduler<std::uint32_t> scheduler;
+
+        for(std::uint64_t i = 0; i < 100000L; i++) {
+            scheduler.attach<ticking_process>();
+        }
 
-    pathological([](auto &registry, auto func) {
         timer timer;
-        registry.template view<position, velocity, comp<0>>().each(func);
+
+        for(auto i = 0; i < 10; ++i) {
+            scheduler.update(1u);
+        }
+
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, IteratePathologicalNonOwningGroup) {
-    std::cout << "Pathological case (non-owning group)" << std::endl;
+TEST(Benchmark, Meta) {
+    using namespace entt::literals;
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<>(entt::get<position, velocity, comp<0>>);
+    // meta types are registered once and for all
+    [[maybe_unused]] static const auto factory = entt::meta<reflected>().type("reflected"_hs).func<&reflected::add>("add"_hs);
 
-        timer timer;
-        group.each(func);
-        timer.elapsed();
-    });
-}
+    measure("Resolving 1000000 types by identifier, constructing and invoking as many objects", [] {
+        entt::meta_type curr{};
+        reflected instance{};
 
-TEST(Benchmark, IteratePathologicalFullOwningGroup) {
-    std::cout << "Pathological case (full-owning group)" << std::endl;
+        timer resolve;
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<position, velocity, comp<0>>();
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            curr = entt::resolve("reflected"_hs);
+        }
 
-        timer timer;
-        group.each(func);
-        timer.elapsed();
+        resolve.elapsed();
+        timer construct;
+
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            entt::meta_any any{reflected{i}};
+            static_cast<void>(any);
+        }
+
+        construct.elapsed();
+        timer invoke;
+
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            static_cast<void>(curr.invoke("add"_hs, instance, i));
+        }
+
+        invoke.elapsed();
     });
 }
 
-TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
-    std::cout << "Pathological case (partial-owning group)" << std::endl;
+TEST(Benchmark, ResourceCacheLoadHits) {
+    measure("Loading 1000000 resources already in cache", [] {
+        entt::resource_cache<resource> cache;
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<position, velocity>(entt::get<comp<0>>);
+        for(std::uint64_t i = 0; i < 1024L; i++) {
+            static_cast<void>(cache.load<resource_builder>(static_cast<entt::id_type>(i), i));
+        }
 
         timer timer;
-        group.each(func);
+
+        for(std::uint64_t i = 0; i < 1000000L; i++) {
+            static_cast<void>(cache.load<resource_builder>(static_cast<entt::id_type>(i % 1024u), i));
+        }
+
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, SortSingle) {
+TEST(Benchmark, SnapshotSave) {
     entt::registry registry;
+    std::size_t bytes{};
 
-    std::cout << "Sort 150000 entities, one component" << std::endl;
+    populate(registry);
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, i, i);
-    }
+    measure("Saving a snapshot of " + std::to_string(entity_count) + " entities, three components", [&registry, &bytes] {
+        output_archive output{};
+
+        timer timer;
 
-    timer timer;
+        entt::snapshot{registry}.entities(output).component<position, velocity, relationship>(output);
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x < rhs.x && lhs.y < rhs.y;
+        timer.elapsed();
+        bytes = output.buffer.size();
     });
 
-    timer.elapsed();
+    throughput(bytes, entity_count);
 }
 
-TEST(Benchmark, SortMulti) {
-    entt::registry registry;
-
-    std::cout << "Sort 150000 entities, two components" << std::endl;
+TEST(Benchmark, SnapshotLoad) {
+    entt::registry source;
+    populate(source);
+    const auto buffer = save(source);
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, i, i);
-        registry.emplace<velocity>(entity, i, i);
-    }
+    measure("Loading a snapshot of " + std::to_string(entity_count) + " entities, three components, orphans", [&buffer] {
+        entt::registry registry;
+        input_archive input{&buffer};
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x < rhs.x && lhs.y < rhs.y;
-    });
+        timer timer;
 
-    timer timer;
+        entt::snapshot_loader{registry}.entities(input).component<position, velocity, relationship>(input).orphans();
 
-    registry.sort<velocity, position>();
+        timer.elapsed();
+    });
 
-    timer.elapsed();
+    throughput(buffer.size(), entity_count);
 }
 
-TEST(Benchmark, AlmostSortedStdSort) {
-    entt::registry registry;
-    entt::entity entities[3]{};
-
-    std::cout << "Sort 150000 entities, almost sorted, std::sort" << std::endl;
-
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, i, i);
+TEST(Benchmark, ContinuousLoad) {
+    entt::registry source;
+    populate(source);
+    const auto buffer = save(source);
 
-        if(!(i % 50000)) {
-            entities[i / 50000] = entity;
-        }
-    }
+    measure("Continuous loading of " + std::to_string(entity_count) + " entities, three components, members, orphans", [&buffer] {
+        entt::registry registry;
+        entt::continuous_loader loader{registry};
+        input_archive input{&buffer};
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entities[i]);
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, 50000 * i, 50000 * i);
-    }
+        timer timer;
 
-    timer timer;
+        loader.entities(input).component<position, velocity, relationship>(input, &relationship::parent).orphans();
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x > rhs.x && lhs.y > rhs.y;
+        timer.elapsed();
     });
 
-    timer.elapsed();
+    throughput(buffer.size(), entity_count);
 }
 
-TEST(Benchmark, AlmostSortedInsertionSort) {
-    entt::registry registry;
-    entt::entity entities[3]{};
-
-    std::cout << "Sort 150000 entities, almost sorted, insertion sort" << std::endl;
+TEST(Benchmark, ContinuousLoadUpdate) {
+    entt::registry source;
+    populate(source);
+    const auto buffer = save(source);
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, i, i);
+    measure("Continuous loading of " + std::to_string(entity_count) + " entities already known, three components, members, orphans", [&buffer] {
+        entt::registry registry;
+        entt::continuous_loader loader{registry};
+        input_archive first{&buffer};
 
-        if(!(i % 50000)) {
-            entities[i / 50000] = entity;
-        }
-    }
+        loader.entities(first).component<position, velocity, relationship>(first, &relationship::parent).orphans().shrink();
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entities[i]);
-        const auto entity = registry.create();
-        registry.emplace<position>(entity, 50000 * i, 50000 * i);
-    }
+        input_archive input{&buffer};
+        timer timer;
 
-    timer timer;
+        // local counterparts exist already and are only updated
+        loader.entities(input).component<position, velocity, relationship>(input, &relationship::parent).orphans().shrink();
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x > rhs.x && lhs.y > rhs.y;
-    }, entt::insertion_sort{});
+        timer.elapsed();
+    });
 
-    timer.elapsed();
+    throughput(buffer.size(), entity_count);
 }
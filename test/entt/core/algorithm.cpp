@@ -1,6 +1,9 @@
 #include <array>
+#include <cstddef>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include <entt/core/thread_pool.hpp>
 
 struct boxed_int {
     int value;
@@ -63,6 +66,40 @@ TEST(Algorithm, InsertionSortEmptyContainer) {
     sort(vec.begin(), vec.end());
 }
 
+TEST(Algorithm, ParallelSort) {
+    std::vector<int> vec(1000u);
+    entt::parallel_sort sort{8u, 64u};
+    entt::thread_pool pool{3u};
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = static_cast<int>((pos * 7919u) % 1013u);
+    }
+
+    sort(vec.begin(), vec.end(), std::greater<>{}, pool);
+
+    for(auto i = 0u; i < (vec.size() - 1u); ++i) {
+        ASSERT_GE(vec[i], vec[i+1u]);
+    }
+}
+
+TEST(Algorithm, ParallelSortShortRange) {
+    std::array<int, 5> arr{{4, 1, 3, 2, 0}};
+    std::size_t calls{};
+    entt::parallel_sort sort;
+
+    sort(arr.begin(), arr.end(), std::less<>{}, [&calls](const std::size_t count, auto task) {
+        for(std::size_t pos{}; pos < count; ++pos, ++calls) {
+            task(pos);
+        }
+    });
+
+    ASSERT_EQ(calls, 0u);
+
+    for(auto i = 0u; i < (arr.size() - 1u); ++i) {
+        ASSERT_LT(arr[i], arr[i+1u]);
+    }
+}
+
 TEST(Algorithm, RadixSort) {
     std::array<uint32_t, 5> arr{{4, 1, 3, 2, 0}};
     entt::radix_sort<8, 32> sort;
@@ -126,3 +126,29 @@ TEST(HashedWString, Constexprness) {
     static_assert(entt::hashed_wstring::value(L"quux", 4) == L"quux"_hws);
     static_assert(entt::hashed_wstring::value(view.data(), view.size()) == 0xbf9cf968);
 }
+
+TEST(WordHashedString, Functionalities) {
+    using hashed_string = entt::basic_hashed_string<char, entt::word_hash>;
+    const std::string path{"textures/characters/hero/diffuse.png"};
+
+    ASSERT_EQ(hashed_string{path.c_str()}, hashed_string::value(path.data(), path.size()));
+    ASSERT_EQ(hashed_string{"textures/characters/hero/diffuse.png"}, hashed_string{path.c_str()});
+    ASSERT_NE(hashed_string{"textures/characters/hero/diffuse.png"}, hashed_string{"textures/characters/hero/diffuse.jpg"});
+
+    for(std::size_t size{}; size < path.size(); ++size) {
+        ASSERT_NE(hashed_string::value(path.data(), size), hashed_string::value(path.data(), size + 1u));
+    }
+
+    ASSERT_NE(hashed_string::value("foobar"), entt::hashed_string::value("foobar"));
+}
+
+TEST(WordHashedString, Constexprness) {
+    using hashed_string = entt::basic_hashed_string<char, entt::word_hash>;
+    using hashed_wstring = entt::basic_hashed_string<wchar_t, entt::word_hash>;
+    constexpr std::string_view view{"foobar__", 6};
+
+    static_assert(hashed_string{"foobar"} == hashed_string::value(view.data(), view.size()));
+    static_assert(hashed_string{"foobar"} != hashed_string{"foobaz"});
+    static_assert(hashed_wstring{L"foobar"} == hashed_wstring::value(L"foobar", 6));
+    static_assert(hashed_wstring{L"foobar"} != hashed_wstring{L"foobaz"});
+}
@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/sparse_set.hpp>
+#include <entt/entity/storage.hpp>
+
+TEST(AlignedAllocator, Functionalities) {
+    entt::aligned_allocator<char, 64u> allocator;
+    entt::aligned_allocator<int, 64u> other{allocator};
+
+    ASSERT_EQ(allocator, other);
+    ASSERT_FALSE(allocator != other);
+    ASSERT_EQ((entt::aligned_allocator<double, 1u>::alignment), alignof(double));
+
+    auto *ptr = allocator.allocate(3u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64u, 0u);
+
+    allocator.deallocate(ptr, 3u);
+
+    std::vector<int, entt::aligned_allocator<int, 64u>> vec{1, 2, 3};
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 64u, 0u);
+}
+
+TEST(AlignedAllocator, SparseSetAndStorage) {
+    entt::basic_sparse_set<entt::entity, entt::aligned_allocator<entt::entity, 64u>> set;
+    entt::basic_storage<entt::entity, int, entt::aligned_allocator<int, 32u>> storage;
+
+    set.emplace(entt::entity{42});
+    storage.emplace(entt::entity{42}, 3);
+
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(set.data()) % 64u, 0u);
+    ASSERT_EQ(storage.get(entt::entity{42}), 3);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(storage.raw()) % 32u, 0u);
+}
+
+TEST(HugePageAllocator, Functionalities) {
+    using allocator_type = entt::huge_page_allocator<int>;
+    constexpr auto huge = allocator_type::huge_page_size / sizeof(int);
+    allocator_type allocator;
+
+    ASSERT_EQ(allocator, entt::huge_page_allocator<char>{});
+
+    auto *small = allocator.allocate(16u);
+    auto *large = allocator.allocate(huge + 1u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(small) % allocator_type::alignment, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % allocator_type::huge_page_size, 0u);
+
+    large[huge] = 42;
+
+    ASSERT_EQ(large[huge], 42);
+
+    allocator.deallocate(large, huge + 1u);
+    allocator.deallocate(small, 16u);
+
+    entt::basic_storage<entt::entity, int, allocator_type> storage;
+    storage.reserve(huge);
+    storage.emplace(entt::entity{3}, 3);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(storage.raw()) % allocator_type::huge_page_size, 0u);
+    ASSERT_EQ(storage.get(entt::entity{3}), 3);
+}
+
+TEST(Arena, Functionalities) {
+    entt::arena arena{64u};
+
+    ASSERT_EQ(arena.capacity(), 0u);
+
+    const std::vector<int> values{1, 2, 3};
+    const auto span = arena.span<int>(values.cbegin(), values.cend());
+    const auto str = arena.string("hello");
+    const auto zeros = arena.span<double>(2u);
+
+    ASSERT_EQ(arena.capacity(), 64u);
+    ASSERT_EQ(span.size(), 3u);
+    ASSERT_EQ(span[2u], 3);
+    ASSERT_EQ((std::vector<int>{span.begin(), span.end()}), values);
+    ASSERT_EQ(str, "hello");
+    ASSERT_EQ(zeros[1u], 0.);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(zeros.data()) % alignof(double), 0u);
+    ASSERT_TRUE(arena.span<char>(0u).empty());
+    ASSERT_TRUE(entt::arena_span<int>{}.empty());
+
+    const auto *first = span.data();
+    auto *large = arena.allocate(128u, 32u);
+
+    ASSERT_GT(arena.capacity(), 64u + 128u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % 32u, 0u);
+
+    const auto capacity = arena.capacity();
+    arena.reset();
+
+    ASSERT_EQ(arena.span<int>(values.cbegin(), values.cend()).data(), first);
+    ASSERT_EQ(arena.allocate(128u, 32u), large);
+    ASSERT_EQ(arena.capacity(), capacity);
+}
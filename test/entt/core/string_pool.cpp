@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/string_pool.hpp>
+
+struct length_hash {
+    template<typename Char>
+    static constexpr entt::id_type value(const Char *, std::size_t size) {
+        return static_cast<entt::id_type>(size);
+    }
+};
+
+TEST(StringPool, Functionalities) {
+    using namespace entt::literals;
+
+    entt::string_pool pool{};
+    const std::string path{"textures/hero.png"};
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.find("textures/hero.png"_hs), nullptr);
+    ASSERT_FALSE(pool.collides(path.data(), path.size()));
+
+    const auto hash = pool.intern(path.data(), path.size());
+
+    ASSERT_EQ(hash, "textures/hero.png"_hs);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_TRUE(pool.contains(hash));
+    ASSERT_EQ(pool.length(hash), path.size());
+    ASSERT_NE(pool.find(hash), path.data());
+    ASSERT_EQ(std::string_view{pool.find(hash)}, path);
+
+    const auto *canonical = pool.find(hash);
+
+    ASSERT_EQ(pool.intern("textures/hero.png"), hash);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.find(hash), canonical);
+    ASSERT_FALSE(pool.collides(path.data(), path.size()));
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.contains(hash));
+}
+
+TEST(StringPool, ManyStrings) {
+    entt::string_pool pool{64u};
+    std::vector<std::pair<entt::id_type, const char *>> interned{};
+    const std::string longest(100u, 'x');
+
+    pool.reserve(10u);
+
+    for(std::size_t pos{}; pos < 1000u; ++pos) {
+        const auto name = "name_" + std::to_string(pos);
+        const auto hash = pool.intern(name.c_str());
+        interned.emplace_back(hash, pool.find(hash));
+    }
+
+    const auto hash = pool.intern(longest.data(), longest.size());
+
+    ASSERT_EQ(pool.size(), 1001u);
+    ASSERT_EQ(std::string_view{pool.find(hash)}, longest);
+
+    for(std::size_t pos{}; pos < interned.size(); ++pos) {
+        // pointers are stable and strings are left untouched
+        ASSERT_EQ(pool.find(interned[pos].first), interned[pos].second);
+        ASSERT_EQ(std::string_view{interned[pos].second}, "name_" + std::to_string(pos));
+        ASSERT_EQ(interned[pos].first, entt::hashed_string::value(interned[pos].second));
+    }
+}
+
+TEST(StringPool, Collisions) {
+    entt::basic_string_pool<char, length_hash> pool{};
+
+    pool.intern("foo");
+
+    ASSERT_TRUE(pool.collides("bar", 3u));
+    ASSERT_FALSE(pool.collides("foo", 3u));
+    ASSERT_FALSE(pool.collides("quux", 4u));
+}
+
+TEST(StringPool, WideCharacters) {
+    using namespace entt::literals;
+
+    entt::wstring_pool pool{};
+    const auto hash = pool.intern(L"foobar");
+
+    ASSERT_EQ(hash, L"foobar"_hws);
+    ASSERT_EQ(std::wstring_view{pool.find(hash)}, L"foobar");
+}
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
+
+struct node {
+    using callback_type = void(const void *, std::vector<int> &);
+
+    void prepare(std::vector<int> &log) const {
+        log.reserve(log.size() + 1u);
+    }
+
+    callback_type * callback() const {
+        return func;
+    }
+
+    bool top_level() const {
+        return root;
+    }
+
+    const void * data() const {
+        return payload;
+    }
+
+    const std::vector<std::size_t> & children() const {
+        return edges;
+    }
+
+    callback_type *func;
+    const void *payload;
+    std::vector<std::size_t> edges;
+    bool root;
+};
+
+struct hinted_node: node {
+    std::size_t cost() const {
+        return weight;
+    }
+
+    bool main_thread() const {
+        return affinity;
+    }
+
+    std::size_t weight;
+    bool affinity;
+};
+
+TEST(ThreadPool, Functionalities) {
+    entt::thread_pool pool{2u};
+    std::atomic<int> counter{};
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.try_run());
+
+    for(auto next = 0; next < 32; ++next) {
+        pool.submit([&counter]() { ++counter; });
+    }
+
+    pool.wait();
+
+    ASSERT_EQ(counter, 32);
+    ASSERT_FALSE(pool.try_run());
+}
+
+TEST(ThreadPool, NoWorkers) {
+    entt::thread_pool pool{0u};
+    int counter{};
+
+    ASSERT_EQ(pool.size(), 0u);
+
+    pool.submit([&counter]() { ++counter; });
+    pool.submit([&counter]() { ++counter; });
+
+    ASSERT_EQ(counter, 0);
+    ASSERT_TRUE(pool.try_run());
+    ASSERT_EQ(counter, 1);
+
+    pool.wait();
+
+    ASSERT_EQ(counter, 2);
+    ASSERT_FALSE(pool.try_run());
+}
+
+TEST(ThreadPool, Executor) {
+    entt::thread_pool pool{3u};
+    std::vector<int> values(64u, 0);
+
+    pool(values.size(), [&values](const std::size_t pos) { values[pos] = static_cast<int>(pos); });
+
+    for(std::size_t pos{}; pos < values.size(); ++pos) {
+        ASSERT_EQ(values[pos], static_cast<int>(pos));
+    }
+
+    pool(0u, [](const std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPool, NestedExecutor) {
+    entt::thread_pool pool{2u};
+    std::atomic<int> counter{};
+
+    pool(4u, [&pool, &counter](const std::size_t) {
+        pool(8u, [&counter](const std::size_t) { ++counter; });
+    });
+
+    ASSERT_EQ(counter, 32);
+}
+
+TEST(ThreadPool, Run) {
+    std::vector<int> log{};
+    std::vector<node> graph{};
+    const int values[4u]{0, 1, 2, 3};
+
+    auto *push = +[](const void *payload, std::vector<int> &out) {
+        out.push_back(*static_cast<const int *>(payload));
+    };
+
+    // a chain, so that the execution order is fully determined
+    graph.push_back({push, &values[0u], {1u, 2u}, true});
+    graph.push_back({push, &values[1u], {2u}, false});
+    graph.push_back({push, &values[2u], {3u}, false});
+    graph.push_back({push, &values[3u], {}, false});
+
+    entt::thread_pool pool{4u};
+    pool.run(graph, log);
+
+    ASSERT_EQ(log.size(), 4u);
+
+    for(std::size_t pos{}; pos < log.size(); ++pos) {
+        ASSERT_EQ(log[pos], values[pos]);
+    }
+
+    entt::thread_pool{0u}.run(graph, log);
+
+    ASSERT_EQ(log.size(), 8u);
+    ASSERT_EQ(log[4u], 0);
+    ASSERT_EQ(log[7u], 3);
+
+    pool.run(std::vector<node>{}, log);
+
+    ASSERT_EQ(log.size(), 8u);
+}
+
+TEST(ThreadPool, Profile) {
+    using namespace std::chrono_literals;
+
+    std::vector<int> log{};
+    std::vector<node> graph{};
+    const int values[4u]{1, 5, 1, 1};
+    std::vector<entt::task_profile> profiles{};
+
+    auto *sleep = +[](const void *payload, std::vector<int> &) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{*static_cast<const int *>(payload)});
+    };
+
+    graph.push_back({sleep, &values[0u], {1u, 2u}, true});
+    graph.push_back({sleep, &values[1u], {3u}, false});
+    graph.push_back({sleep, &values[2u], {3u}, false});
+    graph.push_back({sleep, &values[3u], {}, false});
+
+    entt::thread_pool pool{2u};
+    pool.profile(graph, [&profiles](const entt::task_profile *first, const std::size_t count) { profiles.assign(first, first + count); }, log);
+
+    ASSERT_EQ(profiles.size(), 4u);
+
+    for(std::size_t pos{}; pos < profiles.size(); ++pos) {
+        ASSERT_GE(profiles[pos].duration, std::chrono::milliseconds{values[pos]});
+        ASSERT_NE(profiles[pos].thread, std::thread::id{});
+    }
+
+    ASSERT_EQ(profiles[0u].path, profiles[0u].duration);
+    ASSERT_GE(profiles[1u].start, profiles[0u].start + profiles[0u].duration);
+    ASSERT_GE(profiles[3u].start, profiles[1u].start + profiles[1u].duration);
+    ASSERT_EQ(profiles[1u].path, profiles[0u].path + profiles[1u].duration);
+    ASSERT_EQ(profiles[3u].path, (std::max)(profiles[1u].path, profiles[2u].path) + profiles[3u].duration);
+    ASSERT_GE(profiles[3u].path, 7ms);
+
+    bool invoked = false;
+    pool.profile(std::vector<node>{}, [&invoked](const entt::task_profile *, const std::size_t count) { invoked = (count == 0u); }, log);
+
+    ASSERT_TRUE(invoked);
+}
+
+TEST(ThreadPool, Coarsening) {
+    std::vector<int> log{};
+    std::vector<hinted_node> graph{};
+    std::thread::id threads[6u]{};
+
+    auto *track = +[](const void *payload, std::vector<int> &) {
+        *static_cast<std::thread::id *>(const_cast<void *>(payload)) = std::this_thread::get_id();
+    };
+
+    graph.push_back({{track, &threads[0u], {1u, 2u, 3u, 4u, 5u}, true}, 0u, false});
+    graph.push_back({{track, &threads[1u], {}, false}, 1u, false});
+    graph.push_back({{track, &threads[2u], {}, false}, 1u, false});
+    graph.push_back({{track, &threads[3u], {}, false}, 2u, false});
+    graph.push_back({{track, &threads[4u], {}, false}, 2u, false});
+    graph.push_back({{track, &threads[5u], {}, false}, 4u, false});
+
+    entt::thread_pool pool{4u};
+
+    ASSERT_EQ(pool.grain(), 0u);
+
+    pool.grain(4u);
+    pool.run(graph, log);
+
+    ASSERT_EQ(pool.grain(), 4u);
+
+    for(auto &&curr: threads) {
+        ASSERT_NE(curr, std::thread::id{});
+    }
+
+    // merged vertices run one after the other on the same thread
+    ASSERT_EQ(threads[1u], threads[2u]);
+    ASSERT_EQ(threads[2u], threads[3u]);
+}
+
+TEST(ThreadPool, MainThread) {
+    std::vector<int> log{};
+    std::vector<hinted_node> graph{};
+    std::thread::id threads[4u]{};
+
+    auto *track = +[](const void *payload, std::vector<int> &) {
+        *static_cast<std::thread::id *>(const_cast<void *>(payload)) = std::this_thread::get_id();
+    };
+
+    graph.push_back({{track, &threads[0u], {1u, 2u}, true}, 0u, true});
+    graph.push_back({{track, &threads[1u], {3u}, false}, 0u, false});
+    graph.push_back({{track, &threads[2u], {3u}, false}, 0u, true});
+    graph.push_back({{track, &threads[3u], {}, false}, 0u, true});
+
+    entt::thread_pool pool{2u};
+    pool.run(graph, log);
+
+    ASSERT_EQ(threads[0u], std::this_thread::get_id());
+    ASSERT_NE(threads[1u], std::thread::id{});
+    ASSERT_EQ(threads[2u], std::this_thread::get_id());
+    ASSERT_EQ(threads[3u], std::this_thread::get_id());
+}
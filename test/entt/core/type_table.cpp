@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+
+struct position {
+    int x;
+    int y;
+};
+
+struct velocity {
+    int dx;
+    int dy;
+};
+
+TEST(TypeTable, Functionalities) {
+    entt::type_table table{};
+    entt::type_table::bind(&table);
+
+    ASSERT_EQ(table.size(), 0u);
+    ASSERT_FALSE(table.frozen());
+
+    // as the main application would do when loading plugins
+    table.emplace<position, velocity>();
+
+    ASSERT_EQ(table.size(), 2u);
+    ASSERT_EQ(table.value(entt::type_hash<position>::value()), 0u);
+    ASSERT_EQ(table.value(entt::type_hash<velocity>::value()), 1u);
+    ASSERT_EQ(table.value(entt::type_hash<int>::value()), 2u);
+    ASSERT_EQ(table.size(), 3u);
+
+    table.freeze();
+
+    ASSERT_TRUE(table.frozen());
+    ASSERT_TRUE(table.contains(entt::type_hash<int>::value()));
+    ASSERT_FALSE(table.contains(entt::type_hash<char>::value()));
+    ASSERT_EQ(table.find(entt::type_hash<velocity>::value()), 1u);
+
+    // types that aren't registered get a new identifier and the table isn't modified
+    ASSERT_EQ(table.find(entt::type_hash<char>::value()), 3u);
+    ASSERT_EQ(table.find(entt::type_hash<char>::value()), 4u);
+    ASSERT_EQ(table.size(), 3u);
+
+    ASSERT_EQ(entt::type_seq<int>::value(), 2u);
+    ASSERT_EQ(entt::type_seq<velocity>::value(), 1u);
+    ASSERT_EQ(entt::type_seq<position>::value(), 0u);
+    ASSERT_EQ(entt::type_id<position>().seq(), 0u);
+
+    ASSERT_EQ(table.next(), 5u);
+    ASSERT_EQ(table.value(entt::type_hash<int>::value()), 2u);
+    ASSERT_EQ(table.size(), 3u);
+
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 1, 2);
+    registry.emplace<velocity>(entity, 3, 4);
+
+    ASSERT_EQ(registry.get<position>(entity).y, 2);
+    ASSERT_EQ(registry.get<velocity>(entity).dx, 3);
+
+    entt::type_table::bind(nullptr);
+}
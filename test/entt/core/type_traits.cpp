@@ -1,3 +1,5 @@
+#include <memory>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <gtest/gtest.h>
@@ -5,6 +7,13 @@
 #include <entt/core/hashed_string.hpp>
 #include <entt/core/type_traits.hpp>
 
+struct relocatable_type {
+    std::unique_ptr<int> value;
+};
+
+template<>
+struct entt::is_trivially_relocatable<relocatable_type>: std::true_type {};
+
 TEST(TypeTraits, SizeOf) {
     static_assert(entt::size_of_v<void> == 0u);
     static_assert(entt::size_of_v<char> == sizeof(char));
@@ -70,6 +79,13 @@ TEST(TypeTraits, IsApplicable) {
     static_assert(!entt::is_applicable_r_v<int, int(int, char), std::tuple<void>>);
 }
 
+TEST(TypeTraits, IsTriviallyRelocatable) {
+    static_assert(entt::is_trivially_relocatable_v<int>);
+    static_assert(entt::is_trivially_relocatable_v<std::tuple<int, char>> == std::is_trivially_copyable_v<std::tuple<int, char>>);
+    static_assert(!entt::is_trivially_relocatable_v<std::string>);
+    static_assert(entt::is_trivially_relocatable_v<relocatable_type>);
+}
+
 TEST(TypeTraits, ConstnessAs) {
     static_assert(std::is_same_v<entt::constness_as_t<int, char>, int>);
     static_assert(std::is_same_v<entt::constness_as_t<const int, char>, int>);
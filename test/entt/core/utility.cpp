@@ -58,3 +58,29 @@ TEST(Utility, YCombinator) {
     ASSERT_EQ(gauss(3u), 3u*4u/2u);
     ASSERT_EQ(std::as_const(gauss)(7u), 7u*8u/2u);
 }
+
+TEST(Utility, Span) {
+    int values[3u]{1, 2, 3};
+    entt::span<int> span{values, 3u};
+    const entt::span<const int> other{};
+
+    ASSERT_EQ(span.data(), values);
+    ASSERT_EQ(span.size(), 3u);
+    ASSERT_EQ(span.size_bytes(), sizeof(values));
+    ASSERT_FALSE(span.empty());
+    ASSERT_EQ(span.end() - span.begin(), 3);
+
+    span[1u] = 42;
+    int sum{};
+
+    for(auto value: span) {
+        sum += value;
+    }
+
+    ASSERT_EQ(values[1u], 42);
+    ASSERT_EQ(sum, 46);
+
+    ASSERT_EQ(other.data(), nullptr);
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(other.begin(), other.end());
+}
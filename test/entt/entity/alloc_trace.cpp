@@ -0,0 +1,143 @@
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+struct alloc_entry {
+    std::size_t count{};
+    std::size_t bytes{};
+};
+
+static std::map<std::string, alloc_entry> allocations{};
+
+void record(const char *name, std::string_view type, const std::size_t size) {
+    auto &&entry = allocations[std::string{name} + ':' + std::string{type}];
+    ++entry.count;
+    entry.bytes += size;
+}
+
+#define ENTT_ALLOC_TRACE(name, type, size) record(name, type, size)
+
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/process/process.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/resource/cache.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/sigh.hpp>
+
+struct an_event { int value; };
+
+struct listener {
+    void receive(const an_event &) {}
+    void call(int) {}
+};
+
+struct empty_process: entt::process<empty_process, int> {
+    void update(delta_type, void *) { succeed(); }
+};
+
+struct resource { int value; };
+
+struct loader: entt::resource_loader<loader, resource> {
+    std::shared_ptr<resource> load(int value) const {
+        return std::make_shared<resource>(resource{value});
+    }
+};
+
+std::string key(const char *name, std::string_view type) {
+    return std::string{name} + ':' + std::string{type};
+}
+
+std::size_t total() {
+    std::size_t count{};
+
+    for(auto &&elem: allocations) {
+        count += elem.second.count;
+    }
+
+    return count;
+}
+
+TEST(AllocTrace, Registry) {
+    entt::registry registry;
+    entt::entity entities[64u];
+
+    allocations.clear();
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_NE(allocations.find(key("entt::sparse_set::assure", entt::type_id<entt::entity>().name())), allocations.cend());
+    ASSERT_EQ(allocations[key("entt::storage::insert", entt::type_id<int>().name())].count, 1u);
+    ASSERT_EQ(allocations[key("entt::storage::insert", entt::type_id<int>().name())].bytes, 64u * sizeof(int));
+
+    // steady state, capacity is reused from frame to frame
+    allocations.clear();
+
+    for(auto frame = 0; frame < 3; ++frame) {
+        for(auto entity: entities) {
+            registry.remove<int>(entity);
+        }
+
+        for(auto entity: entities) {
+            registry.emplace<int>(entity, frame);
+        }
+    }
+
+    ASSERT_EQ(total(), 0u);
+}
+
+TEST(AllocTrace, Signals) {
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    entt::dispatcher dispatcher;
+    listener instance;
+
+    allocations.clear();
+
+    sink.connect<&listener::call>(instance);
+    dispatcher.sink<an_event>().connect<&listener::receive>(instance);
+
+    // a couple of listeners fit the small buffer of the signal
+    ASSERT_EQ(allocations.count(key("entt::sink::connect", entt::type_id<void(int)>().name())), 0u);
+    ASSERT_EQ(allocations[key("entt::dispatcher::assure", entt::type_id<an_event>().name())].count, 1u);
+
+    // events are double buffered, both queues get their memory while warming up
+    for(auto frame = 0; frame < 2; ++frame) {
+        dispatcher.enqueue<an_event>(frame);
+        dispatcher.update();
+    }
+
+    allocations.clear();
+
+    for(auto frame = 0; frame < 3; ++frame) {
+        sigh.publish(frame);
+        dispatcher.enqueue<an_event>(frame);
+        dispatcher.update();
+    }
+
+    ASSERT_EQ(total(), 0u);
+}
+
+TEST(AllocTrace, SchedulerMetaAndResources) {
+    entt::scheduler<int> scheduler;
+    entt::resource_cache<resource> cache;
+
+    allocations.clear();
+
+    scheduler.attach<empty_process>();
+    static_cast<void>(cache.load<loader>(entt::id_type{42}, 42));
+    static_cast<void>(cache.load<loader>(entt::id_type{42}, 42));
+    entt::meta_any small{0};
+    entt::meta_any large{std::array<int, 64u>{}};
+
+    ASSERT_EQ(allocations[key("entt::scheduler::attach", entt::type_id<empty_process>().name())].count, 1u);
+    ASSERT_EQ(allocations[key("entt::resource_cache::load", entt::type_id<resource>().name())].count, 1u);
+    ASSERT_EQ((allocations[key("entt::meta_any", entt::type_id<std::array<int, 64u>>().name())].bytes), sizeof(std::array<int, 64u>));
+    ASSERT_EQ(allocations.count(key("entt::meta_any", entt::type_id<int>().name())), 0u);
+}
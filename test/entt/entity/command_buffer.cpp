@@ -0,0 +1,95 @@
+#include <iterator>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct empty_type {};
+
+TEST(CommandBuffer, Functionalities) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<char>(entities[0u], 'c');
+
+    ASSERT_TRUE(buffer.empty());
+
+    buffer.emplace<int>(entities[0u], 42);
+    buffer.emplace<int>(entities[1u], 3);
+    buffer.emplace<int>(entities[1u], 1);
+    buffer.emplace<empty_type>(entities[2u]);
+    buffer.remove<char, double>(entities[0u]);
+    buffer.destroy(entities[2u]);
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_FALSE(registry.has<int>(entities[0u]));
+    ASSERT_TRUE(registry.valid(entities[2u]));
+
+    buffer.apply(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(registry.get<int>(entities[0u]), 42);
+    ASSERT_EQ(registry.get<int>(entities[1u]), 1);
+    ASSERT_FALSE(registry.has<char>(entities[0u]));
+    ASSERT_FALSE(registry.valid(entities[2u]));
+    ASSERT_EQ(registry.size<empty_type>(), 0u);
+
+    buffer.emplace<int>(entities[0u], 0);
+    buffer.emplace<int>(entities[2u], 0);
+    buffer.destroy(entities[2u]);
+    buffer.apply(registry);
+
+    ASSERT_EQ(registry.get<int>(entities[0u]), 0);
+    ASSERT_EQ(registry.size<int>(), 2u);
+}
+
+TEST(CommandBuffer, Create) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+
+    buffer.create(42, 'c');
+    buffer.create(3);
+    buffer.create();
+
+    ASSERT_EQ(registry.alive(), 0u);
+
+    buffer.apply(registry);
+
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(registry.size<int>(), 2u);
+    ASSERT_EQ(registry.size<char>(), 1u);
+
+    registry.view<char>().each([&registry](const auto entity, const auto value) {
+        ASSERT_EQ(value, 'c');
+        ASSERT_EQ(registry.get<int>(entity), 42);
+    });
+}
+
+TEST(CommandBuffer, Merge) {
+    entt::registry registry;
+    entt::command_buffer buffer;
+    entt::command_buffer other;
+    const auto entity = registry.create();
+
+    buffer.create(1);
+    other.create(2, 'c');
+    other.emplace<std::unique_ptr<int>>(entity, std::make_unique<int>(42));
+    other.remove<char>(entity);
+
+    buffer.merge(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_FALSE(buffer.empty());
+
+    buffer.apply(registry);
+
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(*registry.get<std::unique_ptr<int>>(entity), 42);
+
+    registry.view<char>().each([&registry](const auto entt, const auto value) {
+        ASSERT_EQ(value, 'c');
+        ASSERT_EQ(registry.get<int>(entt), 2);
+    });
+}
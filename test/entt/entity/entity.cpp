@@ -27,3 +27,57 @@ TEST(Entity, Null) {
 
     ASSERT_FALSE(registry.valid(entt::null));
 }
+
+enum class shard_entity: std::uint64_t {};
+
+template<>
+struct entt::entt_traits<shard_entity>: entt::basic_entt_traits<std::uint64_t, 32u, 8u> {};
+
+TEST(Entity, CustomLayout) {
+    using traits_type = entt::entt_traits<shard_entity>;
+
+    static_assert(std::is_same_v<traits_type::version_type, std::uint8_t>);
+    static_assert(traits_type::entity_mask == 0xFFFFFFFFu);
+    static_assert(traits_type::version_mask == 0xFFu);
+    static_assert(traits_type::entity_shift == 32u);
+    static_assert(traits_type::user_shift == 40u);
+    static_assert(traits_type::user_mask == 0xFFFFFF0000000000u);
+
+    static_assert(entt::entt_traits<std::uint32_t>::entity_mask == 0xFFFFFu);
+    static_assert(entt::entt_traits<std::uint32_t>::version_mask == 0xFFFu);
+    static_assert(entt::entt_traits<std::uint32_t>::user_mask == 0u);
+
+    entt::basic_registry<shard_entity> registry{};
+    const auto shard = std::uint64_t{42u} << traits_type::user_shift;
+    const auto entity = registry.create(shard_entity{shard | 3u});
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.entity(entity), shard_entity{3u});
+    ASSERT_EQ(registry.version(entity), 0u);
+    ASSERT_FALSE(entity == entt::null);
+
+    registry.emplace<int>(entity, 42);
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+
+    registry.destroy(entity, 255u);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_EQ(registry.current(entity), 255u);
+
+    // recycled identifiers keep the users' bits and the version wraps around
+    auto other = registry.create();
+
+    for(; registry.entity(other) != shard_entity{3u}; other = registry.create());
+
+    ASSERT_EQ(entt::to_integral(other) & traits_type::user_mask, shard);
+    ASSERT_EQ(registry.version(other), 255u);
+
+    registry.destroy(other);
+    other = registry.create();
+
+    ASSERT_EQ(registry.entity(other), shard_entity{3u});
+    ASSERT_EQ(entt::to_integral(other) & traits_type::user_mask, shard);
+    ASSERT_EQ(registry.version(other), 0u);
+    ASSERT_FALSE(registry.has<int>(other));
+}
@@ -1,12 +1,32 @@
+#include <cstdint>
+#include <limits>
 #include <utility>
 #include <iterator>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/group.hpp>
 
 struct empty_type {};
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+};
 struct boxed_int { int value; };
 
 bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
@@ -162,6 +182,29 @@ TEST(NonOwningGroup, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(NonOwningGroup, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    auto group = registry.group(entt::get<int, char>);
+    std::atomic<int> cnt{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 1);
+    registry.insert<char>(entities.begin() + 2u, entities.end());
+
+    group.par_each(thread_executor{}, [](int &value, char &) { ++value; }, 3u);
+
+    ASSERT_EQ(registry.get<int>(entities[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entities[2u]), 2);
+    ASSERT_EQ(registry.get<int>(entities[9u]), 2);
+
+    std::as_const(registry).group(entt::get<const int, const char>).par_each(thread_executor{}, [&cnt](const auto entt, const int &value, const char &) {
+        cnt += value + static_cast<int>(entt::to_integral(entt) >= 2u);
+    });
+
+    ASSERT_EQ(cnt.load(), 24);
+}
+
 TEST(NonOwningGroup, Sort) {
     entt::registry registry;
     auto group = registry.group(entt::get<const int, unsigned int>);
@@ -540,6 +583,119 @@ TEST(NonOwningGroup, SignalRace) {
     ASSERT_EQ(group.size(), 1u);
 }
 
+TEST(NonOwningGroup, RangeOperations) {
+    entt::registry registry;
+    entt::entity entities[4u];
+    const auto group = registry.group(entt::get<int, char>, entt::exclude<double>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities) - 1);
+
+    ASSERT_EQ(group.size(), 3u);
+
+    registry.insert<double>(std::begin(entities), std::begin(entities) + 2);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_TRUE(group.contains(entities[2u]));
+
+    registry.clear<double>();
+
+    ASSERT_EQ(group.size(), 3u);
+
+    registry.remove<char>(std::begin(entities), std::begin(entities) + 2);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_TRUE(group.contains(entities[2u]));
+}
+
+TEST(NonOwningGroup, LazyInitialization) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.emplace<char>(entities[0u]);
+    registry.emplace<char>(entities[1u]);
+
+    const auto group = registry.group(entt::get<int, char>, entt::exclude<double>);
+
+    registry.emplace<char>(entities[2u]);
+    registry.emplace<double>(entities[0u]);
+    registry.remove<int>(entities[1u]);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_FALSE(group.contains(entities[0u]));
+    ASSERT_FALSE(group.contains(entities[1u]));
+    ASSERT_TRUE(group.contains(entities[2u]));
+
+    registry.remove<double>(entities[0u]);
+    registry.emplace<int>(entities[1u]);
+
+    ASSERT_EQ(group.size(), 3u);
+    ASSERT_EQ((registry.group(entt::get<int, char>, entt::exclude<double>).size()), 3u);
+
+    registry.destroy(entities[2u]);
+
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_FALSE(group.contains(entities[2u]));
+}
+
+TEST(NonOwningGroup, ConcurrentLazyInitialization) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+    registry.insert<char>(entities.begin(), entities.end());
+
+    const auto group = std::as_const(registry).group(entt::get<const int, const char>);
+    std::atomic<std::size_t> count{};
+
+    thread_executor{}(4u, [&group, &count](const std::size_t) {
+        for([[maybe_unused]] auto entity: group) {
+            ++count;
+        }
+    });
+
+    ASSERT_EQ(count, 4000u);
+    ASSERT_EQ(group.size(), 1000u);
+}
+
+TEST(NonOwningGroup, BuildGroups) {
+    entt::registry registry;
+    entt::entity entities[4u];
+    std::size_t sizes[3u]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities) - 1u);
+    registry.emplace<double>(entities[0u]);
+
+    static_cast<void>(registry.group(entt::get<int, char>));
+    static_cast<void>(registry.group(entt::get<int, char>, entt::exclude<double>));
+    static_cast<void>(registry.group<double>(entt::get<int>));
+
+    registry.group_stats([&sizes, pos = 0u](auto, const auto size) mutable { sizes[pos++] = size; });
+
+    // owning groups are initialized eagerly
+    ASSERT_EQ(sizes[0u], 0u);
+    ASSERT_EQ(sizes[1u], 0u);
+    ASSERT_EQ(sizes[2u], 1u);
+
+    registry.build_groups(thread_executor{});
+    registry.group_stats([&sizes, pos = 0u](auto, const auto size) mutable { sizes[pos++] = size; });
+
+    ASSERT_EQ(sizes[0u], 3u);
+    ASSERT_EQ(sizes[1u], 2u);
+    ASSERT_EQ(sizes[2u], 1u);
+
+    registry.emplace<char>(entities[3u]);
+
+    ASSERT_EQ((registry.group(entt::get<int, char>).size()), 4u);
+    ASSERT_EQ((registry.group(entt::get<int, char>, entt::exclude<double>).size()), 3u);
+}
+
 TEST(NonOwningGroup, ExtendedGet) {
     using type = decltype(std::declval<entt::registry>().group(entt::get<int, empty_type, char>).get({}));
     static_assert(std::tuple_size_v<type> == 2u);
@@ -694,6 +850,102 @@ TEST(OwningGroup, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(OwningGroup, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    auto group = registry.group<int>(entt::get<char>);
+    std::atomic<int> cnt{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 1);
+    registry.insert<char>(entities.begin() + 2u, entities.end(), 'c');
+
+    group.par_each(thread_executor{}, [](int &value, char &elem) { value += (elem == 'c'); }, 3u);
+
+    ASSERT_EQ(registry.get<int>(entities[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entities[2u]), 2);
+    ASSERT_EQ(registry.get<int>(entities[9u]), 2);
+
+    group.par_each(thread_executor{}, [&cnt, &registry](const auto entt, const int &value, const char &) {
+        ASSERT_EQ(&registry.get<int>(entt), &value);
+        cnt += value;
+    });
+
+    ASSERT_EQ(cnt.load(), 16);
+}
+
+TEST(OwningGroup, EachBatch) {
+    entt::registry registry;
+    auto group = registry.group<int, empty_type>(entt::get<const char>);
+    std::vector<std::size_t> counts{};
+
+    for(int pos{}; pos < 7; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<empty_type>(entity);
+
+        if(pos != 3) {
+            registry.emplace<char>(entity, static_cast<char>('a' + pos));
+        }
+    }
+
+    group.each_batch<4u>([&registry, &counts](const entt::entity *entt, int *value, const char *const *other, auto count) {
+        for(std::size_t next{}; next < count; ++next) {
+            ASSERT_EQ(&registry.get<int>(entt[next]), value + next);
+            ASSERT_EQ(*other[next], static_cast<char>('a' + value[next]));
+            ASSERT_NE(value[next], 3);
+        }
+
+        counts.push_back(count);
+    });
+
+    ASSERT_EQ(counts, (std::vector<std::size_t>{4u, 2u}));
+
+    std::as_const(registry).group<const int, const empty_type>(entt::get<const char>).each_batch<6u>([](const entt::entity *, const int *value, const char *const *, std::size_t count) {
+        ASSERT_EQ(count, 6u);
+        ASSERT_EQ(value[0u], 0);
+    });
+}
+
+TEST(OwningGroup, Spans) {
+    entt::registry registry;
+    auto group = registry.group<int, empty_type, char>();
+
+    ASSERT_TRUE(std::get<0>(group.spans()).empty());
+
+    for(int pos{}; pos < 5; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity, static_cast<char>('a' + pos));
+
+        if(pos != 2) {
+            registry.emplace<empty_type>(entity);
+        }
+    }
+
+    auto [entities, ivalues, cvalues] = group.spans();
+
+    static_assert(std::is_same_v<decltype(entities), entt::span<const entt::entity>>);
+    static_assert(std::is_same_v<decltype(ivalues), entt::span<int>>);
+    static_assert(std::is_same_v<decltype(cvalues), entt::span<char>>);
+
+    ASSERT_EQ(entities.size(), 4u);
+    ASSERT_EQ(ivalues.size(), 4u);
+    ASSERT_EQ(cvalues.size(), 4u);
+    ASSERT_EQ(entities.data(), group.data());
+    ASSERT_EQ(ivalues.data(), group.raw<int>());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(&registry.get<int>(entities[pos]), &ivalues[pos]);
+        ASSERT_EQ(cvalues[pos], static_cast<char>('a' + ivalues[pos]));
+    }
+
+    auto cspans = std::as_const(registry).group<const int, const empty_type, const char>().spans();
+
+    static_assert(std::is_same_v<decltype(cspans), std::tuple<entt::span<const entt::entity>, entt::span<const int>, entt::span<const char>>>);
+    ASSERT_EQ(std::get<1>(cspans).data(), ivalues.data());
+}
+
 TEST(OwningGroup, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<boxed_int, char>();
@@ -1189,6 +1441,36 @@ TEST(OwningGroup, StableLateInitialization) {
     ASSERT_EQ((registry.group<int, char>().size()), 5u);
 }
 
+TEST(OwningGroup, PartitionOnCreation) {
+    entt::registry registry;
+    entt::entity entities[6u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    for(auto pos: { 0u, 1u, 3u, 5u }) {
+        registry.emplace<char>(entities[pos], static_cast<char>(pos));
+    }
+
+    registry.emplace<double>(entities[3u]);
+
+    const auto group = registry.group<int, char>(entt::exclude<double>);
+    const auto &cpool = registry.storage<int>();
+
+    ASSERT_EQ(group.size(), 3u);
+    // valid entities at the front of the pools are left where they are
+    ASSERT_EQ(cpool.data()[0u], entities[0u]);
+    ASSERT_EQ(cpool.data()[1u], entities[1u]);
+    ASSERT_EQ(cpool.data()[2u], entities[5u]);
+
+    group.each([&registry](const auto entt, const int &, const char &value) {
+        ASSERT_EQ(registry.get<char>(entt), value);
+        ASSERT_FALSE(registry.has<double>(entt));
+    });
+
+    ASSERT_EQ((registry.group<int, char>(entt::exclude<double>).size()), 3u);
+}
+
 TEST(OwningGroup, PreventEarlyOptOut) {
     entt::registry registry;
 
@@ -1212,3 +1494,136 @@ TEST(OwningGroup, ExtendedGet) {
     static_assert(std::is_same_v<std::tuple_element_t<0, type>, int &>);
     static_assert(std::is_same_v<std::tuple_element_t<1, type>, char &>);
 }
+
+TEST(OwningGroup, RangeOperations) {
+    entt::registry registry;
+    entt::entity entities[6u];
+    const auto group = registry.group<int, char>(entt::exclude<double>);
+    const auto nested = registry.group<int, char, float>(entt::exclude<double>);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities) + 1, std::end(entities));
+    registry.insert<float>(std::begin(entities) + 3, std::end(entities));
+
+    ASSERT_EQ(group.size(), 5u);
+    ASSERT_EQ(nested.size(), 3u);
+
+    registry.insert<double>(std::begin(entities) + 2, std::begin(entities) + 4);
+
+    ASSERT_EQ(group.size(), 3u);
+    ASSERT_EQ(nested.size(), 2u);
+
+    registry.clear<double>();
+
+    ASSERT_EQ(group.size(), 5u);
+    ASSERT_EQ(nested.size(), 3u);
+
+    registry.remove<float>(std::begin(entities) + 4, std::end(entities));
+
+    ASSERT_EQ(group.size(), 5u);
+    ASSERT_EQ(nested.size(), 1u);
+
+    for(auto entity: group) {
+        ASSERT_TRUE((registry.has<int, char>(entity)));
+    }
+
+    ASSERT_TRUE(nested.contains(entities[3u]));
+
+    registry.clear<char>();
+
+    ASSERT_TRUE(group.empty());
+    ASSERT_TRUE(nested.empty());
+}
+
+TEST(OwningGroup, RangeInsertPreservesOrder) {
+    entt::registry registry;
+    entt::entity entities[5u];
+    const auto group = registry.group<int, char>();
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities), 42);
+    registry.insert<char>(std::begin(entities), std::end(entities), 'c');
+
+    ASSERT_EQ(group.size(), 5u);
+
+    for(auto pos = 0u; pos < 5u; ++pos) {
+        ASSERT_EQ(group.data()[pos], entities[pos]);
+        ASSERT_EQ(registry.view<int>().data()[pos], entities[pos]);
+        ASSERT_EQ(registry.view<char>().data()[pos], entities[pos]);
+    }
+
+    entt::entity others[3u];
+    registry.create(std::begin(others), std::end(others));
+    registry.insert<char>(std::begin(others), std::end(others), 'd');
+    registry.insert<int>(others + 1u, std::end(others), 0);
+
+    ASSERT_EQ(group.size(), 7u);
+    ASSERT_FALSE(group.contains(others[0u]));
+    ASSERT_EQ(group.data()[5u], others[1u]);
+    ASSERT_EQ(group.data()[6u], others[2u]);
+    ASSERT_EQ(registry.view<char>().data()[5u], others[1u]);
+    ASSERT_EQ(registry.view<char>().data()[7u], others[0u]);
+
+    group.each([](const auto &ivalue, const auto &cvalue) {
+        ASSERT_EQ(ivalue == 42, cvalue == 'c');
+    });
+}
+
+struct material { int id; };
+enum class layer: std::uint8_t { back, front };
+
+TEST(OwningGroup, SortBy) {
+    entt::registry registry;
+    auto group = registry.group<material, layer>(entt::get<char>);
+    entt::entity entities[5u];
+
+    const int ids[5u]{3, -2, 7, 3, 0};
+    const layer layers[5u]{layer::front, layer::back, layer::front, layer::back, layer::back};
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities));
+
+    for(auto pos = 0u; pos < 5u; ++pos) {
+        registry.emplace<material>(entities[pos], ids[pos]);
+        registry.emplace<layer>(entities[pos], layers[pos]);
+    }
+
+    group.sort_by<&material::id>();
+
+    int last = std::numeric_limits<int>::min();
+
+    group.each([&last](const material &mat, const layer, const char) {
+        ASSERT_LE(last, mat.id);
+        last = mat.id;
+    });
+
+    ASSERT_EQ(*group.begin(), entities[1u]);
+    ASSERT_EQ(*(group.end() - 1u), entities[2u]);
+
+    // the sort is stable and entities were iterated in reverse order at first
+    auto it = std::find(group.begin(), group.end(), entities[3u]);
+    ASSERT_EQ(*(it + 1u), entities[0u]);
+
+    group.sort_by<layer>([](const layer value) { return value; });
+
+    it = group.begin();
+
+    ASSERT_EQ(*(it++), entities[1u]);
+    ASSERT_EQ(*(it++), entities[4u]);
+    ASSERT_EQ(*(it++), entities[3u]);
+    ASSERT_EQ(*(it++), entities[0u]);
+    ASSERT_EQ(*(it++), entities[2u]);
+    ASSERT_EQ(it, group.end());
+
+    for(auto pos = 0u; pos < 5u; ++pos) {
+        ASSERT_EQ(registry.view<material>().data()[pos], group.data()[pos]);
+        ASSERT_EQ(registry.view<layer>().data()[pos], group.data()[pos]);
+    }
+
+    for(auto entity: group) {
+        const auto pos = std::find(std::begin(entities), std::end(entities), entity) - std::begin(entities);
+        ASSERT_EQ(group.get<material>(entity).id, ids[pos]);
+        ASSERT_EQ(group.get<layer>(entity), layers[pos]);
+    }
+}
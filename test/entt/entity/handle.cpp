@@ -214,3 +214,70 @@ TEST(BasicHandle, ImplicitConversions) {
     ASSERT_EQ(vhandle.get<int>(), cvhandle.get<int>());
     ASSERT_EQ(cvhandle.get<int>(), 42);
 }
+
+TEST(CachedHandle, Functionalities) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    entt::cached_handle<int, char> handle{registry, entity};
+    entt::const_cached_handle<int, char> chandle{std::as_const(registry), entity};
+
+    static_assert(std::is_same_v<decltype(handle.get<int>()), int &>);
+    static_assert(std::is_same_v<decltype(chandle.get<int>()), const int &>);
+
+    ASSERT_FALSE(entt::cached_handle<int>{});
+    ASSERT_TRUE(handle);
+    ASSERT_TRUE(handle.valid());
+    ASSERT_EQ(handle.registry(), &registry);
+    ASSERT_EQ(handle, entity);
+    ASSERT_FALSE((handle.any<int, char>()));
+
+    ASSERT_EQ(handle.emplace<int>(3), 3);
+    ASSERT_EQ(handle.emplace<char>('c'), 'c');
+    ASSERT_TRUE((chandle.has<int, char>()));
+    ASSERT_EQ((handle.get<int, char>()), (std::make_tuple(3, 'c')));
+    ASSERT_EQ(&chandle.get<int>(), &registry.get<int>(entity));
+
+    handle.get<int>() = 42;
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(handle.patch<int>([](auto &value) { ++value; }), 43);
+    ASSERT_EQ(handle.replace<char>('a'), 'a');
+
+    const auto next = handle.rebind(other);
+
+    ASSERT_EQ(next.entity(), other);
+    ASSERT_EQ(next.try_get<int>(), nullptr);
+    ASSERT_EQ(*handle.try_get<int>(), 43);
+    ASSERT_EQ(std::get<1>(next.try_get<int, char>()), nullptr);
+
+    handle.remove<int>();
+
+    ASSERT_FALSE(chandle.has<int>());
+    ASSERT_TRUE(chandle.has<char>());
+
+    const entt::handle_view<int, char> plain = handle;
+
+    ASSERT_EQ(plain.entity(), entity);
+    ASSERT_EQ(plain.get<char>(), 'a');
+}
+
+TEST(CachedHandle, PoolsOutliveEntities) {
+    entt::registry registry;
+    entt::cached_handle<int> handle{registry, registry.create()};
+
+    for(auto pos = 0; pos < 100; ++pos) {
+        registry.emplace<int>(registry.create(), pos);
+    }
+
+    handle.emplace<int>(7);
+    registry.destroy(handle.entity());
+
+    ASSERT_FALSE(handle.valid());
+    ASSERT_FALSE(handle.has<int>());
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 1);
+
+    ASSERT_EQ(handle.rebind(entity).get<int>(), 1);
+}
@@ -1,9 +1,21 @@
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/helper.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/core/type_traits.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+
+struct point {
+    point(int x, int y): sum{x + y} {}
+    int sum;
+};
 
 struct clazz {
     void func(entt::registry &, entt::entity curr) { entt = curr; }
@@ -57,3 +69,99 @@ TEST(Helper, ToEntity) {
     ASSERT_EQ(entt::to_entity(registry, registry.get<int>(other)), other);
     ASSERT_EQ(entt::to_entity(registry, registry.get<char>(other)), other);
 }
+
+TEST(Helper, MetaEmplace) {
+    using namespace entt::literals;
+
+    entt::meta<point>().type("point"_hs)
+        .func<&entt::meta_emplace<entt::entity, point, int, int>, entt::as_ref_t>("emplace"_hs)
+        .func<&entt::meta_insert<entt::entity, point, int, int>>("insert"_hs);
+
+    entt::registry registry;
+    entt::entity entities[3u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    auto type = entt::resolve("point"_hs);
+    auto any = type.func("emplace"_hs).invoke({}, std::ref(registry), entities[0u], 1, 2);
+
+    ASSERT_TRUE(any);
+    ASSERT_EQ(any.cast<point>().sum, 3);
+    ASSERT_EQ(any.try_cast<point>(), &registry.get<point>(entities[0u]));
+
+    const entt::entity *first = entities + 1u;
+    const entt::entity *last = std::end(entities);
+
+    ASSERT_TRUE(type.func("insert"_hs).invoke({}, std::ref(registry), first, last, 3, 4));
+    ASSERT_EQ(registry.size<point>(), 3u);
+    ASSERT_EQ(registry.get<point>(entities[1u]).sum, 7);
+    ASSERT_EQ(registry.get<point>(entities[2u]).sum, 7);
+
+    type.reset();
+}
+
+TEST(Helper, Relationship) {
+    entt::registry registry;
+    entt::entity entities[6u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    const auto parents_first = [&registry]() {
+        std::vector<entt::entity> visited{};
+
+        for(auto [entity, node]: registry.view<entt::relationship>().each()) {
+            if(node.parent != entt::null && std::find(visited.cbegin(), visited.cend(), node.parent) == visited.cend()) {
+                return false;
+            }
+
+            visited.push_back(entity);
+        }
+
+        return true;
+    };
+
+    // children are created before their parents on purpose
+    entt::reparent(registry, entities[5u], entities[3u]);
+    entt::reparent(registry, entities[4u], entities[3u]);
+    entt::reparent(registry, entities[3u], entities[0u]);
+    entt::reparent(registry, entities[2u], entities[1u]);
+    entt::reparent(registry, entities[1u], entities[0u]);
+
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).children, 2u);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).parent, entt::entity{entt::null});
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).first, entities[1u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[1u]).next, entities[3u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[3u]).prev, entities[1u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[3u]).children, 2u);
+    ASSERT_FALSE(parents_first());
+
+    entt::sort_hierarchy(registry);
+
+    ASSERT_TRUE(parents_first());
+
+    // subtrees follow their roots
+    entt::reparent(registry, entities[3u], entities[2u]);
+
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).children, 1u);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).first, entities[1u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[1u]).next, entt::entity{entt::null});
+    ASSERT_EQ(registry.get<entt::relationship>(entities[2u]).first, entities[3u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[3u]).parent, entities[2u]);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[3u]).prev, entt::entity{entt::null});
+
+    entt::reparent(registry, entities[1u], entt::null);
+
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).children, 0u);
+    ASSERT_EQ(registry.get<entt::relationship>(entities[0u]).first, entt::entity{entt::null});
+    ASSERT_EQ(registry.get<entt::relationship>(entities[1u]).parent, entt::entity{entt::null});
+
+    entt::sort_hierarchy(registry);
+
+    ASSERT_TRUE(parents_first());
+
+    const auto view = registry.view<entt::relationship>();
+    auto it = std::find(view.begin(), view.end(), entities[1u]);
+
+    ASSERT_EQ(*(it++), entities[1u]);
+    ASSERT_EQ(*(it++), entities[2u]);
+    ASSERT_EQ(*(it++), entities[3u]);
+    ASSERT_TRUE(*it == entities[4u] || *it == entities[5u]);
+}
@@ -0,0 +1,154 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/image.hpp>
+#include <entt/entity/registry.hpp>
+
+struct position {
+    float x;
+    float y;
+};
+
+struct empty_type {};
+
+TEST(Image, SaveAndLoad) {
+    entt::registry registry;
+    entt::entity entities[5u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[3u]);
+
+    registry.emplace<int>(entities[0u], 42);
+    registry.emplace<int>(entities[4u], 3);
+    registry.emplace<position>(entities[4u], 1.f, 2.f);
+    registry.emplace<empty_type>(entities[0u]);
+
+    std::vector<std::byte> buffer(entt::image::bytes<int, position, empty_type>(registry));
+    entt::image::save<int, position, empty_type>(registry, buffer.data());
+
+    ASSERT_EQ(buffer.size() % 64u, 0u);
+
+    entt::registry other;
+
+    ASSERT_TRUE((entt::image::load<int, position, empty_type>(other, buffer.data(), buffer.size())));
+
+    ASSERT_EQ(other.size(), registry.size());
+    ASSERT_EQ(other.alive(), registry.alive());
+    ASSERT_EQ(other.destroyed(), registry.destroyed());
+
+    ASSERT_TRUE(other.valid(entities[0u]));
+    ASSERT_FALSE(other.valid(entities[1u]));
+    ASSERT_FALSE(other.valid(entities[3u]));
+    ASSERT_TRUE(other.valid(entities[4u]));
+
+    ASSERT_EQ(other.get<int>(entities[0u]), 42);
+    ASSERT_EQ(other.get<int>(entities[4u]), 3);
+    ASSERT_EQ(other.get<position>(entities[4u]).y, 2.f);
+    ASSERT_TRUE(other.has<empty_type>(entities[0u]));
+    ASSERT_FALSE(other.has<empty_type>(entities[4u]));
+
+    ASSERT_EQ(*other.data<int>(), *registry.data<int>());
+
+    std::vector<std::byte> copy(entt::image::bytes<int, position, empty_type>(other));
+    entt::image::save<int, position, empty_type>(other, copy.data());
+
+    ASSERT_EQ(copy, buffer);
+    ASSERT_EQ(other.create(), registry.create());
+}
+
+TEST(Image, Mismatch) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+
+    std::vector<std::byte> buffer(entt::image::bytes<int>(registry));
+    entt::image::save<int>(registry, buffer.data());
+
+    entt::registry other;
+
+    ASSERT_FALSE((entt::image::load<position>(other, buffer.data(), buffer.size())));
+    ASSERT_FALSE((entt::image::load<int, position>(other, buffer.data(), buffer.size())));
+    ASSERT_FALSE((entt::image::load<int>(other, buffer.data(), buffer.size() - 64u)));
+    ASSERT_FALSE((entt::image::load<int>(other, buffer.data(), 0u)));
+
+    ASSERT_EQ(other.size(), 0u);
+
+    ASSERT_TRUE((entt::image::load<int>(other, buffer.data(), buffer.size())));
+    ASSERT_EQ(other.get<int>(entity), 42);
+}
+
+TEST(Image, Corrupted) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 42);
+
+    std::vector<std::byte> buffer(entt::image::bytes<int>(registry));
+    entt::image::save<int>(registry, buffer.data());
+
+    const auto corrupt = [&buffer](const std::size_t pos, const std::uint64_t value) {
+        auto copy = buffer;
+        std::memcpy(copy.data() + pos * sizeof(std::uint64_t), &value, sizeof(value));
+        return copy;
+    };
+
+    entt::registry other;
+
+    for(const auto &image: { corrupt(3u, std::uint64_t{1u} << 62u), corrupt(7u, std::uint64_t{1u} << 62u), corrupt(7u, ~std::uint64_t{}), corrupt(7u, 64u) }) {
+        ASSERT_FALSE((entt::image::load<int>(other, image.data(), image.size())));
+    }
+
+    ASSERT_EQ(other.size(), 0u);
+}
+
+TEST(Image, InvalidEntities) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[3u]);
+    registry.emplace<int>(entities[0u], 42);
+    registry.emplace<int>(entities[2u], 3);
+
+    std::vector<std::byte> buffer(entt::image::bytes<int>(registry));
+    entt::image::save<int>(registry, buffer.data());
+
+    // the list of entities starts at byte 64, the entities of the pool at byte 128
+    const auto corrupt = [&buffer](const std::size_t pos, const entt::entity value) {
+        auto copy = buffer;
+        std::memcpy(copy.data() + pos, &value, sizeof(value));
+        return copy;
+    };
+
+    const auto head = [&buffer](const std::uint64_t value) {
+        auto copy = buffer;
+        std::memcpy(copy.data() + 4u * sizeof(std::uint64_t), &value, sizeof(value));
+        return copy;
+    };
+
+    const auto stale = entt::registry::entity_type{entt::to_integral(entities[2u]) + (1u << entt::entt_traits<entt::entity>::entity_shift)};
+
+    entt::registry other;
+
+    for(const auto &image: {
+        corrupt(128u, entities[1u]),
+        corrupt(128u, entt::entity{7}),
+        corrupt(132u, entities[0u]),
+        corrupt(132u, stale),
+        corrupt(64u + sizeof(entt::entity), entt::entity{3}),
+        head(0u),
+        head(5u)
+    }) {
+        ASSERT_FALSE((entt::image::load<int>(other, image.data(), image.size())));
+    }
+
+    ASSERT_EQ(other.size(), 0u);
+
+    ASSERT_TRUE((entt::image::load<int>(other, buffer.data(), buffer.size())));
+    ASSERT_EQ(other.create(), registry.create());
+}
@@ -0,0 +1,103 @@
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/entity/mailbox.hpp>
+#include <entt/entity/registry.hpp>
+
+struct hit {
+    int damage;
+};
+
+struct empty_type {};
+
+TEST(Mailbox, Functionalities) {
+    entt::mailbox<hit> mailbox;
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    ASSERT_TRUE(mailbox.empty());
+    ASSERT_EQ(mailbox.size(), 0u);
+    ASSERT_EQ(mailbox.count(), 0u);
+
+    mailbox.enqueue(entity, 3);
+    mailbox.enqueue(other, 1);
+    mailbox.enqueue(entity, 2);
+
+    ASSERT_FALSE(mailbox.empty());
+    ASSERT_EQ(mailbox.size(), 2u);
+    ASSERT_EQ(mailbox.count(), 3u);
+    ASSERT_EQ(mailbox.count(entity), 2u);
+    ASSERT_EQ(mailbox.count(other), 1u);
+
+    mailbox.clear();
+
+    ASSERT_TRUE(mailbox.empty());
+    ASSERT_EQ(mailbox.count(entity), 0u);
+}
+
+TEST(Mailbox, Drain) {
+    entt::mailbox<hit> mailbox;
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[0u], 10);
+    registry.emplace<int>(entities[1u], 10);
+    registry.emplace<empty_type>(entities[0u]);
+    registry.emplace<empty_type>(entities[1u]);
+
+    mailbox.enqueue(entities[0u], 3);
+    mailbox.enqueue(entities[1u], 1);
+    mailbox.enqueue(entities[2u], 5);
+    mailbox.enqueue(entities[0u], 2);
+
+    std::size_t visited{};
+
+    mailbox.drain<int, empty_type>(registry, [&visited, &mailbox](const auto entt, auto first, auto last, int &health) {
+        for(; first != last; ++first) {
+            health -= first->damage;
+        }
+
+        // delivered with the next drain
+        mailbox.enqueue(entt, 0);
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, 2u);
+    ASSERT_EQ(registry.get<int>(entities[0u]), 5);
+    ASSERT_EQ(registry.get<int>(entities[1u]), 9);
+    ASSERT_EQ(mailbox.size(), 2u);
+    ASSERT_EQ(mailbox.count(), 2u);
+
+    registry.destroy(entities[1u]);
+    visited = {};
+
+    mailbox.drain(registry, [&visited, &entities](const auto entt, auto first, auto last) {
+        ASSERT_EQ(entt, entities[0u]);
+        ASSERT_EQ(std::distance(first, last), 1);
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, 1u);
+    ASSERT_TRUE(mailbox.empty());
+}
+
+TEST(Mailbox, RecycledTarget) {
+    entt::mailbox<hit> mailbox;
+    entt::registry registry;
+    auto entity = registry.create();
+
+    mailbox.enqueue(entity, 10);
+    registry.destroy(entity);
+    entity = registry.create();
+    registry.emplace<int>(entity, 100);
+
+    mailbox.drain<int>(registry, [](const auto, auto first, auto last, int &health) {
+        for(; first != last; ++first) {
+            health -= first->damage;
+        }
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 100);
+    ASSERT_TRUE(mailbox.empty());
+}
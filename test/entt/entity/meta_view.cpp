@@ -0,0 +1,96 @@
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/meta_view.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/resolve.hpp>
+
+struct position { float x, y; };
+struct velocity { float dx, dy; };
+struct empty_type {};
+
+TEST(MetaView, Functionalities) {
+    entt::meta<position>().type();
+    entt::registry registry;
+
+    const entt::id_type types[]{entt::type_hash<position>::value(), entt::type_hash<velocity>::value(), entt::type_hash<empty_type>::value()};
+    const entt::id_type filter[]{entt::type_hash<int>::value()};
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<position>(entity, 1.f * i, 0.f);
+
+        if(i % 2) {
+            registry.emplace<velocity>(entity, 1.f, 2.f);
+            registry.emplace<empty_type>(entity);
+        }
+
+        if(i == 5) {
+            registry.emplace<int>(entity);
+        }
+    }
+
+    entt::meta_view view{registry, std::begin(types), std::end(types), std::begin(filter), std::end(filter)};
+
+    ASSERT_EQ(view.size(), 3u);
+    ASSERT_EQ(view.size_hint(), 5u);
+
+    const auto pos = view.column(0u);
+    const auto vel = view.column(1u);
+    const auto empty = view.column(2u);
+
+    ASSERT_EQ(pos.type, entt::resolve<position>());
+    ASSERT_FALSE(vel.type);
+    ASSERT_EQ(pos.data, registry.view<position>().raw());
+    ASSERT_EQ(vel.data, registry.view<velocity>().raw());
+    ASSERT_EQ(empty.data, nullptr);
+    ASSERT_EQ(pos.size, 10u);
+    ASSERT_EQ(empty.size, 5u);
+    ASSERT_EQ(vel.entities, registry.view<velocity>().data());
+
+    std::size_t visited{};
+    std::size_t batches{};
+
+    view.each([&](const auto *entities, const auto *positions, const auto count) {
+        for(std::size_t i{}; i < count; ++i) {
+            auto &&elem = static_cast<position *>(pos.data)[positions[i]];
+            auto &&other = static_cast<velocity *>(vel.data)[positions[count + i]];
+
+            ASSERT_EQ(pos.entities[positions[i]], entities[i]);
+            ASSERT_EQ(vel.entities[positions[count + i]], entities[i]);
+            ASSERT_EQ(empty.entities[positions[2u * count + i]], entities[i]);
+            ASSERT_EQ(&elem, &registry.get<position>(entities[i]));
+
+            elem.x += other.dx;
+            elem.y += other.dy;
+        }
+
+        visited += count;
+        ++batches;
+    }, 3u);
+
+    ASSERT_EQ(visited, 4u);
+    ASSERT_EQ(batches, 2u);
+
+    for(auto &&[entity, value]: registry.view<position>().each()) {
+        ASSERT_EQ(value.y, registry.has<velocity>(entity) && !registry.has<int>(entity) ? 2.f : 0.f);
+    }
+
+    entt::resolve<position>().reset();
+}
+
+TEST(MetaView, MissingPool) {
+    entt::registry registry;
+    const entt::id_type types[]{entt::type_hash<position>::value(), entt::type_hash<char>::value()};
+
+    registry.emplace<position>(registry.create());
+
+    entt::meta_view view{registry, std::begin(types), std::end(types)};
+
+    ASSERT_EQ(view.size(), 2u);
+    ASSERT_EQ(view.column(1u).data, nullptr);
+    ASSERT_EQ(view.column(1u).size, 0u);
+
+    view.each([](auto...) { FAIL(); });
+}
@@ -0,0 +1,118 @@
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/multi_storage.hpp>
+
+struct modifier {
+    int value;
+};
+
+TEST(MultiStorage, Functionalities) {
+    entt::multi_storage<modifier> storage;
+
+    ASSERT_TRUE(storage.empty());
+    ASSERT_EQ(storage.count(), 0u);
+    ASSERT_EQ(storage.count(entt::entity{0}), 0u);
+
+    auto [first, last] = storage.equal_range(entt::entity{0});
+
+    ASSERT_EQ(first, last);
+
+    storage.emplace(entt::entity{0}, 1);
+    storage.emplace(entt::entity{3}, 2);
+    storage.emplace(entt::entity{0}, 3);
+    storage.emplace(entt::entity{0}, 4);
+
+    ASSERT_EQ(storage.size(), 2u);
+    ASSERT_EQ(storage.count(), 4u);
+    ASSERT_EQ(storage.count(entt::entity{0}), 3u);
+    ASSERT_EQ(storage.count(entt::entity{3}), 1u);
+
+    std::tie(first, last) = storage.equal_range(entt::entity{0});
+
+    ASSERT_EQ(last - first, 3);
+    ASSERT_EQ(first[0u].value, 1);
+    ASSERT_EQ(first[1u].value, 3);
+    ASSERT_EQ(first[2u].value, 4);
+
+    storage.erase(entt::entity{0}, 0u);
+    std::tie(first, last) = storage.equal_range(entt::entity{0});
+
+    ASSERT_EQ(last - first, 2);
+    ASSERT_EQ(first[0u].value, 4);
+    ASSERT_EQ(first[1u].value, 3);
+
+    storage.erase(entt::entity{3}, 0u);
+
+    ASSERT_FALSE(storage.contains(entt::entity{3}));
+    ASSERT_EQ(storage.count(), 2u);
+
+    storage.remove(entt::entity{0});
+
+    ASSERT_TRUE(storage.empty());
+    ASSERT_EQ(storage.count(), 0u);
+
+    storage.emplace(entt::entity{1}, 5);
+    storage.clear();
+
+    ASSERT_TRUE(storage.empty());
+    ASSERT_EQ(storage.count(), 0u);
+}
+
+TEST(MultiStorage, Each) {
+    entt::multi_storage<modifier> storage;
+
+    for(auto round = 0; round < 3; ++round) {
+        for(auto entt = 0u; entt < 4u; ++entt) {
+            storage.emplace(entt::entity{entt}, static_cast<int>(entt));
+        }
+    }
+
+    std::vector<std::pair<entt::entity, int>> visited{};
+    storage.each([&visited](const auto entt, auto &instance) { visited.emplace_back(entt, instance.value); });
+
+    ASSERT_EQ(visited.size(), 12u);
+
+    for(auto pos = 0u; pos < visited.size(); ++pos) {
+        // entities are returned in the same order of the sparse set
+        ASSERT_EQ(visited[pos].first, storage.begin()[pos / 3u]);
+        ASSERT_EQ(entt::to_integral(visited[pos].first), static_cast<unsigned>(visited[pos].second));
+    }
+
+    storage.compact();
+
+    ASSERT_EQ(storage.count(), 12u);
+    ASSERT_EQ(storage.memory_usage().instances, 12u);
+
+    const modifier *prev = nullptr;
+
+    storage.each([&prev](const auto, const auto &instance) {
+        // a compacted storage is visited linearly
+        ASSERT_TRUE(prev == nullptr || prev + 1 == &instance);
+        prev = &instance;
+    });
+}
+
+TEST(MultiStorage, MoveOnlyType) {
+    entt::multi_storage<std::unique_ptr<int>> storage;
+
+    storage.emplace(entt::entity{0}, std::make_unique<int>(1));
+    storage.emplace(entt::entity{1}, std::make_unique<int>(2));
+    storage.emplace(entt::entity{0}, std::make_unique<int>(3));
+
+    auto [first, last] = storage.equal_range(entt::entity{0});
+
+    ASSERT_EQ(last - first, 2);
+    ASSERT_EQ(*first[0u], 1);
+    ASSERT_EQ(*first[1u], 3);
+
+    storage.sort([](const auto lhs, const auto rhs) { return entt::to_integral(lhs) > entt::to_integral(rhs); });
+
+    std::tie(first, last) = storage.equal_range(entt::entity{0});
+
+    ASSERT_EQ(last - first, 2);
+    ASSERT_EQ(*first[1u], 3);
+    ASSERT_EQ(**storage.equal_range(entt::entity{1}).first, 2);
+}
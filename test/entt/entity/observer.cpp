@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <thread>
 #include <tuple>
 #include <cstddef>
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/observer.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/sparse_set.hpp>
 
 TEST(Observer, Functionalities) {
     entt::registry registry;
@@ -285,6 +291,69 @@ TEST(Observer, Each) {
     ASSERT_EQ(observer.size(), 0u);
 }
 
+TEST(Observer, EachRange) {
+    entt::registry registry;
+    entt::observer observer{registry, entt::collector.group<int>()};
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    std::as_const(observer).each([&observer](const entt::entity *data, const auto size) {
+        ASSERT_EQ(data, observer.data());
+        ASSERT_EQ(size, 3u);
+    });
+
+    ASSERT_EQ(observer.size(), 3u);
+
+    observer.each([](const entt::entity *, const auto size) {
+        ASSERT_EQ(size, 3u);
+    });
+
+    ASSERT_TRUE(observer.empty());
+}
+
+TEST(Observer, SortAs) {
+    entt::registry registry;
+    entt::observer observer{registry, entt::collector.update<int>().where<char>()};
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities));
+
+    registry.patch<int>(entities[1u]);
+    registry.patch<int>(entities[3u]);
+    registry.patch<int>(entities[2u]);
+
+    observer.sort_as(registry.view<int>().begin(), registry.view<int>().end());
+
+    auto it = observer.begin();
+
+    ASSERT_EQ(*(it++), entities[3u]);
+    ASSERT_EQ(*(it++), entities[2u]);
+    ASSERT_EQ(*(it++), entities[1u]);
+    ASSERT_EQ(it, observer.end());
+
+    // rules matched by the entities follow them around
+    registry.remove<char>(entities[3u]);
+
+    ASSERT_EQ(observer.size(), 2u);
+    ASSERT_FALSE(std::find(observer.begin(), observer.end(), entities[3u]) != observer.end());
+
+    registry.patch<int>(entities[0u]);
+
+    ASSERT_EQ(observer.size(), 3u);
+
+    entt::sparse_set set{};
+    set.emplace(entities[2u]);
+    set.emplace(entities[0u]);
+    observer.sort_as(set);
+
+    ASSERT_EQ(observer.begin()[0u], *set.begin());
+    ASSERT_EQ(observer.begin()[1u], *(set.begin() + 1u));
+}
+
 TEST(Observer, MultipleFilters) {
     constexpr auto collector =  entt::collector
             .update<int>().where<char>()
@@ -367,3 +436,77 @@ TEST(Observer, GroupCornerCase) {
     ASSERT_FALSE(add_observer.empty());
     ASSERT_TRUE(remove_observer.empty());
 }
+
+TEST(Observer, Concurrent) {
+    entt::registry registry;
+    entt::observer observer{registry, entt::collector.update<int>().where<char>()};
+    std::vector<std::thread> workers{};
+    entt::entity entities[8u];
+
+    ASSERT_FALSE(observer.concurrent());
+
+    observer.concurrent(true);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities) - 1u);
+
+    ASSERT_TRUE(observer.concurrent());
+    ASSERT_TRUE(observer.empty());
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        workers.emplace_back([&registry, &entities, pos]() {
+            for(std::size_t next{}; next < 2u; ++next) {
+                const auto entity = entities[pos * 2u + next];
+                registry.patch<int>(entity);
+                registry.patch<int>(entity);
+            }
+        });
+    }
+
+    for(auto &&worker: workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(observer.size(), 7u);
+
+    for(auto entity: observer) {
+        ASSERT_NE(entity, entities[7u]);
+        ASSERT_TRUE(registry.has<char>(entity));
+    }
+
+    observer.clear();
+    registry.patch<int>(entities[0u]);
+    registry.remove<char>(entities[0u]);
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.patch<int>(entities[1u]);
+    observer.concurrent(false);
+
+    ASSERT_FALSE(observer.concurrent());
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.begin(), entities[1u]);
+
+    registry.patch<int>(entities[2u]);
+
+    ASSERT_EQ(observer.size(), 2u);
+}
+
+TEST(Observer, ConcurrentDiscard) {
+    entt::registry registry;
+    entt::observer observer{registry, entt::collector.update<int>()};
+    const auto entities = std::array{registry.create(), registry.create()};
+    registry.insert<int>(entities.begin(), entities.end());
+
+    observer.concurrent(true);
+    registry.patch<int>(entities[0u]);
+
+    std::thread worker{[&registry, &entities]() { registry.patch<int>(entities[1u]); }};
+    worker.join();
+
+    registry.destroy(entities[1u]);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.begin(), entities[0u]);
+    ASSERT_TRUE(registry.valid(*observer.begin()));
+}
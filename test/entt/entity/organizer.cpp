@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
+#include <entt/entity/command_buffer.hpp>
 #include <entt/entity/organizer.hpp>
 #include <entt/entity/registry.hpp>
 
@@ -15,10 +19,34 @@ struct clazz {
     void rw_int_char_double(entt::view<entt::exclude_t<>, int, char>, double &) {}
 };
 
+void rw_int(entt::view<entt::exclude_t<>, int> view) {
+    view.each([](auto &value) { value = 2; });
+}
+
+void ro_int_rw_double(entt::view<entt::exclude_t<>, const int> view, double &sum) {
+    view.each([&sum](const auto value) { sum += value; });
+}
+
+void ro_int_rw_float(entt::view<entt::exclude_t<>, const int> view, float &sum) {
+    view.each([&sum](const auto value) { sum += value; });
+}
+
+void ro_double_float_rw_int(const double &lhs, const float &rhs, int &result) {
+    result = static_cast<int>(lhs + rhs);
+}
+
 void to_args_integrity(entt::view<entt::exclude_t<>, int> view, std::size_t &value, entt::registry &registry) {
     value = view.size();
 }
 
+void record_char(entt::view<entt::exclude_t<>, const int> view, entt::command_buffer &buffer) {
+    view.each([&buffer](const auto entity, const auto value) { buffer.emplace<char>(entity, static_cast<char>(value)); });
+}
+
+void count_char(entt::view<entt::exclude_t<>, const char> view, std::size_t &count) {
+    count = view.size();
+}
+
 TEST(Organizer, EmplaceFreeFunction) {
     entt::organizer organizer;
     entt::registry registry;
@@ -238,6 +266,154 @@ TEST(Organizer, SyncPoint) {
     }
 }
 
+TEST(Organizer, ExplicitSyncPoint) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+
+    organizer.emplace<&record_char>("record");
+    organizer.emplace<&ro_int_double>("read");
+    organizer.sync("sync");
+    organizer.emplace<&count_char>("count");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 4u);
+    ASSERT_STREQ(graph[2u].name(), "sync");
+    ASSERT_EQ(graph[2u].info(), entt::type_id<entt::command_buffer>());
+    ASSERT_EQ(graph[2u].ro_count(), 0u);
+    ASSERT_EQ(graph[2u].rw_count(), 0u);
+
+    ASSERT_TRUE(graph[0u].top_level());
+    ASSERT_TRUE(graph[1u].top_level());
+    ASSERT_FALSE(graph[2u].top_level());
+    ASSERT_FALSE(graph[3u].top_level());
+
+    ASSERT_EQ(graph[0u].children(), std::vector<std::size_t>{2u});
+    ASSERT_EQ(graph[1u].children(), std::vector<std::size_t>{2u});
+    ASSERT_EQ(graph[2u].children(), std::vector<std::size_t>{3u});
+
+    for(auto next = 0; next < 3; ++next) {
+        registry.emplace<int>(registry.create(), next);
+    }
+
+    pool.run(graph, registry);
+
+    ASSERT_EQ(registry.ctx<std::size_t>(), 3u);
+    ASSERT_TRUE(registry.ctx<entt::command_buffer>().empty());
+    ASSERT_EQ(registry.size<char>(), 3u);
+}
+
+TEST(Organizer, AutomaticSyncPoint) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&count_char>("count");
+    organizer.emplace<&record_char>("record");
+
+    auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 3u);
+    ASSERT_EQ(graph[2u].name(), nullptr);
+    ASSERT_EQ(graph[2u].info(), entt::type_id<entt::command_buffer>());
+    ASSERT_EQ(graph[0u].children(), std::vector<std::size_t>{2u});
+    ASSERT_EQ(graph[1u].children(), std::vector<std::size_t>{2u});
+    ASSERT_EQ(organizer.graph().size(), 3u);
+
+    registry.emplace<int>(registry.create(), 1);
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+    }
+
+    for(auto &&vertex: graph) {
+        vertex.callback()(vertex.data(), registry);
+    }
+
+    ASSERT_EQ(registry.ctx<std::size_t>(), 0u);
+    ASSERT_EQ(registry.size<char>(), 1u);
+
+    organizer.clear();
+    organizer.emplace<&count_char>("count");
+
+    ASSERT_EQ(organizer.graph().size(), 1u);
+}
+
+TEST(Organizer, IncrementalGraph) {
+    entt::organizer organizer;
+    entt::type_info ro[3u]{};
+    entt::type_info rw[3u]{};
+
+    for(auto next = 0; next < 20; ++next) {
+        switch(next % 5) {
+        case 0: organizer.emplace<const int, char>(+[](const void *, entt::registry &) {}); break;
+        case 1: organizer.emplace<const int, const char>(+[](const void *, entt::registry &) {}); break;
+        case 2: organizer.emplace<double, const char>(+[](const void *, entt::registry &) {}); break;
+        case 3: organizer.emplace<const double>(+[](const void *, entt::registry &) {}); break;
+        case 4: organizer.emplace<int>(+[](const void *, entt::registry &) {}); break;
+        }
+
+        if(next == 12) {
+            organizer.emplace(+[](const void *, entt::registry &) {});
+        }
+    }
+
+    const auto graph = organizer.graph();
+    const auto length = graph.size();
+    std::vector<bool> reachable(length * length, false);
+
+    for(auto vi = length; vi; --vi) {
+        for(auto child: graph[vi - 1u].children()) {
+            ASSERT_GT(child, vi - 1u);
+            reachable[(vi - 1u) * length + child] = true;
+
+            for(std::size_t vj{}; vj < length; ++vj) {
+                reachable[(vi - 1u) * length + vj] = reachable[(vi - 1u) * length + vj] || reachable[child * length + vj];
+            }
+        }
+    }
+
+    const auto conflict = [&](const auto &lhs, const auto &rhs) {
+        if(!(lhs.ro_count() + lhs.rw_count()) || !(rhs.ro_count() + rhs.rw_count())) {
+            return true;
+        }
+
+        const auto lro = lhs.ro_dependency(ro, 3u);
+        const auto lrw = lhs.rw_dependency(rw, 3u);
+        entt::type_info other[3u]{};
+
+        for(std::size_t pos{}, last = rhs.rw_dependency(other, 3u); pos < last; ++pos) {
+            if(std::find(ro, ro + lro, other[pos]) != ro + lro || std::find(rw, rw + lrw, other[pos]) != rw + lrw) {
+                return true;
+            }
+        }
+
+        for(std::size_t pos{}, last = rhs.ro_dependency(other, 3u); pos < last; ++pos) {
+            if(std::find(rw, rw + lrw, other[pos]) != rw + lrw) {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    for(std::size_t vi{}; vi < length; ++vi) {
+        ASSERT_EQ(graph[vi].top_level(), std::none_of(graph.cbegin(), graph.cend(), [vi](const auto &vertex) {
+            return std::find(vertex.children().cbegin(), vertex.children().cend(), vi) != vertex.children().cend();
+        }));
+
+        for(auto vj = vi + 1u; vj < length; ++vj) {
+            ASSERT_TRUE(!conflict(graph[vi], graph[vj]) || reachable[vi * length + vj]);
+        }
+
+        for(auto child: graph[vi].children()) {
+            for(auto other: graph[vi].children()) {
+                ASSERT_FALSE(reachable[other * length + child]);
+            }
+        }
+    }
+}
+
 TEST(Organizer, Override) {
     entt::organizer organizer;
 
@@ -346,3 +522,66 @@ TEST(Organizer, ToArgsIntegrity) {
 
     ASSERT_EQ(registry.ctx<std::size_t>(), 0u);
 }
+
+TEST(Organizer, RunWithThreadPool) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+
+    organizer.emplace<&rw_int>("t1");
+    organizer.emplace<&ro_int_rw_double>("t2");
+    organizer.emplace<&ro_int_rw_float>("t3");
+    organizer.emplace<&ro_double_float_rw_int>("t4");
+
+    for(auto next = 0; next < 3; ++next) {
+        registry.emplace<int>(registry.create(), 0);
+    }
+
+    const auto graph = organizer.graph();
+
+    pool.run(graph, registry);
+
+    ASSERT_EQ(registry.ctx<double>(), 6.);
+    ASSERT_EQ(registry.ctx<float>(), 6.f);
+    ASSERT_EQ(registry.ctx<int>(), 12);
+
+    pool.run(graph, registry);
+
+    ASSERT_EQ(registry.ctx<double>(), 12.);
+    ASSERT_EQ(registry.ctx<float>(), 12.f);
+    ASSERT_EQ(registry.ctx<int>(), 24);
+}
+
+TEST(Organizer, Hint) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+
+    organizer.emplace<&rw_int>("t1");
+    organizer.hint(8u);
+    organizer.emplace<&ro_int_rw_double>("t2");
+    organizer.hint(2u, true);
+    organizer.emplace<&ro_int_rw_float>("t3");
+    organizer.hint(2u);
+    organizer.emplace<&ro_double_float_rw_int>("t4");
+
+    registry.emplace<int>(registry.create(), 0);
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(graph[0u].cost(), 8u);
+    ASSERT_FALSE(graph[0u].main_thread());
+    ASSERT_EQ(graph[1u].cost(), 2u);
+    ASSERT_TRUE(graph[1u].main_thread());
+    ASSERT_EQ(graph[2u].cost(), 2u);
+    ASSERT_FALSE(graph[2u].main_thread());
+    ASSERT_EQ(graph[3u].cost(), 0u);
+    ASSERT_FALSE(graph[3u].main_thread());
+
+    pool.grain(4u);
+    pool.run(graph, registry);
+
+    ASSERT_EQ(registry.ctx<double>(), 2.);
+    ASSERT_EQ(registry.ctx<float>(), 2.f);
+    ASSERT_EQ(registry.ctx<int>(), 4);
+}
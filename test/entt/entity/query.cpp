@@ -0,0 +1,57 @@
+#include <iterator>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <entt/entity/query.hpp>
+#include <entt/entity/registry.hpp>
+
+TEST(Query, Functionalities) {
+    entt::registry registry;
+    entt::query<entt::exclude_t<double>, int, const char> query{registry};
+    entt::entity entities[10u];
+
+    static_assert(std::is_same_v<typename decltype(query)::view_type, entt::view<entt::exclude_t<double>, int, const char>>);
+
+    ASSERT_EQ(query->begin(), query->end());
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.emplace<char>(entities[5u]);
+    registry.emplace<char>(entities[3u]);
+
+    // the pool of chars drives the iterations
+    ASSERT_EQ(*query->begin(), entities[3u]);
+    ASSERT_EQ(std::distance(query->begin(), query->end()), 2);
+
+    for(auto pos = 10u; pos; --pos) {
+        if(pos != 6u && pos != 4u) {
+            registry.emplace<char>(entities[pos - 1u]);
+        }
+    }
+
+    // the pool of ints drives the iterations from now on
+    ASSERT_EQ(*query->begin(), entities[9u]);
+    ASSERT_EQ(std::distance(query->begin(), query->end()), 10);
+
+    registry.emplace<double>(entities[9u]);
+
+    ASSERT_EQ(*query->begin(), entities[8u]);
+    ASSERT_EQ(std::distance((*query).begin(), (*query).end()), 9);
+
+    registry.clear();
+
+    ASSERT_EQ(query->begin(), query->end());
+    ASSERT_EQ(query.view().size_hint(), 0u);
+}
+
+TEST(Query, SingleComponent) {
+    entt::registry registry;
+    const entt::query<entt::exclude_t<>, int> query{registry};
+    const auto entity = registry.create();
+
+    ASSERT_TRUE(query->empty());
+
+    registry.emplace<int>(entity, 42);
+
+    ASSERT_EQ(query->size(), 1u);
+    ASSERT_EQ(query->get<int>(entity), 42);
+}
@@ -1,13 +1,23 @@
 #include <unordered_set>
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <string>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/thread_pool.hpp>
 #include <entt/core/type_traits.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/entity.hpp>
+#include <entt/entity/signature.hpp>
 
 struct empty_type {};
 
@@ -20,6 +30,148 @@ struct aggregate {
     int value{};
 };
 
+struct allocated_type {
+    int value{};
+};
+
+struct counting_base {
+    // shared by all the rebound allocators
+    inline static std::size_t bytes{};
+};
+
+template<typename Type>
+struct counting_allocator: counting_base, std::allocator<Type> {
+    template<typename Other>
+    struct rebind { using other = counting_allocator<Other>; };
+
+    counting_allocator() = default;
+
+    template<typename Other>
+    counting_allocator(const counting_allocator<Other> &) {}
+
+    Type * allocate(const std::size_t count) {
+        bytes += count * sizeof(Type);
+        return std::allocator<Type>::allocate(count);
+    }
+
+    void deallocate(Type *instance, const std::size_t count) {
+        bytes -= count * sizeof(Type);
+        std::allocator<Type>::deallocate(instance, count);
+    }
+};
+
+struct counting_resource: std::pmr::memory_resource {
+    void * do_allocate(const std::size_t size, const std::size_t alignment) override {
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void *ptr, const std::size_t size, const std::size_t alignment) override {
+        bytes -= size;
+        std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    std::size_t bytes{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, allocated_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, allocated_type, counting_allocator<allocated_type>>>>;
+};
+
+struct stable_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, stable_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_stable_storage<Entity, stable_type>>>;
+};
+
+struct paged_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, paged_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_paged_storage<Entity, paged_type>>>;
+};
+
+struct split_type {
+    int value{};
+    char tag{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, split_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_split_storage<Entity, split_type, &split_type::value, &split_type::tag>>>;
+};
+
+struct silent_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, silent_type> {
+    using storage_type = entt::storage_adapter_mixin<entt::basic_storage<Entity, silent_type>>;
+};
+
+struct ticked_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, ticked_type> {
+    using storage_type = entt::tick_storage_mixin<entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, ticked_type>>>>;
+};
+
+struct toggled_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, toggled_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::toggle_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, toggled_type>>>>;
+};
+
+struct toggled_tag {};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, toggled_tag> {
+    using storage_type = entt::sigh_storage_mixin<entt::toggle_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, toggled_tag>>>>;
+};
+
+struct history_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, history_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::history_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, history_type>>, 3u>>;
+};
+
+struct transient_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, transient_type> {
+    using storage_type = entt::storage_adapter_mixin<entt::basic_transient_storage<Entity, transient_type>>;
+};
+
+struct hashed_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, hashed_type> {
+    using storage_type = entt::sigh_storage_mixin<entt::hashed_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, hashed_type>>>>;
+};
+
 struct listener {
     template<typename Component>
     static void sort(entt::registry &registry) {
@@ -38,8 +190,16 @@ struct listener {
         --counter;
     }
 
+    template<typename Component>
+    void incr_range(const entt::registry &, const entt::entity *from, const entt::entity *to) {
+        range = static_cast<int>(to - from);
+        ++calls;
+    }
+
     entt::entity last{entt::null};
     int counter{0};
+    int range{0};
+    int calls{0};
 };
 
 TEST(Registry, Context) {
@@ -95,6 +255,19 @@ TEST(Registry, Context) {
     ASSERT_EQ(registry.ctx<double>(), std::as_const(registry).ctx<double>());
 
     ASSERT_EQ(registry.try_ctx<float>(), nullptr);
+
+    registry.unset<char>();
+
+    ASSERT_EQ(registry.try_ctx<char>(), nullptr);
+    ASSERT_EQ(registry.ctx<int>(), 42);
+    ASSERT_EQ(registry.ctx<double>(), 1.);
+
+    registry.unset<double>();
+    registry.set<char>('d');
+
+    ASSERT_EQ(registry.ctx<char>(), 'd');
+    ASSERT_EQ(registry.ctx<int>(), 42);
+    ASSERT_EQ(registry.try_ctx<double>(), nullptr);
 }
 
 TEST(Registry, Functionalities) {
@@ -525,6 +698,67 @@ TEST(Registry, Each) {
     registry.each([&](auto) { FAIL(); });
 }
 
+TEST(Registry, ReserveSparse) {
+    entt::registry registry;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+    registry.reserve_sparse<int, char>(2u * entt_per_page);
+
+    ASSERT_GE(registry.capacity(), 2u * entt_per_page);
+    ASSERT_EQ(registry.size(), 0u);
+    ASSERT_TRUE((registry.empty<int, char>()));
+
+    std::size_t pages{};
+    registry.stats([&pages](const auto, const entt::pool_stats &stats) { pages += stats.pages; });
+
+    ASSERT_EQ(pages, 4u);
+
+    const auto entity = registry.create(entt::entity{2u * entt_per_page - 1u});
+    registry.emplace<int>(entity);
+
+    pages = {};
+    registry.stats([&pages](const auto, const entt::pool_stats &stats) { pages += stats.pages; });
+
+    ASSERT_EQ(pages, 4u);
+}
+
+TEST(Registry, EachSkipsDeadRanges) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(200u);
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        if(pos % 5u || (pos > 64u && pos < 130u)) {
+            registry.destroy(entities[pos]);
+        }
+    }
+
+    ASSERT_EQ(registry.alive(), 27u);
+
+    std::vector<entt::entity> visited{};
+    registry.each([&visited](const auto entity) { visited.push_back(entity); });
+
+    ASSERT_EQ(visited.size(), 27u);
+    ASSERT_EQ(visited.front(), entities[195u]);
+    ASSERT_EQ(visited.back(), entities[0u]);
+    ASSERT_TRUE(std::is_sorted(visited.rbegin(), visited.rend()));
+
+    entt::registry other;
+    other.assign(registry.data(), registry.data() + registry.size(), registry.destroyed());
+
+    ASSERT_EQ(other.alive(), 27u);
+
+    const auto entity = other.create(entities[100u]);
+
+    ASSERT_EQ(entity, entities[100u]);
+    ASSERT_EQ(other.alive(), 28u);
+
+    other.clear();
+
+    ASSERT_EQ(other.alive(), 0u);
+    ASSERT_EQ(other.size(), 200u);
+}
+
 TEST(Registry, Orphans) {
     entt::registry registry;
     entt::registry::size_type tot{};
@@ -943,6 +1177,73 @@ TEST(Registry, SortSingle) {
     }
 }
 
+TEST(Registry, SortRadix) {
+    entt::registry registry;
+
+    for(auto value: {3u, 42u, 7u, 1u}) {
+        registry.emplace<unsigned int>(registry.create(), value);
+    }
+
+    registry.sort<unsigned int>([](const auto value) { return value; }, entt::radix_sort<8, 32>{});
+
+    const auto view = registry.view<unsigned int>();
+
+    ASSERT_TRUE(std::is_sorted(view.raw(), view.raw() + view.size(), std::greater<unsigned int>{}));
+    ASSERT_EQ(registry.get<unsigned int>(view.front()), 1u);
+    ASSERT_EQ(registry.get<unsigned int>(view.back()), 42u);
+}
+
+TEST(Registry, Storage) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    auto &&pool = registry.storage<int>();
+    listener listener;
+
+    static_assert(std::is_same_v<decltype(std::as_const(registry).storage<int>()), const entt::storage_traits<entt::entity, int>::storage_type &>);
+
+    ASSERT_EQ(&std::as_const(registry).storage<int>(), &pool);
+    ASSERT_TRUE(pool.empty());
+
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    pool.emplace(registry, entity, 42);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(&pool.get(entity), &registry.get<int>(entity));
+
+    for(int next{}; next < 100; ++next) {
+        registry.emplace<int>(registry.create(), next);
+    }
+
+    ASSERT_EQ(&registry.storage<int>(), &pool);
+    ASSERT_EQ(pool.size(), 101u);
+
+    registry.on_destroy<int>().connect<&listener::decr<int>>(listener);
+    pool.remove(registry, entity);
+
+    ASSERT_FALSE(registry.has<int>(entity));
+    ASSERT_EQ(listener.counter, 100);
+}
+
+TEST(Registry, SortParallel) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+
+    for(auto value = 0; value < 500; ++value) {
+        registry.emplace<int>(registry.create(), (value * 37) % 499);
+    }
+
+    registry.sort<int>(std::less<int>{}, entt::parallel_sort{4u, 32u}, pool);
+
+    const auto view = registry.view<int>();
+
+    ASSERT_TRUE(std::is_sorted(view.raw(), view.raw() + view.size(), std::greater<int>{}));
+
+    for(auto entity: view) {
+        ASSERT_EQ(view.get<int>(entity), registry.get<int>(entity));
+    }
+}
+
 TEST(Registry, SortMulti) {
     entt::registry registry;
 
@@ -975,6 +1276,54 @@ TEST(Registry, SortMulti) {
     }
 }
 
+TEST(Registry, SortAs) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::rbegin(entities), std::rend(entities));
+    registry.insert<double>(std::begin(entities) + 1u, std::end(entities));
+
+    registry.sort<int>([](const auto lhs, const auto rhs) { return lhs > rhs; });
+    registry.sort_as<int, char, double>();
+
+    ASSERT_TRUE(std::equal(registry.view<char>().begin(), registry.view<char>().end(), std::rbegin(entities)));
+    ASSERT_TRUE(std::equal(registry.view<double>().begin(), registry.view<double>().end(), std::rbegin(entities)));
+}
+
+TEST(Registry, SortAll) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::rbegin(entities), std::rend(entities));
+    registry.insert<char>(std::begin(entities), std::end(entities));
+    registry.insert<double>(std::begin(entities), std::end(entities));
+    registry.emplace<float>(entities[2u]);
+    registry.emplace<float>(entities[0u]);
+    registry.emplace<float>(entities[3u]);
+
+    static_cast<void>(registry.group<double>(entt::get<char>));
+    const auto *owned = registry.data<double>();
+    const std::vector<entt::entity> expected(owned, owned + registry.size<double>());
+
+    registry.sort_all();
+
+    ASSERT_TRUE(std::equal(registry.view<int>().begin(), registry.view<int>().end(), std::begin(entities)));
+    ASSERT_TRUE(std::equal(registry.view<char>().begin(), registry.view<char>().end(), std::begin(entities)));
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), registry.data<double>()));
+
+    const entt::entity floats[3u]{entities[0u], entities[2u], entities[3u]};
+
+    ASSERT_TRUE(std::equal(registry.view<float>().begin(), registry.view<float>().end(), std::begin(floats)));
+
+    registry.sort_all(std::greater<entt::entity>{});
+
+    ASSERT_TRUE(std::equal(registry.view<int>().begin(), registry.view<int>().end(), std::rbegin(entities)));
+    ASSERT_TRUE(std::equal(registry.view<float>().begin(), registry.view<float>().end(), std::rbegin(floats)));
+}
+
 TEST(Registry, SortEmpty) {
     entt::registry registry;
 
@@ -1006,6 +1355,51 @@ TEST(Registry, ConstructWithComponents) {
     registry.emplace<int>(registry.create(), value);
 }
 
+TEST(Registry, RangeSignals) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    listener listener;
+
+    registry.on_construct_range<empty_type>().connect<&listener::incr_range<empty_type>>(listener);
+    registry.on_construct_range<int>().connect<&listener::incr_range<int>>(listener);
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    registry.create(std::begin(entities), std::end(entities));
+
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.calls, 1);
+    ASSERT_EQ(listener.range, 3);
+    ASSERT_EQ(listener.counter, 3);
+
+    registry.insert<empty_type>(std::begin(entities), std::end(entities) - 1);
+
+    ASSERT_EQ(listener.calls, 2);
+    ASSERT_EQ(listener.range, 2);
+
+    registry.emplace<empty_type>(entities[2u]);
+
+    ASSERT_EQ(listener.calls, 3);
+    ASSERT_EQ(listener.range, 1);
+
+    registry.on_construct_range<int>().disconnect(listener);
+    registry.remove<int>(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.calls, 3);
+    ASSERT_EQ(listener.counter, 6);
+
+    registry.on_destroy_range<int>().connect<&listener::incr_range<int>>(listener);
+    registry.remove<int>(std::begin(entities), std::end(entities) - 1);
+
+    ASSERT_EQ(listener.calls, 4);
+    ASSERT_EQ(listener.range, 2);
+
+    registry.destroy(entities[2u]);
+
+    ASSERT_EQ(listener.calls, 5);
+    ASSERT_EQ(listener.range, 1);
+}
+
 TEST(Registry, Signals) {
     entt::registry registry;
     listener listener;
@@ -1160,6 +1554,47 @@ TEST(Registry, RangeDestroy) {
     ASSERT_FALSE(registry.valid(e2));
 }
 
+TEST(Registry, RangeDestroyAcrossPools) {
+    entt::registry registry;
+    entt::entity entities[6u];
+    listener listener;
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.on_destroy<int>().connect<&listener::decr<int>>(listener);
+
+    for(auto pos = 0u; pos < 6u; ++pos) {
+        registry.emplace<int>(entities[pos], static_cast<int>(pos));
+
+        if(pos % 2u) {
+            registry.emplace<empty_type>(entities[pos]);
+        } else {
+            registry.emplace<stable_type>(entities[pos]);
+        }
+    }
+
+    registry.emplace<split_type>(entities[5u]);
+    listener.counter = 4;
+
+    registry.destroy(std::begin(entities) + 1u, std::begin(entities) + 5u);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(registry.size<int>(), 2u);
+    ASSERT_EQ(registry.size<empty_type>(), 1u);
+    ASSERT_EQ(registry.size<stable_type>(), 1u);
+    ASSERT_EQ(registry.size<split_type>(), 1u);
+    ASSERT_TRUE(registry.valid(entities[0u]));
+    ASSERT_TRUE(registry.valid(entities[5u]));
+    ASSERT_EQ(registry.get<int>(entities[5u]), 5);
+
+    for(auto pos = 1u; pos < 5u; ++pos) {
+        ASSERT_FALSE(registry.valid(entities[pos]));
+        ASSERT_EQ(registry.current(entities[pos]), 1u);
+    }
+
+    // identifiers are released in order, the last one is recycled first
+    ASSERT_EQ(registry.entity(registry.create()), registry.entity(entities[4u]));
+}
+
 TEST(Registry, Insert) {
     entt::registry registry;
 
@@ -1326,6 +1761,41 @@ TEST(Registry, GetOrEmplace) {
     ASSERT_EQ(registry.get<int>(entity), 3);
 }
 
+TEST(Registry, Gather) {
+    entt::registry registry;
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto entity: entities) {
+        registry.emplace<int>(entity, static_cast<int>(entt::to_integral(entity)));
+        registry.emplace<char>(entity, static_cast<char>('a' + entt::to_integral(entity)));
+    }
+
+    const entt::entity pairs[6u]{entities[3u], entities[0u], entities[1u], entities[3u], entities[2u], entities[1u]};
+    int *ints[6u]{};
+    std::vector<char *> chars{};
+
+    registry.gather<int, char>(std::begin(pairs), std::end(pairs), std::begin(ints), std::back_inserter(chars));
+
+    ASSERT_EQ(chars.size(), 6u);
+
+    for(std::size_t pos{}; pos < 6u; ++pos) {
+        ASSERT_EQ(ints[pos], &registry.get<int>(pairs[pos]));
+        ASSERT_EQ(chars[pos], &registry.get<char>(pairs[pos]));
+    }
+
+    *ints[0u] = 42;
+
+    ASSERT_EQ(registry.get<int>(entities[3u]), 42);
+
+    const int *cints[2u]{};
+    std::as_const(registry).gather<int>(std::begin(pairs) + 1u, std::begin(pairs) + 3u, std::begin(cints));
+
+    ASSERT_EQ(*cints[0u], 0);
+    ASSERT_EQ(*cints[1u], 1);
+}
+
 TEST(Registry, Constness) {
     entt::registry registry;
 
@@ -1457,3 +1927,955 @@ TEST(Registry, Visit) {
 
     hasType[1] = false;
 }
+
+TEST(Registry, Stats) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    std::size_t count{};
+
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+    registry.clear<char>();
+
+    registry.stats([&](auto info, const auto &stats) {
+        if(info.hash() == entt::type_hash<int>::value()) {
+            ASSERT_EQ(stats.size, 1u);
+            ASSERT_GE(stats.instance_bytes, sizeof(int));
+        } else if(info.hash() == entt::type_hash<char>::value()) {
+            ASSERT_EQ(stats.size, 0u);
+            ASSERT_EQ(stats.null_slots(), stats.slots);
+        }
+
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+}
+
+TEST(Registry, CustomAllocator) {
+    {
+        entt::registry registry;
+        const auto entity = registry.create();
+
+        ASSERT_EQ(counting_allocator<allocated_type>::bytes, 0u);
+
+        registry.emplace<allocated_type>(entity, 42);
+        registry.emplace<int>(entity, 3);
+
+        // sparse pages and packed entities are drawn from the allocator as well
+        ASSERT_GT(counting_allocator<allocated_type>::bytes, ENTT_PAGE_SIZE + sizeof(allocated_type));
+        ASSERT_EQ(registry.get<allocated_type>(entity).value, 42);
+
+        registry.view<allocated_type, int>().each([](auto &instance, auto &value) {
+            value = instance.value;
+        });
+
+        ASSERT_EQ(registry.get<int>(entity), 42);
+
+        registry.destroy(entity);
+        registry.shrink_to_fit<allocated_type>();
+
+        ASSERT_EQ(counting_allocator<allocated_type>::bytes, 0u);
+
+        registry.emplace<allocated_type>(registry.create());
+    }
+
+    ASSERT_EQ(counting_allocator<allocated_type>::bytes, 0u);
+}
+
+TEST(Registry, MemoryResource) {
+    counting_resource resource{};
+
+    {
+        entt::registry registry{entt::registry::allocator_type{&resource}};
+        const auto entity = registry.create();
+
+        ASSERT_EQ(registry.get_allocator().resource(), &resource);
+        ASSERT_EQ(resource.bytes, 0u);
+
+        registry.emplace<int>(entity, 42);
+        registry.emplace<empty_type>(entity);
+        registry.emplace<stable_type>(entity, 3);
+
+        ASSERT_GT(resource.bytes, 3u * ENTT_PAGE_SIZE);
+        ASSERT_EQ(registry.storage<int>().get_allocator().resource(), &resource);
+
+        // pools that use other allocators don't draw from the resource
+        const auto used = resource.bytes;
+        registry.emplace<allocated_type>(entity);
+
+        ASSERT_EQ(resource.bytes, used);
+
+        registry.clear();
+        registry.shrink_to_fit<int>();
+
+        ASSERT_LT(resource.bytes, used);
+
+        entt::registry other{std::move(registry)};
+        other.emplace<int>(other.create(), 3);
+
+        ASSERT_GT(resource.bytes, 0u);
+    }
+
+    ASSERT_EQ(resource.bytes, 0u);
+
+    entt::registry registry{};
+
+    ASSERT_EQ(registry.get_allocator(), entt::registry::allocator_type{});
+}
+
+TEST(Registry, StableStorage) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<stable_type>(other, 3);
+    auto &instance = registry.emplace<stable_type>(entity, 42);
+    registry.emplace<int>(entity, 0);
+
+    registry.remove<stable_type>(other);
+    registry.emplace<stable_type>(registry.create(), 1);
+
+    ASSERT_EQ(&registry.get<stable_type>(entity), &instance);
+    ASSERT_EQ(instance.value, 42);
+
+    registry.view<stable_type, int>().each([](auto &curr, auto &value) {
+        value = curr.value;
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(registry.view<stable_type>().size(), 2u);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(registry.view<stable_type>().size(), 1u);
+}
+
+TEST(Registry, PagedStorage) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<paged_type>(other, 3);
+    auto &instance = registry.emplace<paged_type>(entity, 42);
+    registry.emplace<int>(entity, 0);
+
+    for(std::size_t pos{}; pos < 4096u; ++pos) {
+        registry.emplace<paged_type>(registry.create(), 1);
+    }
+
+    ASSERT_EQ(&registry.get<paged_type>(entity), &instance);
+
+    registry.remove<paged_type>(other);
+
+    registry.view<paged_type, int>().each([](auto &curr, auto &value) {
+        value = curr.value;
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(registry.view<paged_type>().size(), 4097u);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(registry.view<paged_type>().size(), 4096u);
+}
+
+TEST(Registry, SplitStorage) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<split_type>(other, 3, 'a');
+    auto ref = registry.emplace<split_type>(entity, 42, 'b');
+    registry.emplace<int>(entity, 0);
+
+    ASSERT_EQ(ref.get<&split_type::value>(), 42);
+    ASSERT_EQ(registry.get<split_type>(other).get<&split_type::tag>(), 'a');
+
+    registry.view<split_type, int>().each([](auto curr, auto &value) {
+        value = curr.template get<&split_type::value>();
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+
+    registry.view<const split_type>().each([](const entt::entity, auto curr) {
+        ASSERT_NE(curr.template get<&split_type::tag>(), 'c');
+    });
+
+    registry.replace<split_type>(entity, 7, 'c');
+    auto [value, tag] = static_cast<split_type>(std::get<0>(registry.get<split_type, int>(entity)));
+
+    ASSERT_EQ(value, 7);
+    ASSERT_EQ(tag, 'c');
+    ASSERT_EQ(registry.view<split_type>().size(), 2u);
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(registry.view<split_type>().size(), 1u);
+    ASSERT_EQ(registry.get<split_type>(other).get<&split_type::value>(), 3);
+}
+
+TEST(Registry, NoSignalStorage) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<silent_type>(std::begin(entities), std::end(entities), silent_type{1});
+    registry.emplace<int>(entities[0u]);
+
+    ASSERT_EQ(registry.get<silent_type>(entities[0u]).value, 1);
+
+    registry.patch<silent_type>(entities[0u], [](auto &instance) { instance.value = 2; });
+    registry.replace<silent_type>(entities[1u], 3);
+    registry.emplace_or_replace<silent_type>(entities[2u], 4);
+
+    ASSERT_EQ((registry.view<silent_type, int>().get<silent_type>(entities[0u]).value), 2);
+    ASSERT_EQ(registry.get<silent_type>(entities[1u]).value, 3);
+    ASSERT_EQ(registry.get<silent_type>(entities[2u]).value, 4);
+
+    registry.remove<silent_type>(entities[0u]);
+    registry.destroy(entities[1u]);
+
+    ASSERT_EQ(registry.size<silent_type>(), 1u);
+    ASSERT_TRUE(registry.has<silent_type>(entities[2u]));
+
+    registry.clear();
+
+    ASSERT_EQ(registry.size<silent_type>(), 0u);
+}
+
+TEST(Registry, TickStorageMixin) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<ticked_type>(entities[0u]);
+
+    const auto since = registry.advance_tick();
+
+    ASSERT_EQ(registry.tick(), since + 1u);
+
+    registry.insert<ticked_type>(entities + 1u, std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    std::vector<entt::entity> changed{};
+    registry.view<ticked_type>().each_changed_since(since, [&changed](const auto entity, auto &) { changed.push_back(entity); });
+
+    ASSERT_EQ(changed.size(), 2u);
+    ASSERT_EQ(std::count(changed.cbegin(), changed.cend(), entities[0u]), 0u);
+
+    const auto last = registry.advance_tick();
+    registry.patch<ticked_type>(entities[0u], [](auto &instance) { instance.value = 42; });
+    registry.replace<ticked_type>(entities[2u], 3);
+
+    changed.clear();
+    registry.view<ticked_type, int>().each_changed_since<ticked_type>(last, [&changed](const auto entity, auto &, auto &) { changed.push_back(entity); });
+
+    ASSERT_EQ(changed.size(), 2u);
+    ASSERT_EQ(std::count(changed.cbegin(), changed.cend(), entities[1u]), 0u);
+
+    auto count = 0;
+    registry.view<ticked_type>().each_changed_since(last, [&count](const auto &instance) { count += instance.value; });
+
+    ASSERT_EQ(count, 45);
+
+    registry.remove<ticked_type>(entities[0u]);
+    registry.emplace<ticked_type>(entities[0u]);
+
+    ASSERT_EQ(registry.view<ticked_type>().get<ticked_type>(entities[0u]).value, 0);
+
+    count = 0;
+    registry.view<const ticked_type>().each_changed_since(registry.advance_tick(), [&count](const auto &) { ++count; });
+
+    ASSERT_EQ(count, 0);
+}
+
+TEST(Registry, TickStorageMixinAddedChanged) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<ticked_type>(entity);
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+
+    const auto since = registry.advance_tick();
+    registry.emplace<ticked_type>(other);
+    registry.patch<ticked_type>(entity);
+
+    std::vector<entt::entity> added{};
+    registry.view<ticked_type>().each_added_since(since, [&added](const auto entt, auto &) { added.push_back(entt); });
+
+    ASSERT_EQ(added.size(), 1u);
+    ASSERT_EQ(added[0u], other);
+
+    added.clear();
+    registry.view<int, ticked_type>().each_added_since<ticked_type>(since, [&added](const auto entt, auto &...) { added.push_back(entt); });
+
+    ASSERT_EQ(added.size(), 1u);
+    ASSERT_EQ(added[0u], other);
+
+    auto changed = 0;
+    registry.view<ticked_type>().each_changed_since(since, [&changed](auto &) { ++changed; });
+
+    ASSERT_EQ(changed, 2);
+
+    const auto last = registry.advance_tick();
+    registry.emplace_or_replace<ticked_type>(other, 1);
+
+    added.clear();
+    changed = 0;
+    registry.view<ticked_type>().each_added_since(last, [&added](const auto entt, auto &) { added.push_back(entt); });
+    registry.view<ticked_type>().each_changed_since(last, [&changed](auto &) { ++changed; });
+
+    // replacing doesn't count as creating
+    ASSERT_TRUE(added.empty());
+    ASSERT_EQ(changed, 1);
+    ASSERT_EQ(registry.view<ticked_type>().get<ticked_type>(other).value, 1);
+}
+
+TEST(Registry, Transfer) {
+    entt::registry registry;
+    entt::registry other;
+    entt::entity entities[3u];
+    entt::entity target[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    other.create(std::begin(target), std::end(target));
+
+    registry.emplace<int>(entities[0u], 42);
+    registry.emplace<empty_type>(entities[0u]);
+    registry.emplace<std::unique_ptr<int>>(entities[1u], std::make_unique<int>(3));
+    registry.emplace<split_type>(entities[1u], 1, 'c');
+    registry.emplace<stable_type>(entities[2u], 2);
+    registry.emplace<int>(entities[2u], 1);
+
+    registry.transfer(std::begin(entities), std::end(entities), other, std::begin(target));
+
+    ASSERT_TRUE(std::all_of(std::begin(entities), std::end(entities), [&registry](const auto entt) { return registry.valid(entt) && registry.orphan(entt); }));
+    ASSERT_TRUE(registry.empty<int>());
+    ASSERT_TRUE(registry.empty<std::unique_ptr<int>>());
+
+    ASSERT_EQ(other.get<int>(target[0u]), 42);
+    ASSERT_TRUE(other.has<empty_type>(target[0u]));
+    ASSERT_EQ(*other.get<std::unique_ptr<int>>(target[1u]), 3);
+    ASSERT_EQ(static_cast<split_type>(other.get<split_type>(target[1u])).tag, 'c');
+    ASSERT_EQ(other.get<stable_type>(target[2u]).value, 2);
+    ASSERT_EQ(other.get<int>(target[2u]), 1);
+    ASSERT_FALSE(other.has<int>(target[1u]));
+
+    const auto entity = registry.create();
+    other.transfer(target[0u], registry, entity);
+
+    ASSERT_TRUE(other.orphan(target[0u]));
+    ASSERT_EQ(registry.get<int>(entity), 42);
+}
+
+TEST(Registry, Merge) {
+    entt::registry registry;
+    entt::registry other;
+    entt::entity entities[3u];
+    listener listener;
+
+    registry.emplace<int>(registry.create(), 0);
+    other.create(std::begin(entities), std::end(entities));
+    other.destroy(entities[1u]);
+
+    other.emplace<int>(entities[0u], 42);
+    other.emplace<empty_type>(entities[0u]);
+    other.emplace<std::unique_ptr<int>>(entities[2u], std::make_unique<int>(3));
+    other.emplace<split_type>(entities[2u], 1, 'c');
+    other.emplace<stable_type>(entities[2u], 2);
+    other.emplace<int>(entities[2u], 1);
+
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    std::vector<std::pair<entt::entity, entt::entity>> remap{};
+    registry.merge(other, [&remap](const auto src, const auto dst) { remap.emplace_back(src, dst); });
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(remap.size(), 2u);
+    ASSERT_EQ(other.alive(), 0u);
+    ASSERT_TRUE(other.empty<int>());
+    ASSERT_TRUE(other.empty<std::unique_ptr<int>>());
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_EQ(registry.size<int>(), 3u);
+
+    for(auto [src, dst]: remap) {
+        ASSERT_TRUE(registry.valid(dst));
+
+        if(src == entities[0u]) {
+            ASSERT_EQ(registry.get<int>(dst), 42);
+            ASSERT_TRUE(registry.has<empty_type>(dst));
+            ASSERT_FALSE(registry.has<stable_type>(dst));
+        } else {
+            ASSERT_EQ(src, entities[2u]);
+            ASSERT_EQ(registry.get<int>(dst), 1);
+            ASSERT_EQ(*registry.get<std::unique_ptr<int>>(dst), 3);
+            ASSERT_EQ(static_cast<split_type>(registry.get<split_type>(dst)).tag, 'c');
+            ASSERT_EQ(registry.get<stable_type>(dst).value, 2);
+        }
+    }
+}
+
+TEST(Registry, MergeWithoutSignals) {
+    entt::registry registry;
+    entt::registry other;
+    listener listener;
+
+    registry.cache_signatures(true);
+    registry.on_construct<int>().connect<&listener::incr<int>>(listener);
+    registry.on_construct<empty_type>().connect<&listener::incr<empty_type>>(listener);
+
+    const auto entity = other.create();
+    other.emplace<int>(entity, 42);
+    other.emplace<empty_type>(entity);
+
+    registry.merge(other, false);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(registry.size<int>(), 1u);
+
+    const auto dst = *registry.view<int, empty_type>().begin();
+
+    ASSERT_EQ(registry.get<int>(dst), 42);
+    ASSERT_FALSE(registry.orphan(dst));
+
+    registry.remove_all(dst);
+
+    ASSERT_TRUE(registry.orphan(dst));
+    ASSERT_TRUE(registry.empty<int>());
+}
+
+TEST(Registry, MergeRuntimeStorage) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    entt::registry other;
+    const auto desc = entt::make_runtime_descriptor<std::string>();
+
+    other.destroy(other.create());
+    const auto entity = other.create();
+    static_cast<std::string *>(other.storage("name"_hs, desc).emplace(entity))->assign(3u, 'x');
+
+    registry.merge(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_NE(registry.storage("name"_hs), nullptr);
+    ASSERT_EQ(registry.storage("name"_hs)->size(), 1u);
+
+    const auto dst = registry.storage("name"_hs)->data()[0u];
+
+    ASSERT_TRUE(registry.valid(dst));
+    ASSERT_EQ(*static_cast<const std::string *>(registry.storage("name"_hs)->get(dst)), "xxx");
+}
+
+TEST(Registry, Freeze) {
+    entt::registry registry;
+    const auto &cregistry = registry;
+    const auto entity = registry.create();
+    std::size_t count{};
+
+    registry.prepare<int, char>();
+    registry.emplace<int>(entity, 42);
+    registry.emplace<char>(entity);
+    static_cast<void>(registry.group(entt::get<int, char>));
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.group_stats([&count](auto, const auto length) { count += length; });
+
+    ASSERT_EQ(count, 0u);
+
+    registry.freeze();
+    count = {};
+    registry.group_stats([&count](auto, const auto length) { count += length; });
+
+    ASSERT_EQ(count, 1u);
+
+    registry.remove<char>(entity);
+    static_cast<void>(registry.group<const int>(entt::get<const char>));
+    count = {};
+    registry.visit([&count](auto) { ++count; });
+
+    ASSERT_TRUE(registry.frozen());
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ((cregistry.view<const int>().size()), 1u);
+    ASSERT_EQ((cregistry.view<const double>().size()), 0u);
+    ASSERT_EQ((cregistry.view<const int, const double>().size_hint()), 0u);
+    ASSERT_EQ((cregistry.group<const int>(entt::get<const char>).size()), 0u);
+    ASSERT_FALSE(cregistry.has<double>(entity));
+
+    count = {};
+    registry.visit([&count](auto) { ++count; });
+
+    ASSERT_EQ(count, 2u);
+
+    registry.emplace<double>(entity);
+    count = {};
+    registry.visit([&count](auto) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+    ASSERT_TRUE(cregistry.has<double>(entity));
+
+    registry.freeze(false);
+
+    ASSERT_FALSE(registry.frozen());
+    ASSERT_EQ((cregistry.view<const float>().size()), 0u);
+
+    count = {};
+    registry.visit([&count](auto) { ++count; });
+
+    ASSERT_EQ(count, 4u);
+}
+
+TEST(Registry, Compact) {
+    entt::registry registry;
+    auto &&storage = registry.storage<toggled_type>();
+    std::vector<entt::entity> entities(8u);
+    std::vector<std::pair<entt::entity, entt::entity>> remap{};
+
+    registry.cache_signatures(true);
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities[3u]);
+    entities[3u] = registry.create();
+
+    ASSERT_EQ(registry.version(entities[3u]), 1u);
+
+    registry.insert<int>(entities.begin(), entities.end(), 0);
+    registry.insert<char>(entities.begin() + 4u, entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.get<int>(entities[pos]) = static_cast<int>(pos);
+        registry.emplace<toggled_type>(entities[pos], static_cast<int>(pos));
+    }
+
+    const auto group = registry.group<>(entt::get<int, char>);
+    const auto owning = registry.group<double>(entt::get<int>);
+
+    ASSERT_EQ(group.size(), 4u);
+
+    // leaves behind an object for a destroyed entity to discard
+    storage.disable(registry, entities[1u]);
+    storage.disable(registry, entities[7u]);
+    registry.destroy(entities[1u]);
+    registry.destroy(entities[2u]);
+    registry.destroy(entities[4u]);
+    registry.emplace<double>(entities[6u]);
+
+    registry.compact([&remap](const auto src, const auto dst) { remap.emplace_back(src, dst); });
+
+    ASSERT_EQ(registry.size(), 5u);
+    ASSERT_EQ(registry.alive(), 5u);
+    ASSERT_EQ(registry.destroyed(), entt::entity{entt::null});
+    ASSERT_EQ(remap.size(), 4u);
+    ASSERT_EQ(storage.disabled_size(), 1u);
+    ASSERT_EQ(group.size(), 3u);
+    ASSERT_EQ(owning.size(), 1u);
+
+    const auto find = [&remap](const auto entt) {
+        const auto it = std::find_if(remap.cbegin(), remap.cend(), [entt](auto &&elem) { return elem.first == entt; });
+        return it == remap.cend() ? entt : it->second;
+    };
+
+    for(const auto pos: { 0u, 3u, 5u, 6u, 7u }) {
+        const auto entt = find(entities[pos]);
+
+        ASSERT_TRUE(registry.valid(entt));
+        ASSERT_LT(registry.entity(entt), entt::entity{5u});
+        ASSERT_EQ(registry.version(entt), registry.version(entities[pos]));
+        ASSERT_EQ(registry.get<int>(entt), static_cast<int>(pos));
+        ASSERT_EQ(registry.has<char>(entt), pos > 3u);
+        ASSERT_EQ(group.contains(entt), pos > 4u);
+        ASSERT_EQ(storage.disabled(entt), pos == 7u);
+        ASSERT_EQ(registry.has<toggled_type>(entt), pos != 7u);
+        ASSERT_FALSE(registry.orphan(entt));
+    }
+
+    ASSERT_TRUE(owning.contains(find(entities[6u])));
+
+    storage.enable(registry, find(entities[7u]));
+
+    ASSERT_EQ(registry.get<toggled_type>(find(entities[7u])).value, 7);
+
+    registry.remove_all(find(entities[0u]));
+
+    ASSERT_TRUE(registry.orphan(find(entities[0u])));
+    ASSERT_EQ(registry.create(), entt::entity{5u});
+}
+
+TEST(Registry, CompactTicks) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto entt: entities) {
+        registry.emplace<ticked_type>(entt);
+        registry.advance_tick();
+    }
+
+    const auto &storage = registry.storage<ticked_type>();
+    const auto first = storage.added_tick(entities[1u]);
+    const auto second = storage.added_tick(entities[2u]);
+
+    registry.destroy(entities[0u]);
+    registry.compact();
+
+    ASSERT_EQ(storage.added_tick(entt::entity{0u}), first);
+    ASSERT_EQ(storage.added_tick(entt::entity{1u}), second);
+    ASSERT_EQ(storage.changed_tick(entt::entity{1u}), second);
+}
+
+void copy_remap(std::vector<entt::entity> &table, entt::registry &, const entt::entity *first, const entt::entity *last) {
+    table.assign(first, last);
+}
+
+TEST(Registry, CompactSignatureIndex) {
+    entt::registry registry;
+    entt::signature_index index{registry};
+    entt::entity entities[4u];
+
+    index.track<int, char>();
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[1u]);
+    registry.emplace<int>(entities[3u]);
+    registry.emplace<char>(entities[3u]);
+
+    std::vector<entt::entity> remap(registry.size(), entt::entity{entt::null});
+    registry.on_remap().connect<&copy_remap>(remap);
+
+    registry.destroy(entities[0u]);
+    registry.destroy(entities[2u]);
+    registry.compact();
+
+    ASSERT_EQ(remap[0u], entt::entity{entt::null});
+    ASSERT_EQ(remap[1u], entt::entity{0u});
+    ASSERT_EQ(remap[3u], entt::entity{1u});
+
+    entt::id_type types[] = { entt::type_hash<int>::value() };
+    entt::id_type both[] = { entt::type_hash<int>::value(), entt::type_hash<char>::value() };
+
+    ASSERT_EQ(index.runtime_view(std::begin(types), std::end(types)).size_hint(), 2u);
+    ASSERT_EQ(std::distance(index.runtime_view(std::begin(types), std::end(types)).begin(), index.runtime_view(std::begin(types), std::end(types)).end()), 2);
+    ASSERT_EQ(index.count(std::begin(both), std::end(both)), 1u);
+    ASSERT_TRUE(index.matches(entt::entity{1u}, std::begin(both), std::end(both)));
+    ASSERT_FALSE(index.matches(entt::entity{0u}, std::begin(both), std::end(both)));
+}
+
+enum class tagged_entity: std::uint32_t {};
+
+template<>
+struct entt::entt_traits<tagged_entity>: entt::basic_entt_traits<std::uint32_t, 16u, 8u> {};
+
+TEST(Registry, UserBits) {
+    entt::basic_registry<tagged_entity> registry;
+    const auto first = registry.create();
+
+    ASSERT_EQ(registry.user_bits(), 0u);
+    ASSERT_EQ(entt::to_integral(first), 0u);
+
+    registry.user_bits(0xAB000000u);
+    const auto second = registry.create();
+
+    ASSERT_EQ(registry.user_bits(), 0xAB000000u);
+    ASSERT_EQ(entt::to_integral(second), 0xAB000001u);
+    ASSERT_EQ(registry.entity(second), tagged_entity{1u});
+
+    // recycled identifiers keep their own bits
+    registry.destroy(first);
+
+    ASSERT_EQ(entt::to_integral(registry.create()), 0x00010000u);
+}
+
+template<std::size_t... Index>
+void emplace_tags(entt::registry &registry, const entt::entity entity, std::index_sequence<Index...>) {
+    (registry.emplace<std::integral_constant<std::size_t, Index>>(entity), ...);
+}
+
+TEST(Registry, DenseTypeIndexing) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    auto *pool = &registry.storage<double>();
+    std::size_t count{};
+
+    registry.emplace<double>(entity, .3);
+    // rehashes the lookup table a few times
+    emplace_tags(registry, entity, std::make_index_sequence<40u>{});
+
+    ASSERT_EQ(&registry.storage<double>(), pool);
+    ASSERT_EQ(registry.get<double>(entity), .3);
+    ASSERT_TRUE((registry.has<std::integral_constant<std::size_t, 0u>, std::integral_constant<std::size_t, 39u>>(entity)));
+
+    registry.visit([&count](const auto) { ++count; });
+
+    ASSERT_EQ(count, 41u);
+
+    entt::registry other;
+    other.emplace<double>(other.create());
+    count = {};
+    other.visit([&count](const auto) { ++count; });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(Registry, SignatureCache) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<char>(other);
+
+    ASSERT_FALSE(registry.cached_signatures());
+
+    registry.cache_signatures(true);
+
+    ASSERT_TRUE(registry.cached_signatures());
+    ASSERT_FALSE(registry.orphan(entity));
+
+    registry.emplace<double>(entity);
+    registry.emplace<silent_type>(entity);
+    registry.emplace<stable_type>(other);
+
+    std::vector<entt::id_type> types{};
+    registry.visit(entity, [&types](const auto info) { types.push_back(info.seq()); });
+
+    ASSERT_EQ(types.size(), 3u);
+    ASSERT_TRUE(std::is_sorted(types.rbegin(), types.rend()));
+
+    registry.remove<int>(entity);
+    types.clear();
+    registry.visit(entity, [&types](const auto info) { types.push_back(info.seq()); });
+
+    ASSERT_EQ(types.size(), 2u);
+
+    registry.remove_all(entity);
+
+    ASSERT_TRUE(registry.orphan(entity));
+    ASSERT_TRUE(registry.empty<double>());
+    ASSERT_TRUE(registry.empty<silent_type>());
+    ASSERT_TRUE((registry.has<char, stable_type>(other)));
+
+    registry.destroy(other);
+    const auto recycled = registry.create();
+
+    ASSERT_TRUE(registry.orphan(recycled));
+
+    // more pools than bits in a word
+    emplace_tags(registry, recycled, std::make_index_sequence<70u>{});
+    std::size_t count{};
+    registry.visit(recycled, [&count](const auto) { ++count; });
+
+    ASSERT_EQ(count, 70u);
+
+    registry.remove_all(recycled);
+
+    ASSERT_TRUE(registry.orphan(recycled));
+    ASSERT_TRUE((registry.empty<std::integral_constant<std::size_t, 69u>>()));
+
+    registry.cache_signatures(false);
+    registry.emplace<int>(recycled);
+
+    ASSERT_FALSE(registry.cached_signatures());
+    ASSERT_FALSE(registry.orphan(recycled));
+
+    registry.remove_all(recycled);
+
+    ASSERT_TRUE(registry.orphan(recycled));
+}
+
+TEST(Registry, Clone) {
+    entt::registry registry;
+    listener listener;
+    const auto prefab = registry.create();
+    entt::entity entities[4u];
+
+    registry.emplace<int>(prefab, 42);
+    registry.emplace<empty_type>(prefab);
+    registry.emplace<stable_type>(prefab, 3);
+    registry.emplace<split_type>(prefab, 1, 'c');
+    registry.emplace<char>(registry.create(), 'x');
+
+    registry.on_construct_range<int>().connect<&listener::incr_range<int>>(listener);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.clone(prefab, std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.calls, 1);
+    ASSERT_EQ(listener.range, 4);
+    ASSERT_EQ(registry.size<int>(), 5u);
+    ASSERT_EQ(registry.size<char>(), 1u);
+
+    for(auto entity: entities) {
+        ASSERT_EQ(registry.get<int>(entity), 42);
+        ASSERT_TRUE(registry.has<empty_type>(entity));
+        ASSERT_EQ(registry.get<stable_type>(entity).value, 3);
+        ASSERT_EQ(static_cast<split_type>(registry.get<split_type>(entity)).tag, 'c');
+        ASSERT_FALSE(registry.has<char>(entity));
+    }
+
+    registry.get<int>(entities[0u]) = 0;
+
+    ASSERT_EQ(registry.get<int>(prefab), 42);
+}
+
+TEST(Registry, TransientStorage) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(int frame{}; frame < 2; ++frame) {
+        registry.insert<transient_type>(std::begin(entities), std::end(entities), transient_type{frame});
+
+        ASSERT_EQ(registry.size<transient_type>(), 3u);
+        ASSERT_EQ(registry.get<transient_type>(entities[1u]).value, frame);
+
+        registry.clear<transient_type>();
+
+        ASSERT_TRUE(registry.empty<transient_type>());
+        ASSERT_FALSE(registry.has<transient_type>(entities[0u]));
+    }
+
+    registry.emplace<transient_type>(entities[0u]);
+    registry.emplace<transient_type>(entities[2u]);
+    registry.destroy(entities[2u]);
+
+    ASSERT_EQ(registry.size<transient_type>(), 1u);
+    ASSERT_TRUE(registry.has<transient_type>(entities[0u]));
+}
+
+TEST(Registry, ToggleStorage) {
+    entt::registry registry;
+    listener listener;
+    auto &&storage = registry.view<toggled_type>().storage();
+    auto &&tags = registry.view<toggled_tag>().storage();
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<toggled_type>(entity, 1);
+    registry.emplace<toggled_type>(other, 2);
+    registry.emplace<toggled_tag>(entity);
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+
+    registry.on_construct<toggled_type>().connect<&listener::incr<toggled_type>>(listener);
+    registry.on_destroy<toggled_type>().connect<&listener::decr<toggled_type>>(listener);
+
+    storage.disable(registry, entity);
+    tags.disable(registry, entity);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_TRUE(storage.disabled(entity));
+    ASSERT_FALSE(storage.disabled(other));
+    ASSERT_TRUE(tags.disabled(entity));
+    ASSERT_EQ(storage.disabled_size(), 1u);
+    ASSERT_FALSE(registry.has<toggled_type>(entity));
+    ASSERT_EQ(registry.size<toggled_type>(), 1u);
+
+    std::size_t count{};
+    registry.view<int, toggled_type>().each([&count, other](const auto entt, auto &, auto &) { ASSERT_EQ(entt, other); ++count; });
+    registry.view<int, toggled_tag>().each([&count](const auto, auto &) { ++count; });
+
+    ASSERT_EQ(count, 1u);
+
+    storage.enable(registry, entity);
+    tags.enable(registry, entity);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_FALSE(storage.disabled(entity));
+    ASSERT_EQ(storage.disabled_size(), 0u);
+    ASSERT_EQ(registry.get<toggled_type>(entity).value, 1);
+    ASSERT_TRUE(registry.has<toggled_tag>(entity));
+
+    // objects left behind by destroyed entities are discarded on reuse
+    storage.disable(registry, other);
+    registry.destroy(other);
+    const auto recycled = registry.create();
+
+    ASSERT_FALSE(storage.disabled(recycled));
+    ASSERT_EQ(storage.disabled_size(), 1u);
+
+    registry.emplace<toggled_type>(recycled, 3);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(storage.disabled_size(), 0u);
+    ASSERT_EQ(registry.get<toggled_type>(recycled).value, 3);
+}
+
+TEST(Registry, HistoryStorage) {
+    entt::registry registry;
+    auto &&storage = registry.storage<history_type>();
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    listener listener;
+
+    registry.on_construct<history_type>().connect<&listener::incr<history_type>>(listener);
+
+    ASSERT_EQ(storage.frames(), 0u);
+    ASSERT_EQ(storage.history(entity), nullptr);
+
+    registry.emplace<history_type>(entity, 1);
+    storage.record();
+    registry.patch<history_type>(entity, [](auto &instance) { instance.value = 2; });
+    registry.emplace<history_type>(other, 0);
+    storage.record();
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(storage.frames(), 2u);
+    ASSERT_EQ(storage.history(entity)->value, 2);
+    ASSERT_EQ(storage.history(entity, 1u)->value, 1);
+    ASSERT_EQ(storage.history(entity, 2u), nullptr);
+    ASSERT_EQ(storage.history(other)->value, 0);
+    ASSERT_EQ(storage.history(other, 1u), nullptr);
+
+    for(auto value = 3; value < 6; ++value) {
+        registry.patch<history_type>(entity, [value](auto &instance) { instance.value = value; });
+        storage.record();
+    }
+
+    ASSERT_EQ(storage.frames(), 3u);
+    ASSERT_EQ(storage.history(entity)->value, 5);
+    ASSERT_EQ(storage.history(entity, 2u)->value, 3);
+    ASSERT_EQ(storage.history(entity, 3u), nullptr);
+
+    registry.destroy(other);
+    registry.compact();
+
+    ASSERT_EQ(storage.history(entity)->value, 5);
+
+    storage.forget();
+
+    ASSERT_EQ(storage.frames(), 0u);
+    ASSERT_EQ(storage.history(entity), nullptr);
+    ASSERT_EQ(registry.get<history_type>(entity).value, 5);
+}
+
+TEST(Registry, HashedStorage) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.reserve(5000u);
+
+    for(std::size_t pos{}; pos < 5000u; ++pos) {
+        registry.create();
+    }
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<hashed_type>(entities[0u], 1);
+    registry.insert<hashed_type>(entities + 1u, std::end(entities), hashed_type{2});
+    registry.emplace<int>(entities[1u]);
+
+    ASSERT_TRUE(registry.storage<hashed_type>().hashed());
+    ASSERT_EQ(registry.storage<hashed_type>().memory_usage().pages, 0u);
+    ASSERT_EQ(registry.get<hashed_type>(entities[0u]).value, 1);
+    ASSERT_EQ(registry.get<hashed_type>(entities[2u]).value, 2);
+
+    auto view = registry.view<hashed_type, int>();
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(*view.begin(), entities[1u]);
+
+    registry.destroy(entities[0u]);
+
+    ASSERT_EQ(registry.size<hashed_type>(), 2u);
+    ASSERT_FALSE(registry.storage<hashed_type>().contains(entities[0u]));
+    ASSERT_EQ(registry.get<hashed_type>(entities[1u]).value, 2);
+}
@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+
+struct empty_type {};
+
+struct position {
+    float x;
+    float y;
+};
+
+TEST(Rollback, Functionalities) {
+    entt::registry registry;
+    entt::rollback<position, empty_type> rollback{};
+
+    ASSERT_TRUE(rollback.empty());
+    ASSERT_EQ(rollback.size(), 0u);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<position>(entity, 1.f, 1.f);
+    registry.emplace<position>(other, 2.f, 2.f);
+    registry.emplace<empty_type>(other);
+    rollback.save(registry);
+
+    ASSERT_FALSE(rollback.empty());
+    ASSERT_EQ(rollback.size(), 1u);
+
+    registry.patch<position>(entity, [](auto &pos) { pos.x = 3.f; });
+    registry.destroy(other);
+    registry.emplace<empty_type>(registry.create());
+    rollback.save(registry);
+
+    ASSERT_EQ(rollback.size(), 2u);
+
+    rollback.restore(registry, 1u);
+
+    ASSERT_EQ(rollback.size(), 1u);
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.size<position>(), 2u);
+    ASSERT_EQ(registry.size<empty_type>(), 1u);
+    ASSERT_EQ(registry.get<position>(entity).x, 1.f);
+    ASSERT_EQ(registry.get<position>(other).y, 2.f);
+    ASSERT_TRUE(registry.has<empty_type>(other));
+    ASSERT_EQ(registry.create(), entt::registry::entity_type{2u});
+
+    rollback.clear();
+
+    ASSERT_TRUE(rollback.empty());
+}
+
+TEST(Rollback, Length) {
+    entt::registry registry;
+    entt::rollback<position> rollback{2u};
+
+    for(int next{}; next < 4; ++next) {
+        registry.emplace<position>(registry.create(), static_cast<float>(next), 0.f);
+        rollback.save(registry);
+    }
+
+    ASSERT_EQ(rollback.size(), 2u);
+
+    rollback.restore(registry, 1u);
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_EQ(registry.size<position>(), 3u);
+}
+
+TEST(Rollback, SharedPages) {
+    entt::registry registry;
+    entt::rollback<position> rollback{};
+
+    for(std::size_t pos{}; pos < 4096u; ++pos) {
+        registry.emplace<position>(registry.create(), 0.f, 0.f);
+    }
+
+    rollback.save(registry);
+    const auto pages = rollback.pages();
+
+    ASSERT_NE(pages, 0u);
+
+    for(auto frame = 0; frame < 7; ++frame) {
+        registry.patch<position>(registry.data<position>()[0u], [frame](auto &pos) { pos.x = static_cast<float>(frame + 1); });
+        rollback.save(registry);
+    }
+
+    ASSERT_EQ(rollback.size(), 8u);
+    ASSERT_EQ(rollback.pages(), pages + 7u);
+
+    rollback.restore(registry, 7u);
+
+    ASSERT_EQ(registry.size<position>(), 4096u);
+    ASSERT_EQ(registry.get<position>(registry.data<position>()[0u]).x, 0.f);
+}
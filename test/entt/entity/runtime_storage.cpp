@@ -0,0 +1,188 @@
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <queue>
+#include <string>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_storage.hpp>
+#include <entt/entity/snapshot.hpp>
+
+struct alignas(32u) over_aligned {
+    int value;
+};
+
+struct output_archive {
+    void operator()(const entt::entity entity) { entities.push(entity); }
+    void operator()(const std::uint32_t length) { lengths.push(length); }
+    void operator()(const void *instance) { values.push(static_cast<const std::string *>(instance)->size()); }
+
+    std::queue<entt::entity> &entities;
+    std::queue<std::uint32_t> &lengths;
+    std::queue<std::size_t> &values;
+};
+
+struct input_archive {
+    void operator()(entt::entity &entity) { entity = entities.front(); entities.pop(); }
+    void operator()(std::uint32_t &length) { length = lengths.front(); lengths.pop(); }
+    void operator()(void *instance) { static_cast<std::string *>(instance)->assign(values.front(), 'x'); values.pop(); }
+
+    std::queue<entt::entity> &entities;
+    std::queue<std::uint32_t> &lengths;
+    std::queue<std::size_t> &values;
+};
+
+TEST(RuntimeStorage, Functionalities) {
+    using namespace entt::literals;
+
+    entt::runtime_storage pool{"string"_hs, entt::make_runtime_descriptor<std::string>()};
+    const std::string value{"a value long enough to allocate"};
+
+    ASSERT_EQ(pool.id(), "string"_hs);
+    ASSERT_EQ(pool.descriptor().size, sizeof(std::string));
+    ASSERT_EQ(pool.descriptor().name, entt::type_name<std::string>::value());
+    ASSERT_TRUE(pool.empty());
+
+    pool.reserve(2u);
+
+    ASSERT_EQ(pool.memory_usage().instances, 3u);
+
+    pool.emplace(entt::entity{3});
+    pool.emplace(entt::entity{1}, &value);
+    pool.emplace(entt::entity{7}, &value);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_TRUE(static_cast<const std::string *>(pool.get(entt::entity{3}))->empty());
+    ASSERT_EQ(*static_cast<const std::string *>(pool.get(entt::entity{1})), value);
+    ASSERT_EQ(static_cast<const std::string *>(pool.raw())[2u], value);
+
+    *static_cast<std::string *>(pool.get(entt::entity{3})) = "3";
+    pool.sort(std::less{});
+
+    ASSERT_EQ(pool.data()[0u], entt::entity{7});
+    ASSERT_EQ(*static_cast<const std::string *>(pool.raw()), value);
+    ASSERT_EQ(*static_cast<const std::string *>(pool.get(entt::entity{3})), "3");
+
+    pool.remove(entt::entity{7});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entt::entity{7}));
+    ASSERT_EQ(*static_cast<const std::string *>(pool.get(entt::entity{3})), "3");
+    ASSERT_EQ(*static_cast<const std::string *>(pool.get(entt::entity{1})), value);
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(RuntimeStorage, AlignmentAndMoveOnly) {
+    using namespace entt::literals;
+
+    entt::runtime_storage aligned{"aligned"_hs, entt::make_runtime_descriptor<over_aligned>()};
+    entt::runtime_storage pointers{"pointer"_hs, entt::make_runtime_descriptor<std::unique_ptr<int>>()};
+
+    ASSERT_EQ(pointers.descriptor().copy, nullptr);
+
+    for(std::uint32_t pos{}; pos < 20u; ++pos) {
+        auto *instance = aligned.emplace(entt::entity{pos});
+        auto ptr = std::make_unique<int>(static_cast<int>(pos));
+
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(instance) % 32u, 0u);
+
+        static_cast<over_aligned *>(instance)->value = static_cast<int>(pos);
+        pointers.emplace_move(entt::entity{pos}, &ptr);
+
+        ASSERT_EQ(ptr, nullptr);
+    }
+
+    pointers.remove(entt::entity{0});
+
+    for(std::uint32_t pos{1u}; pos < 20u; ++pos) {
+        ASSERT_EQ(static_cast<over_aligned *>(aligned.get(entt::entity{pos}))->value, static_cast<int>(pos));
+        ASSERT_EQ(**static_cast<std::unique_ptr<int> *>(pointers.get(entt::entity{pos})), static_cast<int>(pos));
+    }
+}
+
+TEST(RuntimeStorage, Registry) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    const auto desc = entt::make_runtime_descriptor<std::string>("script_name");
+    auto &&pool = registry.storage("name"_hs, desc);
+
+    ASSERT_EQ(&registry.storage("name"_hs, desc), &pool);
+    ASSERT_EQ(registry.storage("name"_hs), &pool);
+    ASSERT_EQ(std::as_const(registry).storage("other"_hs), nullptr);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+    *static_cast<std::string *>(pool.emplace(entity)) = "entity";
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), "name"_hs };
+    auto view = registry.runtime_view(std::begin(types), std::end(types));
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(*view.begin(), entity);
+
+    bool found{};
+    registry.visit(entity, [&found](const auto info) { found = found || (info.hash() == "name"_hs && info.name() == "script_name"); });
+
+    ASSERT_TRUE(found);
+
+    const auto prototype = entity;
+    const entt::entity clones[2u]{registry.create(), registry.create()};
+    registry.clone(prototype, std::begin(clones), std::end(clones));
+
+    ASSERT_EQ(*static_cast<const std::string *>(pool.get(clones[1u])), "entity");
+
+    registry.remove_all(clones[0u]);
+
+    ASSERT_FALSE(pool.contains(clones[0u]));
+
+    registry.destroy(entity);
+
+    ASSERT_FALSE(pool.contains(entity));
+    ASSERT_EQ(pool.size(), 1u);
+
+    entt::registry target;
+    const auto dst = target.create();
+    registry.transfer(clones[1u], target, dst);
+
+    ASSERT_FALSE(pool.contains(clones[1u]));
+    ASSERT_EQ(*static_cast<const std::string *>(target.storage("name"_hs)->get(dst)), "entity");
+}
+
+TEST(RuntimeStorage, Snapshot) {
+    using namespace entt::literals;
+
+    entt::registry source;
+    entt::registry destination;
+    const auto desc = entt::make_runtime_descriptor<std::string>();
+    auto &&pool = source.storage("name"_hs, desc);
+
+    std::queue<entt::entity> entities;
+    std::queue<std::uint32_t> lengths;
+    std::queue<std::size_t> values;
+    output_archive output{entities, lengths, values};
+    input_archive input{entities, lengths, values};
+
+    const auto e0 = source.create();
+    const auto e1 = source.create();
+    source.destroy(source.create());
+    static_cast<std::string *>(pool.emplace(e0))->assign(3u, 'x');
+    static_cast<std::string *>(pool.emplace(e1))->assign(5u, 'x');
+
+    entt::snapshot{source}.entities(output).component("name"_hs, output).component("other"_hs, output);
+    entt::snapshot_loader{destination}.entities(input).component("name"_hs, desc, input).component("other"_hs, desc, input);
+
+    ASSERT_TRUE(destination.valid(e0));
+    ASSERT_TRUE(destination.valid(e1));
+    ASSERT_EQ(*static_cast<const std::string *>(destination.storage("name"_hs)->get(e0)), "xxx");
+    ASSERT_EQ(*static_cast<const std::string *>(destination.storage("name"_hs)->get(e1)), "xxxxx");
+    ASSERT_TRUE(destination.storage("other"_hs)->empty());
+}
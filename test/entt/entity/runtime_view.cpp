@@ -1,10 +1,29 @@
-#include <iterator>
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
 
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+};
+
 TEST(RuntimeView, Functionalities) {
     entt::registry registry;
 
@@ -160,6 +179,42 @@ TEST(RuntimeView, EachWithHoles) {
     });
 }
 
+TEST(RuntimeView, PoolsOfDifferentSize) {
+    entt::registry registry;
+    std::size_t expected{};
+
+    for(auto next = 0; next < 60; ++next) {
+        const auto entity = registry.create();
+
+        registry.emplace<int>(entity, next);
+
+        if(next % 2) {
+            registry.emplace<char>(entity);
+        }
+
+        if(!(next % 3)) {
+            registry.emplace<double>(entity);
+        }
+
+        expected += (next % 2) && !(next % 3);
+    }
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), entt::type_hash<char>::value(), entt::type_hash<double>::value() };
+    auto view = registry.runtime_view(std::begin(types), std::end(types));
+    std::size_t cnt{};
+
+    ASSERT_EQ(view.size_hint(), registry.size<double>());
+
+    view.each([&](auto entity) {
+        ASSERT_TRUE(registry.has<int>(entity));
+        ASSERT_TRUE(registry.has<char>(entity));
+        ASSERT_TRUE(registry.has<double>(entity));
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, expected);
+}
+
 TEST(RuntimeView, MissingPool) {
     entt::registry registry;
 
@@ -219,3 +274,31 @@ TEST(RuntimeView, ExcludedComponents) {
         ASSERT_EQ(e0, entity);
     });
 }
+
+TEST(RuntimeView, ParEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    std::atomic<std::size_t> cnt{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end());
+    registry.insert<char>(entities.begin(), entities.begin() + 7u);
+    registry.insert<double>(entities.begin(), entities.begin() + 2u);
+
+    entt::id_type components[] = { entt::type_hash<int>::value(), entt::type_hash<char>::value() };
+    entt::id_type filter[] = { entt::type_hash<double>::value() };
+    auto view = registry.runtime_view(std::begin(components), std::end(components), std::begin(filter), std::end(filter));
+
+    view.par_each(thread_executor{}, [&view, &cnt](const auto entity) {
+        ASSERT_TRUE(view.contains(entity));
+        ++cnt;
+    }, 3u);
+
+    ASSERT_EQ(cnt, 5u);
+
+    registry.clear<char>();
+    view.par_each([](auto...) { FAIL(); }, [](auto) {});
+
+    entt::id_type missing[] = { entt::type_hash<float>::value() };
+    registry.runtime_view(std::begin(missing), std::end(missing)).par_each([](auto...) { FAIL(); }, [](auto) {});
+}
@@ -0,0 +1,138 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sharded.hpp>
+
+enum class shard_entity: std::uint64_t {};
+
+template<>
+struct entt::entt_traits<shard_entity>: entt::basic_entt_traits<std::uint64_t, 32u, 16u> {};
+
+struct empty_type {};
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+};
+
+TEST(ShardedRegistry, Functionalities) {
+    entt::basic_sharded_registry<shard_entity> sharded{3u};
+
+    ASSERT_EQ(sharded.size(), 3u);
+
+    const auto entity = sharded.create(0u);
+    const auto other = sharded.create(2u);
+
+    ASSERT_NE(entity, other);
+    ASSERT_EQ(sharded.shard(entity), 0u);
+    ASSERT_EQ(sharded.shard(other), 2u);
+    ASSERT_EQ(sharded[0u].entity(entity), sharded[2u].entity(other));
+    ASSERT_TRUE(sharded.valid(entity));
+    ASSERT_TRUE(sharded.valid(other));
+    ASSERT_TRUE(sharded[2u].valid(other));
+    ASSERT_FALSE(sharded[0u].valid(other));
+
+    sharded.destroy(other);
+
+    ASSERT_FALSE(sharded.valid(other));
+
+    // recycled identifiers stay within their shard
+    ASSERT_EQ(sharded.shard(sharded.create(2u)), 2u);
+}
+
+TEST(ShardedRegistry, Migrate) {
+    entt::basic_sharded_registry<shard_entity> sharded{2u};
+    const auto entity = sharded.create(0u);
+
+    sharded[0u].emplace<int>(entity, 42);
+    sharded[0u].emplace<char>(entity, 'c');
+    sharded[0u].emplace<empty_type>(entity);
+
+    const auto moved = sharded.migrate(entity, 1u);
+
+    ASSERT_FALSE(sharded.valid(entity));
+    ASSERT_TRUE(sharded.valid(moved));
+    ASSERT_EQ(sharded.shard(moved), 1u);
+    ASSERT_TRUE(sharded[0u].empty<int>());
+    ASSERT_EQ(sharded[1u].get<int>(moved), 42);
+    ASSERT_EQ(sharded[1u].get<char>(moved), 'c');
+    ASSERT_TRUE(sharded[1u].has<empty_type>(moved));
+
+    ASSERT_EQ(sharded.migrate(moved, 1u), moved);
+    ASSERT_EQ(sharded[1u].get<int>(moved), 42);
+}
+
+TEST(ShardedRegistry, MigrateRange) {
+    entt::basic_sharded_registry<shard_entity> sharded{3u};
+    std::vector<shard_entity> entities{};
+
+    for(std::size_t pos{}; pos < 9u; ++pos) {
+        const auto entt = entities.emplace_back(sharded.create(pos % 3u));
+        sharded[pos % 3u].emplace<int>(entt, static_cast<int>(pos));
+
+        if(pos % 2u) {
+            sharded[pos % 3u].emplace<char>(entt, 'c');
+        }
+    }
+
+    sharded.migrate(entities.begin(), entities.end(), 1u);
+
+    ASSERT_TRUE(sharded[0u].empty<int>());
+    ASSERT_TRUE(sharded[2u].empty<int>());
+    ASSERT_EQ(sharded[1u].size<int>(), 9u);
+    ASSERT_EQ(sharded[1u].size<char>(), 4u);
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(sharded.shard(entities[pos]), 1u);
+        ASSERT_EQ(sharded[1u].get<int>(entities[pos]), static_cast<int>(pos));
+        ASSERT_EQ(sharded[1u].has<char>(entities[pos]), (pos % 2u) != 0u);
+    }
+}
+
+TEST(ShardedRegistry, ParEach) {
+    entt::basic_sharded_registry<shard_entity> sharded{4u};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entt = sharded.create(pos % 4u);
+        sharded[pos % 4u].emplace<int>(entt, 1);
+
+        if(pos % 5u == 0u) {
+            sharded[pos % 4u].emplace<empty_type>(entt);
+        }
+    }
+
+    std::atomic<int> total{};
+    sharded.par_each<int>(thread_executor{}, [&total](const auto entt, int &value) {
+        total += value;
+        value = static_cast<int>(entt::basic_sharded_registry<shard_entity>::shard(entt));
+    });
+
+    ASSERT_EQ(total, 100);
+
+    for(std::size_t pos{}; pos < sharded.size(); ++pos) {
+        sharded[pos].view<const int>().each([pos](const int value) {
+            ASSERT_EQ(value, static_cast<int>(pos));
+        });
+    }
+
+    total = 0;
+    sharded.par_each<const int>(thread_executor{}, [&total](const int) { ++total; }, entt::exclude<empty_type>);
+
+    ASSERT_EQ(total, 80);
+}
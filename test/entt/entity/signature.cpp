@@ -0,0 +1,149 @@
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_view.hpp>
+#include <entt/entity/signature.hpp>
+
+struct empty_type {};
+
+template<std::size_t>
+struct tag {};
+
+template<std::size_t... Index>
+void track_all(entt::signature_index &index, std::index_sequence<Index...>) {
+    index.track<tag<Index>...>();
+}
+
+TEST(SignatureIndex, Functionalities) {
+    entt::registry registry;
+    const auto e0 = registry.create();
+    registry.emplace<int>(e0);
+
+    entt::signature_index index{registry};
+
+    ASSERT_FALSE(index.tracked(entt::type_hash<int>::value()));
+
+    index.track<int, char>();
+
+    ASSERT_TRUE(index.tracked(entt::type_hash<int>::value()));
+    ASSERT_TRUE(index.tracked(entt::type_hash<char>::value()));
+    ASSERT_FALSE(index.tracked(entt::type_hash<double>::value()));
+
+    const auto e1 = registry.create();
+    registry.emplace<int>(e1);
+    registry.emplace<char>(e1);
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), entt::type_hash<char>::value() };
+
+    ASSERT_TRUE(index.matches(e0, std::begin(types), std::begin(types) + 1u));
+    ASSERT_FALSE(index.matches(e0, std::begin(types), std::end(types)));
+    ASSERT_TRUE(index.matches(e1, std::begin(types), std::end(types)));
+    ASSERT_FALSE(index.matches(e1, std::begin(types), std::begin(types) + 1u, std::begin(types) + 1u, std::end(types)));
+
+    ASSERT_EQ(index.count(std::begin(types), std::begin(types) + 1u), 2u);
+    ASSERT_EQ(index.count(std::begin(types), std::end(types)), 1u);
+    ASSERT_EQ(index.count(std::begin(types), std::begin(types) + 1u, std::begin(types) + 1u, std::end(types)), 1u);
+
+    registry.remove<char>(e1);
+
+    ASSERT_EQ(index.count(std::begin(types), std::end(types)), 0u);
+
+    registry.destroy(e0);
+
+    ASSERT_EQ(index.count(std::begin(types), std::begin(types) + 1u), 1u);
+    ASSERT_FALSE(index.matches(e0, std::begin(types), std::begin(types) + 1u));
+}
+
+TEST(SignatureIndex, RuntimeView) {
+    entt::registry registry;
+    entt::signature_index index{registry};
+    entt::entity entities[4u];
+
+    index.track<int, char, empty_type>();
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.insert<char>(std::begin(entities), std::begin(entities) + 3u);
+    registry.emplace<empty_type>(entities[1u]);
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), entt::type_hash<char>::value() };
+    entt::id_type filter[] = { entt::type_hash<empty_type>::value() };
+
+    const auto view = index.runtime_view(std::begin(types), std::end(types), std::begin(filter), std::end(filter));
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_TRUE(view.contains(entities[0u]));
+    ASSERT_FALSE(view.contains(entities[1u]));
+    ASSERT_TRUE(view.contains(entities[2u]));
+    ASSERT_FALSE(view.contains(entities[3u]));
+
+    view.each([&](const auto entity) {
+        ASSERT_TRUE(entity == entities[0u] || entity == entities[2u]);
+    });
+
+    registry.remove<empty_type>(entities[1u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+    ASSERT_TRUE(view.contains(entities[1u]));
+}
+
+TEST(SignatureIndex, Fallback) {
+    entt::registry registry;
+    entt::signature_index index{registry};
+    const auto entity = registry.create();
+
+    index.track<int>();
+    registry.emplace<int>(entity);
+    registry.emplace<double>(entity);
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), entt::type_hash<double>::value() };
+    const auto view = index.runtime_view(std::begin(types), std::end(types));
+
+    ASSERT_EQ(index.count(std::begin(types), std::end(types)), 1u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_TRUE(view.contains(entity));
+}
+
+TEST(SignatureIndex, ManyTypes) {
+    entt::registry registry;
+    entt::signature_index index{registry};
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<tag<3u>>(entity);
+    index.track<int>();
+
+    track_all(index, std::make_index_sequence<100u>{});
+    registry.emplace<tag<99u>>(entity);
+
+    entt::id_type types[] = { entt::type_hash<int>::value(), entt::type_hash<tag<3u>>::value(), entt::type_hash<tag<99u>>::value(), entt::type_hash<tag<42u>>::value() };
+
+    ASSERT_TRUE(index.matches(entity, std::begin(types), std::begin(types) + 3u));
+    ASSERT_FALSE(index.matches(entity, std::begin(types), std::end(types)));
+    ASSERT_EQ(index.count(std::begin(types), std::begin(types) + 3u), 1u);
+}
+
+TEST(SignatureIndex, GrowthAfterRuntimeView) {
+    entt::registry registry;
+    entt::signature_index index{registry};
+    entt::entity entities[2u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+    registry.emplace<char>(entities[1u]);
+    index.track<int, char>();
+
+    entt::id_type types[] = { entt::type_hash<int>::value() };
+    entt::id_type filter[] = { entt::type_hash<char>::value() };
+    const auto view = index.runtime_view(std::begin(types), std::end(types), std::begin(filter), std::end(filter));
+
+    track_all(index, std::make_index_sequence<100u>{});
+    registry.emplace<tag<99u>>(entities[0u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_TRUE(view.contains(entities[0u]));
+    ASSERT_FALSE(view.contains(entities[1u]));
+}
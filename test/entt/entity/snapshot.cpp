@@ -1,9 +1,12 @@
+#include <functional>
 #include <map>
+#include <sstream>
 #include <tuple>
 #include <queue>
 #include <vector>
 #include <type_traits>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/snapshot.hpp>
 #include <entt/entity/entity.hpp>
@@ -260,6 +263,227 @@ TEST(Snapshot, Iterator) {
     });
 }
 
+TEST(Snapshot, BinaryArchive) {
+    entt::registry registry;
+    std::vector<char> buffer;
+
+    const auto e0 = registry.create();
+    registry.emplace<int>(e0, 42);
+    registry.emplace<char>(e0, 'c');
+    registry.emplace<double>(e0, .5);
+    registry.emplace<another_component>(e0, 1, 2);
+
+    const auto e1 = registry.create();
+    registry.emplace<a_component>(e1);
+
+    const auto e2 = registry.create();
+    registry.emplace<int>(e2, 3);
+    registry.emplace<a_component>(e2);
+
+    registry.destroy(e1);
+    const auto v1 = registry.current(e1);
+
+    entt::binary_output_archive output{buffer};
+    entt::snapshot{registry}.entities(output).component<int, char, double, a_component, another_component>(output);
+    registry.clear();
+
+    entt::binary_input_archive input{buffer.data(), buffer.size()};
+    entt::snapshot_loader{registry}.entities(input).component<int, char, double, a_component, another_component>(input).orphans();
+
+    ASSERT_EQ(input.remaining(), 0u);
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_TRUE(registry.valid(e2));
+    ASSERT_EQ(registry.current(e1), v1);
+
+    ASSERT_EQ(registry.get<int>(e0), 42);
+    ASSERT_EQ(registry.get<char>(e0), 'c');
+    ASSERT_EQ(registry.get<double>(e0), .5);
+    ASSERT_EQ(registry.get<another_component>(e0).key, 1);
+    ASSERT_EQ(registry.get<another_component>(e0).value, 2);
+    ASSERT_EQ(registry.get<int>(e2), 3);
+    ASSERT_TRUE(registry.has<a_component>(e2));
+    ASSERT_EQ(registry.size<another_component>(), 1u);
+
+    const auto view = registry.view<a_component>();
+    buffer.clear();
+    output = entt::binary_output_archive{buffer};
+    entt::snapshot{registry}.component<int>(output, view.begin(), view.end());
+
+    entt::registry other;
+    entt::continuous_loader loader{other};
+    input = entt::binary_input_archive{buffer.data(), buffer.size()};
+    loader.component<int>(input);
+
+    ASSERT_EQ(input.remaining(), 0u);
+    ASSERT_EQ(other.size<int>(), 1u);
+    ASSERT_TRUE(loader.contains(e2));
+    ASSERT_EQ(other.get<int>(loader.map(e2)), 3);
+}
+
+TEST(Snapshot, StreamArchive) {
+    entt::registry registry;
+    std::stringstream stream;
+
+    for(auto i = 0; i < 1000; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<another_component>(entity, i % 3, 42);
+
+        if(i % 2) {
+            registry.emplace<a_component>(entity);
+        }
+    }
+
+    const auto e0 = registry.data<another_component>()[0u];
+    const auto e1 = registry.data<another_component>()[1u];
+    registry.destroy(e1);
+    const auto v1 = registry.current(e1);
+
+    {
+        entt::stream_output_archive output{stream, 64u};
+        entt::snapshot{registry}.entities(output).component<a_component, another_component>(output);
+    }
+
+    std::vector<char> buffer;
+    entt::binary_output_archive binary{buffer};
+    entt::snapshot{registry}.entities(binary).component<a_component, another_component>(binary);
+
+    ASSERT_LT(stream.str().size(), buffer.size() / 2u);
+
+    registry.clear();
+
+    entt::stream_input_archive input{stream, 64u};
+    entt::snapshot_loader{registry}.entities(input).component<a_component, another_component>(input).orphans();
+
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_EQ(registry.current(e1), v1);
+    ASSERT_EQ(registry.size<another_component>(), 999u);
+    ASSERT_EQ(registry.size<a_component>(), 499u);
+
+    registry.view<another_component>().each([](const auto entity, const auto &instance) {
+        ASSERT_EQ(instance.key, static_cast<int>(entt::to_integral(entity) % 3u));
+        ASSERT_EQ(instance.value, 42);
+    });
+}
+
+TEST(Snapshot, Parallel) {
+    entt::registry registry;
+    entt::thread_pool pool{2u};
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, i);
+
+        if(i % 2) {
+            registry.emplace<a_component>(entity);
+        } else {
+            registry.emplace<double>(entity, i / 2.);
+        }
+    }
+
+    std::vector<char> buffer[4u];
+    entt::binary_output_archive entities{buffer[0u]};
+    entt::binary_output_archive first{buffer[1u]};
+    entt::binary_output_archive second{buffer[2u]};
+    entt::binary_output_archive third{buffer[3u]};
+
+    entt::snapshot{registry}
+        .entities(entities)
+        .par_component<int, a_component, double>(std::ref(pool), first, second, third);
+
+    entt::registry other;
+    entt::binary_input_archive input[4u]{
+        {buffer[0u].data(), buffer[0u].size()},
+        {buffer[1u].data(), buffer[1u].size()},
+        {buffer[2u].data(), buffer[2u].size()},
+        {buffer[3u].data(), buffer[3u].size()}
+    };
+
+    entt::snapshot_loader{other}
+        .entities(input[0u])
+        .component<int>(input[1u])
+        .component<a_component>(input[2u])
+        .component<double>(input[3u]);
+
+    ASSERT_EQ(other.size<int>(), 100u);
+    ASSERT_EQ(other.size<a_component>(), 50u);
+    ASSERT_EQ(other.size<double>(), 50u);
+
+    registry.view<int>().each([&other](const auto entity, const auto value) {
+        ASSERT_EQ(other.get<int>(entity), value);
+        ASSERT_EQ(other.has<a_component>(entity), (value % 2) != 0);
+
+        if(!(value % 2)) {
+            ASSERT_EQ(other.get<double>(entity), value / 2.);
+        }
+    });
+}
+
+TEST(Snapshot, Delta) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+
+    entt::delta_snapshot delta{src};
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>,
+        std::queue<int>,
+        std::queue<what_a_component>
+    >;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const auto untracked = src.create();
+    src.emplace<int>(untracked, 0);
+
+    delta.track<int, what_a_component>();
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+    const auto e2 = src.create();
+
+    src.emplace<int>(e0, 1);
+    src.emplace<int>(e1, 2);
+    src.emplace<what_a_component>(e1, e0);
+    src.emplace<int>(e2, 3);
+    src.remove<int>(e2);
+
+    delta.component<int, what_a_component>(output);
+    delta.checkpoint();
+    loader.patch<int, what_a_component>(input, &what_a_component::bar);
+
+    ASSERT_FALSE(loader.contains(untracked));
+    ASSERT_FALSE(loader.contains(e2));
+    ASSERT_EQ(dst.size<int>(), 2u);
+    ASSERT_EQ(dst.get<int>(loader.map(e0)), 1);
+    ASSERT_EQ(dst.get<int>(loader.map(e1)), 2);
+    ASSERT_EQ(dst.get<what_a_component>(loader.map(e1)).bar, loader.map(e0));
+
+    src.patch<int>(e0, [](auto &value) { value = 42; });
+    src.remove<what_a_component>(e1);
+
+    delta.component<int, what_a_component>(output);
+    delta.checkpoint();
+    loader.patch<int, what_a_component>(input, &what_a_component::bar);
+
+    ASSERT_EQ(dst.size<int>(), 2u);
+    ASSERT_EQ(dst.get<int>(loader.map(e0)), 42);
+    ASSERT_EQ(dst.get<int>(loader.map(e1)), 2);
+    ASSERT_FALSE(dst.has<what_a_component>(loader.map(e1)));
+
+    delta.component<int, what_a_component>(output);
+
+    ASSERT_EQ(std::get<std::queue<typename traits_type::entity_type>>(storage).size(), 4u);
+    ASSERT_TRUE(std::get<std::queue<entt::entity>>(storage).empty());
+}
+
 TEST(Snapshot, Continuous) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -530,6 +754,51 @@ TEST(Snapshot, MoreOnShrink) {
     ASSERT_FALSE(dst.valid(entity));
 }
 
+TEST(Snapshot, ContinuousRecycledEntities) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry src;
+    entt::registry dst;
+
+    entt::continuous_loader loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<typename traits_type::entity_type>,
+        std::queue<entt::entity>,
+        std::queue<int>
+    >;
+
+    storage_type storage;
+    output_archive<storage_type> output{storage};
+    input_archive<storage_type> input{storage};
+
+    const auto entity = src.create();
+    src.emplace<int>(entity, 1);
+
+    entt::snapshot{src}.entities(output).component<int>(output);
+    loader.entities(input).component<int>(input).shrink();
+
+    const auto local = loader.map(entity);
+
+    ASSERT_TRUE(dst.valid(local));
+    ASSERT_EQ(dst.get<int>(local), 1);
+
+    src.destroy(entity);
+    const auto other = src.create();
+    src.emplace<int>(other, 2);
+
+    ASSERT_EQ(entt::to_integral(other) & traits_type::entity_mask, entt::to_integral(entity) & traits_type::entity_mask);
+
+    entt::snapshot{src}.entities(output).component<int>(output);
+    loader.entities(input).component<int>(input).shrink();
+
+    ASSERT_FALSE(loader.contains(entity));
+    ASSERT_TRUE(loader.contains(other));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_EQ(dst.size<int>(), 1u);
+    ASSERT_EQ(dst.get<int>(loader.map(other)), 2);
+}
+
 TEST(Snapshot, SyncDataMembers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
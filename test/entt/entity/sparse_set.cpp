@@ -1,16 +1,54 @@
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <iterator>
 #include <algorithm>
 #include <functional>
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
 #include <entt/entity/fwd.hpp>
 
 struct empty_type {};
 struct boxed_int { int value; };
 
+template<typename Type>
+struct tracked_allocator {
+    using value_type = Type;
+
+    tracked_allocator(std::size_t *ref)
+        : bytes{ref}
+    {}
+
+    template<typename Other>
+    tracked_allocator(const tracked_allocator<Other> &other)
+        : bytes{other.bytes}
+    {}
+
+    Type * allocate(const std::size_t count) {
+        *bytes += count * sizeof(Type);
+        return std::allocator<Type>{}.allocate(count);
+    }
+
+    void deallocate(Type *instance, const std::size_t count) {
+        *bytes -= count * sizeof(Type);
+        std::allocator<Type>{}.deallocate(instance, count);
+    }
+
+    bool operator==(const tracked_allocator &other) const {
+        return bytes == other.bytes;
+    }
+
+    bool operator!=(const tracked_allocator &other) const {
+        return !(*this == other);
+    }
+
+    std::size_t *bytes;
+};
+
 TEST(SparseSet, Functionalities) {
     entt::sparse_set set;
 
@@ -97,6 +135,11 @@ TEST(SparseSet, Pagination) {
     ASSERT_TRUE(set.contains(entt::entity{entt_per_page}));
 
     set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 2 * entt_per_page);
+    ASSERT_EQ(set.memory_usage().pages, 1u);
+    ASSERT_TRUE(set.contains(entt::entity{entt_per_page}));
+
     set.remove(entt::entity{entt_per_page});
 
     ASSERT_EQ(set.extent(), 2 * entt_per_page);
@@ -108,6 +151,197 @@ TEST(SparseSet, Pagination) {
     ASSERT_EQ(set.extent(), 0u);
 }
 
+TEST(SparseSet, MemoryUsage) {
+    entt::sparse_set set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+    ASSERT_EQ(set.memory_usage().bytes(), 0u);
+
+    set.reserve(4u);
+    set.emplace(entt::entity{0});
+    set.emplace(entt::entity{3 * entt_per_page});
+    const auto stats = set.memory_usage();
+
+    ASSERT_EQ(stats.size, 2u);
+    ASSERT_EQ(stats.capacity, set.capacity());
+    ASSERT_EQ(stats.pages, 2u);
+    ASSERT_EQ(stats.slots, 2u * entt_per_page);
+    ASSERT_EQ(stats.null_slots(), 2u * entt_per_page - 2u);
+    ASSERT_EQ(stats.instances, 0u);
+    ASSERT_EQ(stats.packed_bytes, set.capacity() * sizeof(entt::entity));
+    ASSERT_GE(stats.sparse_bytes, 4u * sizeof(entt::entity *) + 2u * ENTT_PAGE_SIZE);
+    ASSERT_EQ(stats.instance_bytes, 0u);
+    ASSERT_EQ(stats.bytes(), stats.sparse_bytes + stats.packed_bytes);
+
+    set.clear();
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.memory_usage().pages, 0u);
+    ASSERT_EQ(set.memory_usage().bytes(), 0u);
+}
+
+TEST(SparseSet, ShrinkToFit) {
+    entt::sparse_set set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+    set.emplace(entt::entity{0});
+    set.emplace(entt::entity{entt_per_page});
+    set.emplace(entt::entity{4 * entt_per_page});
+    set.emplace(entt::entity{9 * entt_per_page});
+
+    ASSERT_EQ(set.extent(), 10 * entt_per_page);
+    ASSERT_EQ(set.memory_usage().pages, 4u);
+
+    set.remove(entt::entity{entt_per_page});
+    set.remove(entt::entity{9 * entt_per_page});
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 5 * entt_per_page);
+    ASSERT_EQ(set.memory_usage().pages, 2u);
+    ASSERT_TRUE(set.contains(entt::entity{0}));
+    ASSERT_FALSE(set.contains(entt::entity{entt_per_page}));
+    ASSERT_TRUE(set.contains(entt::entity{4 * entt_per_page}));
+    ASSERT_FALSE(set.contains(entt::entity{9 * entt_per_page}));
+
+    set.emplace(entt::entity{entt_per_page + 1u});
+
+    ASSERT_TRUE(set.contains(entt::entity{entt_per_page + 1u}));
+    ASSERT_EQ(set.memory_usage().pages, 3u);
+    ASSERT_EQ(set.index(entt::entity{entt_per_page + 1u}), 2u);
+}
+
+TEST(SparseSet, ReserveSparse) {
+    entt::sparse_set set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+    set.reserve_sparse(0u);
+
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.emplace(entt::entity{entt_per_page});
+    set.reserve_sparse(3u * entt_per_page + 1u);
+
+    ASSERT_EQ(set.extent(), 4u * entt_per_page);
+    ASSERT_EQ(set.memory_usage().pages, 4u);
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_TRUE(set.contains(entt::entity{entt_per_page}));
+    ASSERT_FALSE(set.contains(entt::entity{3u * entt_per_page}));
+
+    set.reserve_sparse(entt_per_page);
+
+    ASSERT_EQ(set.extent(), 4u * entt_per_page);
+
+    set.emplace(entt::entity{3u * entt_per_page});
+
+    ASSERT_EQ(set.memory_usage().pages, 4u);
+
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.memory_usage().pages, 2u);
+}
+
+TEST(SparseSet, Reset) {
+    entt::sparse_set set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+    constexpr auto epochs = entt::entt_traits<entt::entity>::version_mask + 2u;
+
+    set.emplace(entt::entity{entt_per_page});
+    set.emplace(entt::entity{3});
+
+    for(std::size_t next{}; next < epochs; ++next) {
+        set.reset();
+
+        ASSERT_TRUE(set.empty());
+        ASSERT_FALSE(set.contains(entt::entity{entt_per_page}));
+        ASSERT_FALSE(set.contains(entt::entity{3}));
+
+        set.emplace(entt::entity{3});
+
+        ASSERT_TRUE(set.contains(entt::entity{3}));
+        ASSERT_FALSE(set.contains(entt::entity{entt_per_page}));
+        ASSERT_EQ(set.index(entt::entity{3}), 0u);
+
+        set.emplace(entt::entity{entt_per_page});
+        set.remove(entt::entity{3});
+
+        ASSERT_FALSE(set.contains(entt::entity{3}));
+        ASSERT_EQ(set.index(entt::entity{entt_per_page}), 0u);
+    }
+
+    ASSERT_EQ(set.memory_usage().pages, 2u);
+
+    set.sort(std::less{});
+    set.reset();
+    set.emplace(entt::entity{2});
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_TRUE(set.contains(entt::entity{2}));
+    ASSERT_FALSE(set.contains(entt::entity{entt_per_page}));
+
+    set.clear();
+
+    ASSERT_EQ(set.memory_usage().pages, 0u);
+}
+
+TEST(SparseSet, Hashed) {
+    entt::sparse_set set;
+    const entt::entity entities[3u]{entt::entity{1000000}, entt::entity{3}, entt::entity{900000}};
+
+    set.emplace(entities[0u]);
+    set.hashed(true);
+
+    ASSERT_TRUE(set.hashed());
+    ASSERT_TRUE(set.contains(entities[0u]));
+    ASSERT_EQ(set.memory_usage().pages, 0u);
+
+    set.insert(std::begin(entities) + 1u, std::end(entities));
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.index(entities[2u]), 2u);
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+    ASSERT_FALSE(set.contains(entt::entity{4}));
+    ASSERT_FALSE(set.contains(entt::entity{1000001}));
+
+    for(std::uint32_t next{}; next < 1000u; ++next) {
+        set.emplace(entt::entity{500000u + next * 512u});
+    }
+
+    ASSERT_EQ(set.size(), 1003u);
+    ASSERT_LT(set.memory_usage().sparse_bytes, 1003u * 4u * 4u * sizeof(entt::entity));
+
+    for(std::uint32_t next{}; next < 1000u; next += 2u) {
+        set.remove(entt::entity{500000u + next * 512u});
+    }
+
+    ASSERT_EQ(set.size(), 503u);
+    ASSERT_FALSE(set.contains(entt::entity{500000u}));
+    ASSERT_TRUE(set.contains(entt::entity{500000u + 512u}));
+    ASSERT_EQ(set.index(entities[1u]), 1u);
+
+    set.swap(entities[0u], entities[2u]);
+    set.remove(entities[1u]);
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(entities[0u]));
+
+    set.emplace(entities[1u]);
+
+    ASSERT_TRUE(set.contains(entities[1u]));
+    ASSERT_EQ(set.index(entities[1u]), 0u);
+
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 8u);
+    ASSERT_TRUE(set.contains(entities[1u]));
+
+    set.hashed(false);
+
+    ASSERT_FALSE(set.hashed());
+    ASSERT_TRUE(set.contains(entities[1u]));
+    ASSERT_EQ(set.memory_usage().pages, 1u);
+}
+
 TEST(SparseSet, Insert) {
     entt::sparse_set set;
     entt::entity entities[2];
@@ -171,6 +405,42 @@ TEST(SparseSet, Remove) {
     ASSERT_EQ(*set.begin(), entt::entity{42});
 }
 
+TEST(SparseSet, RemoveCompact) {
+    entt::sparse_set set;
+    entt::entity entities[6u];
+
+    for(std::size_t pos{}; pos < 6u; ++pos) {
+        entities[pos] = entt::entity(pos * 3u);
+    }
+
+    for(auto hashed: { false, true }) {
+        set.clear();
+        set.hashed(hashed);
+        set.insert(std::begin(entities), std::end(entities));
+
+        const entt::entity doomed[3u]{entities[4u], entities[0u], entities[1u]};
+        set.remove(std::begin(doomed), std::end(doomed));
+
+        ASSERT_EQ(set.size(), 3u);
+        ASSERT_FALSE(set.contains(entities[0u]));
+        ASSERT_FALSE(set.contains(entities[1u]));
+        ASSERT_FALSE(set.contains(entities[4u]));
+
+        // the entities left keep their relative order
+        ASSERT_EQ(set.data()[0u], entities[2u]);
+        ASSERT_EQ(set.data()[1u], entities[3u]);
+        ASSERT_EQ(set.data()[2u], entities[5u]);
+
+        ASSERT_EQ(set.index(entities[2u]), 0u);
+        ASSERT_EQ(set.index(entities[3u]), 1u);
+        ASSERT_EQ(set.index(entities[5u]), 2u);
+
+        set.emplace(entities[0u]);
+
+        ASSERT_EQ(set.index(entities[0u]), 3u);
+    }
+}
+
 TEST(SparseSet, Iterator) {
     using iterator = typename entt::sparse_set::iterator;
 
@@ -296,6 +566,52 @@ TEST(SparseSet, Data) {
     ASSERT_EQ(set.data()[2u], entt::entity{42});
 }
 
+TEST(SparseSet, Chunks) {
+    entt::sparse_set set;
+
+    ASSERT_EQ(set.chunks().size(), 0u);
+    ASSERT_EQ(set.chunks().begin(), set.chunks().end());
+
+    for(auto next = 0; next < 10; ++next) {
+        set.emplace(entt::entity(next));
+    }
+
+    auto chunks = set.chunks(4u);
+    std::size_t cnt{};
+
+    ASSERT_EQ(chunks.size(), 3u);
+    ASSERT_EQ(std::get<1>(chunks[0u]), 4u);
+    ASSERT_EQ(std::get<1>(chunks[2u]), 2u);
+
+    for(auto [first, count]: chunks) {
+        ASSERT_EQ(first, set.data() + cnt);
+        cnt += count;
+    }
+
+    ASSERT_EQ(cnt, set.size());
+    ASSERT_EQ(set.chunks().size(), 1u);
+    ASSERT_EQ(std::get<1>(set.chunks()[0u]), set.size());
+}
+
+TEST(SparseSet, BatchContains) {
+    entt::sparse_set set;
+    entt::entity batch[4u]{entt::entity{3}, entt::entity{42}, entt::entity{0}, entt::entity{99999}};
+
+    set.emplace(entt::entity{3});
+    set.emplace(entt::entity{0});
+    set.emplace(entt::entity{99999});
+
+    ASSERT_EQ(set.contains(batch, 0b1111u), 0b1101u);
+    ASSERT_EQ(set.contains(batch, 0b0011u), 0b0001u);
+    ASSERT_EQ(set.contains(batch, 0b1010u), 0b1000u);
+    ASSERT_EQ(set.contains(batch, 0u), 0u);
+
+    set.remove(entt::entity{3});
+
+    ASSERT_EQ(set.contains(batch, 0b1111u), 0b1100u);
+    ASSERT_EQ(entt::sparse_set{}.contains(batch, 0b1111u), 0u);
+}
+
 TEST(SparseSet, SortOrdered) {
     entt::sparse_set set;
     entt::entity entities[5u]{entt::entity{42}, entt::entity{12}, entt::entity{9}, entt::entity{7}, entt::entity{3}};
@@ -472,6 +788,57 @@ TEST(SparseSet, RespectUnordered) {
     ASSERT_EQ(begin, end);
 }
 
+TEST(SparseSet, RespectSmaller) {
+    entt::sparse_set lhs;
+    entt::sparse_set rhs;
+
+    entt::entity lhs_entities[4u]{entt::entity{7}, entt::entity{2}, entt::entity{5}, entt::entity{3}};
+    lhs.insert(std::begin(lhs_entities), std::end(lhs_entities));
+
+    entt::entity rhs_entities[6u]{entt::entity{1}, entt::entity{2}, entt::entity{3}, entt::entity{4}, entt::entity{5}, entt::entity{6}};
+    rhs.insert(std::begin(rhs_entities), std::end(rhs_entities));
+
+    lhs.respect(rhs);
+
+    auto begin = lhs.begin();
+    auto end = lhs.end();
+
+    ASSERT_EQ(*(begin++), entt::entity{5});
+    ASSERT_EQ(*(begin++), entt::entity{3});
+    ASSERT_EQ(*(begin++), entt::entity{2});
+    ASSERT_EQ(*(begin++), entt::entity{7});
+    ASSERT_EQ(begin, end);
+
+    ASSERT_TRUE(std::equal(std::rbegin(rhs_entities), std::rend(rhs_entities), rhs.begin(), rhs.end()));
+}
+
+TEST(SparseSet, Remap) {
+    entt::sparse_set set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+    std::vector<entt::entity> table(4u * entt_per_page, entt::entity{entt::null});
+
+    set.emplace(entt::entity{3u * entt_per_page});
+    set.emplace(entt::entity{1});
+    set.emplace(entt::entity{2u * entt_per_page});
+
+    ASSERT_EQ(set.extent(), 4u * entt_per_page);
+
+    table[3u * entt_per_page] = entt::entity{0};
+    table[1u] = entt::entity{2};
+    table[2u * entt_per_page] = entt::entity{1};
+
+    set.remap(table.data());
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.extent(), entt_per_page);
+    ASSERT_EQ(set.data()[0u], entt::entity{0});
+    ASSERT_EQ(set.data()[1u], entt::entity{2});
+    ASSERT_EQ(set.data()[2u], entt::entity{1});
+    ASSERT_EQ(set.index(entt::entity{2}), 1u);
+    ASSERT_FALSE(set.contains(entt::entity{3u * entt_per_page}));
+    ASSERT_FALSE(set.contains(entt::entity{2u * entt_per_page}));
+}
+
 TEST(SparseSet, CanModifyDuringIteration) {
     entt::sparse_set set;
     set.emplace(entt::entity{0});
@@ -487,3 +854,79 @@ TEST(SparseSet, CanModifyDuringIteration) {
     const auto entity = *it;
     (void)entity;
 }
+
+TEST(SparseSet, CustomAllocator) {
+    std::size_t bytes{};
+
+    {
+        entt::basic_sparse_set<entt::entity, tracked_allocator<entt::entity>> set{tracked_allocator<entt::entity>{&bytes}};
+
+        ASSERT_EQ(set.get_allocator(), tracked_allocator<entt::entity>{&bytes});
+        ASSERT_EQ(bytes, 0u);
+
+        set.emplace(entt::entity{42});
+        set.emplace(entt::entity{3});
+
+        const auto used = bytes;
+
+        ASSERT_GT(used, 0u);
+        ASSERT_TRUE(set.contains(entt::entity{42}));
+        ASSERT_TRUE(set.contains(entt::entity{3}));
+
+        decltype(set) other{std::move(set)};
+
+        ASSERT_EQ(bytes, used);
+        ASSERT_TRUE(other.contains(entt::entity{42}));
+
+        set = std::move(other);
+
+        ASSERT_EQ(bytes, used);
+        ASSERT_TRUE(set.contains(entt::entity{3}));
+
+        set.clear();
+        set.shrink_to_fit();
+
+        ASSERT_EQ(bytes, 0u);
+
+        set.emplace(entt::entity{42});
+
+        ASSERT_GT(bytes, 0u);
+    }
+
+    ASSERT_EQ(bytes, 0u);
+}
+
+TEST(SparseSet, ForeignAllocator) {
+    std::size_t bytes{};
+
+    {
+        entt::sparse_set set{std::allocator_arg, tracked_allocator<int>{&bytes}};
+        const auto adaptor = bytes;
+
+        ASSERT_NE(adaptor, 0u);
+        ASSERT_NE(set.get_allocator(), entt::sparse_set::allocator_type{});
+
+        set.emplace(entt::entity{42});
+
+        ASSERT_GT(bytes, adaptor);
+
+        entt::sparse_set other{std::move(set)};
+
+        ASSERT_TRUE(other.contains(entt::entity{42}));
+
+        other.clear();
+        other.shrink_to_fit();
+
+        ASSERT_EQ(bytes, adaptor);
+    }
+
+    ASSERT_EQ(bytes, 0u);
+
+    entt::sparse_set lhs{std::allocator_arg, std::allocator<int>{}};
+    entt::sparse_set rhs{};
+
+    lhs.emplace(entt::entity{3});
+    rhs = std::move(lhs);
+
+    ASSERT_TRUE(rhs.contains(entt::entity{3}));
+}
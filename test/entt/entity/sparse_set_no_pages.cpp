@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/sparse_set.hpp>
+
+TEST(SparseSet, NoPages) {
+    entt::sparse_set set;
+
+    ASSERT_EQ(set.extent(), 0u);
+    ASSERT_FALSE(set.contains(entt::entity{42}));
+    ASSERT_NE(entt::sparse_set::chunk_size, 0u);
+
+    set.emplace(entt::entity{42});
+
+    ASSERT_EQ(set.extent(), 43u);
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_FALSE(set.contains(entt::entity{41}));
+    ASSERT_FALSE(set.contains(entt::entity{43}));
+
+    set.emplace(entt::entity{3});
+
+    ASSERT_EQ(set.extent(), 43u);
+    ASSERT_EQ(set.index(entt::entity{42}), 0u);
+    ASSERT_EQ(set.index(entt::entity{3}), 1u);
+
+    set.swap(entt::entity{42}, entt::entity{3});
+
+    ASSERT_EQ(set.index(entt::entity{42}), 1u);
+    ASSERT_EQ(set.index(entt::entity{3}), 0u);
+
+    set.remove(entt::entity{3});
+
+    ASSERT_FALSE(set.contains(entt::entity{3}));
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_EQ(set.index(entt::entity{42}), 0u);
+
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 43u);
+
+    set.remove(entt::entity{42});
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.emplace(entt::entity{3});
+    set.emplace(entt::entity{42});
+    set.remove(entt::entity{42});
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.extent(), 4u);
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+    ASSERT_FALSE(set.contains(entt::entity{42}));
+}
+
+TEST(SparseSet, NoPagesReserveSparse) {
+    entt::sparse_set set;
+
+    set.reserve_sparse(100u);
+
+    ASSERT_EQ(set.extent(), 100u);
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(entt::entity{99}));
+
+    set.emplace(entt::entity{99});
+    set.reserve_sparse(10u);
+
+    ASSERT_EQ(set.extent(), 100u);
+    ASSERT_TRUE(set.contains(entt::entity{99}));
+}
+
+TEST(SparseSet, NoPagesReset) {
+    entt::sparse_set set;
+    constexpr auto epochs = entt::entt_traits<entt::entity>::version_mask + 2u;
+
+    for(std::uint32_t next{}; next < epochs; ++next) {
+        set.emplace(entt::entity{next % 7u});
+        set.emplace(entt::entity{7});
+
+        ASSERT_EQ(set.index(entt::entity{7}), 1u);
+
+        set.reset();
+
+        ASSERT_TRUE(set.empty());
+        ASSERT_FALSE(set.contains(entt::entity{next % 7u}));
+        ASSERT_FALSE(set.contains(entt::entity{7}));
+    }
+
+    ASSERT_EQ(set.extent(), 8u);
+}
+
+TEST(Registry, NoPages) {
+    entt::registry registry;
+
+    for(auto next = 0; next < 100; ++next) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, next);
+
+        if(next % 2) {
+            registry.emplace<char>(entity);
+        }
+    }
+
+    registry.sort<int>([](const int lhs, const int rhs) { return lhs > rhs; });
+
+    std::size_t count{};
+
+    registry.view<int, char>().each([&count](const auto entity, const int value, char) {
+        ASSERT_EQ(entt::to_integral(entity), value);
+        ASSERT_TRUE(value % 2);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 50u);
+
+    registry.destroy(entt::entity{4});
+
+    ASSERT_FALSE(registry.valid(entt::entity{4}));
+    ASSERT_EQ(registry.size<int>(), 99u);
+}
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/spatial.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/view.hpp>
+
+struct position {
+    float x;
+    float y;
+};
+
+struct point {
+    int x;
+    int y;
+    int z;
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, position> {
+    using storage_type = entt::sigh_storage_mixin<entt::spatial_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, position>>, &position::x, &position::y>>;
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, point> {
+    using storage_type = entt::spatial_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, point>>, &point::x, &point::y, &point::z>;
+};
+
+template<typename Storage>
+std::vector<entt::entity> aabb(const Storage &storage, const typename Storage::point_type &min, const typename Storage::point_type &max) {
+    std::vector<entt::entity> found{};
+    storage.query_aabb(min, max, std::back_inserter(found));
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+template<typename Storage>
+std::vector<entt::entity> radius(const Storage &storage, const typename Storage::point_type &center, const typename Storage::coord_type value) {
+    std::vector<entt::entity> found{};
+    storage.query_radius(center, value, std::back_inserter(found));
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+TEST(SpatialStorage, Functionalities) {
+    entt::registry registry;
+    auto &&storage = registry.view<position>().storage();
+    entt::entity entities[4u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<position>(entities[0u], .5f, .5f);
+    registry.emplace<position>(entities[1u], 2.5f, 2.5f);
+    registry.emplace<position>(entities[2u], -3.f, 1.f);
+    registry.emplace<position>(entities[3u], 10.f, 10.f);
+
+    ASSERT_EQ(storage.cell_size(), 1.f);
+    ASSERT_EQ(aabb(storage, {0.f, 0.f}, {3.f, 3.f}), (std::vector{entities[0u], entities[1u]}));
+    ASSERT_EQ(aabb(storage, {-3.f, 1.f}, {-3.f, 1.f}), (std::vector{entities[2u]}));
+    ASSERT_TRUE(aabb(storage, {3.f, 3.f}, {0.f, 0.f}).empty());
+    ASSERT_EQ(radius(storage, {0.f, 0.f}, 3.2f), (std::vector{entities[0u], entities[2u]}));
+    ASSERT_EQ(radius(storage, {0.f, 0.f}, 3.6f), (std::vector{entities[0u], entities[1u], entities[2u]}));
+
+    registry.patch<position>(entities[3u], [](auto &pos) { pos.x = pos.y = 1.f; });
+    registry.replace<position>(entities[2u], 100.f, 100.f);
+
+    ASSERT_EQ(aabb(storage, {0.f, 0.f}, {3.f, 3.f}), (std::vector{entities[0u], entities[1u], entities[3u]}));
+    ASSERT_EQ(radius(storage, {100.f, 100.f}, 0.f), (std::vector{entities[2u]}));
+
+    registry.remove<position>(entities[0u]);
+    registry.destroy(entities[1u]);
+
+    ASSERT_EQ(aabb(storage, {0.f, 0.f}, {3.f, 3.f}), (std::vector{entities[3u]}));
+
+    storage.cell_size(50.f);
+
+    ASSERT_EQ(storage.cell_size(), 50.f);
+    ASSERT_EQ(aabb(storage, {-200.f, -200.f}, {200.f, 200.f}), (std::vector{entities[2u], entities[3u]}));
+    ASSERT_EQ(radius(storage, {0.f, 0.f}, 2.f), (std::vector{entities[3u]}));
+
+    registry.clear<position>();
+
+    ASSERT_TRUE(aabb(storage, {-200.f, -200.f}, {200.f, 200.f}).empty());
+}
+
+TEST(SpatialStorage, Insert) {
+    entt::registry registry;
+    auto &&storage = registry.view<point>().storage();
+    std::vector<entt::entity> entities(8u);
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert(entities.begin(), entities.begin() + 4u, point{1, 1, 1});
+    registry.insert(entities.begin() + 4u, entities.end(), point{-1, -1, -1});
+
+    ASSERT_EQ(aabb(storage, {0, 0, 0}, {2, 2, 2}), (std::vector<entt::entity>{entities.begin(), entities.begin() + 4u}));
+    ASSERT_EQ(radius(storage, {0, 0, 0}, 2), entities);
+
+    registry.remove<point>(entities.begin() + 2u, entities.begin() + 6u);
+
+    ASSERT_EQ(radius(storage, {0, 0, 0}, 2), (std::vector{entities[0u], entities[1u], entities[6u], entities[7u]}));
+}
+
+TEST(SpatialStorage, Compact) {
+    entt::registry registry;
+    auto &&storage = registry.view<position>().storage();
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<position>(entities[1u], .5f, .5f);
+    registry.emplace<position>(entities[2u], 5.5f, 5.5f);
+    registry.destroy(entities[0u]);
+    registry.compact();
+
+    const auto found = aabb(storage, {0.f, 0.f}, {1.f, 1.f});
+
+    ASSERT_EQ(found.size(), 1u);
+    ASSERT_TRUE(registry.valid(found[0u]));
+    ASSERT_EQ(registry.get<position>(found[0u]).x, .5f);
+
+    registry.remove<position>(found[0u]);
+
+    ASSERT_TRUE(aabb(storage, {0.f, 0.f}, {1.f, 1.f}).empty());
+    ASSERT_EQ(aabb(storage, {0.f, 0.f}, {10.f, 10.f}).size(), 1u);
+}
+
+TEST(SpatialStorage, Boundaries) {
+    entt::registry registry;
+    auto &&storage = registry.view<position>().storage();
+    const auto nan = std::numeric_limits<float>::quiet_NaN();
+    const auto inf = std::numeric_limits<float>::infinity();
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<position>(entities[0u], 1.f, 1.f);
+    registry.emplace<position>(entities[1u], 1e30f, -1e30f);
+    registry.emplace<position>(entities[2u], nan, 0.f);
+
+    ASSERT_EQ(aabb(storage, {-inf, -inf}, {inf, inf}), (std::vector{entities[0u], entities[1u]}));
+    ASSERT_EQ(aabb(storage, {0.f, -inf}, {inf, 0.f}), (std::vector{entities[1u]}));
+    ASSERT_TRUE(aabb(storage, {nan, 0.f}, {2.f, 2.f}).empty());
+    ASSERT_EQ(radius(storage, {1.f, 1.f}, 1e6f), (std::vector{entities[0u]}));
+
+    registry.remove<position>(entities[2u]);
+
+    ASSERT_EQ(storage.size(), 2u);
+}
+
+struct construct_listener {
+    void query(entt::registry &registry, const entt::entity entity) {
+        const auto &instance = registry.get<position>(entity);
+        found = aabb(registry.view<position>().storage(), {instance.x, instance.y}, {instance.x, instance.y});
+    }
+
+    std::vector<entt::entity> found{};
+};
+
+TEST(SpatialStorage, Signals) {
+    entt::registry registry;
+    construct_listener listener{};
+    registry.on_construct<position>().connect<&construct_listener::query>(listener);
+
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 3.f, 4.f);
+
+    ASSERT_EQ(listener.found, (std::vector{entity}));
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/spawner.hpp>
+
+TEST(Spawner, Functionalities) {
+    entt::registry registry;
+    entt::spawner spawner{registry};
+
+    ASSERT_EQ(spawner.size(), 0u);
+    ASSERT_EQ(spawner.create(), entt::entity{entt::null});
+
+    registry.destroy(registry.create());
+    spawner.reserve(3u);
+
+    ASSERT_EQ(spawner.size(), 3u);
+    ASSERT_EQ(registry.alive(), 3u);
+
+    const auto entity = spawner.create();
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.version(entity), 1u);
+    ASSERT_EQ(spawner.size(), 2u);
+
+    spawner.reserve(2u);
+
+    ASSERT_EQ(spawner.size(), 2u);
+    ASSERT_EQ(registry.alive(), 3u);
+
+    spawner.release();
+
+    ASSERT_EQ(spawner.size(), 0u);
+    ASSERT_EQ(registry.alive(), 1u);
+    ASSERT_TRUE(registry.valid(entity));
+}
+
+TEST(Spawner, Range) {
+    entt::registry registry;
+    entt::spawner spawner{registry};
+    entt::entity entities[3u];
+
+    spawner.reserve(4u);
+
+    ASSERT_EQ(spawner.create(std::begin(entities), std::end(entities)), std::end(entities));
+    ASSERT_EQ(spawner.size(), 1u);
+    ASSERT_EQ(spawner.create(std::begin(entities), std::end(entities)), std::begin(entities) + 1);
+    ASSERT_EQ(spawner.size(), 0u);
+    ASSERT_EQ(spawner.create(std::begin(entities), std::end(entities)), std::begin(entities));
+
+    ASSERT_TRUE(std::all_of(std::begin(entities), std::end(entities), [&registry](auto entity) { return registry.valid(entity); }));
+}
+
+TEST(Spawner, Destruction) {
+    entt::registry registry;
+
+    {
+        entt::spawner spawner{registry};
+        spawner.reserve(4u);
+        static_cast<void>(spawner.create());
+    }
+
+    ASSERT_EQ(registry.alive(), 1u);
+}
+
+TEST(Spawner, Concurrent) {
+    entt::registry registry;
+    entt::spawner spawner{registry};
+    std::vector<entt::entity> created[4u];
+    std::vector<std::thread> workers;
+
+    spawner.reserve(4000u);
+
+    for(auto &&curr: created) {
+        workers.emplace_back([&spawner, &curr]() {
+            for(auto entity = spawner.create(); entity != entt::null; entity = spawner.create()) {
+                curr.push_back(entity);
+            }
+        });
+    }
+
+    for(auto &&worker: workers) {
+        worker.join();
+    }
+
+    std::vector<entt::entity> all;
+
+    for(auto &&curr: created) {
+        all.insert(all.end(), curr.cbegin(), curr.cend());
+    }
+
+    std::sort(all.begin(), all.end());
+
+    ASSERT_EQ(all.size(), 4000u);
+    ASSERT_EQ(std::adjacent_find(all.cbegin(), all.cend()), all.cend());
+    ASSERT_TRUE(std::all_of(all.cbegin(), all.cend(), [&registry](auto entity) { return registry.valid(entity); }));
+}
@@ -0,0 +1,127 @@
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/stage.hpp>
+#include <entt/entity/storage.hpp>
+
+struct ticked_type {
+    int value{};
+};
+
+template<typename Entity>
+struct entt::storage_traits<Entity, ticked_type> {
+    using storage_type = entt::tick_storage_mixin<entt::sigh_storage_mixin<entt::storage_adapter_mixin<entt::basic_storage<Entity, ticked_type>>>>;
+};
+
+TEST(Stage, Contiguous) {
+    entt::registry registry;
+    entt::entity entities[4u];
+    int buffer[4u]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto pos = 0u; pos < 4u; ++pos) {
+        registry.emplace<int>(entities[pos], static_cast<int>(pos));
+        registry.emplace<char>(entities[pos], static_cast<char>('a' + pos));
+    }
+
+    ASSERT_EQ(entt::stage<int>(registry.view<int>(), buffer), 4u);
+
+    for(auto pos = 0u; pos < 4u; ++pos) {
+        ASSERT_EQ(buffer[pos], registry.get<int>(registry.view<int>().data()[pos]));
+    }
+
+    registry.get<int>(entities[3u]) = 42;
+    static_cast<void>(registry.group<int>(entt::get<char>));
+    auto group = std::as_const(registry).group<const int>(entt::get<const char>);
+
+    ASSERT_EQ(entt::stage<const int>(group, buffer), 4u);
+    ASSERT_EQ(buffer[3u], 42);
+
+    std::string strings[2u]{};
+    registry.emplace<std::string>(entities[0u], "foo");
+    registry.emplace<std::string>(entities[1u], "bar");
+
+    ASSERT_EQ(entt::stage<std::string>(registry.view<std::string>(), strings), 2u);
+    ASSERT_EQ(strings[0u], "foo");
+    ASSERT_EQ(strings[1u], "bar");
+}
+
+TEST(Stage, Gather) {
+    entt::registry registry;
+    entt::entity entities[4u];
+    char buffer[4u]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    for(auto pos = 0u; pos < 3u; ++pos) {
+        registry.emplace<char>(entities[pos], static_cast<char>('a' + pos));
+    }
+
+    const auto view = registry.view<int, const char>();
+
+    ASSERT_EQ(entt::stage<const char>(view, buffer), 3u);
+
+    std::size_t pos{};
+
+    for(auto entity: view) {
+        ASSERT_EQ(buffer[pos++], registry.get<char>(entity));
+    }
+
+    int values[3u]{};
+
+    for(auto entity: view) {
+        registry.replace<int>(entity, 42);
+    }
+
+    ASSERT_EQ(entt::stage<int>(registry.group<char>(entt::get<int>), values), 3u);
+    ASSERT_EQ(values[0u], 42);
+    ASSERT_EQ(values[2u], 42);
+}
+
+TEST(Stage, ChangedRanges) {
+    entt::registry registry;
+    entt::entity entities[6u];
+    ticked_type buffer[6u]{};
+    std::vector<std::pair<std::size_t, std::size_t>> ranges{};
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.insert<ticked_type>(std::begin(entities), std::end(entities));
+    registry.insert<int>(std::begin(entities), std::end(entities));
+
+    const auto since = registry.advance_tick();
+    const auto &tracker = registry.storage<ticked_type>();
+    const auto callback = [&ranges](const std::size_t offset, const std::size_t count) { ranges.emplace_back(offset, count); };
+
+    registry.replace<ticked_type>(entities[1u], 1);
+    registry.replace<ticked_type>(entities[2u], 2);
+    registry.replace<ticked_type>(entities[5u], 5);
+
+    ASSERT_EQ(entt::stage<ticked_type>(registry.view<ticked_type>(), buffer, tracker, since, callback), 6u);
+    ASSERT_EQ(ranges, (std::vector<std::pair<std::size_t, std::size_t>>{{1u, 2u}, {5u, 1u}}));
+    ASSERT_EQ(buffer[0u].value, 0);
+    ASSERT_EQ(buffer[1u].value, 1);
+    ASSERT_EQ(buffer[2u].value, 2);
+    ASSERT_EQ(buffer[5u].value, 5);
+
+    ranges.clear();
+    const auto view = registry.view<int, ticked_type>();
+
+    ASSERT_EQ(entt::stage<ticked_type>(view, buffer, tracker, since, callback), 6u);
+    ASSERT_EQ(ranges.size(), 2u);
+
+    for(auto &&[offset, count]: ranges) {
+        for(auto next = offset; next < offset + count; ++next) {
+            ASSERT_NE(buffer[next].value, 0);
+        }
+    }
+
+    ranges.clear();
+
+    ASSERT_EQ(entt::stage<ticked_type>(registry.view<ticked_type>(), buffer, tracker, registry.advance_tick(), callback), 6u);
+    ASSERT_TRUE(ranges.empty());
+}
@@ -1,9 +1,12 @@
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <iterator>
 #include <exception>
 #include <type_traits>
 #include <unordered_set>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/storage.hpp>
 #include <entt/entity/fwd.hpp>
@@ -11,10 +14,61 @@
 struct empty_type {};
 struct boxed_int { int value; };
 
+template<typename Type>
+struct tracked_allocator {
+    using value_type = Type;
+
+    tracked_allocator(std::size_t *ref)
+        : bytes{ref}
+    {}
+
+    template<typename Other>
+    tracked_allocator(const tracked_allocator<Other> &other)
+        : bytes{other.bytes}
+    {}
+
+    Type * allocate(const std::size_t count) {
+        *bytes += count * sizeof(Type);
+        return std::allocator<Type>{}.allocate(count);
+    }
+
+    void deallocate(Type *instance, const std::size_t count) {
+        *bytes -= count * sizeof(Type);
+        std::allocator<Type>{}.deallocate(instance, count);
+    }
+
+    bool operator==(const tracked_allocator &other) const {
+        return bytes == other.bytes;
+    }
+
+    bool operator!=(const tracked_allocator &other) const {
+        return !(*this == other);
+    }
+
+    std::size_t *bytes;
+};
+
 bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
     return lhs.value == rhs.value;
 }
 
+struct split_type {
+    int x{};
+    int y{};
+    char tag{};
+};
+
+struct relocatable_type {
+    relocatable_type(int value)
+        : ptr{std::make_unique<int>(value)}
+    {}
+
+    std::unique_ptr<int> ptr;
+};
+
+template<>
+struct entt::is_trivially_relocatable<relocatable_type>: std::true_type {};
+
 struct throwing_component {
     struct constructor_exception: std::exception {};
 
@@ -150,6 +204,34 @@ TEST(Storage, Remove) {
     ASSERT_EQ(*pool.begin(), 42);
 }
 
+TEST(Storage, RemoveCompact) {
+    entt::storage<std::unique_ptr<int>> pool;
+    entt::stable_storage<int> stable;
+    entt::sparse_set &base = pool;
+    entt::sparse_set &other = stable;
+
+    for(int value{}; value < 6; ++value) {
+        pool.emplace(entt::entity(value), std::make_unique<int>(value));
+        stable.emplace(entt::entity(value), value);
+    }
+
+    const entt::entity doomed[3u]{entt::entity{4}, entt::entity{0}, entt::entity{1}};
+    base.remove(std::begin(doomed), std::end(doomed));
+    other.remove(std::begin(doomed), std::end(doomed));
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(stable.size(), 3u);
+
+    for(auto entity: { entt::entity{2}, entt::entity{3}, entt::entity{5} }) {
+        ASSERT_EQ(*pool.get(entity), static_cast<int>(entity));
+        ASSERT_EQ(stable.get(entity), static_cast<int>(entity));
+    }
+
+    ASSERT_EQ(pool.index(entt::entity{2}), 0u);
+    ASSERT_EQ(pool.index(entt::entity{3}), 1u);
+    ASSERT_EQ(pool.index(entt::entity{5}), 2u);
+}
+
 TEST(Storage, AggregatesMustWork) {
     struct aggregate_type { int value; };
     // the goal of this test is to enforce the requirements for aggregate types
@@ -331,6 +413,30 @@ TEST(Storage, ConstReverseIterator) {
     ASSERT_GE(cend, pool.crend());
 }
 
+TEST(Storage, MemoryUsage) {
+    entt::storage<int> pool;
+    entt::storage<empty_type> empty;
+
+    pool.reserve(42u);
+    pool.emplace(entt::entity{3}, 3);
+    empty.emplace(entt::entity{3});
+
+    ASSERT_EQ(pool.memory_usage().size, 1u);
+    ASSERT_EQ(pool.memory_usage().instances, 42u);
+    ASSERT_EQ(pool.memory_usage().instance_bytes, 42u * sizeof(int));
+    ASSERT_EQ(pool.memory_usage().bytes(), pool.memory_usage().sparse_bytes + pool.memory_usage().packed_bytes + 42u * sizeof(int));
+    ASSERT_EQ(static_cast<const entt::sparse_set &>(pool).memory_usage().instances, 42u);
+
+    ASSERT_EQ(empty.memory_usage().size, 1u);
+    ASSERT_EQ(empty.memory_usage().instances, 0u);
+    ASSERT_EQ(empty.memory_usage().instance_bytes, 0u);
+
+    pool.remove(entt::entity{3});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().bytes(), 0u);
+}
+
 TEST(Storage, Raw) {
     entt::storage<int> pool;
 
@@ -347,6 +453,41 @@ TEST(Storage, Raw) {
     ASSERT_EQ(pool.raw()[2u], 9);
 }
 
+TEST(Storage, Chunks) {
+    entt::storage<int> pool;
+
+    ASSERT_EQ(pool.chunks().size(), 0u);
+    ASSERT_EQ(std::as_const(pool).chunks().begin(), std::as_const(pool).chunks().end());
+
+    for(auto next = 0; next < 10; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    std::size_t cnt{};
+
+    for(auto [entities, instances, count]: pool.chunks(3u)) {
+        static_assert(std::is_same_v<decltype(entities), const entt::entity *>);
+        static_assert(std::is_same_v<decltype(instances), int *>);
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(entt::to_integral(entities[pos]), instances[pos]);
+            instances[pos] *= 2;
+        }
+
+        cnt += count;
+    }
+
+    ASSERT_EQ(cnt, pool.size());
+    ASSERT_EQ(pool.chunks(3u).size(), 4u);
+
+    const auto [entities, instances, count] = std::as_const(pool).chunks(3u)[3u];
+    static_assert(std::is_same_v<decltype(instances), const int *const>);
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(entities, pool.data() + 9u);
+    ASSERT_EQ(*instances, 18);
+}
+
 TEST(Storage, SortOrdered) {
     entt::storage<boxed_int> pool;
     entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
@@ -371,6 +512,32 @@ TEST(Storage, SortReverse) {
     ASSERT_TRUE(std::equal(std::begin(values), std::end(values), pool.begin(), pool.end()));
 }
 
+TEST(Storage, SortRadix) {
+    entt::storage<boxed_int> pool;
+    entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+    boxed_int values[5u]{{6}, {3}, {1}, {9}, {12}};
+
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+    pool.sort([](const auto &instance) { return instance.value; }, entt::radix_sort<8, 32>{});
+
+    ASSERT_EQ(pool.begin()[0u], boxed_int{1});
+    ASSERT_EQ(pool.begin()[1u], boxed_int{3});
+    ASSERT_EQ(pool.begin()[2u], boxed_int{6});
+    ASSERT_EQ(pool.begin()[3u], boxed_int{9});
+    ASSERT_EQ(pool.begin()[4u], boxed_int{12});
+
+    ASSERT_EQ(pool.entt::sparse_set::begin()[0u], entt::entity{7});
+    ASSERT_EQ(pool.entt::sparse_set::begin()[1u], entt::entity{42});
+    ASSERT_EQ(pool.entt::sparse_set::begin()[2u], entt::entity{12});
+    ASSERT_EQ(pool.entt::sparse_set::begin()[3u], entt::entity{3});
+    ASSERT_EQ(pool.entt::sparse_set::begin()[4u], entt::entity{9});
+
+    pool.sort([](const entt::entity entt) { return entt::to_integral(entt); }, entt::radix_sort<8, 32>{});
+
+    ASSERT_TRUE(std::is_sorted(pool.entt::sparse_set::begin(), pool.entt::sparse_set::end()));
+    ASSERT_EQ(pool.get(entt::entity{42}), boxed_int{3});
+}
+
 TEST(Storage, SortUnordered) {
     entt::storage<boxed_int> pool;
     entt::entity entities[5u]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
@@ -588,6 +755,32 @@ TEST(Storage, RespectUnordered) {
     ASSERT_EQ(rhs.data()[5u], entt::entity{5});
 }
 
+TEST(Storage, RespectSmaller) {
+    entt::storage<int> lhs;
+    entt::storage<int> rhs;
+
+    entt::entity lhs_entities[3u]{entt::entity{9}, entt::entity{4}, entt::entity{2}};
+    int lhs_values[3u]{9, 4, 2};
+    lhs.insert(std::begin(lhs_entities), std::end(lhs_entities), std::begin(lhs_values), std::end(lhs_values));
+
+    entt::entity rhs_entities[5u]{entt::entity{4}, entt::entity{1}, entt::entity{2}, entt::entity{3}, entt::entity{5}};
+    rhs.insert(std::begin(rhs_entities), std::end(rhs_entities));
+
+    lhs.respect(rhs);
+
+    auto begin = lhs.begin();
+    auto end = lhs.end();
+
+    ASSERT_EQ(*(begin++), 2);
+    ASSERT_EQ(*(begin++), 4);
+    ASSERT_EQ(*(begin++), 9);
+    ASSERT_EQ(begin, end);
+
+    ASSERT_EQ(lhs.get(entt::entity{9}), 9);
+    ASSERT_EQ(lhs.get(entt::entity{4}), 4);
+    ASSERT_EQ(lhs.get(entt::entity{2}), 2);
+}
+
 TEST(Storage, CanModifyDuringIteration) {
     entt::storage<int> pool;
     pool.emplace(entt::entity{0}, 42);
@@ -638,6 +831,37 @@ TEST(Storage, MoveOnlyComponent) {
     (void)pool;
 }
 
+TEST(Storage, TriviallyRelocatable) {
+    entt::storage<relocatable_type> pool;
+
+    for(auto next = 0; next < 8; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    pool.remove(entt::entity{2});
+    pool.remove(entt::entity{7});
+    pool.swap(entt::entity{0}, entt::entity{5});
+    pool.swap(entt::entity{1}, entt::entity{1});
+    pool.sort([](const auto &lhs, const auto &rhs) { return *lhs.ptr < *rhs.ptr; });
+
+    ASSERT_EQ(pool.size(), 6u);
+
+    for(auto entity: static_cast<const entt::sparse_set &>(pool)) {
+        ASSERT_EQ(*pool.get(entity).ptr, static_cast<int>(entt::to_integral(entity)));
+    }
+
+    auto it = pool.cbegin();
+
+    for(auto next: {0, 1, 3, 4, 5, 6}) {
+        ASSERT_EQ(*(it++)->ptr, next);
+    }
+
+    const std::vector<entt::entity> entities{pool.data(), pool.data() + pool.size()};
+    pool.remove(entities.cbegin(), entities.cend());
+
+    ASSERT_TRUE(pool.empty());
+}
+
 TEST(Storage, ConstructorExceptionDoesNotAddToStorage) {
     entt::storage<throwing_component> pool;
 
@@ -649,3 +873,523 @@ TEST(Storage, ConstructorExceptionDoesNotAddToStorage) {
 
     ASSERT_TRUE(pool.empty());
 }
+
+TEST(Storage, CustomAllocator) {
+    std::size_t bytes{};
+
+    {
+        entt::basic_storage<entt::entity, int, tracked_allocator<int>> pool{tracked_allocator<int>{&bytes}};
+        // the sparse set reaches the allocator through an adaptor that lives as long as the pool
+        const auto adaptor = bytes;
+
+        ASSERT_EQ(pool.get_allocator(), tracked_allocator<int>{&bytes});
+        ASSERT_NE(adaptor, 0u);
+
+        pool.reserve(4u);
+
+        ASSERT_GE(bytes, adaptor + 4u * sizeof(int) + 4u * sizeof(entt::entity));
+
+        pool.emplace(entt::entity{3}, 42);
+        const entt::entity entities[2u]{entt::entity{1}, entt::entity{2}};
+        pool.insert(std::begin(entities), std::end(entities), 0);
+
+        ASSERT_EQ(pool.get(entt::entity{3}), 42);
+        // sparse pages are also drawn from the allocator
+        ASSERT_GE(bytes, adaptor + pool.size() * (sizeof(int) + sizeof(entt::entity)) + ENTT_PAGE_SIZE);
+
+        pool.clear();
+        pool.shrink_to_fit();
+
+        ASSERT_EQ(bytes, adaptor);
+
+        pool.emplace(entt::entity{3}, 42);
+    }
+
+    ASSERT_EQ(bytes, 0u);
+
+    entt::basic_storage<entt::entity, empty_type, tracked_allocator<empty_type>> pool{tracked_allocator<empty_type>{&bytes}};
+    pool.emplace(entt::entity{3});
+
+    ASSERT_TRUE(pool.contains(entt::entity{3}));
+    // empty types aren't instantiated, the allocator serves the entities only
+    ASSERT_GT(bytes, ENTT_PAGE_SIZE);
+}
+
+TEST(StableStorage, Functionalities) {
+    entt::stable_storage<int> pool;
+
+    ASSERT_TRUE(pool.empty());
+
+    auto &first = pool.emplace(entt::entity{41}, 3);
+    auto &second = pool.emplace(entt::entity{42}, 42);
+    auto &third = pool.emplace(entt::entity{43}, 7);
+    const auto *addr = &second;
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(&pool.get(entt::entity{41}), &first);
+    ASSERT_EQ(&pool.get(entt::entity{43}), &third);
+
+    pool.remove(entt::entity{41});
+
+    ASSERT_FALSE(pool.contains(entt::entity{41}));
+    ASSERT_EQ(&pool.get(entt::entity{42}), addr);
+    ASSERT_EQ(pool.get(entt::entity{42}), 42);
+    ASSERT_EQ(pool.get(entt::entity{43}), 7);
+
+    // the free slot is reused first
+    ASSERT_EQ(&pool.emplace(entt::entity{44}, 0), &first);
+    ASSERT_EQ(&pool.get(entt::entity{42}), addr);
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+
+    pool.shrink_to_fit();
+    pool.reserve(42u);
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(StableStorage, Iterator) {
+    entt::stable_storage<boxed_int> pool;
+    pool.emplace(entt::entity{3}, 3);
+    pool.emplace(entt::entity{42}, 42);
+    pool.emplace(entt::entity{1}, 1);
+    pool.remove(entt::entity{3});
+
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(pool.begin()[0u], pool.get(entt::entity{42}));
+    ASSERT_EQ(pool.begin()[1u], pool.get(entt::entity{1}));
+    ASSERT_EQ(*pool.rbegin(), pool.get(entt::entity{1}));
+    ASSERT_EQ(pool.begin()->value, 42);
+
+    auto it = pool.cbegin();
+
+    for(auto entity: static_cast<const entt::sparse_set &>(pool)) {
+        ASSERT_EQ(&*it++, &std::as_const(pool).get(entity));
+    }
+
+    ASSERT_EQ(it, pool.cend());
+}
+
+TEST(StableStorage, Sort) {
+    entt::stable_storage<boxed_int> pool;
+    const entt::entity entities[3u]{entt::entity{12}, entt::entity{42}, entt::entity{7}};
+    const boxed_int values[3u]{{6}, {3}, {1}};
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+    const auto *addr = &pool.get(entt::entity{42});
+
+    pool.sort([](auto lhs, auto rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(&pool.get(entt::entity{42}), addr);
+    ASSERT_EQ(pool.data()[0u], entt::entity{12});
+    ASSERT_EQ(pool.data()[1u], entt::entity{42});
+    ASSERT_EQ(pool.data()[2u], entt::entity{7});
+
+    auto it = pool.begin();
+
+    ASSERT_EQ((it++)->value, 1);
+    ASSERT_EQ((it++)->value, 3);
+    ASSERT_EQ((it++)->value, 6);
+    ASSERT_EQ(it, pool.end());
+
+    pool.sort([](const auto &instance) { return instance.value; }, entt::radix_sort<8, 32>{});
+    it = pool.begin();
+
+    ASSERT_EQ(&pool.get(entt::entity{42}), addr);
+    ASSERT_EQ((it++)->value, 1);
+    ASSERT_EQ((it++)->value, 3);
+    ASSERT_EQ((it++)->value, 6);
+}
+
+TEST(StableStorage, CustomAllocator) {
+    std::size_t bytes{};
+
+    {
+        entt::basic_stable_storage<entt::entity, int, tracked_allocator<int>> pool{tracked_allocator<int>{&bytes}};
+        const auto adaptor = bytes;
+
+        ASSERT_EQ(pool.get_allocator(), tracked_allocator<int>{&bytes});
+
+        pool.emplace(entt::entity{3}, 42);
+        pool.emplace(entt::entity{1}, 3);
+
+        ASSERT_GT(bytes, adaptor + ENTT_PAGE_SIZE);
+
+        pool.clear();
+        pool.shrink_to_fit();
+
+        ASSERT_EQ(bytes, adaptor);
+
+        pool.emplace(entt::entity{3}, 42);
+    }
+
+    ASSERT_EQ(bytes, 0u);
+}
+
+TEST(StableStorage, ConstructorExceptionDoesNotAddToStorage) {
+    entt::stable_storage<throwing_component> pool;
+
+    try {
+        pool.emplace(entt::entity{0});
+    } catch (const throwing_component::constructor_exception &) {
+        ASSERT_TRUE(pool.empty());
+    }
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(StableStorage, Insert) {
+    entt::stable_storage<boxed_int> pool;
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+    const boxed_int values[3u]{{3}, {42}, {1}};
+    pool.emplace(entt::entity{0}, 0);
+    const auto *addr = &pool.get(entt::entity{0});
+
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(&pool.get(entt::entity{0}), addr);
+    ASSERT_EQ(pool.get(entt::entity{3}), boxed_int{3});
+    ASSERT_EQ(pool.get(entt::entity{42}), boxed_int{42});
+    ASSERT_EQ(pool.get(entt::entity{1}), boxed_int{1});
+
+    pool.remove(std::begin(entities), std::end(entities));
+    pool.insert(std::begin(entities), std::end(entities), boxed_int{7});
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(&pool.get(entt::entity{0}), addr);
+    ASSERT_EQ(pool.get(entt::entity{42}), boxed_int{7});
+}
+
+TEST(StableStorage, MemoryUsage) {
+    entt::stable_storage<boxed_int> pool;
+
+    pool.emplace(entt::entity{3}, 3);
+    const auto stats = pool.memory_usage();
+
+    ASSERT_EQ(stats.size, 1u);
+    ASSERT_GE(stats.instances, 1u);
+    ASSERT_GE(stats.instance_bytes, stats.instances * sizeof(boxed_int));
+
+    pool.remove(entt::entity{3});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().instances, 0u);
+    ASSERT_EQ(pool.memory_usage().bytes(), 0u);
+}
+
+TEST(PagedStorage, Functionalities) {
+    entt::paged_storage<int> pool;
+
+    ASSERT_TRUE(pool.empty());
+
+    for(auto next = 0; next < 2048; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    const auto *addr = &pool.get(entt::entity{3});
+
+    for(auto next = 2048; next < 4096; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    // growth never moves the objects already in use
+    ASSERT_EQ(&pool.get(entt::entity{3}), addr);
+    ASSERT_EQ(pool.size(), 4096u);
+    ASSERT_EQ(pool.get(entt::entity{4095}), 4095);
+
+    pool.remove(entt::entity{3});
+
+    ASSERT_FALSE(pool.contains(entt::entity{3}));
+    ASSERT_EQ(pool.get(entt::entity{4095}), 4095);
+    ASSERT_EQ(&pool.get(entt::entity{4095}), &pool.rbegin()[pool.index(entt::entity{4095})]);
+
+    for(auto entity: static_cast<const entt::sparse_set &>(pool)) {
+        ASSERT_EQ(pool.get(entity), static_cast<int>(entt::to_integral(entity)));
+    }
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+
+    pool.shrink_to_fit();
+    pool.reserve(42u);
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(PagedStorage, Iterator) {
+    entt::paged_storage<boxed_int> pool;
+    pool.emplace(entt::entity{3}, 3);
+    pool.emplace(entt::entity{42}, 42);
+    pool.emplace(entt::entity{1}, 1);
+    pool.remove(entt::entity{3});
+
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(pool.begin()[0u], pool.get(entt::entity{42}));
+    ASSERT_EQ(pool.begin()[1u], pool.get(entt::entity{1}));
+    ASSERT_EQ(*pool.rbegin(), pool.get(entt::entity{1}));
+    ASSERT_EQ(pool.begin()->value, 42);
+
+    auto it = pool.cbegin();
+
+    for(auto entity: static_cast<const entt::sparse_set &>(pool)) {
+        ASSERT_EQ(&*it++, &std::as_const(pool).get(entity));
+    }
+
+    ASSERT_EQ(it, pool.cend());
+}
+
+TEST(PagedStorage, Sort) {
+    entt::paged_storage<boxed_int> pool;
+    const entt::entity entities[3u]{entt::entity{12}, entt::entity{42}, entt::entity{7}};
+    const boxed_int values[3u]{{6}, {3}, {1}};
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+
+    pool.sort([](auto lhs, auto rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(pool.data()[0u], entt::entity{12});
+    ASSERT_EQ(pool.data()[1u], entt::entity{42});
+    ASSERT_EQ(pool.data()[2u], entt::entity{7});
+
+    auto it = pool.begin();
+
+    ASSERT_EQ((it++)->value, 1);
+    ASSERT_EQ((it++)->value, 3);
+    ASSERT_EQ((it++)->value, 6);
+    ASSERT_EQ(it, pool.end());
+    ASSERT_EQ(pool.get(entt::entity{42}).value, 3);
+}
+
+TEST(PagedStorage, CustomAllocator) {
+    std::size_t bytes{};
+
+    {
+        entt::basic_paged_storage<entt::entity, int, tracked_allocator<int>> pool{tracked_allocator<int>{&bytes}};
+        const auto adaptor = bytes;
+
+        ASSERT_EQ(pool.get_allocator(), tracked_allocator<int>{&bytes});
+
+        pool.emplace(entt::entity{3}, 42);
+        pool.emplace(entt::entity{1}, 3);
+
+        ASSERT_GT(bytes, adaptor + ENTT_PAGE_SIZE);
+
+        pool.clear();
+        pool.shrink_to_fit();
+
+        ASSERT_EQ(bytes, adaptor);
+
+        pool.emplace(entt::entity{3}, 42);
+    }
+
+    ASSERT_EQ(bytes, 0u);
+}
+
+TEST(PagedStorage, TriviallyRelocatable) {
+    entt::paged_storage<relocatable_type> pool;
+
+    for(auto next = 0; next < 8; ++next) {
+        pool.emplace(entt::entity(next), next);
+    }
+
+    pool.remove(entt::entity{2});
+    pool.remove(entt::entity{7});
+    pool.sort([](const auto &lhs, const auto &rhs) { return *lhs.ptr < *rhs.ptr; });
+
+    ASSERT_EQ(pool.size(), 6u);
+
+    for(auto entity: static_cast<const entt::sparse_set &>(pool)) {
+        ASSERT_EQ(*pool.get(entity).ptr, static_cast<int>(entt::to_integral(entity)));
+    }
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(PagedStorage, ConstructorExceptionDoesNotAddToStorage) {
+    entt::paged_storage<throwing_component> pool;
+
+    try {
+        pool.emplace(entt::entity{0});
+    } catch (const throwing_component::constructor_exception &) {
+        ASSERT_TRUE(pool.empty());
+    }
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(PagedStorage, MemoryUsage) {
+    entt::paged_storage<boxed_int> pool;
+
+    pool.emplace(entt::entity{3}, 3);
+    const auto stats = pool.memory_usage();
+
+    ASSERT_EQ(stats.size, 1u);
+    ASSERT_GE(stats.instances, 1u);
+    ASSERT_GE(stats.instance_bytes, stats.instances * sizeof(boxed_int));
+
+    pool.remove(entt::entity{3});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().instances, 0u);
+    ASSERT_EQ(pool.memory_usage().bytes(), 0u);
+}
+
+TEST(SplitStorage, Functionalities) {
+    entt::split_storage<split_type, &split_type::x, &split_type::y, &split_type::tag> pool;
+
+    pool.reserve(42);
+
+    ASSERT_EQ(pool.capacity(), 42u);
+    ASSERT_TRUE(pool.empty());
+
+    auto ref = pool.emplace(entt::entity{41}, 1, 2, 'c');
+    pool.emplace(entt::entity{3});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(ref.get<&split_type::x>(), 1);
+    ASSERT_EQ(ref.get<&split_type::y>(), 2);
+    ASSERT_EQ(ref.get<&split_type::tag>(), 'c');
+
+    ref.get<&split_type::y>() = 3;
+    const split_type value = std::as_const(pool).get(entt::entity{41});
+
+    ASSERT_EQ(value.x, 1);
+    ASSERT_EQ(value.y, 3);
+    ASSERT_EQ(value.tag, 'c');
+
+    pool.get(entt::entity{3}) = split_type{4, 5, 'd'};
+
+    ASSERT_EQ(pool.raw<&split_type::x>()[0u], 1);
+    ASSERT_EQ(pool.raw<&split_type::x>()[1u], 4);
+    ASSERT_EQ(pool.raw<&split_type::tag>()[1u], 'd');
+
+    pool.remove(entt::entity{41});
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.raw<&split_type::x>()[0u], 4);
+    ASSERT_EQ(pool.raw<&split_type::y>()[0u], 5);
+    ASSERT_EQ(pool.raw<&split_type::tag>()[0u], 'd');
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(SplitStorage, MemoryUsage) {
+    entt::split_storage<split_type, &split_type::x, &split_type::tag> pool;
+
+    pool.reserve(42u);
+    pool.emplace(entt::entity{3});
+
+    ASSERT_EQ(pool.memory_usage().size, 1u);
+    ASSERT_EQ(pool.memory_usage().instances, 42u);
+    ASSERT_EQ(pool.memory_usage().instance_bytes, 42u * (sizeof(int) + sizeof(char)));
+}
+
+TEST(SplitStorage, Iterator) {
+    entt::split_storage<split_type, &split_type::x, &split_type::y> pool;
+    pool.emplace(entt::entity{3}, 3, 0);
+    pool.emplace(entt::entity{42}, 42, 1);
+
+    auto it = pool.begin();
+
+    ASSERT_EQ(pool.end() - it, 2);
+    ASSERT_EQ((*it).get<&split_type::x>(), 42);
+    ASSERT_EQ(it[1].get<&split_type::x>(), 3);
+    ASSERT_EQ((*(++it)).get<&split_type::x>(), 3);
+    ASSERT_EQ(++it, pool.end());
+
+    ASSERT_EQ((*pool.rbegin()).get<&split_type::x>(), 3);
+    ASSERT_EQ(pool.rend() - pool.rbegin(), 2);
+
+    for(auto &&ref: pool) {
+        ref.get<&split_type::y>() = ref.get<&split_type::x>();
+    }
+
+    for(entt::split_storage<split_type, &split_type::x, &split_type::y>::const_reference ref: std::as_const(pool)) {
+        ASSERT_EQ(ref.get<&split_type::x>(), ref.get<&split_type::y>());
+    }
+}
+
+TEST(SplitStorage, Insert) {
+    entt::split_storage<split_type, &split_type::x, &split_type::y, &split_type::tag> pool;
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+    const split_type values[3u]{{3, 0, 'a'}, {42, 1, 'b'}, {1, 2, 'c'}};
+
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(static_cast<split_type>(pool.get(entt::entity{42})).tag, 'b');
+    ASSERT_EQ(pool.get(entt::entity{1}).get<&split_type::x>(), 1);
+
+    pool.remove(std::begin(entities), std::end(entities));
+    pool.insert(std::begin(entities), std::end(entities), split_type{7, 8, 'z'});
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.get(entt::entity{3}).get<&split_type::y>(), 8);
+    ASSERT_EQ(pool.get(entt::entity{42}).get<&split_type::tag>(), 'z');
+}
+
+TEST(SplitStorage, Sort) {
+    entt::split_storage<split_type, &split_type::x, &split_type::y> pool;
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{42}, entt::entity{1}};
+    const split_type values[3u]{{3, 0}, {42, 1}, {1, 2}};
+
+    pool.insert(std::begin(entities), std::end(entities), std::begin(values), std::end(values));
+    pool.sort([](const auto lhs, const auto rhs) { return lhs.template get<&split_type::x>() < rhs.template get<&split_type::x>(); });
+
+    ASSERT_EQ(pool.data()[0u], entt::entity{42});
+    ASSERT_EQ(pool.data()[1u], entt::entity{3});
+    ASSERT_EQ(pool.data()[2u], entt::entity{1});
+    ASSERT_EQ(pool.raw<&split_type::y>()[0u], 1);
+    ASSERT_EQ(pool.raw<&split_type::y>()[1u], 0);
+    ASSERT_EQ(pool.raw<&split_type::y>()[2u], 2);
+}
+
+TEST(TransientStorage, Functionalities) {
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::entity);
+    entt::transient_storage<boxed_int> pool;
+    const entt::entity entities[3u]{entt::entity{3}, entt::entity{entt_per_page + 1u}, entt::entity{1}};
+
+    for(int round{}; round < 3; ++round) {
+        for(auto entity: entities) {
+            pool.emplace(entity, boxed_int{round});
+        }
+
+        ASSERT_EQ(pool.size(), 3u);
+        ASSERT_EQ(pool.get(entt::entity{1}).value, round);
+
+        pool.remove(std::begin(entities), std::end(entities));
+
+        ASSERT_TRUE(pool.empty());
+        ASSERT_FALSE(pool.contains(entt::entity{3}));
+        ASSERT_FALSE(pool.contains(entt::entity{entt_per_page + 1u}));
+        ASSERT_EQ(pool.memory_usage().pages, 2u);
+        ASSERT_GE(pool.capacity(), 3u);
+        ASSERT_GE(pool.memory_usage().instances, 3u);
+    }
+
+    pool.emplace(entt::entity{3});
+    pool.emplace(entt::entity{1});
+    pool.remove(std::begin(entities), std::begin(entities) + 1u);
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_TRUE(pool.contains(entt::entity{1}));
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.memory_usage().pages, 2u);
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().pages, 0u);
+}
@@ -0,0 +1,114 @@
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/telemetry.hpp>
+
+struct listener {
+    static void on_construct(entt::registry &, entt::entity) {}
+};
+
+TEST(Telemetry, Functionalities) {
+    entt::registry registry;
+    entt::telemetry telemetry{};
+    entt::telemetry::sample_type sample{};
+
+    ASSERT_EQ(telemetry.samples(), 0u);
+    ASSERT_FALSE(telemetry.try_read(sample));
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+    registry.emplace<int>(registry.create());
+    registry.destroy(registry.create());
+    registry.on_construct<int>().connect<&listener::on_construct>();
+    static_cast<void>(registry.group<int>(entt::get<char>));
+
+    telemetry.sample(registry);
+
+    ASSERT_EQ(telemetry.samples(), 1u);
+    ASSERT_TRUE(telemetry.try_read(sample));
+    ASSERT_EQ(sample.frame, 0u);
+    ASSERT_EQ(sample.entities, 3u);
+    ASSERT_EQ(sample.alive, 2u);
+    ASSERT_EQ(sample.pool_count, 2u);
+    ASSERT_EQ(sample.group_count, 1u);
+    ASSERT_EQ(sample.groups[0u].types, 2u);
+    ASSERT_EQ(sample.groups[0u].size, 1u);
+
+    for(std::size_t pos{}; pos < sample.pool_count; ++pos) {
+        const auto &elem = sample.pools[pos];
+
+        if(elem.id == entt::type_hash<int>::value()) {
+            ASSERT_EQ(elem.size, 2u);
+            ASSERT_GE(elem.capacity, 2u);
+            ASSERT_NE(elem.bytes, 0u);
+            // the listener above plus those of the group
+            ASSERT_EQ(elem.listeners, 3u);
+        } else {
+            ASSERT_EQ(elem.id, entt::type_hash<char>::value());
+            ASSERT_EQ(elem.size, 1u);
+            ASSERT_EQ(elem.listeners, 2u);
+        }
+    }
+
+    registry.clear();
+    telemetry.sample(registry);
+    sample = telemetry.read();
+
+    ASSERT_EQ(telemetry.samples(), 2u);
+    ASSERT_EQ(sample.frame, 1u);
+    ASSERT_EQ(sample.alive, 0u);
+    ASSERT_EQ(sample.groups[0u].size, 0u);
+}
+
+TEST(Telemetry, Capacity) {
+    entt::registry registry;
+    entt::basic_telemetry<entt::entity, 1u, 0u> telemetry{};
+
+    registry.emplace<int>(registry.create());
+    registry.emplace<char>(registry.create());
+    static_cast<void>(registry.group<int>(entt::get<char>));
+    telemetry.sample(registry);
+
+    const auto sample = telemetry.read();
+
+    ASSERT_EQ(sample.pool_count, 1u);
+    ASSERT_EQ(sample.group_count, 0u);
+}
+
+TEST(Telemetry, ConcurrentReader) {
+    entt::registry registry;
+    entt::telemetry telemetry{};
+    std::atomic<bool> done{};
+
+    telemetry.sample(registry);
+
+    std::thread reader{[&telemetry, &done]() {
+        while(!done.load()) {
+            const auto sample = telemetry.read();
+            // the writer keeps both pools equal in size, a torn sample wouldn't
+            ASSERT_EQ(sample.alive, sample.pool_count ? sample.pools[0u].size : 0u);
+
+            for(std::size_t pos{}; pos < sample.pool_count; ++pos) {
+                ASSERT_EQ(sample.pools[pos].size, sample.alive);
+            }
+        }
+    }};
+
+    for(int frame{}; frame < 1000; ++frame) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity);
+        registry.emplace<char>(entity);
+        telemetry.sample(registry);
+    }
+
+    done.store(true);
+    reader.join();
+
+    ASSERT_EQ(telemetry.samples(), 1001u);
+    ASSERT_EQ(telemetry.read().alive, 1000u);
+}
@@ -0,0 +1,96 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+static std::vector<std::string> zones{};
+
+#define ENTT_TRACE(name, type) zones.push_back(std::string{name} + ':' + std::string{type})
+
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/process/process.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+struct an_event {};
+
+struct listener {
+    void receive(const an_event &) {}
+};
+
+struct empty_process: entt::process<empty_process, int> {
+    void update(delta_type, void *) { succeed(); }
+};
+
+std::string zone(const char *name, std::string_view type) {
+    return std::string{name} + ':' + std::string{type};
+}
+
+TEST(Trace, Registry) {
+    entt::registry registry;
+    entt::entity entities[2u];
+
+    zones.clear();
+
+    const auto entity = registry.create();
+    registry.create(std::begin(entities), std::end(entities));
+
+    registry.emplace<int>(entity, 42);
+    registry.emplace<char>(entity, 'c');
+
+    registry.sort<int>(std::less{});
+    registry.sort<char, int>();
+    registry.destroy(entity);
+
+    ASSERT_EQ(zones.size(), 5u);
+    ASSERT_EQ(zones[0u], zone("entt::registry::create", entt::type_id<entt::entity>().name()));
+    ASSERT_EQ(zones[1u], zone("entt::registry::create", entt::type_id<entt::entity>().name()));
+    ASSERT_EQ(zones[2u], zone("entt::registry::sort", entt::type_id<int>().name()));
+    ASSERT_EQ(zones[3u], zone("entt::registry::sort", entt::type_id<char>().name()));
+    ASSERT_EQ(zones[4u], zone("entt::registry::destroy", entt::type_id<entt::entity>().name()));
+}
+
+TEST(Trace, ViewAndGroup) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+
+    auto view = registry.view<int>();
+    auto multi = registry.view<int, char>();
+    auto group = registry.group<int>(entt::get<char>);
+
+    zones.clear();
+
+    view.each([](auto &&...) {});
+    multi.each([](auto &&...) {});
+    group.each([](auto &&...) {});
+    group.sort([](auto lhs, auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(zones.size(), 4u);
+    ASSERT_EQ(zones[0u], zone("entt::view::each", entt::type_id<decltype(view)>().name()));
+    ASSERT_EQ(zones[1u], zone("entt::view::each", entt::type_id<decltype(multi)>().name()));
+    ASSERT_EQ(zones[2u], zone("entt::group::each", entt::type_id<decltype(group)>().name()));
+    ASSERT_EQ(zones[3u], zone("entt::group::sort", entt::type_id<decltype(group)>().name()));
+}
+
+TEST(Trace, DispatcherAndScheduler) {
+    entt::dispatcher dispatcher;
+    entt::scheduler<int> scheduler;
+    listener instance;
+
+    dispatcher.sink<an_event>().connect<&listener::receive>(instance);
+    dispatcher.enqueue<an_event>();
+    scheduler.attach<empty_process>();
+
+    zones.clear();
+
+    dispatcher.update();
+    scheduler.update(0);
+
+    ASSERT_EQ(zones.size(), 2u);
+    ASSERT_EQ(zones[0u], zone("entt::dispatcher::update", entt::type_id<an_event>().name()));
+    ASSERT_EQ(zones[1u], zone("entt::scheduler::update", entt::type_id<entt::scheduler<int>>().name()));
+}
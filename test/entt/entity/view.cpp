@@ -1,5 +1,9 @@
+#include <atomic>
+#include <iterator>
+#include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
@@ -7,6 +11,21 @@
 
 struct empty_type {};
 
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) const {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+};
+
 TEST(SingleComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<char>();
@@ -140,6 +159,75 @@ TEST(SingleComponentView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(SingleComponentView, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    std::atomic<std::size_t> cnt{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 1);
+    registry.view<int>().par_each(thread_executor{}, [](int &value) { ++value; }, 3u);
+
+    for(auto &&[entt, value]: registry.view<int>().each()) {
+        ASSERT_EQ(value, 2);
+    }
+
+    std::as_const(registry).view<const int>().par_each(thread_executor{}, [&cnt](const auto, const int &value) { cnt += value; }, 4u);
+
+    ASSERT_EQ(cnt, 20u);
+
+    registry.insert<empty_type>(entities.begin(), entities.begin() + 5u);
+    registry.view<empty_type>().par_each(thread_executor{}, [&cnt](const auto) { --cnt; }, 2u);
+    registry.view<empty_type>().par_each(thread_executor{}, [&cnt]() { --cnt; });
+
+    ASSERT_EQ(cnt, 10u);
+
+    registry.clear();
+    registry.view<int>().par_each([](auto...) { FAIL(); }, [](auto &&...) {});
+}
+
+TEST(SingleComponentView, EachBatch) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    std::vector<std::size_t> counts{};
+
+    registry.create(entities.begin(), entities.end());
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.emplace<int>(entities[pos], static_cast<int>(pos));
+    }
+
+    registry.view<int>().each_batch<4u>([&registry, &counts](const entt::entity *entt, int *value, auto count) {
+        static_assert(std::is_convertible_v<decltype(count), std::size_t>);
+        ASSERT_EQ((std::is_same_v<decltype(count), std::size_t>), counts.size() == 2u);
+
+        for(std::size_t next{}; next < count; ++next) {
+            ASSERT_EQ(&registry.get<int>(entt[next]), value + next);
+            value[next] *= 2;
+        }
+
+        counts.push_back(count);
+    });
+
+    ASSERT_EQ(counts, (std::vector<std::size_t>{4u, 4u, 2u}));
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        ASSERT_EQ(registry.get<int>(entities[pos]), static_cast<int>(2u * pos));
+    }
+
+    std::size_t cnt{};
+    registry.insert<empty_type>(entities.begin(), entities.begin() + 5u);
+    std::as_const(registry).view<const empty_type>().each_batch<5u>([&cnt](const entt::entity *entt, std::size_t count) {
+        ASSERT_EQ(entt[0u], entt::entity{0});
+        cnt += count;
+    });
+
+    ASSERT_EQ(cnt, 5u);
+
+    registry.clear();
+    registry.view<int>().each_batch<4u>([](auto &&...) { FAIL(); });
+}
+
 TEST(SingleComponentView, ConstNonConstAndAllInBetween) {
     entt::registry registry;
     auto view = registry.view<int>();
@@ -445,6 +533,41 @@ TEST(MultiComponentView, SizeHint) {
     ASSERT_EQ(view.rbegin(), view.rend());
 }
 
+TEST(MultiComponentView, Count) {
+    entt::registry registry;
+    std::size_t expected{};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity);
+
+        if(pos % 3u) {
+            registry.emplace<char>(entity);
+        }
+
+        if(pos % 5u) {
+            registry.emplace<double>(entity);
+        }
+
+        if(pos % 7u == 0u) {
+            registry.emplace<float>(entity);
+        }
+
+        expected += (pos % 3u) && (pos % 5u) && (pos % 7u);
+    }
+
+    const auto view = registry.view<int, char, double>(entt::exclude<float>);
+
+    ASSERT_EQ(view.count(), expected);
+    ASSERT_EQ(view.count(), static_cast<std::size_t>(std::distance(view.begin(), view.end())));
+    ASSERT_EQ(registry.view<int>().count(), 100u);
+    ASSERT_EQ((registry.view<int, char>().count()), 66u);
+
+    registry.clear<char>();
+
+    ASSERT_EQ(view.count(), 0u);
+}
+
 TEST(MultiComponentView, Each) {
     entt::registry registry;
 
@@ -529,6 +652,142 @@ TEST(MultiComponentView, EachWithSuggestedType) {
     }
 }
 
+TEST(MultiComponentView, ParallelEach) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    std::atomic<std::size_t> cnt{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 1);
+    registry.insert<char>(entities.begin() + 2u, entities.end());
+    registry.insert<double>(entities.begin() + 4u, entities.end());
+    registry.insert<empty_type>(entities.begin() + 6u, entities.end());
+
+    registry.view<int, char>(entt::exclude<empty_type>).par_each(thread_executor{}, [&cnt](const auto, int &value, char &) {
+        ASSERT_EQ(value, 1);
+        value += 2;
+        ++cnt;
+    }, 3u);
+
+    ASSERT_EQ(cnt, 4u);
+
+    std::as_const(registry).view<const int, const double>().par_each<const int>(thread_executor{}, [&cnt](const int &value, const double &) {
+        cnt += value;
+    }, 1u);
+
+    ASSERT_EQ(cnt, 14u);
+
+    registry.view<int, empty_type>().par_each(thread_executor{}, [&cnt](const auto, int &) { --cnt; });
+
+    ASSERT_EQ(cnt, 10u);
+}
+
+TEST(MultiComponentView, EachBatch) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(10u);
+    std::vector<std::size_t> counts{};
+
+    registry.create(entities.begin(), entities.end());
+    registry.insert<int>(entities.begin(), entities.end(), 1);
+    registry.insert<char>(entities.begin() + 1u, entities.end(), 'c');
+    registry.insert<empty_type>(entities.begin() + 1u, entities.end());
+    registry.insert<double>(entities.begin() + 8u, entities.end());
+
+    registry.view<int, const char, empty_type>(entt::exclude<double>).each_batch<3u>([&registry, &counts](const entt::entity *entt, int *const *value, const char *const *other, auto count) {
+        for(std::size_t next{}; next < count; ++next) {
+            ASSERT_EQ(&registry.get<int>(entt[next]), value[next]);
+            ASSERT_EQ(*other[next], 'c');
+            ++*value[next];
+        }
+
+        counts.push_back(count);
+    });
+
+    ASSERT_EQ(counts, (std::vector<std::size_t>{3u, 3u, 1u}));
+    ASSERT_EQ(registry.get<int>(entities[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entities[1u]), 2);
+    ASSERT_EQ(registry.get<int>(entities[8u]), 1);
+
+    registry.view<int, char>(entt::exclude<empty_type>).each_batch<2u>([](const entt::entity *entt, int *const *, char *const *, std::size_t count) {
+        ASSERT_EQ(count, 1u);
+        ASSERT_EQ(entt[0u], entt::entity{0});
+    });
+}
+
+TEST(MultiComponentView, EachAscending) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(6u);
+    std::vector<entt::entity> visited{};
+
+    registry.create(entities.begin(), entities.end());
+
+    for(auto it = entities.rbegin(); it != entities.rend(); ++it) {
+        registry.emplace<int>(*it, static_cast<int>(entt::to_integral(*it)));
+    }
+
+    registry.insert<char>(entities.begin(), entities.end());
+    registry.insert<empty_type>(entities.begin() + 2u, entities.begin() + 3u);
+    registry.remove<int>(entities[4u]);
+    registry.emplace<int>(entities[4u], 4);
+
+    registry.view<int, const char>(entt::exclude<empty_type>).each_ascending([&visited](const auto entt, int &value, const char &) {
+        ASSERT_EQ(value, static_cast<int>(entt::to_integral(entt)));
+        visited.push_back(entt);
+    });
+
+    ASSERT_EQ(visited, (std::vector<entt::entity>{entities[0u], entities[1u], entities[3u], entities[4u], entities[5u]}));
+
+    std::size_t count{};
+    registry.view<int, char>().each_ascending([&count](int &value, char &) { count += (value >= 0); });
+
+    ASSERT_EQ(count, 6u);
+}
+
+TEST(MultiComponentView, BatchedFilter) {
+    entt::registry registry;
+    std::size_t expected{};
+
+    for(auto next = 0; next < 100; ++next) {
+        const auto entity = registry.create();
+
+        registry.emplace<int>(entity, next);
+
+        if(next % 2) {
+            registry.emplace<char>(entity);
+        }
+
+        if(next % 3) {
+            registry.emplace<double>(entity);
+        }
+
+        if(!(next % 5)) {
+            registry.emplace<float>(entity);
+        }
+
+        expected += (next % 2) && (next % 3) && (next % 5);
+    }
+
+    const auto view = registry.view<int, char, double>(entt::exclude<float>);
+    std::size_t cnt{};
+
+    view.each([&cnt](const auto entity, const int value, char, double) {
+        ASSERT_EQ(entt::to_integral(entity), value);
+        ASSERT_TRUE((value % 2) && (value % 3) && (value % 5));
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, expected);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), static_cast<std::ptrdiff_t>(expected));
+
+    cnt = {};
+    view.each<int>([&cnt](const auto entity, const int value, char, double) {
+        ASSERT_EQ(entt::to_integral(entity), value);
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, expected);
+}
+
 TEST(MultiComponentView, EachWithHoles) {
     entt::registry registry;
 
@@ -798,4 +1057,109 @@ TEST(MultiComponentView, DeductionGuide) {
     static_assert(std::is_same_v<decltype(entt::basic_view{std::as_const(istorage), dstorage}), entt::basic_view<entt::entity, entt::exclude_t<>, const int, double>>);
     static_assert(std::is_same_v<decltype(entt::basic_view{istorage, std::as_const(dstorage)}), entt::basic_view<entt::entity, entt::exclude_t<>, int, const double>>);
     static_assert(std::is_same_v<decltype(entt::basic_view{std::as_const(istorage), std::as_const(dstorage)}), entt::basic_view<entt::entity, entt::exclude_t<>, const int, const double>>);
-}
\ No newline at end of file
+}
+
+TEST(ExcludeOnlyView, Functionalities) {
+    entt::registry registry;
+    const auto view = registry.view(entt::exclude<int>);
+
+    ASSERT_EQ(view.size_hint(), 0u);
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_EQ(view.rbegin(), view.rend());
+    ASSERT_EQ(view.front(), static_cast<entt::entity>(entt::null));
+
+    entt::entity entities[4u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    registry.emplace<int>(entities[1u]);
+    registry.destroy(entities[2u]);
+
+    ASSERT_EQ(view.size_hint(), 4u);
+    ASSERT_EQ(view.front(), entities[0u]);
+    ASSERT_EQ(view.back(), entities[3u]);
+
+    ASSERT_TRUE(view.contains(entities[0u]));
+    ASSERT_FALSE(view.contains(entities[1u]));
+    ASSERT_FALSE(view.contains(entities[2u]));
+    ASSERT_TRUE(view.contains(entities[3u]));
+
+    ASSERT_EQ(view.find(entities[3u]), ++view.begin());
+    ASSERT_EQ(view.find(entities[1u]), view.end());
+    ASSERT_EQ(view.find(entities[2u]), view.end());
+    ASSERT_EQ(*view.rbegin(), entities[3u]);
+    ASSERT_EQ(*(++view.rbegin()), entities[0u]);
+    ASSERT_EQ(++(++view.rbegin()), view.rend());
+
+    std::size_t cnt{};
+
+    view.each([&cnt](const entt::entity) { ++cnt; });
+
+    ASSERT_EQ(cnt, 2u);
+
+    for(auto [entt]: view.each()) {
+        ASSERT_TRUE(entt == entities[0u] || entt == entities[3u]);
+        --cnt;
+    }
+
+    ASSERT_EQ(cnt, 0u);
+
+    const auto other = registry.create();
+
+    ASSERT_TRUE(view.contains(other));
+    ASSERT_TRUE(view.contains(entities[3u]));
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+
+    registry.remove<int>(entities[1u]);
+    registry.destroy(entities[0u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+    ASSERT_EQ(view.front(), entities[1u]);
+    ASSERT_EQ(view.get(entities[1u]), std::tuple<>{});
+}
+
+TEST(ExcludeOnlyView, SkipDeadRanges) {
+    entt::registry registry;
+    const auto view = registry.view(entt::exclude<int>);
+    entt::entity entities[150u];
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(std::size_t pos{}; pos < 150u; ++pos) {
+        if(pos != 3u && pos != 70u && pos != 71u && pos != 149u) {
+            registry.destroy(entities[pos]);
+        }
+    }
+
+    registry.emplace<int>(entities[70u]);
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+    ASSERT_EQ(view.front(), entities[3u]);
+    ASSERT_EQ(view.back(), entities[149u]);
+    ASSERT_EQ(*(++view.begin()), entities[71u]);
+    ASSERT_EQ(*(++view.rbegin()), entities[71u]);
+    ASSERT_EQ(view.find(entities[71u]), ++view.begin());
+
+    std::size_t cnt{};
+    view.each([&cnt](const entt::entity) { ++cnt; });
+
+    ASSERT_EQ(cnt, 3u);
+}
+
+TEST(ExcludeOnlyView, IteratorOutlivesView) {
+    entt::registry registry;
+    entt::entity entities[3u];
+    registry.create(std::begin(entities), std::end(entities));
+    registry.emplace<int>(entities[1u]);
+
+    auto it = registry.view(entt::exclude<int>).begin();
+    const auto last = registry.view(entt::exclude<int>).end();
+
+    ASSERT_EQ(*it, entities[0u]);
+    ASSERT_EQ(*(++it), entities[2u]);
+    ASSERT_EQ(++it, last);
+
+    auto rit = registry.view(entt::exclude<int>).rbegin();
+
+    ASSERT_EQ(*rit, entities[2u]);
+    ASSERT_EQ(*(++rit), entities[0u]);
+    ASSERT_EQ(++rit, registry.view(entt::exclude<int>).rend());
+}
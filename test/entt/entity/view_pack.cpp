@@ -1,8 +1,10 @@
+#include <array>
 #include <cstdint>
 #include <iterator>
 #include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/group.hpp>
 #include <entt/entity/view.hpp>
 #include <entt/entity/view_pack.hpp>
 
@@ -80,6 +82,44 @@ TEST(ViewPack, Iterator) {
     ASSERT_EQ(*pack.begin(), entity);
 }
 
+TEST(ViewPack, MultiPassIterator) {
+    entt::registry registry;
+    const auto entities = std::array{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<int>(entities.begin(), entities.end());
+    registry.emplace<char>(entities[0u]);
+    registry.emplace<char>(entities[2u]);
+
+    const auto pack = registry.view<int>() | registry.view<char>();
+    const auto multi = registry.view<int, char>() | registry.view<int>();
+    const auto forward = registry.view(entt::exclude<double>) | registry.view<char>();
+
+    static_assert(std::is_same_v<std::iterator_traits<decltype(pack.begin())>::iterator_category, std::bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<std::iterator_traits<decltype(multi.begin())>::iterator_category, std::bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<std::iterator_traits<decltype(forward.begin())>::iterator_category, std::forward_iterator_tag>);
+
+    ASSERT_EQ(pack.size_hint(), 3u);
+    ASSERT_EQ(multi.size_hint(), 2u);
+    ASSERT_EQ(forward.size_hint(), 3u);
+
+    decltype(pack.begin()) it{};
+    it = pack.begin();
+    const auto other = it;
+
+    ASSERT_EQ(std::distance(it, pack.end()), 2);
+    ASSERT_EQ(*other, *it++);
+    ASSERT_NE(*other, *it);
+    ASSERT_EQ(++it, pack.end());
+    ASSERT_EQ(*--it, entities[0u]);
+    ASSERT_EQ(*(it--), entities[0u]);
+    ASSERT_EQ(it, other);
+    ASSERT_EQ(*it, entities[2u]);
+
+    ASSERT_EQ(std::distance(multi.begin(), multi.end()), 2);
+    ASSERT_EQ(std::distance(forward.begin(), forward.end()), 2);
+    ASSERT_EQ(*std::next(forward.begin()), *std::next(forward.begin()));
+}
+
 TEST(ViewPack, ReverseIterator) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -402,3 +442,77 @@ TEST(ViewPack, LongestPool) {
         }
     }
 }
+
+TEST(ViewPack, ExcludeOnlyView) {
+    entt::registry registry;
+    const auto entities = std::array{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entities[0u], 0);
+    registry.emplace<int>(entities[1u], 1);
+    registry.emplace<char>(entities[1u]);
+    registry.emplace<int>(entities[2u], 2);
+    registry.destroy(entities[2u]);
+
+    const auto excluded = registry.view(entt::exclude<char>);
+    auto leading = registry.view<int>() | excluded;
+    auto trailing = excluded | registry.view<int>();
+
+    ASSERT_EQ(std::distance(leading.begin(), leading.end()), 1);
+    ASSERT_EQ(std::distance(trailing.begin(), trailing.end()), 1);
+    ASSERT_EQ(*leading.begin(), entities[0u]);
+    ASSERT_EQ(*trailing.begin(), entities[0u]);
+
+    trailing.each([&](const auto entt, int &value) {
+        ASSERT_EQ(entt, entities[0u]);
+        ASSERT_EQ(value, 0);
+    });
+
+    for(auto [entt, value]: leading.each()) {
+        ASSERT_EQ(entt, entities[0u]);
+        ASSERT_EQ(value, 0);
+    }
+}
+
+TEST(ViewPack, Group) {
+    entt::registry registry;
+    const auto group = registry.group<int, char>();
+    const auto entities = std::array{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<int>(entities.begin(), entities.end(), 42);
+    registry.insert<char>(entities.begin(), entities.end(), '2');
+    registry.emplace<double>(entities[0u], .3);
+    registry.emplace<double>(entities[2u], .3);
+    registry.emplace<float>(entities[2u]);
+
+    const auto pack = group | registry.view<double>(entt::exclude<float>);
+    const auto other = registry.view<double>() | group;
+
+    static_assert(std::is_same_v<decltype(pack.get({})), std::tuple<int &, char &, double &>>);
+    static_assert(std::is_same_v<decltype(other.get({})), std::tuple<double &, int &, char &>>);
+
+    ASSERT_EQ(pack.size_hint(), 3u);
+    ASSERT_EQ(other.size_hint(), 2u);
+    ASSERT_EQ(std::distance(pack.begin(), pack.end()), 1);
+    ASSERT_EQ(std::distance(other.begin(), other.end()), 2);
+    ASSERT_EQ(pack.front(), entities[0u]);
+    ASSERT_TRUE(pack.contains(entities[0u]));
+    ASSERT_FALSE(pack.contains(entities[2u]));
+
+    for(auto [entt, ivalue, cvalue, dvalue]: pack.each()) {
+        ASSERT_EQ(entt, entities[0u]);
+        ASSERT_EQ(ivalue, 42);
+        ASSERT_EQ(cvalue, '2');
+        ASSERT_EQ(dvalue, .3);
+    }
+
+    const auto extended = group | registry.view<double>() | registry.view<float>();
+    static_assert(std::is_same_v<std::remove_const_t<decltype(extended)>, decltype(group | (registry.view<double>() | registry.view<float>()))>);
+
+    ASSERT_EQ(extended.front(), entities[2u]);
+    ASSERT_EQ(extended.back(), entities[2u]);
+
+    std::size_t cnt{};
+    (registry.view<int>() | group).each([&cnt](int &, int &, char &) { ++cnt; });
+
+    ASSERT_EQ(cnt, 3u);
+}
@@ -46,3 +46,43 @@ TEST(ServiceLocator, Functionalities) {
 
     ASSERT_FALSE(entt::service_locator<another_service>::get().lock()->check);
 }
+
+TEST(AtomicServiceLocator, Functionalities) {
+    ASSERT_TRUE(entt::atomic_service_locator<a_service>::empty());
+    ASSERT_TRUE(entt::atomic_service_locator<another_service>::empty());
+
+    entt::atomic_service_locator<a_service>::set();
+
+    ASSERT_FALSE(entt::atomic_service_locator<a_service>::empty());
+    ASSERT_TRUE(entt::atomic_service_locator<another_service>::empty());
+
+    entt::atomic_service_locator<a_service>::reset();
+
+    ASSERT_TRUE(entt::atomic_service_locator<a_service>::empty());
+    ASSERT_EQ(entt::atomic_service_locator<a_service>::get(), nullptr);
+
+    a_service instance;
+    entt::atomic_service_locator<a_service>::set(&instance);
+
+    ASSERT_FALSE(entt::atomic_service_locator<a_service>::empty());
+    ASSERT_EQ(entt::atomic_service_locator<a_service>::get(), &instance);
+    ASSERT_EQ(&entt::atomic_service_locator<a_service>::ref(), &instance);
+
+    entt::atomic_service_locator<a_service>::reset();
+    entt::atomic_service_locator<another_service>::set<derived_service>(42);
+
+    ASSERT_TRUE(entt::atomic_service_locator<a_service>::empty());
+    ASSERT_FALSE(entt::atomic_service_locator<another_service>::empty());
+
+    entt::atomic_service_locator<another_service>::get()->f(!entt::atomic_service_locator<another_service>::get()->check);
+
+    ASSERT_TRUE(entt::atomic_service_locator<another_service>::get()->check);
+
+    entt::atomic_service_locator<another_service>::ref().f(!entt::atomic_service_locator<another_service>::ref().check);
+
+    ASSERT_FALSE(entt::atomic_service_locator<another_service>::ref().check);
+
+    entt::atomic_service_locator<another_service>::reset();
+
+    ASSERT_TRUE(entt::atomic_service_locator<another_service>::empty());
+}
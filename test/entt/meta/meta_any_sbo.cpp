@@ -0,0 +1,63 @@
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+
+struct vec3_t {
+    bool operator==(const vec3_t &other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    float x, y, z;
+};
+
+struct handle_t {
+    bool operator==(const handle_t &other) const {
+        return first == other.first && second == other.second;
+    }
+
+    void *first;
+    void *second;
+};
+
+struct fat_t {
+    bool operator==(const fat_t &other) const {
+        return value[0] == other.value[0];
+    }
+
+    double value[8u];
+};
+
+bool is_local(const entt::meta_any &any) {
+    const auto *data = static_cast<const char *>(any.data());
+    const auto *base = reinterpret_cast<const char *>(&any);
+    return data >= base && data < (base + sizeof(entt::meta_any));
+}
+
+TEST(MetaAnySBO, Functionalities) {
+    int value = 42;
+    entt::meta_any vec{vec3_t{1.f, 2.f, 3.f}};
+    entt::meta_any handle{handle_t{&value, &value}};
+    entt::meta_any fat{fat_t{{1.}}};
+
+    ASSERT_TRUE(is_local(vec));
+    ASSERT_TRUE(is_local(handle));
+    ASSERT_FALSE(is_local(fat));
+
+    entt::meta_any copy{vec};
+
+    ASSERT_TRUE(is_local(copy));
+    ASSERT_EQ(copy, vec);
+
+    entt::meta_any other{std::move(handle)};
+
+    ASSERT_TRUE(is_local(other));
+    ASSERT_EQ(other.cast<handle_t>().first, &value);
+
+    std::swap(vec, fat);
+
+    ASSERT_TRUE(is_local(fat));
+    ASSERT_FALSE(is_local(vec));
+    ASSERT_EQ(fat.cast<vec3_t>().z, 3.f);
+    ASSERT_EQ(vec.cast<fat_t>().value[0u], 1.);
+}
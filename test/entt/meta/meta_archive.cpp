@@ -0,0 +1,141 @@
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/archive.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+
+struct position_t {
+    float x;
+    float y;
+};
+
+struct base_t {
+    std::uint32_t id;
+};
+
+struct padded_t: base_t {
+    char tag;
+    // not reflected, it's neither written nor read
+    int cache;
+    double weight;
+    position_t position;
+    int values[3u];
+};
+
+enum class state_t: std::uint8_t { idle, running };
+
+struct MetaArchive: ::testing::Test {
+    static void SetUpTestCase() {
+        using namespace entt::literals;
+
+        entt::meta<position_t>().data<&position_t::x>("x"_hs).data<&position_t::y>("y"_hs);
+        entt::meta<base_t>().data<&base_t::id>("id"_hs);
+
+        entt::meta<padded_t>()
+            .base<base_t>()
+            .data<&padded_t::tag>("tag"_hs)
+            .data<&padded_t::weight>("weight"_hs)
+            .data<&padded_t::position>("position"_hs)
+            .data<&padded_t::values>("values"_hs);
+    }
+};
+
+TEST_F(MetaArchive, Layout) {
+    const entt::meta_layout position{position_t{}};
+    const entt::meta_layout padded{padded_t{}};
+
+    ASSERT_TRUE(position.packed());
+    ASSERT_EQ(position.size(), sizeof(position_t));
+
+    ASSERT_FALSE(padded.packed());
+    ASSERT_EQ(padded.size(), sizeof(std::uint32_t) + sizeof(char) + sizeof(double) + sizeof(position_t) + sizeof(int[3u]));
+
+    padded_t source[2u]{{{1u}, 'a', 42, 2., {3.f, 4.f}, {5, 6, 7}}, {{8u}, 'b', 42, 9., {10.f, 11.f}, {12, 13, 14}}};
+    padded_t target[2u]{};
+    std::byte buffer[2u * sizeof(padded_t)]{};
+
+    padded.save(source, 2u, buffer);
+    padded.load(buffer, 2u, target);
+
+    for(std::size_t pos{}; pos < 2u; ++pos) {
+        ASSERT_EQ(target[pos].id, source[pos].id);
+        ASSERT_EQ(target[pos].tag, source[pos].tag);
+        ASSERT_EQ(target[pos].cache, 0);
+        ASSERT_EQ(target[pos].weight, source[pos].weight);
+        ASSERT_EQ(target[pos].position.x, source[pos].position.x);
+        ASSERT_EQ(target[pos].position.y, source[pos].position.y);
+        ASSERT_EQ(target[pos].values[2u], source[pos].values[2u]);
+    }
+}
+
+TEST_F(MetaArchive, Values) {
+    entt::meta_output_archive output{};
+    output(42, state_t::running, position_t{1.f, 2.f});
+
+    ASSERT_EQ(output.size(), sizeof(int) + sizeof(state_t) + sizeof(position_t));
+
+    int value{};
+    state_t state{};
+    position_t position{};
+    entt::meta_input_archive input{output.data(), output.size()};
+    input(value, state, position);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(value, 42);
+    ASSERT_EQ(state, state_t::running);
+    ASSERT_EQ(position.y, 2.f);
+
+    output.clear();
+
+    ASSERT_EQ(output.size(), 0u);
+}
+
+TEST_F(MetaArchive, Snapshot) {
+    entt::registry source;
+    entt::registry target;
+
+    for(int next{}; next < 8; ++next) {
+        const auto entity = source.create();
+        source.emplace<position_t>(entity, static_cast<float>(next), 0.f);
+
+        if(next % 2) {
+            source.emplace<padded_t>(entity, padded_t{{static_cast<std::uint32_t>(next)}, 'c', 0, 1., {2.f, 3.f}, {next, 0, 0}});
+            source.emplace<state_t>(entity, state_t::running);
+        }
+    }
+
+    source.destroy(source.data()[2u]);
+
+    entt::meta_output_archive output{};
+    entt::snapshot{source}.entities(output).component<position_t, padded_t, state_t>(output);
+
+    entt::meta_input_archive input{output.data(), output.size()};
+    entt::snapshot_loader{target}.entities(input).component<position_t, padded_t, state_t>(input).orphans();
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(target.size(), source.size());
+    ASSERT_EQ(target.alive(), source.alive());
+    ASSERT_EQ(target.size<position_t>(), source.size<position_t>());
+    ASSERT_EQ(target.size<padded_t>(), source.size<padded_t>());
+
+    source.each([&source, &target](const auto entity) {
+        ASSERT_TRUE(target.valid(entity));
+        ASSERT_EQ(target.get<position_t>(entity).x, source.get<position_t>(entity).x);
+
+        if(source.has<padded_t>(entity)) {
+            const auto &expected = source.get<padded_t>(entity);
+            const auto &actual = target.get<padded_t>(entity);
+
+            ASSERT_EQ(actual.id, expected.id);
+            ASSERT_EQ(actual.position.y, expected.position.y);
+            ASSERT_EQ(actual.values[0u], expected.values[0u]);
+            ASSERT_EQ(target.get<state_t>(entity), state_t::running);
+        } else {
+            ASSERT_FALSE(target.has<state_t>(entity));
+        }
+    });
+}
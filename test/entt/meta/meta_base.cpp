@@ -7,12 +7,42 @@
 struct base_t {};
 struct derived_t: base_t {};
 
+struct padding_t {
+    int padding{};
+};
+
+struct other_t {
+    int value{};
+};
+
+struct middle_t: padding_t, other_t {
+    operator char() const {
+        return static_cast<char>(middle);
+    }
+
+    int middle{};
+};
+
+struct top_t {
+    int top{};
+};
+
+struct bottom_t: top_t, middle_t {
+    operator int() const {
+        return value;
+    }
+
+    int value{};
+};
+
 struct MetaBase: ::testing::Test {
     static void SetUpTestCase() {
         using namespace entt::literals;
 
         entt::meta<base_t>().type("base"_hs);
         entt::meta<derived_t>().type("derived"_hs).base<base_t>();
+        entt::meta<middle_t>().base<padding_t>().base<other_t>().conv<char>();
+        entt::meta<bottom_t>().base<middle_t>().conv<int>();
     }
 };
 
@@ -27,3 +57,29 @@ TEST_F(MetaBase, Functionalities) {
     ASSERT_EQ(base.type(), entt::resolve<base_t>());
     ASSERT_EQ(base.cast(&derived), static_cast<base_t *>(&derived));
 }
+
+TEST_F(MetaBase, CastThroughHierarchy) {
+    bottom_t instance{};
+    entt::meta_any any{std::ref(instance)};
+
+    ASSERT_EQ(any.try_cast<middle_t>(), static_cast<middle_t *>(&instance));
+    ASSERT_EQ(any.try_cast<other_t>(), static_cast<other_t *>(&instance));
+    ASSERT_EQ(any.try_cast<padding_t>(), static_cast<padding_t *>(&instance));
+    ASSERT_EQ(any.try_cast<derived_t>(), nullptr);
+    ASSERT_EQ(std::as_const(any).try_cast<derived_t>(), nullptr);
+
+    static_cast<other_t &>(instance).value = 42;
+
+    ASSERT_EQ(any.cast<other_t>().value, 42);
+}
+
+TEST_F(MetaBase, ConvertThroughHierarchy) {
+    bottom_t instance{};
+    instance.value = 3;
+    instance.middle = 'c';
+    const entt::meta_any any{std::ref(instance)};
+
+    ASSERT_EQ(any.convert<int>().cast<int>(), 3);
+    ASSERT_EQ(any.convert<char>().cast<char>(), 'c');
+    ASSERT_FALSE(any.convert<double>());
+}
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/meta/container.hpp>
@@ -181,6 +182,29 @@ TEST_F(MetaContainer, StdArray) {
     ASSERT_EQ(view.size(), 3u);
 }
 
+TEST_F(MetaContainer, ContiguousSequenceContainer) {
+    std::vector<float> vec{1.f, 2.f, 3.f};
+    std::array<int, 3> arr{3, 4, 5};
+    entt::meta_any vany{std::ref(vec)};
+    entt::meta_any aany{std::ref(arr)};
+
+    auto vview = vany.as_sequence_container();
+    auto aview = aany.as_sequence_container();
+
+    ASSERT_TRUE(vview.is_contiguous());
+    ASSERT_TRUE(aview.is_contiguous());
+    ASSERT_EQ(vview.data(), vec.data());
+    ASSERT_EQ(aview.data(), arr.data());
+
+    std::vector<float> other(vview.size());
+    std::memcpy(other.data(), vview.data(), vview.size() * vview.value_type().size_of());
+
+    ASSERT_EQ(other, vec);
+
+    ASSERT_TRUE(vview.resize(5u));
+    ASSERT_EQ(vview.data(), vec.data());
+}
+
 TEST_F(MetaContainer, StdMap) {
     std::map<int, char> map{{2, 'c'}, {3, 'd'}, {4, 'e'}};
     entt::meta_any any{std::ref(map)};
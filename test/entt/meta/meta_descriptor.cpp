@@ -0,0 +1,78 @@
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/meta/descriptor.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+
+using namespace entt::literals;
+
+struct base_t {
+    int base_value{};
+};
+
+struct clazz_t: base_t {
+    clazz_t() = default;
+    clazz_t(int v): value{v} {}
+
+    int get() const { return value; }
+    operator int() const { return value; }
+
+    int value{};
+};
+
+template<>
+struct entt::meta_type_t<base_t>: entt::meta_descriptor<
+    "base"_hs,
+    entt::meta_data_desc<"base_value"_hs, &base_t::base_value>
+> {};
+
+template<>
+struct entt::meta_type_t<clazz_t>: entt::meta_descriptor<
+    "clazz"_hs,
+    entt::meta_base_desc<base_t>,
+    entt::meta_conv_desc<int>,
+    entt::meta_ctor_desc<int>,
+    entt::meta_data_desc<"value"_hs, &clazz_t::value>,
+    entt::meta_data_desc<"ref"_hs, &clazz_t::value, entt::as_ref_t>,
+    entt::meta_func_desc<"get"_hs, &clazz_t::get>,
+    entt::meta_prop_desc<"flag"_hs.value()>,
+    entt::meta_prop_desc<"answer"_hs.value(), 42>
+> {};
+
+struct MetaDescriptor: ::testing::Test {
+    static void SetUpTestCase() {
+        entt::meta_load<base_t, clazz_t>();
+    }
+};
+
+TEST_F(MetaDescriptor, Functionalities) {
+    auto type = entt::resolve("clazz"_hs);
+
+    ASSERT_TRUE(type);
+    ASSERT_EQ(type, entt::resolve<clazz_t>());
+    ASSERT_EQ(entt::resolve("base"_hs), entt::resolve<base_t>());
+    ASSERT_TRUE(type.base("base"_hs));
+
+    auto instance = type.construct(3);
+
+    ASSERT_TRUE(instance);
+    ASSERT_EQ(instance.cast<clazz_t>().value, 3);
+    ASSERT_EQ(type.func("get"_hs).invoke(instance).cast<int>(), 3);
+    ASSERT_TRUE(type.data("value"_hs).set(instance, 42));
+    ASSERT_EQ(type.data("ref"_hs).get(instance).cast<int>(), 42);
+    ASSERT_TRUE(type.data("base_value"_hs).set(instance, 1));
+    ASSERT_EQ(instance.cast<clazz_t>().base_value, 1);
+    ASSERT_TRUE(instance.convert<int>());
+    ASSERT_EQ(std::as_const(instance).convert<int>().cast<int>(), 42);
+}
+
+TEST_F(MetaDescriptor, Properties) {
+    auto type = entt::resolve<clazz_t>();
+
+    ASSERT_TRUE(type.prop(entt::id_type{"flag"_hs}));
+    ASSERT_FALSE(type.prop(entt::id_type{"flag"_hs}).value());
+    ASSERT_TRUE(type.prop(entt::id_type{"answer"_hs}));
+    ASSERT_EQ(type.prop(entt::id_type{"answer"_hs}).value(), 42);
+}
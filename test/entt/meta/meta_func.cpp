@@ -382,3 +382,56 @@ TEST_F(MetaFunc, ExternalMemberFunction) {
 
     ASSERT_TRUE(registry.has<func_t>(entity));
 }
+
+TEST_F(MetaFunc, Thunk) {
+    using namespace entt::literals;
+
+    auto type = entt::resolve<func_t>();
+    func_t instance{};
+
+    ASSERT_EQ(type.func("f2"_hs).thunk<int>(), nullptr);
+    ASSERT_EQ((type.func("f2"_hs).thunk<int, double>()), nullptr);
+    ASSERT_NE((type.func("f2"_hs).thunk<int, int>()), nullptr);
+
+    int first = 3;
+    int second = 2;
+    int result{};
+    void *args[]{&first, &second};
+
+    auto *thunk = type.func("f2"_hs).thunk<int, int>();
+    thunk(&instance, args, &result);
+
+    ASSERT_EQ(result, 4);
+    ASSERT_EQ(func_t::value, 3);
+
+    second = 5;
+    thunk(&instance, args, nullptr);
+
+    ASSERT_EQ(func_t::value, 3);
+
+    const entt::meta_type types[]{entt::resolve<int>()};
+    func_t::value = 2;
+
+    ASSERT_EQ(type.func("h"_hs).thunk(types, 0u), nullptr);
+    ASSERT_NE(type.func("h"_hs).thunk(types, 1u), nullptr);
+
+    type.func("h"_hs).thunk(types, 1u)(nullptr, args, &result);
+
+    ASSERT_EQ(result, 6);
+    ASSERT_EQ(first, 6);
+
+    type.func("g"_hs).thunk<int>()(&instance, args, nullptr);
+
+    ASSERT_EQ(func_t::value, 36);
+
+    int *ref{};
+    type.func("a"_hs).thunk<>()(&instance, nullptr, &ref);
+
+    ASSERT_EQ(ref, &func_t::value);
+
+    result = 0;
+    type.func("v"_hs).thunk<int>()(&instance, args, &result);
+
+    ASSERT_EQ(result, 0);
+    ASSERT_EQ(func_t::value, 6);
+}
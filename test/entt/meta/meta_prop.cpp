@@ -1,3 +1,5 @@
+#include <string>
+#include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/meta/factory.hpp>
@@ -7,6 +9,9 @@
 struct base_1_t {};
 struct base_2_t {};
 struct derived_t: base_1_t, base_2_t {};
+struct keyed_t {};
+
+enum class prop_key { value = 3 };
 
 struct MetaProp: ::testing::Test {
     static void SetUpTestCase() {
@@ -15,6 +20,7 @@ struct MetaProp: ::testing::Test {
         entt::meta<base_1_t>().prop("int"_hs, 42);
         entt::meta<base_2_t>().prop("bool"_hs, false);
         entt::meta<derived_t>().base<base_1_t>().base<base_2_t>();
+        entt::meta<keyed_t>().props(std::make_pair(3, 'c'), std::make_pair(prop_key::value, 'k'), std::make_pair(std::string{"key"}, 's'));
     }
 };
 
@@ -41,3 +47,19 @@ TEST_F(MetaProp, FromBase) {
     ASSERT_FALSE(prop_bool.value().cast<bool>());
     ASSERT_EQ(prop_int.value().cast<int>(), 42);
 }
+
+TEST_F(MetaProp, Lookup) {
+    using namespace entt::literals;
+
+    auto type = entt::resolve<keyed_t>();
+
+    ASSERT_EQ(type.prop(3).value(), 'c');
+    ASSERT_EQ(type.prop(prop_key::value).value(), 'k');
+    ASSERT_EQ(type.prop(std::string{"key"}).value(), 's');
+
+    ASSERT_FALSE(type.prop(3u));
+    ASSERT_FALSE(type.prop(4));
+    ASSERT_FALSE(type.prop(std::string{"other"}));
+    ASSERT_FALSE(type.prop(entt::meta_any{}));
+    ASSERT_FALSE(entt::resolve<base_1_t>().prop("bool"_hs));
+}
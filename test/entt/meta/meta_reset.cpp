@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+
+struct base_t {
+    int value{};
+};
+
+struct derived_t: base_t {
+    void func(int v) {
+        value = v;
+    }
+};
+
+struct MetaReset: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta<double>().type("double"_hs).conv<int>();
+        entt::meta<base_t>().type("base"_hs).data<&base_t::value>("value"_hs);
+        entt::meta<derived_t>().type("derived"_hs).base<base_t>().func<&derived_t::func>("func"_hs);
+    }
+};
+
+TEST_F(MetaReset, Type) {
+    using namespace entt::literals;
+
+    ASSERT_TRUE(entt::resolve("derived"_hs));
+    ASSERT_TRUE(entt::resolve<derived_t>().func("func"_hs));
+
+    entt::meta_reset<derived_t>();
+
+    ASSERT_FALSE(entt::resolve("derived"_hs));
+    ASSERT_FALSE(entt::resolve<derived_t>().func("func"_hs));
+    ASSERT_FALSE(entt::resolve<derived_t>().base("base"_hs));
+    ASSERT_TRUE(entt::resolve("base"_hs));
+    ASSERT_TRUE(entt::resolve("double"_hs));
+
+    entt::meta_reset();
+}
+
+TEST_F(MetaReset, Context) {
+    using namespace entt::literals;
+
+    ASSERT_NE(entt::resolve().begin(), entt::resolve().end());
+
+    entt::meta_reset();
+
+    ASSERT_EQ(entt::resolve().begin(), entt::resolve().end());
+    ASSERT_FALSE(entt::resolve("double"_hs));
+    ASSERT_FALSE(entt::resolve("base"_hs));
+    ASSERT_FALSE(entt::resolve("derived"_hs));
+    ASSERT_FALSE(entt::resolve<base_t>().data("value"_hs));
+    ASSERT_FALSE(entt::resolve<derived_t>().func("func"_hs));
+    ASSERT_FALSE(entt::meta_any{3.}.convert<int>());
+
+    entt::meta<base_t>().type("base"_hs);
+
+    ASSERT_TRUE(entt::resolve("base"_hs));
+    ASSERT_FALSE(entt::resolve("derived"_hs));
+
+    entt::meta_reset();
+}
@@ -78,6 +78,14 @@ struct overloaded_func_t {
     inline static int value = 0;
 };
 
+struct wrapped_int_t {
+    operator int() const {
+        return value;
+    }
+
+    int value;
+};
+
 enum class property_t {
     random,
     value,
@@ -90,6 +98,23 @@ union union_t {
     double d;
 };
 
+template<std::size_t>
+struct indexed_t: base_t {
+    int index{};
+    int func() const { return index; }
+};
+
+template<std::size_t... Index>
+void register_indexed(std::index_sequence<Index...>) {
+    using namespace entt::literals;
+    (entt::meta<indexed_t<Index>>().type(Index + 1u).template base<base_t>().template data<&indexed_t<Index>::index>(Index + 1u).template func<&indexed_t<Index>::func>("func"_hs), ...);
+}
+
+template<std::size_t... Index>
+void reset_indexed(std::index_sequence<Index...>) {
+    (entt::resolve<indexed_t<Index>>().reset(), ...);
+}
+
 struct MetaType: ::testing::Test {
     static void SetUpTestCase() {
         using namespace entt::literals;
@@ -392,6 +417,31 @@ TEST_F(MetaType, OverloadedFunc) {
     ASSERT_FALSE(ambiguous);
 }
 
+TEST_F(MetaType, OverloadedFuncCache) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<overloaded_func_t>();
+    overloaded_func_t instance{};
+
+    for(int value{}; value < 3; ++value) {
+        ASSERT_EQ(type.invoke("f"_hs, instance, value, 2).cast<int>(), 4);
+        ASSERT_EQ(type.invoke("f"_hs, instance, value).cast<int>(), value * value);
+        ASSERT_EQ(overloaded_func_t::value, value);
+    }
+
+    ASSERT_FALSE(type.invoke("f"_hs, instance, wrapped_int_t{3}));
+    ASSERT_FALSE(type.invoke("f"_hs, instance, wrapped_int_t{3}));
+
+    entt::meta<wrapped_int_t>().conv<int>();
+
+    ASSERT_TRUE(type.invoke("f"_hs, instance, wrapped_int_t{3}));
+    ASSERT_EQ(type.invoke("f"_hs, instance, wrapped_int_t{4}).cast<int>(), 16);
+
+    entt::resolve<wrapped_int_t>().reset();
+
+    ASSERT_FALSE(type.invoke("f"_hs, instance, wrapped_int_t{3}));
+}
+
 TEST_F(MetaType, SetGet) {
     using namespace entt::literals;
 
@@ -552,6 +602,42 @@ TEST_F(MetaType, PropertiesAndCornerCases) {
     ASSERT_FALSE(type.data("list"_hs).prop(property_t::key_only).value());
 }
 
+TEST_F(MetaType, ManyTypes) {
+    using namespace entt::literals;
+
+    register_indexed(std::make_index_sequence<64u>{});
+
+    for(entt::id_type id = 1u; id <= 64u; ++id) {
+        const auto type = entt::resolve(id);
+
+        ASSERT_TRUE(type);
+        ASSERT_EQ(type.id(), id);
+        ASSERT_TRUE(type.data(id));
+        ASSERT_FALSE(type.data(id + 1u));
+        ASSERT_TRUE(type.func("func"_hs));
+        // members of the base classes are looked up as well
+        ASSERT_EQ(type.data("value"_hs).parent(), entt::resolve<base_t>());
+    }
+
+    ASSERT_FALSE(entt::resolve(65u));
+
+    entt::resolve<indexed_t<3u>>().reset();
+
+    ASSERT_FALSE(entt::resolve(4u));
+    ASSERT_TRUE(entt::resolve(5u));
+
+    entt::meta<indexed_t<3u>>().type(65u);
+
+    ASSERT_FALSE(entt::resolve(4u));
+    ASSERT_EQ(entt::resolve(65u), entt::resolve<indexed_t<3u>>());
+    ASSERT_FALSE(entt::resolve(65u).data(4u));
+
+    reset_indexed(std::make_index_sequence<64u>{});
+
+    ASSERT_FALSE(entt::resolve(1u));
+    ASSERT_FALSE(entt::resolve(65u));
+}
+
 TEST_F(MetaType, ResetAndReRegistrationAfterReset) {
     using namespace entt::literals;
 
@@ -0,0 +1,106 @@
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/process/co_process.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+struct an_event { int value; };
+
+entt::co_task<int> script(std::vector<int> &steps, entt::dispatcher &dispatcher) {
+    steps.push_back(0);
+    co_await entt::next_tick;
+    steps.push_back(1);
+    co_await entt::wait(3);
+    steps.push_back(2);
+    const auto event = co_await entt::next_event<an_event>(dispatcher);
+    steps.push_back(event.value);
+}
+
+entt::co_task<int> endless(int &ticks) {
+    while(true) {
+        ++ticks;
+        co_await entt::next_tick;
+    }
+}
+
+TEST(CoProcess, Functionalities) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    std::vector<int> steps{};
+
+    scheduler.attach<entt::co_process<int>>(script(steps, dispatcher));
+
+    ASSERT_TRUE(steps.empty());
+
+    scheduler.update(1);
+
+    ASSERT_EQ(steps, std::vector<int>({0}));
+
+    scheduler.update(1);
+    scheduler.update(2);
+
+    ASSERT_EQ(steps, std::vector<int>({0, 1}));
+
+    scheduler.update(1);
+
+    ASSERT_EQ(steps, std::vector<int>({0, 1, 2}));
+
+    scheduler.update(1);
+    dispatcher.trigger<an_event>(42);
+    dispatcher.trigger<an_event>(3);
+
+    ASSERT_EQ(steps, std::vector<int>({0, 1, 2}));
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(1);
+
+    ASSERT_EQ(steps, std::vector<int>({0, 1, 2, 42}));
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_TRUE(dispatcher.sink<an_event>().empty());
+}
+
+TEST(CoProcess, Continuation) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    std::vector<int> steps{};
+    int ticks{};
+
+    scheduler.attach<entt::co_process<int>>(endless(ticks)).then<entt::co_process<int>>(script(steps, dispatcher));
+
+    for(auto i = 0; i < 4; ++i) {
+        scheduler.update(1);
+    }
+
+    ASSERT_EQ(ticks, 4);
+    ASSERT_TRUE(steps.empty());
+
+    scheduler.abort();
+    scheduler.update(1);
+    scheduler.update(1);
+
+    ASSERT_EQ(ticks, 4);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(CoProcess, Abort) {
+    entt::scheduler<int> scheduler;
+    entt::dispatcher dispatcher;
+    std::vector<int> steps{};
+
+    scheduler.attach<entt::co_process<int>>(script(steps, dispatcher));
+
+    for(auto i = 0; i < 8; ++i) {
+        scheduler.update(1);
+    }
+
+    ASSERT_FALSE(dispatcher.sink<an_event>().empty());
+
+    scheduler.abort(true);
+
+    ASSERT_TRUE(dispatcher.sink<an_event>().empty());
+    ASSERT_EQ(steps, std::vector<int>({0, 1, 2}));
+}
+
+#endif
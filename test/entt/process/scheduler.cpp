@@ -1,5 +1,10 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/thread_pool.hpp>
 #include <entt/process/scheduler.hpp>
 #include <entt/process/process.hpp>
 
@@ -109,3 +114,260 @@ TEST(Scheduler, Functor) {
     ASSERT_TRUE(first_functor);
     ASSERT_TRUE(second_functor);
 }
+
+TEST(Scheduler, Recycling) {
+    entt::scheduler<int> scheduler;
+    int counter{};
+
+    const auto func = [&counter](auto, void *, auto resolve, auto) {
+        ++counter;
+        resolve();
+    };
+
+    for(auto i = 0; i < 256; ++i) {
+        scheduler.attach(func).then(func).then(func);
+    }
+
+    ASSERT_EQ(scheduler.size(), 256u);
+
+    scheduler.update(0);
+
+    ASSERT_EQ(counter, 256);
+    ASSERT_EQ(scheduler.size(), 256u);
+
+    for(auto i = 0; i < 128; ++i) {
+        scheduler.attach(func).then(func);
+    }
+
+    scheduler.update(0);
+
+    ASSERT_EQ(counter, 640);
+    ASSERT_EQ(scheduler.size(), 384u);
+
+    scheduler.update(0);
+
+    ASSERT_EQ(counter, 1024);
+    ASSERT_TRUE(scheduler.empty());
+
+    scheduler.attach(func).then(func);
+    scheduler.clear();
+
+    ASSERT_TRUE(scheduler.empty());
+
+    entt::scheduler<int> other{std::move(scheduler)};
+    other.attach(func).then(func);
+    scheduler = std::move(other);
+    scheduler.update(0);
+
+    ASSERT_EQ(counter, 1025);
+    ASSERT_EQ(scheduler.size(), 1u);
+
+    scheduler.update(0);
+
+    ASSERT_EQ(counter, 1026);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Scheduler, ParallelUpdate) {
+    entt::scheduler<int> scheduler;
+    entt::thread_pool pool{4u};
+    std::atomic<int> ticks{};
+    std::vector<int> order{};
+
+    for(auto i = 0; i < 100; ++i) {
+        scheduler.attach([&ticks, i](auto, void *, auto resolve, auto reject) {
+            ++ticks;
+            (i % 2) ? resolve() : reject();
+        }).then([&order, i](auto, void *, auto resolve, auto) {
+            order.push_back(i);
+            resolve();
+        });
+    }
+
+    scheduler.par_update(std::ref(pool), 0, nullptr, 8u);
+
+    ASSERT_EQ(ticks.load(), 100);
+    ASSERT_EQ(scheduler.size(), 50u);
+    ASSERT_TRUE(order.empty());
+
+    scheduler.par_update(std::ref(pool), 0);
+
+    ASSERT_EQ(ticks.load(), 100);
+    ASSERT_EQ(order.size(), 50u);
+    ASSERT_TRUE(scheduler.empty());
+
+    for(std::size_t pos{}; pos < order.size(); ++pos) {
+        ASSERT_EQ(order[pos], 2 * static_cast<int>(pos) + 1);
+    }
+
+    scheduler.par_update([](auto...) { FAIL(); }, 0);
+}
+
+TEST(Scheduler, Wait) {
+    entt::scheduler<int> scheduler;
+    std::vector<int> order{};
+
+    const auto push = [&order](const int value) {
+        return [&order, value](auto, void *, auto resolve, auto) {
+            order.push_back(value);
+            resolve();
+        };
+    };
+
+    scheduler.wait(10).then(push(0));
+    scheduler.attach(push(1)).wait(5).then(push(2)).wait(0).then(push(3));
+    scheduler.wait(100000).then(push(4));
+
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.update(4);
+
+    ASSERT_EQ(order, (std::vector<int>{1}));
+
+    scheduler.update(4);
+
+    ASSERT_EQ(order, (std::vector<int>{1}));
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.update(4);
+    scheduler.update(0);
+
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 0}));
+
+    scheduler.update(0);
+
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 0, 3}));
+    ASSERT_EQ(scheduler.size(), 1u);
+
+    for(auto step = 0; step < 1000 && order.size() == 4u; ++step) {
+        scheduler.update(99);
+    }
+
+    ASSERT_EQ(order.size(), 4u);
+
+    scheduler.update(1000);
+    scheduler.update(0);
+
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 0, 3, 4}));
+    ASSERT_TRUE(scheduler.empty());
+
+    scheduler.wait(1).then(push(5));
+    scheduler.abort();
+
+    ASSERT_TRUE(scheduler.empty());
+
+    scheduler.wait(1).then(push(5));
+    scheduler.clear();
+    scheduler.update(2);
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_EQ(order.size(), 5u);
+}
+
+TEST(Scheduler, WaitResolution) {
+    entt::scheduler<float> scheduler{.5f};
+    bool done{};
+
+    scheduler.wait(.75f).then([&done](auto, void *, auto resolve, auto) {
+        done = true;
+        resolve();
+    });
+
+    scheduler.update(.5f);
+    scheduler.update(0.f);
+
+    ASSERT_FALSE(done);
+
+    scheduler.update(.5f);
+    scheduler.update(0.f);
+
+    ASSERT_TRUE(done);
+}
+
+TEST(Scheduler, WaitLongRun) {
+    entt::scheduler<float> scheduler;
+    float received{};
+    bool done{};
+
+    scheduler.attach([&received](const float delta, void *, auto, auto) {
+        received = delta;
+    }).background();
+
+    scheduler.wait(16777216.f).then([&done](auto, void *, auto resolve, auto) {
+        done = true;
+        resolve();
+    });
+
+    scheduler.update(16777216.f, std::chrono::hours{1});
+    scheduler.update(0.f, std::chrono::hours{1});
+
+    ASSERT_TRUE(done);
+
+    scheduler.update(1.f, std::chrono::hours{1});
+
+    ASSERT_EQ(received, 1.f);
+}
+
+TEST(Scheduler, WaitMove) {
+    entt::scheduler<int> scheduler;
+    bool done{};
+
+    scheduler.wait(2).then([&done](auto, void *, auto resolve, auto) {
+        done = true;
+        resolve();
+    });
+
+    entt::scheduler<int> other{std::move(scheduler)};
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_EQ(other.size(), 1u);
+
+    other.update(2);
+    other.update(0);
+
+    ASSERT_TRUE(done);
+    ASSERT_TRUE(other.empty());
+}
+
+TEST(Scheduler, Budget) {
+    entt::scheduler<int> scheduler;
+    std::vector<int> foreground(2u);
+    std::vector<int> background(3u);
+
+    const auto count = [](std::vector<int> &vec, const std::size_t pos) {
+        return [&vec, pos](const int delta, void *, auto, auto) {
+            vec[pos] += delta;
+        };
+    };
+
+    scheduler.attach(count(background, 0u)).background();
+    scheduler.attach(count(foreground, 0u));
+    scheduler.attach(count(background, 1u)).background();
+    scheduler.attach(count(background, 2u)).background();
+    scheduler.attach(count(foreground, 1u));
+
+    scheduler.update(1, std::chrono::seconds{0});
+
+    ASSERT_EQ(foreground, (std::vector<int>{1, 1}));
+    ASSERT_EQ(background, (std::vector<int>{1, 0, 0}));
+
+    scheduler.update(2, std::chrono::seconds{0});
+    scheduler.update(3, std::chrono::seconds{0});
+
+    ASSERT_EQ(foreground, (std::vector<int>{6, 6}));
+    ASSERT_EQ(background, (std::vector<int>{1, 3, 6}));
+
+    scheduler.update(4, std::chrono::seconds{0});
+
+    ASSERT_EQ(background, (std::vector<int>{10, 3, 6}));
+
+    scheduler.update(5, std::chrono::hours{1});
+
+    ASSERT_EQ(foreground, (std::vector<int>{15, 15}));
+    ASSERT_EQ(background, (std::vector<int>{15, 15, 15}));
+
+    scheduler.update(1);
+
+    ASSERT_EQ(foreground, (std::vector<int>{16, 16}));
+    ASSERT_EQ(background, (std::vector<int>{16, 16, 16}));
+}
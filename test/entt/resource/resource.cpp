@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
+#include <entt/core/thread_pool.hpp>
 #include <entt/resource/cache.hpp>
 
 struct resource { int value; };
@@ -17,6 +24,32 @@ struct broken_loader: entt::resource_loader<broken_loader, resource> {
     }
 };
 
+struct sized_loader: entt::resource_loader<sized_loader, resource> {
+    std::shared_ptr<resource> load(int value) const {
+        return std::shared_ptr<resource>(new resource{ value });
+    }
+
+    std::size_t size(const resource &res) const {
+        return static_cast<std::size_t>(res.value);
+    }
+};
+
+struct batch_loader: entt::resource_loader<batch_loader, resource> {
+    std::shared_ptr<resource> load(entt::id_type, int) const {
+        return nullptr;
+    }
+
+    void load_batch(const entt::id_type *ids, const std::size_t count, std::shared_ptr<resource> *out, int &calls) const {
+        ASSERT_TRUE(std::is_sorted(ids, ids + count));
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            out[pos] = (pos % 2u) ? nullptr : std::make_shared<resource>(resource{ static_cast<int>(ids[pos]) });
+        }
+
+        ++calls;
+    }
+};
+
 TEST(Resource, Functionalities) {
     entt::resource_cache<resource> cache;
 
@@ -136,3 +169,171 @@ TEST(Resource, Each) {
 
     ASSERT_TRUE(cache.empty());
 }
+
+TEST(Resource, LoadAsync) {
+    using namespace entt::literals;
+
+    entt::resource_cache<resource> cache;
+    entt::thread_pool pool{0u};
+    const auto submit = [&pool](auto task) { pool.submit(std::move(task)); };
+
+    auto future = cache.load_async<loader>(submit, "resource"_hs, 42);
+    const auto other = cache.load_async<loader>(submit, "resource"_hs, 0);
+    auto broken = cache.load_async<broken_loader>(submit, "broken"_hs, 0);
+
+    ASSERT_TRUE(future);
+    ASSERT_FALSE(future.ready());
+    ASSERT_FALSE(future.handle());
+    ASSERT_FALSE(cache.contains("resource"_hs));
+    ASSERT_EQ(cache.sync(), 2u);
+
+    pool.wait();
+
+    ASSERT_TRUE(future.ready());
+    ASSERT_TRUE(other.ready());
+    ASSERT_TRUE(broken.ready());
+    ASSERT_EQ(future.handle()->value, 42);
+    ASSERT_EQ(&future.handle().get(), &other.handle().get());
+    ASSERT_FALSE(broken.handle());
+    ASSERT_FALSE(cache.contains("resource"_hs));
+    ASSERT_EQ(cache.sync(), 0u);
+    ASSERT_TRUE(cache.contains("resource"_hs));
+    ASSERT_FALSE(cache.contains("broken"_hs));
+    ASSERT_EQ(cache.handle("resource"_hs)->value, 42);
+
+    future = cache.load_async<loader>(submit, "resource"_hs, 0);
+
+    ASSERT_TRUE(future.ready());
+    ASSERT_EQ(future.handle()->value, 42);
+
+    broken = cache.load_async<loader>(submit, "discarded"_hs, 0);
+    cache.discard("discarded"_hs);
+    pool.wait();
+
+    ASSERT_EQ(cache.sync(), 0u);
+    ASSERT_TRUE(broken.handle());
+    ASSERT_FALSE(cache.contains("discarded"_hs));
+}
+
+TEST(Resource, LoadAsyncMultipleThreads) {
+    entt::resource_cache<resource> cache;
+    entt::thread_pool pool{2u};
+    std::vector<entt::resource_future<resource>> futures;
+
+    for(entt::id_type id{}; id < 100u; ++id) {
+        futures.push_back(cache.load_async<loader>([&pool](auto task) { pool.submit(std::move(task)); }, id % 50u, static_cast<int>(id)));
+    }
+
+    pool.wait();
+
+    ASSERT_EQ(cache.sync(), 0u);
+    ASSERT_EQ(cache.size(), 50u);
+
+    for(entt::id_type id{}; id < 100u; ++id) {
+        ASSERT_TRUE(futures[id].ready());
+        ASSERT_EQ(futures[id].handle()->value, static_cast<int>(id % 50u));
+    }
+}
+
+TEST(Resource, Budget) {
+    using namespace entt::literals;
+
+    entt::resource_cache<resource> cache;
+
+    ASSERT_EQ(cache.budget(), (std::numeric_limits<std::size_t>::max)());
+
+    cache.budget(10u);
+    static_cast<void>(cache.load<sized_loader>("res1"_hs, 4));
+    static_cast<void>(cache.load<sized_loader>("res2"_hs, 4));
+
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.stats().usage, 8u);
+    ASSERT_EQ(cache.stats().misses, 2u);
+
+    static_cast<void>(cache.handle("res1"_hs));
+    static_cast<void>(cache.load<sized_loader>("res1"_hs, 4));
+
+    ASSERT_EQ(cache.stats().hits, 1u);
+
+    // res2 is the least recently used resource
+    {
+        auto handle = cache.load<sized_loader>("res3"_hs, 4);
+
+        ASSERT_EQ(cache.size(), 2u);
+        ASSERT_TRUE(cache.contains("res1"_hs));
+        ASSERT_FALSE(cache.contains("res2"_hs));
+        ASSERT_TRUE(cache.contains("res3"_hs));
+        ASSERT_EQ(cache.stats().evictions, 1u);
+
+        // referenced resources are never discarded
+        cache.budget(0u);
+
+        ASSERT_EQ(cache.size(), 1u);
+        ASSERT_TRUE(cache.contains("res3"_hs));
+        ASSERT_EQ(cache.stats().usage, 4u);
+        ASSERT_EQ(cache.stats().evictions, 2u);
+    }
+
+    cache.trim();
+
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(cache.stats().usage, 0u);
+    ASSERT_EQ(cache.stats().budget, 0u);
+    ASSERT_EQ(cache.stats().evictions, 3u);
+
+    cache.budget(sizeof(resource));
+
+    ASSERT_TRUE(cache.load<loader>("res1"_hs, 42));
+    ASSERT_EQ(cache.stats().usage, sizeof(resource));
+
+    static_cast<void>(cache.load<loader>("res2"_hs, 42));
+
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_TRUE(cache.contains("res2"_hs));
+
+    cache.discard("res2"_hs);
+
+    ASSERT_EQ(cache.stats().usage, 0u);
+}
+
+TEST(Resource, BudgetLoadAsync) {
+    using namespace entt::literals;
+
+    entt::resource_cache<resource> cache;
+    entt::thread_pool pool{0u};
+    const auto submit = [&pool](auto task) { pool.submit(std::move(task)); };
+    cache.budget(4u);
+
+    static_cast<void>(cache.load_async<sized_loader>(submit, "res1"_hs, 4));
+    static_cast<void>(cache.load_async<sized_loader>(submit, "res2"_hs, 4));
+    pool.wait();
+
+    ASSERT_EQ(cache.sync(), 0u);
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_EQ(cache.stats().usage, 4u);
+    ASSERT_EQ(cache.stats().misses, 2u);
+    ASSERT_EQ(cache.stats().evictions, 1u);
+}
+
+TEST(Resource, Preload) {
+    entt::resource_cache<resource> cache;
+    const entt::id_type ids[]{ 3u, 1u, 2u, 1u };
+
+    ASSERT_EQ(cache.preload<loader>(std::begin(ids), std::end(ids)), 3u);
+    ASSERT_EQ(cache.size(), 3u);
+    ASSERT_EQ(cache.handle(2u)->value, 2);
+    ASSERT_EQ(cache.stats().misses, 3u);
+
+    ASSERT_EQ(cache.preload<loader>(std::begin(ids), std::end(ids)), 0u);
+    ASSERT_EQ(cache.stats().hits, 4u);
+
+    entt::resource_cache<resource> other;
+    const entt::id_type more[]{ 7u, 5u, 6u };
+    int calls{};
+
+    ASSERT_EQ(other.preload<batch_loader>(std::begin(more), std::end(more), calls), 2u);
+    ASSERT_EQ(calls, 1);
+    ASSERT_TRUE(other.contains(5u));
+    ASSERT_FALSE(other.contains(6u));
+    ASSERT_TRUE(other.contains(7u));
+}
@@ -0,0 +1,129 @@
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/resource/pool.hpp>
+
+struct resource { int value; };
+
+struct counted {
+    counted(int &ref): counter{&ref} { ++*counter; }
+    ~counted() { --*counter; }
+    int *counter;
+};
+
+TEST(ResourcePool, Functionalities) {
+    entt::resource_pool<resource> pool;
+
+    constexpr auto hs1 = entt::hashed_string{"res1"};
+    constexpr auto hs2 = entt::hashed_string{"res2"};
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.contains(hs1));
+    ASSERT_FALSE(pool.handle(hs1));
+
+    auto handle = pool.load(hs1, 42);
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(handle->value, 42);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_FALSE(pool.empty());
+    ASSERT_TRUE(pool.contains(hs1));
+    ASSERT_FALSE(pool.contains(hs2));
+
+    ASSERT_EQ(pool.load(hs1, 3)->value, 42);
+    ASSERT_EQ(&pool.handle(hs1).get(), &handle.get());
+    ASSERT_EQ(pool.reload(hs1, 3)->value, 3);
+    ASSERT_FALSE(handle);
+
+    handle = pool.load(hs2, 1);
+    const auto other = handle;
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ((*other).value, 1);
+
+    pool.discard(other);
+
+    ASSERT_FALSE(handle);
+    ASSERT_FALSE(pool.contains(hs2));
+    ASSERT_EQ(pool.size(), 1u);
+
+    pool.discard(hs1);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.handle(hs1));
+}
+
+TEST(ResourcePool, Handle) {
+    static_assert(std::is_trivially_copyable_v<entt::resource_ref<resource>>);
+
+    entt::resource_pool<resource> pool;
+    entt::resource_ref<resource> handle{};
+
+    ASSERT_FALSE(handle);
+
+    handle = pool.load(entt::hashed_string{"res"}, 0);
+    resource &ref = handle;
+    ref.value = 42;
+
+    ASSERT_EQ(std::as_const(handle)->value, 42);
+    ASSERT_EQ(pool.handle(entt::hashed_string{"res"})->value, 42);
+
+    pool.discard(entt::hashed_string{"res"});
+    const auto other = pool.load(entt::hashed_string{"other"}, 3);
+
+    // the slot is recycled but old handles stay invalid
+    ASSERT_EQ(&other.get(), &ref);
+    ASSERT_FALSE(handle);
+    ASSERT_TRUE(other);
+}
+
+TEST(ResourcePool, Lifetime) {
+    int counter{};
+
+    {
+        entt::resource_pool<counted> pool;
+
+        for(entt::id_type id{}; id < 100u; ++id) {
+            pool.load(id, counter);
+        }
+
+        ASSERT_EQ(counter, 100);
+
+        pool.discard(0u);
+        pool.discard(1u);
+
+        ASSERT_EQ(counter, 98);
+
+        pool.clear();
+
+        ASSERT_EQ(counter, 0);
+        ASSERT_TRUE(pool.empty());
+
+        pool.load(0u, counter);
+        pool.load(1u, counter);
+    }
+
+    ASSERT_EQ(counter, 0);
+}
+
+TEST(ResourcePool, Each) {
+    entt::resource_pool<resource> pool;
+    pool.load(entt::hashed_string{"res"}, 0);
+
+    pool.each([](entt::resource_ref<resource> res) {
+        ++res->value;
+    });
+
+    pool.each([](const entt::id_type id, entt::resource_ref<resource> res) {
+        ASSERT_EQ(id, entt::hashed_string{"res"});
+        ++res->value;
+    });
+
+    pool.each([&pool](const entt::id_type id) {
+        pool.discard(id);
+    });
+
+    ASSERT_TRUE(pool.empty());
+}
@@ -0,0 +1,97 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/signal/concurrent_dispatcher.hpp>
+
+struct an_event { int value; };
+struct another_event {};
+
+struct receiver {
+    void receive(const an_event &event) { values.push_back(event.value); }
+    void count(const another_event &) { ++cnt; }
+    std::vector<int> values{};
+    int cnt{0};
+};
+
+TEST(ConcurrentDispatcher, Functionalities) {
+    entt::concurrent_dispatcher dispatcher;
+    auto &first = dispatcher.make_producer();
+    auto &second = dispatcher.make_producer();
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    dispatcher.sink<another_event>().connect<&receiver::count>(receiver);
+
+    dispatcher.trigger<an_event>(0);
+
+    ASSERT_EQ(receiver.values, std::vector<int>({0}));
+
+    second.enqueue<an_event>(3);
+    first.enqueue(an_event{1});
+    first.enqueue<an_event>(2);
+    dispatcher.enqueue<an_event>(-1);
+    second.enqueue<another_event>();
+
+    ASSERT_EQ(receiver.values.size(), 1u);
+
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(receiver.values, std::vector<int>({0, -1, 1, 2, 3}));
+    ASSERT_EQ(receiver.cnt, 0);
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 1);
+
+    second.enqueue<an_event>(4);
+    dispatcher.clear<an_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.values.size(), 5u);
+
+    dispatcher.disconnect(receiver);
+    first.enqueue<another_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 1);
+}
+
+TEST(ConcurrentDispatcher, MultipleThreads) {
+    entt::concurrent_dispatcher dispatcher;
+    std::vector<std::thread> threads{};
+    std::atomic<bool> stop{};
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+
+    for(auto count = 0; count < 4; ++count) {
+        threads.emplace_back([&stop, &producer = dispatcher.make_producer(), count]() {
+            for(auto value = 0; value < 10000; ++value) {
+                producer.enqueue<an_event>(count * 10000 + value);
+            }
+
+            while(!stop.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    while(receiver.values.size() != 40000u) {
+        dispatcher.update();
+    }
+
+    stop = true;
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    std::vector<int> last(4u, -1);
+
+    for(auto value: receiver.values) {
+        // events of a producer are delivered in the order in which they are enqueued
+        ASSERT_GT(value, last[value / 10000]);
+        last[value / 10000] = value;
+    }
+}
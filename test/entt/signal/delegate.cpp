@@ -399,3 +399,73 @@ TEST(Delegate, UnboundMemberFunction) {
 
     ASSERT_EQ(delegate(&functor, 3), 6);
 }
+
+TEST(OwningDelegate, Functionalities) {
+    entt::owning_delegate<int(int)> func{};
+
+    ASSERT_FALSE(func);
+
+    int base = 2;
+    func = [base, offset = 1](int value) { return value * base + offset; };
+
+    ASSERT_TRUE(func);
+    ASSERT_EQ(func(3), 7);
+
+    func.emplace([&base](int value) { return base += value; });
+
+    ASSERT_EQ(func(3), 5);
+    ASSERT_EQ(base, 5);
+
+    func.reset();
+
+    ASSERT_FALSE(func);
+
+    func = entt::delegate<int(int)>{entt::connect_arg<&delegate_function>};
+
+    ASSERT_TRUE(func);
+    ASSERT_EQ(func(3), 9);
+}
+
+TEST(OwningDelegate, StatefulClosure) {
+    entt::owning_delegate<int()> func{[counter = 0]() mutable { return ++counter; }};
+
+    ASSERT_EQ(func(), 1);
+    ASSERT_EQ(func(), 2);
+
+    auto other = func;
+
+    ASSERT_EQ(other(), 3);
+    ASSERT_EQ(func(), 3);
+
+    auto moved = std::move(func);
+
+    ASSERT_FALSE(func);
+    ASSERT_EQ(moved(), 4);
+}
+
+TEST(OwningDelegate, Lifetime) {
+    auto value = std::make_shared<int>(42);
+    entt::owning_delegate<int(int)> func{[value](int other) { return *value + other; }};
+
+    ASSERT_EQ(value.use_count(), 2);
+
+    {
+        auto other = func;
+
+        ASSERT_EQ(value.use_count(), 3);
+        ASSERT_EQ(other(1), 43);
+
+        func = std::move(other);
+
+        ASSERT_FALSE(other);
+        ASSERT_EQ(value.use_count(), 2);
+    }
+
+    ASSERT_EQ(value.use_count(), 2);
+    ASSERT_EQ(func(0), 42);
+
+    func = [](int other) { return other; };
+
+    ASSERT_EQ(value.use_count(), 1);
+    ASSERT_EQ(func(3), 3);
+}
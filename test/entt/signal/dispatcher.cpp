@@ -1,5 +1,11 @@
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
 #include <entt/core/type_traits.hpp>
 #include <entt/signal/dispatcher.hpp>
 
@@ -7,6 +13,17 @@ struct an_event {};
 struct another_event {};
 struct one_more_event {};
 
+struct tracker {
+    void receive(const an_event &event) { received.push_back(&event); }
+    std::vector<const an_event *> received{};
+};
+
+struct batch_receiver {
+    void receive(an_event *, const std::size_t count) { cnt += count; ++calls; }
+    std::size_t cnt{};
+    int calls{};
+};
+
 struct receiver {
     static void forward(entt::dispatcher &dispatcher, an_event &event) {
         dispatcher.enqueue(event);
@@ -17,6 +34,34 @@ struct receiver {
     int cnt{0};
 };
 
+template<typename Event, int Value>
+void order_of(std::vector<int> &order, const Event &) {
+    order.push_back(Value);
+}
+
+struct thread_executor {
+    template<typename Task>
+    void operator()(const std::size_t count, Task task) {
+        std::vector<std::thread> workers{};
+        batches.push_back(count);
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(task, pos);
+        }
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::vector<std::size_t> &batches;
+};
+
+template<typename Event>
+void count_of(int &cnt, const Event &) {
+    ++cnt;
+}
+
 TEST(Dispatcher, Functionalities) {
     entt::dispatcher dispatcher;
     receiver receiver;
@@ -82,6 +127,61 @@ TEST(Dispatcher, StopAndGo) {
     ASSERT_EQ(receiver.cnt, 2);
 }
 
+TEST(Dispatcher, DoubleBuffering) {
+    entt::dispatcher dispatcher;
+    tracker tracker;
+
+    dispatcher.reserve<an_event>(2u);
+    dispatcher.sink<an_event>().connect<&tracker::receive>(tracker);
+
+    for(auto frame = 0; frame < 3; ++frame) {
+        dispatcher.enqueue<an_event>();
+        dispatcher.enqueue<an_event>();
+        dispatcher.update<an_event>();
+    }
+
+    ASSERT_EQ(tracker.received.size(), 6u);
+    // buffers are swapped and reused across updates, events are never moved around
+    ASSERT_EQ(tracker.received[0u] + 1u, tracker.received[1u]);
+    ASSERT_NE(tracker.received[0u], tracker.received[2u]);
+    ASSERT_EQ(tracker.received[0u], tracker.received[4u]);
+    ASSERT_EQ(tracker.received[1u], tracker.received[5u]);
+}
+
+TEST(Dispatcher, BatchListener) {
+    entt::dispatcher dispatcher;
+    batch_receiver batch;
+    receiver receiver;
+
+    dispatcher.batch_sink<an_event>().connect<&batch_receiver::receive>(batch);
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+
+    dispatcher.update<an_event>();
+
+    ASSERT_EQ(batch.calls, 0);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(batch.calls, 1);
+    ASSERT_EQ(batch.cnt, 3u);
+    ASSERT_EQ(receiver.cnt, 3);
+
+    dispatcher.trigger<an_event>();
+
+    ASSERT_EQ(batch.calls, 2);
+    ASSERT_EQ(batch.cnt, 4u);
+
+    dispatcher.disconnect(batch);
+    dispatcher.enqueue<an_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(batch.calls, 2);
+    ASSERT_EQ(receiver.cnt, 5);
+}
+
 TEST(Dispatcher, OpaqueDisconnect) {
     entt::dispatcher dispatcher;
     receiver receiver;
@@ -96,3 +196,178 @@ TEST(Dispatcher, OpaqueDisconnect) {
 
     ASSERT_EQ(receiver.cnt, 1);
 }
+
+TEST(Dispatcher, Priority) {
+    entt::dispatcher dispatcher;
+    std::vector<int> order{};
+
+    dispatcher.sink<an_event>().connect<&order_of<an_event, 0>>(order);
+    dispatcher.sink<another_event>().connect<&order_of<another_event, 1>>(order);
+    dispatcher.sink<one_more_event>().connect<&order_of<one_more_event, 2>>(order);
+
+    dispatcher.priority<another_event>(1);
+    dispatcher.priority<an_event>(-1);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<another_event>();
+    dispatcher.enqueue<one_more_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 0}));
+}
+
+struct late_event {};
+
+void enqueue_late(entt::dispatcher &dispatcher, const an_event &) {
+    dispatcher.priority<another_event>(1);
+    dispatcher.enqueue<late_event>();
+}
+
+TEST(Dispatcher, NewEventDuringUpdate) {
+    entt::dispatcher dispatcher;
+    std::vector<int> order{};
+
+    dispatcher.sink<an_event>().connect<&enqueue_late>(dispatcher);
+    dispatcher.sink<an_event>().connect<&order_of<an_event, 0>>(order);
+    dispatcher.sink<another_event>().connect<&order_of<another_event, 1>>(order);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<another_event>();
+    dispatcher.update();
+    dispatcher.sink<late_event>().connect<&order_of<late_event, 2>>(order);
+
+    ASSERT_EQ(order.size(), 2u);
+
+    order.clear();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<another_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 0}));
+}
+
+TEST(Dispatcher, Budget) {
+    entt::dispatcher dispatcher;
+    batch_receiver batch;
+    receiver receiver;
+
+    dispatcher.sink<an_event>().connect<&receiver::forward>(dispatcher);
+    dispatcher.sink<an_event>().connect<&receiver::receive>(receiver);
+    dispatcher.batch_sink<an_event>().connect<&batch_receiver::receive>(batch);
+
+    for(auto pos = 0; pos < 5; ++pos) {
+        dispatcher.enqueue<an_event>();
+    }
+
+    ASSERT_EQ(dispatcher.update(3u), 3u);
+    ASSERT_EQ(receiver.cnt, 3);
+    ASSERT_EQ(batch.calls, 1);
+
+    ASSERT_EQ(dispatcher.update(3u), 2u);
+    ASSERT_EQ(receiver.cnt, 5);
+    ASSERT_EQ(batch.cnt, 5u);
+
+    dispatcher.clear();
+
+    ASSERT_EQ(dispatcher.update(3u), 0u);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(dispatcher.update(1u), 1u);
+
+    dispatcher.clear<an_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 6);
+
+    receiver.reset();
+    dispatcher.sink<an_event>().disconnect<&receiver::forward>(dispatcher);
+    dispatcher.enqueue<an_event>();
+
+    ASSERT_EQ(dispatcher.update(std::chrono::seconds{1}), 1u);
+    ASSERT_EQ(dispatcher.update(std::chrono::seconds{0}), 0u);
+    ASSERT_EQ(receiver.cnt, 1);
+}
+
+struct message_event {
+    entt::arena_string text;
+};
+
+struct message_receiver {
+    void receive(const message_event &event) { last = event.text; }
+    std::string last{};
+};
+
+TEST(Dispatcher, Arena) {
+    entt::dispatcher dispatcher;
+    message_receiver receiver;
+
+    dispatcher.sink<message_event>().connect<&message_receiver::receive>(receiver);
+    const auto text = dispatcher.arena().string("hello");
+    dispatcher.enqueue<message_event>(text);
+    dispatcher.enqueue<message_event>(dispatcher.arena().string("world"));
+
+    auto *arena = &dispatcher.arena();
+    dispatcher.update(1u);
+
+    ASSERT_EQ(receiver.last, "hello");
+    ASSERT_NE(&dispatcher.arena(), arena);
+
+    dispatcher.enqueue<message_event>(dispatcher.arena().string("again"));
+    dispatcher.update(1u);
+
+    ASSERT_EQ(receiver.last, "world");
+    ASSERT_NE(&dispatcher.arena(), arena);
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.last, "again");
+    ASSERT_EQ(&dispatcher.arena(), arena);
+    ASSERT_EQ(dispatcher.arena().string("").data(), text.data());
+}
+
+TEST(Dispatcher, ParUpdate) {
+    entt::dispatcher dispatcher;
+    std::vector<std::size_t> batches{};
+    int counts[3u]{};
+
+    dispatcher.sink<an_event>().connect<&count_of<an_event>>(counts[0u]);
+    dispatcher.sink<another_event>().connect<&count_of<another_event>>(counts[1u]);
+    dispatcher.sink<one_more_event>().connect<&count_of<one_more_event>>(counts[2u]);
+
+    dispatcher.priority<an_event>(2);
+    dispatcher.priority<another_event>(1);
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<another_event>();
+    dispatcher.enqueue<one_more_event>();
+    dispatcher.par_update(thread_executor{batches});
+
+    ASSERT_TRUE(batches.empty());
+    ASSERT_EQ(counts[0u], 2);
+    ASSERT_EQ(counts[1u], 1);
+    ASSERT_EQ(counts[2u], 1);
+
+    dispatcher.resources<an_event, const int>();
+    dispatcher.resources<another_event, const int, char>();
+    dispatcher.resources<one_more_event, int>();
+
+    dispatcher.enqueue<an_event>();
+    dispatcher.enqueue<another_event>();
+    dispatcher.enqueue<one_more_event>();
+    dispatcher.par_update(thread_executor{batches});
+
+    ASSERT_EQ(batches, (std::vector<std::size_t>{2u}));
+    ASSERT_EQ(counts[0u], 3);
+    ASSERT_EQ(counts[1u], 2);
+    ASSERT_EQ(counts[2u], 2);
+
+    dispatcher.resources<one_more_event, const int>();
+    dispatcher.enqueue<one_more_event>();
+    dispatcher.par_update(thread_executor{batches});
+
+    ASSERT_EQ(batches, (std::vector<std::size_t>{2u, 3u}));
+    ASSERT_EQ(counts[2u], 3);
+}
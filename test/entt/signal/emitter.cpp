@@ -1,3 +1,4 @@
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_traits.hpp>
 #include <entt/signal/emitter.hpp>
@@ -128,3 +129,102 @@ TEST(Emitter, OnAndErase) {
     ASSERT_TRUE(emitter.empty());
     ASSERT_TRUE(emitter.empty<bar_event>());
 }
+
+TEST(Emitter, ConnectionsAreStable) {
+    test_emitter emitter;
+    std::vector<test_emitter::connection<foo_event>> conns{};
+    int cnt{};
+
+    for(auto pos = 0; pos < 16; ++pos) {
+        conns.push_back(emitter.on<foo_event>([&cnt](auto &, auto &) { ++cnt; }));
+        emitter.once<foo_event>([&cnt](auto &, auto &em) {
+            // registered while publishing, invoked with the next event only
+            em.template once<foo_event>([&cnt](auto &, auto &) { ++cnt; });
+            ++cnt;
+        });
+    }
+
+    emitter.publish<foo_event>(0, 'c');
+
+    ASSERT_EQ(cnt, 32);
+
+    for(auto pos = 0u; pos < conns.size(); pos += 2u) {
+        emitter.erase(conns[pos]);
+    }
+
+    cnt = 0;
+    emitter.publish<foo_event>(0, 'c');
+
+    ASSERT_EQ(cnt, 24);
+
+    for(auto pos = 1u; pos < conns.size(); pos += 2u) {
+        emitter.erase(conns[pos]);
+    }
+
+    cnt = 0;
+    emitter.publish<foo_event>(0, 'c');
+
+    ASSERT_EQ(cnt, 0);
+    ASSERT_TRUE(emitter.empty());
+}
+
+TEST(Emitter, EraseWhilePublishing) {
+    test_emitter emitter;
+    test_emitter::connection<bar_event> conn{};
+    int cnt{};
+
+    conn = emitter.on<bar_event>([&conn, &cnt](const auto &, auto &em) {
+        em.erase(conn);
+        ++cnt;
+    });
+
+    emitter.on<bar_event>([&cnt](const auto &, auto &em) {
+        em.template publish<quux_event>();
+        ++cnt;
+    });
+
+    emitter.publish<bar_event>();
+    emitter.publish<bar_event>();
+
+    ASSERT_EQ(cnt, 3);
+    ASSERT_FALSE(emitter.empty<bar_event>());
+}
+
+TEST(Emitter, EnqueueAndUpdate) {
+    test_emitter emitter;
+    std::vector<int> values{};
+    int once{};
+
+    emitter.on<foo_event>([&values](auto &event, auto &owner) {
+        values.push_back(event.i);
+
+        if(event.i == 1) {
+            owner.template enqueue<foo_event>(3, 'c');
+        }
+    });
+
+    emitter.once<foo_event>([&once](auto &, auto &) { ++once; });
+    emitter.enqueue<foo_event>(1, 'a');
+    emitter.enqueue<foo_event>(2, 'b');
+    emitter.enqueue<bar_event>();
+
+    ASSERT_TRUE(values.empty());
+
+    emitter.update<bar_event>();
+
+    ASSERT_TRUE(values.empty());
+
+    emitter.update<foo_event>();
+
+    ASSERT_EQ(values, (std::vector<int>{1, 2}));
+    ASSERT_EQ(once, 1);
+
+    emitter.update();
+
+    ASSERT_EQ(values, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(once, 1);
+
+    emitter.update();
+
+    ASSERT_EQ(values.size(), 3u);
+}
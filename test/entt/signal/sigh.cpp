@@ -341,6 +341,49 @@ TEST_F(SigH, ConstNonConstNoExcept) {
     ASSERT_EQ(cfunctor.cnt, 2);
 }
 
+TEST_F(SigH, ManyListeners) {
+    entt::sigh<void()> sigh;
+    entt::sink sink{sigh};
+    const_nonconst_noexcept functor;
+
+    sink.connect<&const_nonconst_noexcept::f>(functor);
+    sink.connect<&const_nonconst_noexcept::g>(functor);
+
+    auto copy = sigh;
+    sink.connect<&const_nonconst_noexcept::h>(functor);
+    sink.before<&const_nonconst_noexcept::g>(functor).connect<&const_nonconst_noexcept::i>(functor);
+
+    ASSERT_EQ(sigh.size(), 4u);
+    ASSERT_EQ(copy.size(), 2u);
+
+    sigh.publish();
+    copy.publish();
+
+    ASSERT_EQ(functor.cnt, 6);
+
+    sink.disconnect<&const_nonconst_noexcept::g>(functor);
+    sink.disconnect<&const_nonconst_noexcept::f>(functor);
+    copy = sigh;
+    sink.disconnect<&const_nonconst_noexcept::i>(functor);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(copy.size(), 2u);
+
+    sigh.publish();
+    copy.publish();
+
+    ASSERT_EQ(functor.cnt, 9);
+
+    sink.disconnect(functor);
+
+    ASSERT_TRUE(sigh.empty());
+
+    sink.connect<&const_nonconst_noexcept::f>(functor);
+    sigh.publish();
+
+    ASSERT_EQ(functor.cnt, 10);
+}
+
 TEST_F(SigH, BeforeFunction) {
     entt::sigh<void(int)> sigh;
     entt::sink sink{sigh};
@@ -417,6 +460,47 @@ TEST_F(SigH, BeforeListenerNotPresent) {
     ASSERT_EQ(functor.value, 2);
 }
 
+TEST_F(SigH, Priority) {
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    before_after functor;
+
+    sink.connect<&before_after::add>(functor);
+    sink.priority(1).connect<&before_after::mul>(functor);
+    sink.priority(-1).connect<&before_after::static_add>();
+    sigh.publish(2);
+
+    ASSERT_EQ(functor.value, 4);
+
+    sink.disconnect<&before_after::mul>(functor);
+    functor.value = 0;
+    sigh.publish(2);
+
+    ASSERT_EQ(functor.value, 4);
+}
+
+TEST_F(SigH, BeforeWithPriority) {
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    before_after functor;
+
+    sink.priority(1).connect<&before_after::add>(functor);
+    sink.priority(-1).connect<&before_after::static_add>();
+    sink.before<&before_after::static_add>().connect<&before_after::mul>(functor);
+    sink.priority(0).connect<&before_after::static_mul>(functor);
+    sigh.publish(2);
+
+    ASSERT_EQ(functor.value, 10);
+    ASSERT_EQ(sigh.size(), 4u);
+
+    sink.disconnect(functor);
+    functor.value = 0;
+    sigh.publish(2);
+
+    ASSERT_EQ(functor.value, 2);
+    ASSERT_EQ(sigh.size(), 1u);
+}
+
 TEST_F(SigH, UnboundDataMember) {
     sigh_listener listener;
     entt::sigh<bool &(sigh_listener &)> sigh;
@@ -4,18 +4,14 @@
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/registry.hpp>
-#include "type_context.h"
 #include "types.h"
 
-template<typename Type>
-struct entt::type_seq<Type> {
-    [[nodiscard]] static id_type value() ENTT_NOEXCEPT {
-        static const entt::id_type value = type_context::instance()->value(entt::type_hash<Type>::value());
-        return value;
-    }
-};
-
 TEST(Lib, Registry) {
+    entt::type_table table{};
+    entt::type_table::bind(&table);
+    table.emplace<position, velocity>();
+    table.freeze();
+
     entt::registry registry;
 
     for(auto i = 0; i < 3; ++i) {
@@ -25,7 +21,7 @@ TEST(Lib, Registry) {
     cr_plugin ctx;
     cr_plugin_load(ctx, PLUGIN);
 
-    ctx.userdata = type_context::instance();
+    ctx.userdata = &table;
     cr_plugin_update(ctx);
 
     ctx.userdata = &registry;
@@ -41,4 +37,5 @@ TEST(Lib, Registry) {
 
     registry = {};
     cr_plugin_close(ctx);
+    entt::type_table::bind(nullptr);
 }
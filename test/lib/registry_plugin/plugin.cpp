@@ -1,26 +1,18 @@
 #include <cr.h>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/registry.hpp>
-#include "type_context.h"
 #include "types.h"
 
 struct ctx {
-    inline static type_context *ref;
-};
-
-template<typename Type>
-struct entt::type_seq<Type> {
-    [[nodiscard]] static id_type value() ENTT_NOEXCEPT {
-        static const entt::id_type value = ctx::ref->value(entt::type_hash<Type>::value());
-        return value;
-    }
+    inline static entt::type_table *ref;
 };
 
 CR_EXPORT int cr_main(cr_plugin *ctx, cr_op operation) {
     switch (operation) {
     case CR_STEP:
         if(!ctx::ref) {
-            ctx::ref = static_cast<type_context *>(ctx->userdata);
+            ctx::ref = static_cast<entt::type_table *>(ctx->userdata);
+            entt::type_table::bind(ctx::ref);
         } else {
             // forces things to break
             auto &registry = *static_cast<entt::registry *>(ctx->userdata);